@@ -348,6 +348,12 @@
 // プロファイラー | Profiler
 # include <Siv3D/Profiler.hpp>
 
+// スコープの実行時間の計測 | Scoped profiler zone
+# include <Siv3D/ProfilerZone.hpp>
+
+// Renderer2D の統計 | Renderer2D statistics
+# include <Siv3D/Renderer2DStat.hpp>
+
 // 処理にかかった時間の測定 | Clock counter in milliseconds
 # include <Siv3D/MillisecClock.hpp>
 
@@ -456,6 +462,12 @@
 // ZIP 圧縮ファイルの書き出し | ZIP writer
 //# include <Siv3D/ZIPWriter.hpp> // [Siv3D ToDo]
 
+// アセットアーカイブの読み込み | Asset archive reader
+# include <Siv3D/AssetArchive.hpp>
+
+// アセットアーカイブの作成 | Asset archive writer
+# include <Siv3D/AssetArchiveWriter.hpp>
+
 //////////////////////////////////////////////////
 //
 //	テキストファイルと設定ファイル | Text Files and Configuration Files
@@ -474,6 +486,9 @@
 // CSV データの読み書き | CSV reader/writer
 # include <Siv3D/CSV.hpp>
 
+// CSV ファイルのストリーミング読み込み | Streaming CSV file reader
+# include <Siv3D/CSVReader.hpp>
+
 // INI データの読み書き | INI reader/writer
 # include <Siv3D/INI.hpp>
 
@@ -564,6 +579,9 @@
 // SIMD 対応 Float4 | SIMD Float4
 # include <Siv3D/SIMD_Float4.hpp>
 
+// SIMD 一括衝突判定 | SIMD batch collision
+# include <Siv3D/SIMDCollision.hpp>
+
 // 数式パーサ | Math parser
 # include <Siv3D/MathParser.hpp>
 
@@ -708,6 +726,9 @@
 // 複数の多角形 | Multi-polygon
 # include <Siv3D/MultiPolygon.hpp>
 
+// 多角形の空間インデックス | Spatial index for polygons
+# include <Siv3D/PolygonIndex.hpp>
+
 // 2 次ベジェ曲線 | Quadratic Bézier curve
 # include <Siv3D/Bezier2.hpp>
 
@@ -1417,6 +1438,9 @@
 
 # include <Siv3D/Asset.hpp>
 
+// アセットの非同期ロード | Asynchronous asset loading
+# include <Siv3D/AssetLoader.hpp>
+
 # include <Siv3D/AudioAssetData.hpp>
 
 # include <Siv3D/AudioAsset.hpp>
@@ -1641,6 +1665,7 @@
 
 # include <Siv3D/TextStyle.hpp>
 # include <Siv3D/DrawableText.hpp>
+# include <Siv3D/TextLayout.hpp>
 # include <Siv3D/Print.hpp>
 # include <Siv3D/PutText.hpp>
 # include <Siv3D/Icon.hpp>
@@ -1772,6 +1797,9 @@
 # include <Siv3D/Physics2D/P2ContactPair.hpp>
 # include <Siv3D/Physics2D/P2Contact.hpp>
 # include <Siv3D/Physics2D/P2Collision.hpp>
+# include <Siv3D/Physics2D/P2QueryFilter.hpp>
+# include <Siv3D/Physics2D/P2RaycastHit.hpp>
+# include <Siv3D/Physics2D/P2StepStat.hpp>
 # include <Siv3D/Physics2D/P2World.hpp>
 # include <Siv3D/Physics2D/P2Body.hpp>
 # include <Siv3D/Physics2D/P2Shape.hpp>
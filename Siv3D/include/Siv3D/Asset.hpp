@@ -48,6 +48,16 @@ namespace s3d
 		[[nodiscard]]
 		bool isFinished() const;
 
+		/// @brief 非同期ロードの優先度を設定します。
+		/// @param priority 優先度。大きいほど先にロードされます。
+		/// @remark 次に loadAsync() を呼んだときのロードに適用されます。
+		void setLoadPriority(int32 priority);
+
+		/// @brief 非同期ロードの優先度を返します。
+		/// @return 非同期ロードの優先度
+		[[nodiscard]]
+		int32 getLoadPriority() const;
+
 	protected:
 
 		[[nodiscard]]
@@ -0,0 +1,153 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Blob.hpp"
+# include "IReader.hpp"
+
+namespace s3d
+{
+	/// @brief AssetArchive のエントリのデータを読み込む Reader | Reader for the data of an entry in an AssetArchive
+	/// @remark 非圧縮のエントリは、アーカイブのメモリマップを直接参照します（コピーしません）。 | Uncompressed entries refer directly to the memory-mapped archive without copying.
+	/// @remark Reader が存在する間は、アーカイブを閉じてもメモリマップは維持されます。 | The memory map stays valid while the reader exists, even if the archive is closed.
+	class AssetArchiveEntryReader : public IReader
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		AssetArchiveEntryReader() = default;
+
+		/// @brief データを参照する Reader を作成します。 | Creates a reader that refers to data.
+		/// @param owner データの寿命を管理するオブジェクト | Object that owns the data
+		/// @param data データの先頭ポインタ | Pointer to the data
+		/// @param size データのサイズ（バイト） | Size of the data in bytes
+		SIV3D_NODISCARD_CXX20
+		AssetArchiveEntryReader(std::shared_ptr<const void> owner, const Byte* data, size_t size) noexcept;
+
+		[[nodiscard]]
+		bool supportsLookahead() const noexcept override;
+
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		[[nodiscard]]
+		int64 size() const override;
+
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		bool setPos(int64 pos) override;
+
+		int64 skip(int64 offset) override;
+
+		int64 read(void* dst, int64 size) override;
+
+		int64 read(void* dst, int64 pos, int64 size) override;
+
+		int64 lookahead(void* dst, int64 size) const override;
+
+		int64 lookahead(void* dst, int64 pos, int64 size) const override;
+
+		/// @brief エントリのデータの先頭ポインタを返します。 | Returns a pointer to the entry data.
+		/// @return エントリのデータの先頭ポインタ | Pointer to the entry data
+		[[nodiscard]]
+		const Byte* data() const noexcept;
+
+	private:
+
+		std::shared_ptr<const void> m_owner;
+
+		const Byte* m_ptr = nullptr;
+
+		int64 m_size = 0;
+
+		int64 m_pos = 0;
+	};
+
+	/// @brief Siv3D 独自形式のアセットアーカイブの読み込み | Reads a Siv3D asset archive
+	/// @remark アーカイブはメモリマップで開かれ、エントリはハッシュでソートされたディレクトリから O(log n) で検索されます。 | The archive is memory-mapped and entries are looked up in O(log n) from a hash-sorted directory.
+	/// @remark エントリの読み込みは複数のスレッドから同時に行えます。 | Entries can be read from multiple threads concurrently.
+	/// @remark アーカイブは AssetArchiveWriter で作成します。 | Archives are created with AssetArchiveWriter.
+	class AssetArchive
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		AssetArchive();
+
+		/// @brief アセットアーカイブを開きます。 | Opens an asset archive.
+		/// @param path アーカイブのパス | Path of the archive
+		SIV3D_NODISCARD_CXX20
+		explicit AssetArchive(FilePathView path);
+
+		~AssetArchive();
+
+		/// @brief アセットアーカイブを開きます。 | Opens an asset archive.
+		/// @param path アーカイブのパス | Path of the archive
+		/// @return アーカイブを開くことに成功した場合 true, それ以外の場合は false | Returns true if the archive was opened successfully, false otherwise
+		bool open(FilePathView path);
+
+		/// @brief アセットアーカイブを閉じます。 | Closes the asset archive.
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief エントリの数を返します。 | Returns the number of entries.
+		/// @return エントリの数 | Number of entries
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief すべてのエントリのパスを返します。 | Returns the paths of all the entries.
+		/// @return エントリのパス | Paths of the entries
+		[[nodiscard]]
+		const Array<FilePath>& enumPaths() const;
+
+		/// @brief 指定したパスのエントリが存在するかを返します。 | Returns whether an entry with the specified path exists.
+		/// @param path エントリのパス | Path of the entry
+		/// @return エントリが存在する場合 true, それ以外の場合は false | Returns true if the entry exists, false otherwise
+		[[nodiscard]]
+		bool contains(FilePathView path) const;
+
+		/// @brief 指定したパスのエントリが圧縮されているかを返します。 | Returns whether the entry with the specified path is compressed.
+		/// @param path エントリのパス | Path of the entry
+		/// @return エントリが圧縮されている場合 true, それ以外の場合は false | Returns true if the entry is compressed, false otherwise
+		[[nodiscard]]
+		bool isCompressed(FilePathView path) const;
+
+		/// @brief 指定したパスのエントリを読み込む Reader を返します。 | Returns a reader for the entry with the specified path.
+		/// @param path エントリのパス | Path of the entry
+		/// @return エントリを読み込む Reader。エントリが存在しない場合は空の Reader | Reader for the entry, or an empty reader if the entry does not exist
+		/// @remark 圧縮されたエントリは展開されます。 | Compressed entries are decompressed.
+		[[nodiscard]]
+		AssetArchiveEntryReader getReader(FilePathView path) const;
+
+		/// @brief 指定したパスのエントリを Blob にコピーします。 | Copies the entry with the specified path to a Blob.
+		/// @param path エントリのパス | Path of the entry
+		/// @return エントリのデータ。エントリが存在しない場合は空の Blob | Entry data, or an empty Blob if the entry does not exist
+		[[nodiscard]]
+		Blob extractToBlob(FilePathView path) const;
+
+	private:
+
+		class AssetArchiveDetail;
+
+		std::shared_ptr<AssetArchiveDetail> pImpl;
+	};
+}
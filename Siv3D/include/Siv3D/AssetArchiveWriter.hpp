@@ -0,0 +1,95 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Blob.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	/// @brief AssetArchive のエントリの圧縮方法 | Compression of an AssetArchive entry
+	enum class AssetArchiveCompression : uint8
+	{
+		/// @brief 既に圧縮されている形式（PNG, JPEG, OGG, MP3 など）以外を zstd で圧縮し、サイズが十分に小さくならない場合は非圧縮で格納します。 | Compresses with zstd unless the data is an already-compressed format (PNG, JPEG, OGG, MP3, ...), and stores it uncompressed if compression does not reduce the size enough.
+		Auto,
+
+		/// @brief 非圧縮で格納します。 | Stores uncompressed.
+		None,
+
+		/// @brief zstd で圧縮します。 | Compresses with zstd.
+		Zstd,
+	};
+
+	/// @brief Siv3D 独自形式のアセットアーカイブの作成 | Creates a Siv3D asset archive
+	/// @remark 作成したアーカイブは AssetArchive で読み込みます。 | Created archives are read with AssetArchive.
+	class AssetArchiveWriter
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		AssetArchiveWriter();
+
+		~AssetArchiveWriter();
+
+		/// @brief データをエントリとして追加します。 | Adds data as an entry.
+		/// @param path アーカイブ内のパス | Path in the archive
+		/// @param data データ | Data
+		/// @param compression 圧縮方法 | Compression
+		/// @return 追加に成功した場合 true, 同じパスのエントリが既にある場合は false | Returns true if the entry was added, false if an entry with the same path already exists
+		bool add(FilePathView path, const Blob& data, AssetArchiveCompression compression = AssetArchiveCompression::Auto);
+
+		/// @brief ファイルをエントリとして追加します。 | Adds a file as an entry.
+		/// @param path アーカイブ内のパス | Path in the archive
+		/// @param sourcePath 追加するファイルのパス | Path of the file to add
+		/// @param compression 圧縮方法 | Compression
+		/// @return 追加に成功した場合 true, それ以外の場合は false | Returns true if the entry was added, false otherwise
+		bool addFile(FilePathView path, FilePathView sourcePath, AssetArchiveCompression compression = AssetArchiveCompression::Auto);
+
+		/// @brief ディレクトリ内のすべてのファイルを、ディレクトリからの相対パスでエントリとして追加します。 | Adds all the files in a directory as entries, using their paths relative to the directory.
+		/// @param directory ディレクトリのパス | Path of the directory
+		/// @param compression 圧縮方法 | Compression
+		/// @return すべてのファイルの追加に成功した場合 true, それ以外の場合は false | Returns true if all the files were added, false otherwise
+		bool addDirectory(FilePathView directory, AssetArchiveCompression compression = AssetArchiveCompression::Auto);
+
+		/// @brief 追加されたエントリの数を返します。 | Returns the number of added entries.
+		/// @return エントリの数 | Number of entries
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief 圧縮レベルを設定します。 | Sets the compression level.
+		/// @param compressionLevel 圧縮レベル | Compression level
+		/// @remark 設定した後に追加したエントリに適用されます。 | Applies to entries added afterwards.
+		void setCompressionLevel(int32 compressionLevel) noexcept;
+
+		/// @brief アーカイブをファイルに保存します。 | Saves the archive to a file.
+		/// @param path 保存するファイルのパス | Path of the file to save
+		/// @return 保存に成功した場合 true, それ以外の場合は false | Returns true if the archive was saved successfully, false otherwise
+		bool save(FilePathView path) const;
+
+		/// @brief ディレクトリ内のすべてのファイルからアーカイブを作成します。 | Creates an archive from all the files in a directory.
+		/// @param directory ディレクトリのパス | Path of the directory
+		/// @param archivePath 保存するアーカイブのパス | Path of the archive to save
+		/// @param compression 圧縮方法 | Compression
+		/// @param compressionLevel 圧縮レベル | Compression level
+		/// @return 作成に成功した場合 true, それ以外の場合は false | Returns true if the archive was created successfully, false otherwise
+		static bool Pack(FilePathView directory, FilePathView archivePath, AssetArchiveCompression compression = AssetArchiveCompression::Auto, int32 compressionLevel = Compression::DefaultLevel);
+
+	private:
+
+		class AssetArchiveWriterDetail;
+
+		std::shared_ptr<AssetArchiveWriterDetail> pImpl;
+	};
+}
@@ -0,0 +1,109 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "Common.hpp"
+# include "AssetInfo.hpp"
+
+namespace s3d
+{
+	/// @brief 同じタグを持つアセットのロードの進捗 | Loading progress of the assets that share a tag
+	struct AssetLoadProgress
+	{
+		/// @brief タグを持つアセットの数 | Number of assets with the tag
+		size_t total = 0;
+
+		/// @brief ロード済みのアセットの数 | Number of loaded assets
+		size_t loaded = 0;
+
+		/// @brief ロードに失敗したアセットの数 | Number of assets that failed to load
+		size_t failed = 0;
+
+		/// @brief 非同期ロード中のアセットの数 | Number of assets being loaded asynchronously
+		size_t loading = 0;
+
+		/// @brief ロードが完了した（失敗を含む）アセットの割合を返します。 | Returns the ratio of assets whose loading has finished (including failures).
+		/// @return ロードが完了したアセットの割合。アセットが無い場合は 1.0 | Ratio of finished assets, or 1.0 if there are no assets
+		[[nodiscard]]
+		double ratio() const noexcept;
+
+		/// @brief すべてのアセットのロードが完了したかを返します。 | Returns whether all the assets have finished loading.
+		/// @return すべてのアセットのロードが完了した場合 true, それ以外の場合は false | Returns true if all the assets have finished loading, false otherwise
+		[[nodiscard]]
+		bool isDone() const noexcept;
+	};
+
+	/// @brief アセットの非同期ロードの統計 | Statistics of asynchronous asset loading
+	struct AssetLoaderStat
+	{
+		/// @brief 同時にロードを実行するワーカースレッドの最大数 | Maximum number of worker threads that load assets concurrently
+		size_t maxWorkers = 0;
+
+		/// @brief 作成されたワーカースレッドの数 | Number of worker threads created
+		size_t workerCount = 0;
+
+		/// @brief 作成されたワーカースレッドの数の最大値 | Peak number of worker threads
+		size_t peakWorkerCount = 0;
+
+		/// @brief 実行待ちのロードの数 | Number of loads waiting to run
+		size_t pendingCount = 0;
+
+		/// @brief 実行中のロードの数 | Number of loads running
+		size_t runningCount = 0;
+
+		/// @brief 完了したロードの数 | Number of completed loads
+		size_t completedCount = 0;
+
+		/// @brief 実行前にキャンセルされたロードの数 | Number of loads cancelled before running
+		size_t cancelledCount = 0;
+
+		/// @brief 直近 1 秒間に完了したロードの数 | Number of loads completed in the last second
+		double loadsPerSecond = 0.0;
+
+		/// @brief 1 回のロードにかかった平均時間（ミリ秒） | Average time of a load (milliseconds)
+		double avgLoadMillisec = 0.0;
+	};
+
+	namespace AssetLoader
+	{
+		/// @brief 非同期ロードを同時に実行するワーカースレッドの最大数を設定します。 | Sets the maximum number of worker threads that run asynchronous loads concurrently.
+		/// @param maxWorkers ワーカースレッドの最大数 | Maximum number of worker threads
+		/// @remark 既定では、論理コア数の半分（1 以上 4 以下）です。 | The default is half the number of logical cores, between 1 and 4.
+		void SetMaxWorkers(size_t maxWorkers);
+
+		/// @brief 非同期ロードを同時に実行するワーカースレッドの最大数を返します。 | Returns the maximum number of worker threads that run asynchronous loads concurrently.
+		/// @return ワーカースレッドの最大数 | Maximum number of worker threads
+		[[nodiscard]]
+		size_t GetMaxWorkers();
+
+		/// @brief 非同期ロードしたテクスチャを、メインスレッドで 1 フレームあたり何枚まで GPU に転送するかを設定します。 | Sets how many asynchronously loaded textures are uploaded to the GPU on the main thread per frame.
+		/// @param count 1 フレームあたりの最大枚数 | Maximum number per frame
+		/// @remark 既定では 4 です。 | The default is 4.
+		void SetUploadBudget(size_t count);
+
+		/// @brief 非同期ロードしたテクスチャを、メインスレッドで 1 フレームあたり何枚まで GPU に転送するかを返します。 | Returns how many asynchronously loaded textures are uploaded to the GPU on the main thread per frame.
+		/// @return 1 フレームあたりの最大枚数 | Maximum number per frame
+		[[nodiscard]]
+		size_t GetUploadBudget();
+
+		/// @brief 指定したタグを持つ、すべての種類のアセットのロードの進捗を返します。 | Returns the loading progress of the assets of all types with the specified tag.
+		/// @param tag タグ | Tag
+		/// @return ロードの進捗 | Loading progress
+		[[nodiscard]]
+		AssetLoadProgress GetProgress(const AssetTag& tag);
+
+		/// @brief 非同期ロードの統計を返します。 | Returns the statistics of asynchronous loading.
+		/// @return 非同期ロードの統計 | Statistics of asynchronous loading
+		[[nodiscard]]
+		AssetLoaderStat GetStat();
+	}
+}
@@ -30,6 +30,9 @@ namespace s3d
 		/// @brief ストリーミング再生を指定するフラグ
 		static constexpr struct FileStreaming {} Stream{};
 
+		/// @brief 圧縮されたままメモリ上に保持し、再生時にデコードすることを指定するフラグ
+		static constexpr struct CompressedInMemory {} Compressed{};
+
 		/// @brief バスの最大数
 		static constexpr size_t MaxBusCount = 4;
 
@@ -195,6 +198,42 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		Audio(FileStreaming, FilePathView path, Arg::loopBegin_<uint64> loopBegin);
 
+		/// @brief オーディオファイルを圧縮されたままメモリ上に保持し、再生時に少しずつデコードするオーディオを作成します。
+		/// @param  
+		/// @param path 
+		/// @remark メモリ使用量はファイルサイズ程度に抑えられますが、再生中のデコードに CPU 時間を使います。
+		/// @remark OggVorbis, Opus のデコード結果の一部はキャッシュされ、繰り返し再生する効果音の再デコードが省かれます。
+		/// @remark WAVE, FLAC, MP3 はキャッシュされずにメモリ上からストリーミング再生されます。対応しない形式の場合、すべてデコードされます。
+		SIV3D_NODISCARD_CXX20
+		Audio(CompressedInMemory, FilePathView path);
+
+		/// @brief オーディオファイルを圧縮されたままメモリ上に保持し、再生時に少しずつデコードするオーディオを作成します。
+		/// @param  
+		/// @param path 
+		/// @param loop 
+		/// @remark メモリ使用量はファイルサイズ程度に抑えられますが、再生中のデコードに CPU 時間を使います。
+		/// @remark OggVorbis, Opus のデコード結果の一部はキャッシュされ、繰り返し再生する効果音の再デコードが省かれます。
+		/// @remark WAVE, FLAC, MP3 はキャッシュされずにメモリ上からストリーミング再生されます。対応しない形式の場合、すべてデコードされます。
+		SIV3D_NODISCARD_CXX20
+		Audio(CompressedInMemory, FilePathView path, Loop loop);
+
+		/// @brief オーディオファイルを圧縮されたままメモリ上に保持し、再生時に少しずつデコードするオーディオを作成します。
+		/// @param  
+		/// @param path 
+		/// @param loopBegin 
+		/// @remark メモリ使用量はファイルサイズ程度に抑えられますが、再生中のデコードに CPU 時間を使います。
+		/// @remark OggVorbis, Opus のデコード結果の一部はキャッシュされ、繰り返し再生する効果音の再デコードが省かれます。
+		/// @remark WAVE, FLAC, MP3 はキャッシュされずにメモリ上からストリーミング再生されます。対応しない形式の場合、すべてデコードされます。
+		SIV3D_NODISCARD_CXX20
+		Audio(CompressedInMemory, FilePathView path, Arg::loopBegin_<uint64> loopBegin);
+
+		/// @brief IReader から読み込んだデータを圧縮されたままメモリ上に保持し、再生時に少しずつデコードするオーディオを作成します。
+		/// @param  
+		/// @param reader 
+		/// @remark メモリ使用量はデータサイズ程度に抑えられますが、再生中のデコードに CPU 時間を使います。
+		SIV3D_NODISCARD_CXX20
+		Audio(CompressedInMemory, IReader&& reader);
+
 		/// @brief 楽器の音のオーディオを作成します。
 		/// @param instrument 楽器
 		/// @param key 音階
@@ -0,0 +1,249 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <string>
+# include <string_view>
+# include <functional>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Optional.hpp"
+# include "Parse.hpp"
+# include "MemoryMappedFileView.hpp"
+
+namespace s3d
+{
+	/// @brief CSVReader が読み取った 1 つの値への参照 | View of a single field read by CSVReader
+	/// @remark ファイル上の UTF-8 のバイト列を参照し、値が必要になるまで変換を行いません。 | Refers to the UTF-8 bytes in the file and does not convert them until the value is needed.
+	class CSVField
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		CSVField() = default;
+
+		SIV3D_NODISCARD_CXX20
+		CSVField(std::string_view raw, char quote, char escape, bool hasEscape, bool plain) noexcept;
+
+		/// @brief ファイル上の UTF-8 のバイト列を返します。クオートやエスケープ記号も含まれます。 | Returns the UTF-8 bytes in the file, including quotes and escape characters.
+		/// @return ファイル上のバイト列 | Bytes in the file
+		[[nodiscard]]
+		std::string_view raw() const noexcept;
+
+		/// @brief クオートやエスケープ記号を含まず、raw() がそのまま値であるかを返します。 | Returns whether the field contains no quotes or escape characters, so that raw() is the value itself.
+		/// @return raw() がそのまま値である場合 true, それ以外の場合は false | Returns true if raw() is the value itself, false otherwise
+		[[nodiscard]]
+		bool isPlain() const noexcept;
+
+		/// @brief 値が空であるかを返します。 | Returns whether the value is empty.
+		/// @return 値が空である場合 true, それ以外の場合は false | Returns true if the value is empty, false otherwise
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief クオートとエスケープを処理した値を UTF-8 で返します。 | Returns the value with quotes and escapes processed, in UTF-8.
+		/// @return UTF-8 の値 | Value in UTF-8
+		[[nodiscard]]
+		std::string toUTF8() const;
+
+		/// @brief クオートとエスケープを処理した値を返します。 | Returns the value with quotes and escapes processed.
+		/// @return 値 | Value
+		[[nodiscard]]
+		String toString() const;
+
+		/// @brief 値を指定した型に変換して返します。失敗した場合は Type() を返します。 | Returns the value converted to the specified type. Returns Type() on failure.
+		/// @tparam Type 変換後の型 | Type to convert to
+		/// @return 変換した値 | Converted value
+		template <class Type = String>
+		[[nodiscard]]
+		Type get() const;
+
+		/// @brief 値を指定した型に変換して返します。失敗した場合は none を返します。 | Returns the value converted to the specified type. Returns none on failure.
+		/// @tparam Type 変換後の型 | Type to convert to
+		/// @return 変換した値。失敗した場合は none | Converted value, or none on failure
+		template <class Type>
+		[[nodiscard]]
+		Optional<Type> getOpt() const;
+
+	private:
+
+		std::string_view m_raw;
+
+		char m_quote = '\"';
+
+		char m_escape = '\\';
+
+		bool m_hasEscape = true;
+
+		bool m_plain = true;
+	};
+
+	/// @brief CSVReader が読み取った 1 行への参照 | View of a single row read by CSVReader
+	/// @remark 参照先の CSVReader が開いている間だけ有効です。 | Valid only while the CSVReader it refers to is open.
+	class CSVRowView
+	{
+	public:
+
+		using iterator = Array<CSVField>::const_iterator;
+
+		/// @brief 行の値の個数を返します。 | Returns the number of fields in the row.
+		/// @return 値の個数 | Number of fields
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief 行に値が無いかを返します。 | Returns whether the row has no fields.
+		/// @return 値が無い場合 true, それ以外の場合は false | Returns true if the row has no fields, false otherwise
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		[[nodiscard]]
+		const CSVField& operator [](size_t index) const noexcept;
+
+		[[nodiscard]]
+		iterator begin() const noexcept;
+
+		[[nodiscard]]
+		iterator end() const noexcept;
+
+		/// @brief 行の先頭の、ファイル内でのオフセット（バイト）を返します。 | Returns the offset in bytes of the beginning of the row in the file.
+		/// @return 行の先頭のオフセット | Offset of the beginning of the row
+		[[nodiscard]]
+		size_t offset() const noexcept;
+
+		/// @brief 行のすべての値を変換して返します。 | Returns all fields of the row converted to strings.
+		/// @return 行の値 | Fields of the row
+		[[nodiscard]]
+		Array<String> toArray() const;
+
+	private:
+
+		friend class CSVChunk;
+
+		Array<CSVField> m_fields;
+
+		size_t m_offset = 0;
+	};
+
+	/// @brief CSV ファイルの、行の境界で区切られた一部分 | Part of a CSV file, split at row boundaries
+	/// @remark 異なる CSVChunk は、異なるスレッドから同時に読み進めることができます。 | Different CSVChunk objects can be read from different threads at the same time.
+	class CSVChunk
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		CSVChunk() = default;
+
+		SIV3D_NODISCARD_CXX20
+		CSVChunk(const char* fileBegin, const char* begin, const char* end, char separator, char quote, char escape) noexcept;
+
+		/// @brief 次の行を読み取ります。 | Reads the next row.
+		/// @param row 読み取った行の格納先 | Row to store the result
+		/// @return 行を読み取った場合 true, 終端に達していた場合は false | Returns true if a row was read, false if the end has been reached
+		bool readRow(CSVRowView& row);
+
+		/// @brief 読み取り位置をチャンクの先頭に戻します。 | Moves the read position back to the beginning of the chunk.
+		void rewind() noexcept;
+
+		/// @brief チャンクの先頭の、ファイル内でのオフセット（バイト）を返します。 | Returns the offset in bytes of the beginning of the chunk in the file.
+		[[nodiscard]]
+		size_t offset() const noexcept;
+
+		/// @brief チャンクの大きさ（バイト）を返します。 | Returns the size of the chunk in bytes.
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+	private:
+
+		const char* m_fileBegin = nullptr;
+
+		const char* m_begin = nullptr;
+
+		const char* m_end = nullptr;
+
+		const char* m_pos = nullptr;
+
+		char m_separator = ',';
+
+		char m_quote = '\"';
+
+		char m_escape = '\\';
+	};
+
+	/// @brief UTF-8 の CSV ファイルを、メモリマップを使って 1 行ずつ読み取るクラス | Reads a UTF-8 CSV file row by row through a memory map.
+	/// @remark ファイル全体を String に変換して保持する CSV と異なり、読み取った行の値はファイル上のバイト列を参照します。 | Unlike CSV, which converts the whole file to String, the fields of a row refer to the bytes in the file.
+	/// @remark CSV と同じく、1 行が 1 つのレコードです。区切り文字、クオート、エスケープ記号は ASCII 文字のみ使えます。 | As with CSV, each line is one record. Separator, quote and escape must be ASCII characters.
+	class CSVReader
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		CSVReader() = default;
+
+		SIV3D_NODISCARD_CXX20
+		explicit CSVReader(FilePathView path, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		/// @brief CSV ファイルを開きます。 | Opens a CSV file.
+		/// @param path ファイルパス | File path
+		/// @param separator 値の区切り文字 | Separator between fields
+		/// @param quote クオーテーション記号 | Quote character
+		/// @param escape エスケープ記号 | Escape character
+		/// @return ファイルを開けた場合 true, それ以外の場合は false | Returns true if the file was opened, false otherwise
+		bool open(FilePathView path, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief ファイルの大きさ（バイト）を返します。 | Returns the size of the file in bytes.
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief 次の行を読み取ります。 | Reads the next row.
+		/// @param row 読み取った行の格納先 | Row to store the result
+		/// @return 行を読み取った場合 true, 終端に達していた場合は false | Returns true if a row was read, false if the end has been reached
+		bool readRow(CSVRowView& row);
+
+		/// @brief 読み取り位置をファイルの先頭に戻します。 | Moves the read position back to the beginning of the file.
+		void rewind() noexcept;
+
+		/// @brief ファイルを行の境界で分割します。 | Splits the file at row boundaries.
+		/// @param count 分割数の上限 | Maximum number of chunks
+		/// @return 分割したチャンク | Chunks
+		[[nodiscard]]
+		Array<CSVChunk> split(size_t count) const;
+
+		/// @brief ファイルを行の境界で分割し、エンジンのスレッドプールで並列に読み取ります。 | Splits the file at row boundaries and reads the chunks in parallel on the engine thread pool.
+		/// @param f 各行に対して呼ばれる関数。複数のスレッドから同時に呼ばれます。 | Function called for each row. It is called from multiple threads at the same time.
+		/// @param chunkCount 分割数の上限。0 の場合は自動で決定されます。 | Maximum number of chunks. If 0, it is determined automatically.
+		/// @remark f の 2 番目の引数は chunkCount 未満のチャンクのインデックスです。チャンクごとに結果を集計すると、スレッド間の同期を避けられます。 | The second argument of f is the index of the chunk, less than chunkCount. Aggregating per chunk avoids synchronization between threads.
+		/// @return 分割数 | Number of chunks
+		size_t parallelForEachRow(const std::function<void(const CSVRowView&, size_t)>& f, size_t chunkCount = 0) const;
+
+	private:
+
+		MemoryMappedFileView m_file;
+
+		CSVChunk m_all;
+
+		char m_separator = ',';
+
+		char m_quote = '\"';
+
+		char m_escape = '\\';
+	};
+}
+
+# include "detail/CSVReader.ipp"
@@ -405,6 +405,32 @@ namespace s3d
 		/// @return 事前生成に成功した場合 true, それ以外の場合は false
 		bool preload(StringView chars) const;
 
+		/// @brief 指定した文字列のためのグリフを、フォールバックフォントのものも含めて事前生成します。
+		/// @param chars 文字列
+		/// @remark SDF / MSDF 方式のフォントでは、グリフの画像を複数のスレッドで並列に生成します。すべてのグリフがキャッシュされるまで戻りません。
+		/// @return 事前生成に成功した場合 true, それ以外の場合は false
+		bool prewarm(StringView chars) const;
+
+		/// @brief 指定した範囲の文字のためのグリフを、フォールバックフォントのものも含めて事前生成します。
+		/// @param first 範囲の最初の文字
+		/// @param last 範囲の最後の文字（この文字も含む）
+		/// @remark サロゲートの範囲の値は無視されます。
+		/// @return 事前生成に成功した場合 true, それ以外の場合は false
+		bool prewarm(char32 first, char32 last) const;
+
+		/// @brief キャッシュされているグリフのテクスチャと情報を、ファイルに保存します。
+		/// @param path 保存するファイルのパス
+		/// @remark SDF / MSDF 方式のフォントでのみ利用できます。
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool saveGlyphCache(FilePathView path) const;
+
+		/// @brief saveGlyphCache() で保存したファイルから、グリフのキャッシュを復元します。
+		/// @param path 読み込むファイルのパス
+		/// @remark フォントファイルの内容、フェイスインデックス、サイズ、方式、スタイル、バッファの幅のいずれかが保存時と異なる場合は失敗します。
+		/// @remark 復元に成功すると、それまでのキャッシュは置き換えられます。
+		/// @return 復元に成功した場合 true, それ以外の場合は false
+		bool loadGlyphCache(FilePathView path) const;
+
 		/// @brief フォントの内部でキャッシュされているテクスチャを返します。
 		/// @return フォントの内部でキャッシュされているテクスチャ
 		[[nodiscard]]
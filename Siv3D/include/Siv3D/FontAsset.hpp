@@ -58,7 +58,16 @@ namespace s3d
 
 		static bool Load(AssetNameView name, StringView preloadText = U"");
 
-		static void LoadAsync(AssetNameView name, StringView preloadText = U"");
+		/// @brief 指定したフォントアセットの非同期ロードを開始します。
+		/// @param name フォントアセット名
+		/// @param preloadText 事前にレンダリングしておく文字
+		/// @param priority 優先度。大きいほど先にロードされます。
+		static void LoadAsync(AssetNameView name, StringView preloadText = U"", int32 priority = 0);
+
+		/// @brief 指定したフォントアセットの、まだ開始していない非同期ロードをキャンセルします。
+		/// @param name フォントアセット名
+		/// @return キャンセルした場合 true, それ以外の場合は false
+		static bool CancelLoadAsync(AssetNameView name);
 
 		/// @brief 指定したフォントアセットのロードが完了するまで待機します。
 		/// @param name フォントアセット名
@@ -32,6 +32,16 @@ namespace s3d
 		/// @brief 一時停止しているすべてのアクティブな Audio を再開します。
 		void ResumeAll();
 
+		/// @brief Audio::Compressed で作成したオーディオのデコード済みブロックのキャッシュ容量を返します。
+		/// @return キャッシュ容量（バイト）
+		[[nodiscard]]
+		size_t GetCompressedCacheCapacity();
+
+		/// @brief Audio::Compressed で作成したオーディオのデコード済みブロックのキャッシュ容量を設定します。
+		/// @param bytes キャッシュ容量（バイト）。0 の場合はキャッシュを無効にします。
+		/// @remark キャッシュはすべての Audio::Compressed オーディオで共有されます。デフォルトは 4 MiB です。
+		void SetCompressedCacheCapacity(size_t bytes);
+
 		/// @brief 最終出力の音量の設定を返します。
 		/// @return 最終出力の音量の設定 [0.0, 1.0]
 		[[nodiscard]]
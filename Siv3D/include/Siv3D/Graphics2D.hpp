@@ -12,6 +12,10 @@
 # pragma once
 # include "Common.hpp"
 # include "Optional.hpp"
+# include "Array.hpp"
+# include "2DShapesFwd.hpp"
+# include "ColorHSV.hpp"
+# include "Palette.hpp"
 # include "BlendState.hpp"
 # include "RasterizerState.hpp"
 # include "SamplerState.hpp"
@@ -126,6 +130,44 @@ namespace s3d
 		/// @param count 描画する三角形の個数
 		void DrawTriangles(uint32 count);
 
+		/// @brief 複数の円をまとめて描画します。
+		/// @param circles 円の配列
+		/// @param color 色
+		/// @remark 円ごとに `Circle::draw()` を呼ぶよりも高速に描画できます。
+		void DrawCircles(const Array<Circle>& circles, const ColorF& color = Palette::White);
+
+		/// @brief 複数の円をまとめて描画します。
+		/// @param circles 円の配列
+		/// @param colors 円ごとの色の配列
+		/// @remark circles と colors の要素数が異なる場合、少ないほうの要素数だけ描画します。
+		void DrawCircles(const Array<Circle>& circles, const Array<ColorF>& colors);
+
+		/// @brief 複数の長方形をまとめて描画します。
+		/// @param rects 長方形の配列
+		/// @param color 色
+		/// @remark 長方形ごとに `RectF::draw()` を呼ぶよりも高速に描画できます。
+		void DrawRects(const Array<RectF>& rects, const ColorF& color = Palette::White);
+
+		/// @brief 複数の長方形をまとめて描画します。
+		/// @param rects 長方形の配列
+		/// @param colors 長方形ごとの色の配列
+		/// @remark rects と colors の要素数が異なる場合、少ないほうの要素数だけ描画します。
+		void DrawRects(const Array<RectF>& rects, const Array<ColorF>& colors);
+
+		/// @brief テクスチャ全体を貼り付けた複数の四角形をまとめて描画します。
+		/// @param texture テクスチャ
+		/// @param quads 四角形の配列
+		/// @param diffuse 乗算する色
+		void DrawTexturedQuads(const Texture& texture, const Array<Quad>& quads, const ColorF& diffuse = Palette::White);
+
+		/// @brief テクスチャの一部を貼り付けた複数の四角形をまとめて描画します。
+		/// @param texture テクスチャ
+		/// @param quads 四角形の配列
+		/// @param uvRects 四角形ごとの UV 座標の配列
+		/// @param diffuse 乗算する色
+		/// @remark quads と uvRects の要素数が異なる場合、少ないほうの要素数だけ描画します。
+		void DrawTexturedQuads(const Texture& texture, const Array<Quad>& quads, const Array<RectF>& uvRects, const ColorF& diffuse = Palette::White);
+
 		/// @brief SDF 描画用のパラメータを設定します。
 		/// @param textStyle テキストスタイル
 		void SetSDFParameters(const TextStyle& textStyle);
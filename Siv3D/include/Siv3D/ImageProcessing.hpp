@@ -60,6 +60,16 @@ namespace s3d
 		void Inpaint(const Image& image, const Image& maskImage, const Color& maskColor, Image& result, int32 radius = 2);
 
 		void Inpaint(const Image& image, const Grid<uint8>& maskImage, Image& result, int32 radius = 2);
+
+		/// @brief Image の画素単位の処理（negate, grayscale, mirror, rotate90 など）を、エンジンのスレッドプールで並列に実行するかを設定します。
+		/// @param enabled 並列に実行する場合 true, それ以外の場合は false（デフォルトは false）
+		/// @remark 小さな画像は設定にかかわらず呼び出し元のスレッドで処理されます。
+		void SetParallelEnabled(bool enabled) noexcept;
+
+		/// @brief Image の画素単位の処理を、エンジンのスレッドプールで並列に実行するかを返します。
+		/// @return 並列に実行する場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool IsParallelEnabled() noexcept;
 	}
 }
 
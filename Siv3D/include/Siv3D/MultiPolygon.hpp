@@ -16,6 +16,8 @@
 
 namespace s3d
 {
+	class PolygonIndex;
+
 	/// @brief Polygon の集合
 	class MultiPolygon
 	{
@@ -443,6 +445,12 @@ namespace s3d
 		[[nodiscard]]
 		bool contains(const Shape2DType& other) const;
 
+		/// @brief 多角形の集合に対する空間クエリを高速に行うための空間インデックスを構築します。
+		/// @remark 多数の多角形に対して繰り返しクエリを行う場合に使います。構築後にこの MultiPolygon を変更しても、インデックスには反映されません。
+		/// @return 空間インデックス
+		[[nodiscard]]
+		PolygonIndex buildIndex() const;
+
 		[[nodiscard]]
 		bool leftClicked() const noexcept;
 
@@ -14,6 +14,7 @@
 # include "NavMeshConfig.hpp"
 # include "TriangleIndex.hpp"
 # include "Polygon.hpp"
+# include "AsyncTask.hpp"
 
 namespace s3d
 {
@@ -156,6 +157,58 @@ namespace s3d
 		/// @param areaCosts エリアのコスト
 		void query(const Vec3& start, const Vec3& end, Array<Vec3>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
 
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をまとめて計算します。
+		/// @param starts 出発地点の座標の配列
+		/// @param ends 目的地の座標の配列
+		/// @param areaCosts エリアのコスト
+		/// @return `starts[i]` から `ends[i]` への経路の配列。要素数は `starts` と `ends` の少ない方
+		[[nodiscard]]
+		Array<Array<Vec2>> queryMany(const Array<Vec2>& starts, const Array<Vec2>& ends, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をまとめて計算します。
+		/// @param starts 出発地点の座標の配列
+		/// @param ends 目的地の座標の配列
+		/// @param paths 経路の格納先
+		/// @param areaCosts エリアのコスト
+		/// @remark 複数のスレッドで計算します。`paths` の各要素のメモリは再利用されます。
+		void queryMany(const Array<Vec2>& starts, const Array<Vec2>& ends, Array<Array<Vec2>>& paths, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をまとめて計算します。
+		/// @param starts 出発地点の座標の配列
+		/// @param ends 目的地の座標の配列
+		/// @param areaCosts エリアのコスト
+		/// @return `starts[i]` から `ends[i]` への経路の配列。要素数は `starts` と `ends` の少ない方
+		[[nodiscard]]
+		Array<Array<Vec3>> queryMany(const Array<Vec3>& starts, const Array<Vec3>& ends, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をまとめて計算します。
+		/// @param starts 出発地点の座標の配列
+		/// @param ends 目的地の座標の配列
+		/// @param paths 経路の格納先
+		/// @param areaCosts エリアのコスト
+		/// @remark 複数のスレッドで計算します。`paths` の各要素のメモリは再利用されます。
+		void queryMany(const Array<Vec3>& starts, const Array<Vec3>& ends, Array<Array<Vec3>>& paths, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路を非同期に計算します。
+		/// @param starts 出発地点の座標の配列
+		/// @param ends 目的地の座標の配列
+		/// @param areaCosts エリアのコスト
+		/// @param paths 経路の格納先として再利用する配列。前回の結果を渡すとメモリの確保を減らせます。
+		/// @return 経路の配列を返す非同期タスク
+		/// @remark タスクの完了前に、このナビメッシュを再構築してはいけません。
+		[[nodiscard]]
+		AsyncTask<Array<Array<Vec2>>> queryManyAsync(Array<Vec2> starts, Array<Vec2> ends, Array<std::pair<int32, double>> areaCosts = {}, Array<Array<Vec2>> paths = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路を非同期に計算します。
+		/// @param starts 出発地点の座標の配列
+		/// @param ends 目的地の座標の配列
+		/// @param areaCosts エリアのコスト
+		/// @param paths 経路の格納先として再利用する配列。前回の結果を渡すとメモリの確保を減らせます。
+		/// @return 経路の配列を返す非同期タスク
+		/// @remark タスクの完了前に、このナビメッシュを再構築してはいけません。
+		[[nodiscard]]
+		AsyncTask<Array<Array<Vec3>>> queryManyAsync(Array<Vec3> starts, Array<Vec3> ends, Array<std::pair<int32, double>> areaCosts = {}, Array<Array<Vec3>> paths = {}) const;
+
 	private:
 
 		class NavMeshDetail;
@@ -11,6 +11,7 @@
 
 # pragma once
 # include "Common.hpp"
+# include "Array.hpp"
 # include "PointVector.hpp"
 # include "IEmitter2D.hpp"
 # include "ParticleSystem2DParameters.hpp"
@@ -64,6 +65,13 @@ namespace s3d
 
 		void drawDebug() const;
 
+		/// @brief 複数のパーティクルシステムを、エンジンのスレッドプールで並列に更新します。
+		/// @param systems 更新するパーティクルシステムの一覧
+		/// @param deltaTime 前回の更新からの経過時間（秒）
+		/// @remark 同じパーティクルシステム（コピーを含む）を一覧に複数含めることはできません。
+		/// @remark エミッタと `ParticleSystem2DParameters` の関数は、複数のスレッドから同時に呼ばれます。
+		static void UpdateMany(Array<ParticleSystem2D>& systems, double deltaTime = Scene::DeltaTime());
+
 	private:
 
 		class ParticleSystem2DDetail;
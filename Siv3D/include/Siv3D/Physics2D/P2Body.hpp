@@ -305,6 +305,23 @@ namespace s3d
 		[[nodiscard]]
 		std::pair<Vec2, double> getTransform() const noexcept;
 
+		/// @brief 描画用に、直前のステップの開始時点と現在の物体のワールド座標 (cm) を補間した値を返します。
+		/// @remark 補間係数には `P2World::getInterpolationAlpha()` が使われます。`P2World::updateFixed()` と組み合わせて使います。
+		/// @return 補間した物体のワールド座標 (cm)
+		[[nodiscard]]
+		Vec2 getInterpolatedPos() const noexcept;
+
+		/// @brief 描画用に、直前のステップの開始時点と現在の物体の回転角度（ラジアン）を補間した値を返します。
+		/// @remark 補間係数には `P2World::getInterpolationAlpha()` が使われます。`P2World::updateFixed()` と組み合わせて使います。
+		/// @return 補間した物体の回転角度（ラジアン）
+		[[nodiscard]]
+		double getInterpolatedAngle() const noexcept;
+
+		/// @brief 描画用に、直前のステップの開始時点と現在の物体の姿勢を補間した値を返します。
+		/// @return 補間した物体のワールド座標 (cm) と回転角度（ラジアン）
+		[[nodiscard]]
+		std::pair<Vec2, double> getInterpolatedTransform() const noexcept;
+
 		/// @brief 
 		/// @param v 
 		/// @return 
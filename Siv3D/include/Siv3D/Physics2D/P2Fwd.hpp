@@ -27,6 +27,9 @@ namespace s3d
 
 	struct P2Material;
 	struct P2Filter;
+	struct P2QueryFilter;
+	struct P2RaycastHit;
+	struct P2StepStat;
 	enum class P2BodyType : uint8;
 	enum class P2ShapeType : uint8;
 	struct P2ContactPair;
@@ -0,0 +1,32 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "P2Fwd.hpp"
+
+namespace s3d
+{
+	/// @brief P2World の空間クエリで対象とする部品のフィルタ
+	struct P2QueryFilter
+	{
+		/// @brief 対象とするカテゴリーを表すビットフラグです。
+		/// @remark 部品の `P2Filter::categoryBits` とのビット AND が 0 でない部品が対象になります。
+		uint16 maskBits = 0b1111'1111'1111'1111;
+
+		/// @brief センサー部品を対象にするか
+		bool includeSensors = false;
+
+		/// @brief 対象から除外する物体の ID
+		/// @remark 0 の場合はどの物体も除外しません。レイを発射する物体自身を除外する場合などに使います。
+		P2BodyID ignoreBodyID = 0;
+	};
+}
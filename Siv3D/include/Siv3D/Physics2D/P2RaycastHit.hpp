@@ -0,0 +1,34 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "../PointVector.hpp"
+# include "P2Fwd.hpp"
+
+namespace s3d
+{
+	/// @brief レイキャストで見つかった物体の情報
+	struct P2RaycastHit
+	{
+		/// @brief レイと交差した物体の ID
+		P2BodyID id = 0;
+
+		/// @brief レイと交差した点の座標 (cm)
+		Vec2 pos = { 0.0, 0.0 };
+
+		/// @brief 交差した点における部品の法線ベクトル
+		Vec2 normal = { 0.0, 0.0 };
+
+		/// @brief レイの始点から交差した点までの距離 (cm)
+		double distance = 0.0;
+	};
+}
@@ -0,0 +1,48 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "P2Fwd.hpp"
+
+namespace s3d
+{
+	/// @brief P2World の直近の更新で行われたステップの統計
+	/// @remark 時間の計測値は、直近の `P2World::update()` または `P2World::updateFixed()` の呼び出しで実行されたすべてのステップの合計です。
+	struct P2StepStat
+	{
+		/// @brief 実行されたステップの回数
+		uint32 steps = 0;
+
+		/// @brief サブステップ数の上限に達したために切り捨てられた時間（秒）
+		double droppedTime = 0.0;
+
+		/// @brief ステップ全体にかかった時間（ミリ秒）
+		double stepMillisec = 0.0;
+
+		/// @brief ブロードフェーズ（新しい接触の検出）にかかった時間（ミリ秒）
+		/// @remark `solveMillisec` に含まれます。
+		double broadphaseMillisec = 0.0;
+
+		/// @brief 接触している部品の形状の衝突判定にかかった時間（ミリ秒）
+		double collideMillisec = 0.0;
+
+		/// @brief 接触とジョイントの拘束の解決にかかった時間（ミリ秒）
+		double solveMillisec = 0.0;
+
+		/// @brief 連続的衝突判定 (TOI) の解決にかかった時間（ミリ秒）
+		double solveTOIMillisec = 0.0;
+
+		/// @brief 接触のコールバックで `P2World::getCollisions()` の一覧を更新するのにかかった時間（ミリ秒）
+		/// @remark `collideMillisec`, `solveMillisec`, `solveTOIMillisec` に含まれます。
+		double contactListenerMillisec = 0.0;
+	};
+}
@@ -13,12 +13,17 @@
 # include <memory>
 # include "../Common.hpp"
 # include "../PointVector.hpp"
+# include "../Array.hpp"
+# include "../Optional.hpp"
 # include "../HashTable.hpp"
 # include "../Scene.hpp"
 # include "P2Fwd.hpp"
 # include "P2BodyType.hpp"
 # include "P2Material.hpp"
 # include "P2Filter.hpp"
+# include "P2QueryFilter.hpp"
+# include "P2RaycastHit.hpp"
+# include "P2StepStat.hpp"
 # include "P2Body.hpp"
 # include "P2PivotJoint.hpp"
 # include "P2DistanceJoint.hpp"
@@ -49,6 +54,40 @@ namespace s3d
 		/// @param positionIterations 物体の衝突時の位置の補正の回数
 		void update(double timeStep = Scene::DeltaTime(), int32 velocityIterations = 6, int32 positionIterations = 2) const;
 
+		/// @brief 経過時間を蓄積し、固定のタイムステップで 2D 物理演算のワールドの状態を更新します。
+		/// @remark 蓄積された時間が `fixedTimeStep` 以上である間、`fixedTimeStep` ごとにステップを実行します。実行されなかった端数は次回の呼び出しに持ち越されます。
+		/// @remark 1 回の呼び出しで `maxSubSteps` を超える数のステップが必要な場合、超過分の時間は切り捨てられます（`P2StepStat::droppedTime`）。これにより、フレームの遅延時に追いつくための計算が際限なく増えることを防ぎます。
+		/// @remark 各ステップの結果は `deltaTime` の値に依存しないため、同じ `fixedTimeStep` で同じ入力を同じステップに与えれば、ビット単位で同一の結果が再現されます。入力を与えたステップは `getStepCount()` で識別できます。
+		/// @remark 物体に加えた力（`applyForce()` など）は、この呼び出しで実行されるすべてのステップに適用された後にクリアされます。
+		/// @param deltaTime 前回の呼び出しからの経過時間（秒）
+		/// @param fixedTimeStep 1 ステップあたりのタイムステップ（秒）
+		/// @param maxSubSteps 1 回の呼び出しで実行するステップの最大数
+		/// @param velocityIterations 物体の衝突時の速度の補正の回数
+		/// @param positionIterations 物体の衝突時の位置の補正の回数
+		/// @return 実行したステップの数
+		size_t updateFixed(double deltaTime = Scene::DeltaTime(), double fixedTimeStep = (1.0 / 120.0), size_t maxSubSteps = 8, int32 velocityIterations = 6, int32 positionIterations = 2) const;
+
+		/// @brief 描画時の物体の姿勢の補間に使う係数を返します。
+		/// @remark `updateFixed()` で持ち越された時間を `fixedTimeStep` で割った値で、[0, 1) の範囲です。`update()` を呼んだ後は 1 になります。
+		/// @remark `P2Body::getInterpolatedPos()`, `P2Body::getInterpolatedAngle()` はこの係数で直前のステップの姿勢と現在の姿勢を補間します。
+		/// @return 補間係数
+		[[nodiscard]]
+		double getInterpolationAlpha() const noexcept;
+
+		/// @brief `updateFixed()` で蓄積された時間を破棄します。
+		/// @remark シーンの切り替え後など、それまでの経過時間を物理演算に反映したくない場合に使います。
+		void resetAccumulator();
+
+		/// @brief ワールドの作成以降に実行されたステップの総数を返します。
+		/// @return ステップの総数
+		[[nodiscard]]
+		uint64 getStepCount() const noexcept;
+
+		/// @brief 直近の `update()` または `updateFixed()` で実行されたステップの統計を返します。
+		/// @return ステップの統計
+		[[nodiscard]]
+		const P2StepStat& getStepStat() const noexcept;
+
 		/// @brief ワールド内の物体がスリープ状態になることを許可・不許可を設定します（デフォルトでは許可）。
 		/// @param enabled 許可する場合 true, 許可しない場合 false
 		void setSleepEnabled(bool enabled);
@@ -396,6 +435,68 @@ namespace s3d
 		[[nodiscard]]
 		const HashTable<P2ContactPair, P2Collision>& getCollisions() const noexcept;
 
+		/// @brief 長方形とバウンディングボックスが重なる部品を持つ物体の一覧を返します。
+		/// @remark 部品の形状ではなくバウンディングボックスで判定するため、実際には重なっていない物体も含まれることがあります。
+		/// @param rect 長方形のワールド座標 (cm)
+		/// @param filter 対象とする部品のフィルタ
+		/// @return 物体の ID の一覧
+		[[nodiscard]]
+		Array<P2BodyID> queryAABB(const RectF& rect, const P2QueryFilter& filter = {}) const;
+
+		/// @brief 線分と交差する物体のうち、始点に最も近いものを返します。
+		/// @param start レイの始点のワールド座標 (cm)
+		/// @param end レイの終点のワールド座標 (cm)
+		/// @param filter 対象とする部品のフィルタ
+		/// @return 交差した物体の情報。交差する物体が無い場合は none
+		[[nodiscard]]
+		Optional<P2RaycastHit> raycast(const Vec2& start, const Vec2& end, const P2QueryFilter& filter = {}) const;
+
+		/// @brief 線分と交差するすべての物体を、始点に近い順に返します。
+		/// @remark 1 つの物体が複数の部品で交差する場合、始点に最も近い交差のみを返します。
+		/// @param start レイの始点のワールド座標 (cm)
+		/// @param end レイの終点のワールド座標 (cm)
+		/// @param filter 対象とする部品のフィルタ
+		/// @return 交差した物体の情報の一覧
+		[[nodiscard]]
+		Array<P2RaycastHit> raycastAll(const Vec2& start, const Vec2& end, const P2QueryFilter& filter = {}) const;
+
+		/// @brief 複数の線分について、それぞれ始点に最も近い交差を求めます。
+		/// @remark 線分の数が多い場合、エンジンのスレッドプールで並列に処理します。
+		/// @param rays レイのワールド座標 (cm)。`Line::begin` が始点、`Line::end` が終点です。
+		/// @param results 結果を格納する配列。`rays` と同じ要素数になります。
+		/// @param filter 対象とする部品のフィルタ
+		void raycastMany(const Array<Line>& rays, Array<Optional<P2RaycastHit>>& results, const P2QueryFilter& filter = {}) const;
+
+		/// @brief 複数の線分について、それぞれ始点に最も近い交差を求めます。
+		/// @remark 線分の数が多い場合、エンジンのスレッドプールで並列に処理します。
+		/// @param rays レイのワールド座標 (cm)。`Line::begin` が始点、`Line::end` が終点です。
+		/// @param filter 対象とする部品のフィルタ
+		/// @return `rays` の各要素に対応する結果
+		[[nodiscard]]
+		Array<Optional<P2RaycastHit>> raycastMany(const Array<Line>& rays, const P2QueryFilter& filter = {}) const;
+
+		/// @brief 円と重なる部品を持つ物体の一覧を返します。
+		/// @param circle 円のワールド座標 (cm)
+		/// @param filter 対象とする部品のフィルタ
+		/// @return 物体の ID の一覧
+		[[nodiscard]]
+		Array<P2BodyID> overlapCircle(const Circle& circle, const P2QueryFilter& filter = {}) const;
+
+		/// @brief 多角形と重なる部品を持つ物体の一覧を返します。
+		/// @param polygon 多角形のワールド座標 (cm)
+		/// @param filter 対象とする部品のフィルタ
+		/// @return 物体の ID の一覧
+		[[nodiscard]]
+		Array<P2BodyID> overlapPolygon(const Polygon& polygon, const P2QueryFilter& filter = {}) const;
+
+		/// @brief 点を含む部品を持つ物体の一覧を返します。
+		/// @remark 線分の部品は点を含むことがないため、対象になりません。
+		/// @param pos 点のワールド座標 (cm)
+		/// @param filter 対象とする部品のフィルタ
+		/// @return 物体の ID の一覧
+		[[nodiscard]]
+		Array<P2BodyID> pointQuery(const Vec2& pos, const P2QueryFilter& filter = {}) const;
+
 	private:
 
 		std::shared_ptr<detail::P2WorldDetail> pImpl;
@@ -652,7 +652,14 @@ namespace s3d
 
 	private:
 
-		std::unique_ptr<PolygonDetail> pImpl;
+		// コピーは内部データを共有し、変更時に複製する (copy-on-write)
+		std::shared_ptr<PolygonDetail> pImpl;
+
+		[[nodiscard]]
+		PolygonDetail& _mutableDetail();
+
+		[[nodiscard]]
+		static const std::shared_ptr<PolygonDetail>& _emptyDetail();
 	};
 
 	inline void swap(Polygon& a, Polygon& b) noexcept;
@@ -0,0 +1,132 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Optional.hpp"
+# include "PointVector.hpp"
+# include "RectF.hpp"
+# include "Polygon.hpp"
+
+namespace s3d
+{
+	class MultiPolygon;
+
+	/// @brief 多数の Polygon に対する空間クエリを高速に行うための静的な空間インデックス
+	/// @remark STR (Sort-Tile-Recursive) 法で一括構築したパックド R-tree です。構築後に多角形を追加・変更することはできません。
+	/// @remark 多角形はインデックス内にコピーされます（Polygon のコピーは内部データを共有するため、コストは小さいです）。
+	class PolygonIndex
+	{
+	public:
+
+		/// @brief 1 つのノードが持つ子の最大数
+		static constexpr size_t NodeCapacity = 16;
+
+		SIV3D_NODISCARD_CXX20
+		PolygonIndex() = default;
+
+		/// @brief 空間インデックスを構築します。
+		/// @param polygons 多角形の集合
+		SIV3D_NODISCARD_CXX20
+		explicit PolygonIndex(const MultiPolygon& polygons);
+
+		/// @brief 空間インデックスを構築します。
+		/// @param polygons 多角形の配列
+		SIV3D_NODISCARD_CXX20
+		explicit PolygonIndex(const Array<Polygon>& polygons);
+
+		/// @brief インデックスが空であるかを返します。
+		/// @return インデックスが空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief インデックスに含まれる多角形の数を返します。
+		/// @return インデックスに含まれる多角形の数
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief インデックスに含まれる多角形の配列を返します。
+		/// @remark クエリが返すインデックスは、この配列のインデックスです。
+		/// @return インデックスに含まれる多角形の配列
+		[[nodiscard]]
+		const Array<Polygon>& polygons() const noexcept;
+
+		/// @brief バウンディングボックスが長方形と交差する多角形の一覧を返します。
+		/// @param rect 長方形
+		/// @return 多角形のインデックスの一覧
+		[[nodiscard]]
+		Array<size_t> queryRect(const RectF& rect) const;
+
+		/// @brief 図形と交差する多角形の一覧を返します。
+		/// @tparam Shape2DType 図形の型
+		/// @param shape 図形
+		/// @return 多角形のインデックスの一覧（昇順）
+		template <class Shape2DType>
+		[[nodiscard]]
+		Array<size_t> queryIntersects(const Shape2DType& shape) const;
+
+		/// @brief 点を含む多角形の一覧を返します。
+		/// @param pos 点の座標
+		/// @return 多角形のインデックスの一覧（昇順）
+		[[nodiscard]]
+		Array<size_t> queryContains(const Vec2& pos) const;
+
+		/// @brief 点に最も近い多角形を返します。
+		/// @remark 点を含む多角形との距離は 0 です。距離が等しい場合はインデックスが小さいものを返します。
+		/// @param pos 点の座標
+		/// @return 最も近い多角形のインデックス。インデックスが空の場合は none
+		[[nodiscard]]
+		Optional<size_t> nearest(const Vec2& pos) const;
+
+		/// @brief 複数の点について、それぞれの点を含む多角形を並列に検索します。
+		/// @param points 点の座標の配列
+		/// @return それぞれの点を含む多角形のうち、インデックスが最も小さいもの。含む多角形が無い場合は none
+		[[nodiscard]]
+		Array<Optional<size_t>> queryAll(const Array<Vec2>& points) const;
+
+		/// @brief インデックスを消去し、メモリから解放します。
+		void release();
+
+	private:
+
+		struct Node
+		{
+			float minX;
+
+			float minY;
+
+			float maxX;
+
+			float maxY;
+
+			/// @brief 葉の場合は多角形のインデックス、それ以外の場合は最初の子ノードの位置
+			uint32 first;
+
+			/// @brief 子ノードの数。葉の場合は 0
+			uint32 count;
+		};
+
+		Array<Polygon> m_polygons;
+
+		// 葉、その親、... の順にレベルごとに連続して並べ、最後の要素を根とする
+		Array<Node> m_nodes;
+
+		void build();
+
+		/// @brief バウンディングボックスが長方形と交差する多角形のインデックスについて関数を呼び出します。
+		/// @param f 多角形のインデックスを受け取り、探索を続ける場合 true を返す関数
+		template <class Fty>
+		void visit(const RectF& rect, Fty f) const;
+	};
+}
+
+# include "detail/PolygonIndex.ipp"
@@ -11,7 +11,11 @@
 
 # pragma once
 # include "Common.hpp"
+# include "Array.hpp"
 # include "ProfilerStat.hpp"
+# include "ProfilerZone.hpp"
+# include "ProfilerZoneStat.hpp"
+# include "Renderer2DStat.hpp"
 
 namespace s3d
 {
@@ -29,5 +33,43 @@ namespace s3d
 
 		[[nodiscard]]
 		const ProfilerStat& GetStat();
+
+		/// @brief ProfilerZone による計測の ON / OFF を設定します。
+		/// @param enabled 計測を有効にするか
+		/// @remark 無効の場合、ProfilerZone のコストは 1 回の atomic 変数の読み込みのみです。
+		void EnableZoneProfiling(bool enabled) noexcept;
+
+		/// @brief ProfilerZone による計測が有効であるかを返します。
+		/// @return 計測が有効である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool IsZoneProfilingEnabled() noexcept;
+
+		/// @brief 直近のフレームにおける、各 ProfilerZone の統計を返します。
+		/// @remark 統計はフレームの終わりに更新されます。
+		/// @return 各 ProfilerZone の統計
+		[[nodiscard]]
+		Array<ProfilerZoneStat> GetZoneStats();
+
+		/// @brief 直近のフレームで記録された ProfilerZone を、Chrome の trace event 形式の JSON ファイルに保存します。
+		/// @param path 保存するファイルのパス
+		/// @remark 保存したファイルは chrome://tracing や Perfetto で開くことができます。
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool ExportChromeTrace(FilePathView path);
+
+		/// @brief これまでに記録された ProfilerZone の統計と trace を破棄します。
+		/// @remark 特定の処理だけを計測したい場合に、その直前に呼びます。メインスレッドから呼ぶ必要があります。
+		void ClearZoneHistory();
+
+		/// @brief 直近のフレームにおける Renderer2D の統計を返します。
+		/// @remark バッチ数や状態変更の回数などの詳細な統計は、Null レンダラー（ヘッドレスモード）でのみ集計されます。
+		/// @return Renderer2D の統計
+		[[nodiscard]]
+		const Renderer2DStat& GetRenderer2DStat();
+
+		/// @brief 次のフレームで Renderer2D に送られたコマンド列と頂点データを、テキストファイルに保存します。
+		/// @param path 保存するファイルのパス
+		/// @remark Null レンダラー（ヘッドレスモード）でのみ対応しています。ファイルは次の System::Update() で書き出されます。
+		/// @return 要求が受け付けられた場合 true, レンダラーが対応していない場合は false
+		bool CaptureRenderer2DFrame(FilePathView path);
 	}
 }
@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <atomic>
+# include "Common.hpp"
+# include "Time.hpp"
+
+namespace s3d
+{
+	/// @brief スコープの実行時間を計測して、プロファイラーに記録します。 | Measures the execution time of a scope and records it in the profiler.
+	/// @remark `Profiler::EnableZoneProfiling(true)` が呼ばれるまでは何も記録しません。 | Nothing is recorded until `Profiler::EnableZoneProfiling(true)` is called.
+	/// @remark ゾーンは入れ子にでき、どのスレッドでも使えます。 | Zones can be nested and used from any thread.
+	class ProfilerZone
+	{
+	public:
+
+		/// @brief 計測を開始します。 | Starts measuring.
+		/// @param name ゾーンの名前。文字列リテラルなど、プログラムの終了まで有効な文字列である必要があります。 | Name of the zone. Must be valid until the program exits, such as a string literal.
+		SIV3D_NODISCARD_CXX20
+		explicit ProfilerZone(const char32* name) noexcept;
+
+		/// @brief 計測を終了して、結果を記録します。 | Stops measuring and records the result.
+		~ProfilerZone();
+
+		ProfilerZone(const ProfilerZone&) = delete;
+
+		ProfilerZone& operator =(const ProfilerZone&) = delete;
+
+	private:
+
+		const char32* m_name = nullptr;
+
+		uint64 m_beginNanosec = 0;
+	};
+}
+
+# include "detail/ProfilerZone.ipp"
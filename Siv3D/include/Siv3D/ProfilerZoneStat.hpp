@@ -0,0 +1,44 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+
+namespace s3d
+{
+	/// @brief ProfilerZone の直近のフレームにおける統計 | Statistics of a ProfilerZone over recent frames
+	/// @remark 時間は、そのゾーンが記録された各フレームにおける合計時間をもとに計算されます。 | Times are based on the total time of the zone in each frame in which it was recorded.
+	struct ProfilerZoneStat
+	{
+		/// @brief ゾーンの名前 | Name of the zone
+		String name;
+
+		/// @brief ゾーンが記録されたフレーム数 | Number of frames in which the zone was recorded
+		uint32 frameCount = 0;
+
+		/// @brief 1 フレームあたりの平均呼び出し回数 | Average number of calls per frame
+		double callsPerFrame = 0.0;
+
+		/// @brief 1 フレームあたりの最短時間（ミリ秒） | Minimum time per frame (milliseconds)
+		double minMillisec = 0.0;
+
+		/// @brief 1 フレームあたりの平均時間（ミリ秒） | Average time per frame (milliseconds)
+		double avgMillisec = 0.0;
+
+		/// @brief 1 フレームあたりの最長時間（ミリ秒） | Maximum time per frame (milliseconds)
+		double maxMillisec = 0.0;
+
+		/// @brief 1 フレームあたりの時間の 99 パーセンタイル（ミリ秒） | 99th percentile of time per frame (milliseconds)
+		double p99Millisec = 0.0;
+	};
+}
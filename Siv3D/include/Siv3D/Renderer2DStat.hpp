@@ -0,0 +1,88 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief Renderer2D の 1 フレームあたりの状態変更の回数
+	/// @remark Null レンダラー（ヘッドレスモード）でのみ集計されます。
+	struct Renderer2DStateChangeStat
+	{
+		uint32 colorMul = 0;
+
+		uint32 colorAdd = 0;
+
+		uint32 blendState = 0;
+
+		uint32 rasterizerState = 0;
+
+		uint32 samplerState = 0;
+
+		uint32 scissorRect = 0;
+
+		uint32 viewport = 0;
+
+		uint32 sdfParams = 0;
+
+		uint32 internalPSConstants = 0;
+
+		uint32 renderTarget = 0;
+
+		uint32 vertexShader = 0;
+
+		uint32 pixelShader = 0;
+
+		uint32 transform = 0;
+
+		uint32 constantBuffer = 0;
+
+		uint32 texture = 0;
+
+		/// @brief 状態変更の合計回数を返します。
+		/// @return 状態変更の合計回数
+		[[nodiscard]]
+		constexpr uint32 total() const noexcept
+		{
+			return (colorMul + colorAdd + blendState + rasterizerState + samplerState
+				+ scissorRect + viewport + sdfParams + internalPSConstants + renderTarget
+				+ vertexShader + pixelShader + transform + constantBuffer + texture);
+		}
+	};
+
+	/// @brief Renderer2D の 1 フレームあたりの統計
+	/// @remark drawCalls と triangleCount 以外のメンバは、Null レンダラー（ヘッドレスモード）でのみ集計されます。
+	struct Renderer2DStat
+	{
+		/// @brief 描画コール数
+		uint32 drawCalls = 0;
+
+		/// @brief 描画された三角形の数
+		uint32 triangleCount = 0;
+
+		/// @brief 頂点バッファ・インデックスバッファの更新（バッチ）の数
+		uint32 batchCount = 0;
+
+		/// @brief バッチに書き込まれた頂点の数
+		uint32 vertexCount = 0;
+
+		/// @brief バッチに書き込まれたインデックスの数
+		uint32 indexCount = 0;
+
+		/// @brief コマンドの数
+		uint32 commandCount = 0;
+
+		/// @brief 種類別の状態変更の回数
+		Renderer2DStateChangeStat stateChanges;
+	};
+}
@@ -11,6 +11,10 @@
 
 # pragma once
 # include "Platform.hpp"
+# include <utility>
+# include "Common.hpp"
+# include "Array.hpp"
+# include "2DShapes.hpp"
 
 # if SIV3D_INTRINSIC(SSE)
     # define _XM_SSE4_INTRINSICS_
@@ -33,3 +37,98 @@ SIV3D_DISABLE_MSVC_WARNINGS_POP()
     # undef __out
     # undef __valid
 # endif
+
+namespace s3d
+{
+	/// @brief 多数の 2D 図形の交差判定をまとめて行う関数群
+	/// @remark AVX2 に対応した CPU では AVX2 を使って処理します。判定結果は `Geometry2D::Intersect()` と一致します。
+	namespace SIMDCollision
+	{
+		/// @brief 1 ワードあたりの判定結果の数
+		inline constexpr size_t BitsPerWord = 64;
+
+		/// @brief 複数の円それぞれが長方形と交差するかを調べます。
+		/// @param circles 円の配列
+		/// @param rect 長方形
+		/// @return 判定結果のビットマスク。i 番目の円が交差する場合、(i / 64) 番目の要素の (i % 64) ビット目が 1 になります。
+		[[nodiscard]]
+		Array<uint64> IntersectMany(const Array<Circle>& circles, const RectF& rect);
+
+		/// @brief 複数の円それぞれが長方形と交差するかを調べます。
+		/// @param circles 円の配列
+		/// @param rect 長方形
+		/// @param results 判定結果のビットマスクの格納先。確保済みのメモリは再利用されます。
+		void IntersectMany(const Array<Circle>& circles, const RectF& rect, Array<uint64>& results);
+
+		/// @brief 複数の円それぞれが円と交差するかを調べます。
+		/// @param circles 円の配列
+		/// @param circle 円
+		/// @return 判定結果のビットマスク。i 番目の円が交差する場合、(i / 64) 番目の要素の (i % 64) ビット目が 1 になります。
+		[[nodiscard]]
+		Array<uint64> IntersectMany(const Array<Circle>& circles, const Circle& circle);
+
+		/// @brief 複数の円それぞれが円と交差するかを調べます。
+		/// @param circles 円の配列
+		/// @param circle 円
+		/// @param results 判定結果のビットマスクの格納先。確保済みのメモリは再利用されます。
+		void IntersectMany(const Array<Circle>& circles, const Circle& circle, Array<uint64>& results);
+
+		/// @brief 複数の長方形それぞれが長方形と交差するかを調べます。
+		/// @param rects 長方形の配列
+		/// @param rect 長方形
+		/// @return 判定結果のビットマスク。i 番目の長方形が交差する場合、(i / 64) 番目の要素の (i % 64) ビット目が 1 になります。
+		[[nodiscard]]
+		Array<uint64> IntersectMany(const Array<RectF>& rects, const RectF& rect);
+
+		/// @brief 複数の長方形それぞれが長方形と交差するかを調べます。
+		/// @param rects 長方形の配列
+		/// @param rect 長方形
+		/// @param results 判定結果のビットマスクの格納先。確保済みのメモリは再利用されます。
+		void IntersectMany(const Array<RectF>& rects, const RectF& rect, Array<uint64>& results);
+
+		/// @brief 複数の長方形それぞれが円と交差するかを調べます。
+		/// @param rects 長方形の配列
+		/// @param circle 円
+		/// @return 判定結果のビットマスク。i 番目の長方形が交差する場合、(i / 64) 番目の要素の (i % 64) ビット目が 1 になります。
+		[[nodiscard]]
+		Array<uint64> IntersectMany(const Array<RectF>& rects, const Circle& circle);
+
+		/// @brief 複数の長方形それぞれが円と交差するかを調べます。
+		/// @param rects 長方形の配列
+		/// @param circle 円
+		/// @param results 判定結果のビットマスクの格納先。確保済みのメモリは再利用されます。
+		void IntersectMany(const Array<RectF>& rects, const Circle& circle, Array<uint64>& results);
+
+		/// @brief ビットマスクの i 番目の判定結果を返します。
+		/// @param results `IntersectMany()` の判定結果
+		/// @param i インデックス
+		/// @return i 番目の判定結果
+		[[nodiscard]]
+		inline bool Test(const Array<uint64>& results, const size_t i) noexcept
+		{
+			return ((results[i / BitsPerWord] >> (i % BitsPerWord)) & 1);
+		}
+
+		/// @brief 円と長方形の組のうち、交差するものをすべて列挙します。
+		/// @param circles 円の配列
+		/// @param rects 長方形の配列
+		/// @return 交差する (円のインデックス, 長方形のインデックス) の配列。昇順にソートされています。
+		/// @remark x 軸方向の sweep and prune で候補を絞り込んでから判定します。
+		[[nodiscard]]
+		Array<std::pair<size_t, size_t>> IntersectPairs(const Array<Circle>& circles, const Array<RectF>& rects);
+
+		/// @brief 円の組のうち、交差するものをすべて列挙します。
+		/// @param circles 円の配列
+		/// @return 交差する (i, j) (i < j) の配列。昇順にソートされています。
+		/// @remark x 軸方向の sweep and prune で候補を絞り込んでから判定します。
+		[[nodiscard]]
+		Array<std::pair<size_t, size_t>> IntersectPairs(const Array<Circle>& circles);
+
+		/// @brief 長方形の組のうち、交差するものをすべて列挙します。
+		/// @param rects 長方形の配列
+		/// @return 交差する (i, j) (i < j) の配列。昇順にソートされています。
+		/// @remark x 軸方向の sweep and prune で候補を絞り込んでから判定します。
+		[[nodiscard]]
+		Array<std::pair<size_t, size_t>> IntersectPairs(const Array<RectF>& rects);
+	}
+}
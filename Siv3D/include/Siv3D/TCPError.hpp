@@ -25,5 +25,7 @@ namespace s3d
 		ConnectionRefused,
 
 		Error,
+
+		InvalidMessage,
 	};
 }
@@ -11,8 +11,10 @@
 
 # pragma once
 # include <memory>
+# include <span>
 # include "Common.hpp"
 # include "Array.hpp"
+# include "Byte.hpp"
 # include "Optional.hpp"
 # include "Unspecified.hpp"
 
@@ -25,6 +27,9 @@ namespace s3d
 	{
 	public:
 
+		/// @brief `sendMessage()` / `receiveMessage()` で扱えるメッセージの最大サイズ（バイト）の既定値
+		static constexpr size_t DefaultMaxMessageSize = (16 * 1024 * 1024);
+
 		SIV3D_NODISCARD_CXX20
 		TCPServer();
 
@@ -71,11 +76,62 @@ namespace s3d
 		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
 		bool read(TriviallyCopyable& to, const Optional<TCPSessionID>& id = unspecified);
 
+		/// @brief 受信済みのデータを、コピーせずに参照します。
+		/// @param id セッション ID。省略した場合は最も古いセッション
+		/// @return 受信済みのデータ
+		/// @remark 返した領域は、同じセッションに対して次に `peek()`, `consume()`, `skip()`, `read()` を呼ぶまで有効です。
+		[[nodiscard]]
+		std::span<const Byte> peek(const Optional<TCPSessionID>& id = unspecified);
+
+		/// @brief 受信済みのデータの先頭を取り除きます。`peek()` で解析し終えたデータを読み捨てるのに使います。
+		/// @param size 取り除くサイズ（バイト）
+		/// @param id セッション ID。省略した場合は最も古いセッション
+		/// @return 取り除いた場合 true, 受信済みのデータが足りない場合は false
+		bool consume(size_t size, const Optional<TCPSessionID>& id = unspecified);
+
 		bool send(const void* data, size_t size, const Optional<TCPSessionID>& id = unspecified);
 
 		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
 		bool send(const TriviallyCopyable& to, const Optional<TCPSessionID>& id = unspecified);
 
+		/// @brief 長さ付きのメッセージを送信します。
+		/// @param data メッセージの先頭
+		/// @param size メッセージのサイズ（バイト）
+		/// @param id セッション ID。省略した場合は最も古いセッション
+		/// @return 送信を開始した場合 true, それ以外の場合は false
+		/// @remark メッセージの前に、長さを可変長整数で書き込みます。受信側は `receiveMessage()` で 1 つのメッセージとして受け取れます。
+		/// @remark 同じフレームで送信したデータは、まとめて 1 回の書き込みで送られます。
+		bool sendMessage(const void* data, size_t size, const Optional<TCPSessionID>& id = unspecified);
+
+		/// @brief 長さ付きのメッセージを送信します。
+		/// @param message メッセージ
+		/// @param id セッション ID。省略した場合は最も古いセッション
+		/// @return 送信を開始した場合 true, それ以外の場合は false
+		bool sendMessage(std::span<const Byte> message, const Optional<TCPSessionID>& id = unspecified);
+
+		/// @brief `sendMessage()` で送信されたメッセージを 1 つ受信します。
+		/// @param message メッセージの格納先
+		/// @param id セッション ID。省略した場合は最も古いセッション
+		/// @return メッセージ全体を受信済みで、取り出した場合 true, それ以外の場合は false
+		/// @remark 最大サイズを超えるメッセージや不正なヘッダを受信した場合は、そのセッションを切断します。
+		bool receiveMessage(Array<Byte>& message, const Optional<TCPSessionID>& id = unspecified);
+
+		/// @brief `sendMessage()` / `receiveMessage()` で扱えるメッセージの最大サイズを設定します。
+		/// @param size メッセージの最大サイズ（バイト）
+		void setMaxMessageSize(size_t size);
+
+		/// @brief `sendMessage()` / `receiveMessage()` で扱えるメッセージの最大サイズ（バイト）を返します。
+		/// @return メッセージの最大サイズ（バイト）
+		[[nodiscard]]
+		size_t maxMessageSize() const;
+
+		/// @brief セッションの送信で、ソケットへの書き込みを行った回数を返します。
+		/// @param id セッション ID。省略した場合は最も古いセッション
+		/// @return 書き込みを行った回数
+		/// @remark 送信中に追加されたデータは次の 1 回の書き込みにまとめられるため、通常は `send()` / `sendMessage()` の呼び出し回数より少なくなります。
+		[[nodiscard]]
+		uint64 getWriteCount(const Optional<TCPSessionID>& id = unspecified) const;
+
 	private:
 
 		class TCPServerDetail;
@@ -0,0 +1,207 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "PointVector.hpp"
+# include "2DShapes.hpp"
+# include "Font.hpp"
+# include "GlyphCluster.hpp"
+# include "TextStyle.hpp"
+# include "Palette.hpp"
+
+namespace s3d
+{
+	struct DrawableText;
+	class TextLayoutDetail;
+
+	/// @brief グリフのレイアウトをキャッシュした、繰り返し描画するためのテキスト
+	/// @remark グリフクラスタと各グリフの位置を構築時に計算して保持するため、描画のたびのシェーピングやレイアウトの計算が不要です。
+	/// @remark `setText()` でテキストを変更した場合、変更前と共通する先頭部分（最後の空白文字まで）のレイアウトは再利用されます。
+	/// @remark `Font::loadGlyphCache()` でフォントのグリフのキャッシュを置き換えた場合は、`setText()` などで再構築する必要があります。
+	class TextLayout
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		TextLayout();
+
+		/// @brief テキストのレイアウトを作成します。
+		/// @param font フォント
+		/// @param text テキスト
+		SIV3D_NODISCARD_CXX20
+		TextLayout(const Font& font, StringView text);
+
+		/// @brief テキストのレイアウトを作成します。
+		/// @param font フォント
+		/// @param fontSize フォントサイズ
+		/// @param text テキスト
+		SIV3D_NODISCARD_CXX20
+		TextLayout(const Font& font, double fontSize, StringView text);
+
+		/// @brief `Font::operator()` が返すテキストから、レイアウトを作成します。
+		/// @param text テキスト
+		/// @remark グリフクラスタは text のものを再利用します。
+		SIV3D_NODISCARD_CXX20
+		explicit TextLayout(const DrawableText& text);
+
+		/// @brief `Font::operator()` が返すテキストから、レイアウトを作成します。
+		/// @param text テキスト
+		/// @param fontSize フォントサイズ
+		/// @remark グリフクラスタは text のものを再利用します。
+		SIV3D_NODISCARD_CXX20
+		TextLayout(const DrawableText& text, double fontSize);
+
+		~TextLayout();
+
+		/// @brief テキストを変更します。
+		/// @param text 新しいテキスト
+		/// @remark 変更前のテキストと共通する先頭部分のうち、最後の空白文字までのグリフクラスタとレイアウトは再利用され、それ以降だけが計算し直されます。
+		void setText(StringView text);
+
+		/// @brief フォントサイズを変更します。
+		/// @param fontSize 新しいフォントサイズ
+		/// @remark グリフクラスタは再利用され、レイアウトだけが計算し直されます。
+		void setFontSize(double fontSize);
+
+		/// @brief レイアウトが空であるかを返します。
+		/// @return テキストが空であるか、フォントが設定されていない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief フォントを返します。
+		/// @return フォント
+		[[nodiscard]]
+		const Font& font() const noexcept;
+
+		/// @brief テキストを返します。
+		/// @return テキスト
+		[[nodiscard]]
+		const String& text() const noexcept;
+
+		/// @brief フォントサイズを返します。
+		/// @return フォントサイズ
+		[[nodiscard]]
+		double fontSize() const noexcept;
+
+		/// @brief グリフクラスタの一覧を返します。
+		/// @return グリフクラスタの一覧
+		[[nodiscard]]
+		const Array<GlyphCluster>& clusters() const noexcept;
+
+		/// @brief 直前の `setText()` で再利用されたグリフクラスタの数を返します。
+		/// @return 再利用されたグリフクラスタの数
+		[[nodiscard]]
+		size_t reusedClusters() const noexcept;
+
+		/// @brief テキストが描画される領域の大きさを返します。
+		/// @return テキストが描画される領域の大きさ
+		[[nodiscard]]
+		SizeF size() const noexcept;
+
+		/// @brief テキストが描画される領域を返します。
+		/// @param x 描画する左上の X 座標
+		/// @param y 描画する左上の Y 座標
+		/// @return テキストが描画される領域
+		[[nodiscard]]
+		RectF region(double x, double y) const noexcept;
+
+		/// @brief テキストが描画される領域を返します。
+		/// @param pos 描画する左上の座標
+		/// @return テキストが描画される領域
+		[[nodiscard]]
+		RectF region(const Vec2& pos = Vec2{ 0, 0 }) const noexcept;
+
+		/// @brief テキストが描画される領域を返します。
+		/// @param x 描画する中心の X 座標
+		/// @param y 描画する中心の Y 座標
+		/// @return テキストが描画される領域
+		[[nodiscard]]
+		RectF regionAt(double x, double y) const noexcept;
+
+		/// @brief テキストが描画される領域を返します。
+		/// @param center 描画する中心の座標
+		/// @return テキストが描画される領域
+		[[nodiscard]]
+		RectF regionAt(const Vec2& center = Vec2{ 0, 0 }) const noexcept;
+
+		/// @brief テキストが描画される領域を返します。
+		/// @param pos 描画するベースラインの左端の座標
+		/// @return テキストが描画される領域
+		[[nodiscard]]
+		RectF regionBase(const Vec2& pos = Vec2{ 0, 0 }) const noexcept;
+
+		/// @brief テキストを描画します。
+		/// @param x 描画する左上の X 座標
+		/// @param y 描画する左上の Y 座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF draw(double x, double y, const ColorF& color = Palette::White) const;
+
+		/// @brief テキストを描画します。
+		/// @param pos 描画する左上の座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF draw(const Vec2& pos = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+		/// @brief テキストを描画します。
+		/// @param textStyle テキストスタイル
+		/// @param pos 描画する左上の座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF draw(const TextStyle& textStyle, const Vec2& pos = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+		/// @brief 中心位置を指定してテキストを描画します。
+		/// @param x 描画する中心の X 座標
+		/// @param y 描画する中心の Y 座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF drawAt(double x, double y, const ColorF& color = Palette::White) const;
+
+		/// @brief 中心位置を指定してテキストを描画します。
+		/// @param center 描画する中心の座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF drawAt(const Vec2& center = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+		/// @brief 中心位置を指定してテキストを描画します。
+		/// @param textStyle テキストスタイル
+		/// @param center 描画する中心の座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF drawAt(const TextStyle& textStyle, const Vec2& center = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+		/// @brief ベースラインの位置を指定してテキストを描画します。
+		/// @param pos 描画するベースラインの左端の座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF drawBase(const Vec2& pos = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+		/// @brief ベースラインの位置を指定してテキストを描画します。
+		/// @param textStyle テキストスタイル
+		/// @param pos 描画するベースラインの左端の座標
+		/// @param color 文字の色
+		/// @return テキストが描画された領域
+		RectF drawBase(const TextStyle& textStyle, const Vec2& pos = Vec2{ 0, 0 }, const ColorF& color = Palette::White) const;
+
+	private:
+
+		std::shared_ptr<TextLayoutDetail> pImpl;
+
+		/// @brief 変更のために、他のオブジェクトと共有していない内部データを返します。
+		[[nodiscard]]
+		TextLayoutDetail& _mutableDetail();
+	};
+}
@@ -73,7 +73,13 @@ namespace s3d
 
 		/// @brief 指定したテクスチャアセットの非同期ロードを開始します。
 		/// @param name テクスチャアセット名
-		static void LoadAsync(AssetNameView name);
+		/// @param priority 優先度。大きいほど先にロードされます。
+		static void LoadAsync(AssetNameView name, int32 priority = 0);
+
+		/// @brief 指定したテクスチャアセットの、まだ開始していない非同期ロードをキャンセルします。
+		/// @param name テクスチャアセット名
+		/// @return キャンセルした場合 true, それ以外の場合は false
+		static bool CancelLoadAsync(AssetNameView name);
 
 		/// @brief 指定したテクスチャアセットのロードが完了するまで待機します。
 		/// @param name テクスチャアセット名
@@ -10,6 +10,13 @@
 //-----------------------------------------------
 
 # pragma once
+# include <atomic>
+# include <condition_variable>
+# include <exception>
+# include <functional>
+# include <mutex>
+# include <type_traits>
+# include "Common.hpp"
 
 namespace s3d
 {
@@ -19,5 +26,80 @@ namespace s3d
 		/// @return サポートされるスレッド数 | Number of concurrent threads supported
 		[[nodiscard]]
 		size_t GetConcurrency() noexcept;
+
+		/// @brief エンジンのスレッドプールのワーカースレッド数を返します。 | Returns the number of worker threads in the engine thread pool.
+		/// @return ワーカースレッド数 | Number of worker threads
+		[[nodiscard]]
+		size_t GetWorkerCount() noexcept;
+
+		/// @brief 現在のスレッドがエンジンのスレッドプールのワーカースレッドであるかを返します。 | Returns whether the current thread is a worker thread of the engine thread pool.
+		/// @return ワーカースレッドである場合 true, それ以外の場合は false | Returns true if the current thread is a worker thread, false otherwise
+		[[nodiscard]]
+		bool IsWorkerThread() noexcept;
+
+		/// @brief スレッドプールに投入したタスクの完了を待つためのカウンタです。 | Counter for waiting for the completion of tasks submitted to the thread pool.
+		class WaitGroup
+		{
+		public:
+
+			SIV3D_NODISCARD_CXX20
+			WaitGroup() = default;
+
+			WaitGroup(const WaitGroup&) = delete;
+
+			WaitGroup& operator =(const WaitGroup&) = delete;
+
+			/// @brief 未完了のタスク数を増やします。 | Increases the number of pending tasks.
+			/// @param n 増やす数 | Number to increase
+			void add(size_t n = 1) noexcept;
+
+			/// @brief タスクが 1 つ完了したことを通知します。 | Notifies that one task has been completed.
+			void done() noexcept;
+
+			/// @brief すべてのタスクが完了しているかを返します。 | Returns whether all tasks have been completed.
+			/// @return すべてのタスクが完了している場合 true, それ以外の場合は false | Returns true if all tasks have been completed, false otherwise
+			[[nodiscard]]
+			bool isDone() const noexcept;
+
+			/// @brief すべてのタスクが完了するまで待機します。 | Waits until all tasks have been completed.
+			/// @remark ワーカースレッドから呼ばれた場合、待機中に他のタスクを実行します。 | When called from a worker thread, other tasks are executed while waiting.
+			/// @throw タスクが例外を送出した場合、最初の例外を再送出します。 | Rethrows the first exception thrown by a task.
+			void wait();
+
+		private:
+
+			friend void Submit(WaitGroup& waitGroup, std::function<void()> task);
+
+			std::atomic<size_t> m_count{ 0 };
+
+			// done() は m_mutex を保持したまま通知するため、wait() から戻った後に WaitGroup を破棄しても安全
+			std::mutex m_mutex;
+
+			std::condition_variable m_condition;
+
+			std::exception_ptr m_exception;
+
+			void setException(std::exception_ptr exception) noexcept;
+		};
+
+		/// @brief エンジンのスレッドプールでタスクを実行します。 | Runs a task on the engine thread pool.
+		/// @param task タスク | Task
+		void Submit(std::function<void()> task);
+
+		/// @brief エンジンのスレッドプールでタスクを実行します。 | Runs a task on the engine thread pool.
+		/// @param waitGroup タスクの完了を通知する WaitGroup | WaitGroup to be notified when the task is completed
+		/// @param task タスク | Task
+		void Submit(WaitGroup& waitGroup, std::function<void()> task);
+
+		/// @brief [0, count) の範囲を grainSize 個ずつのチャンクに分割し、エンジンのスレッドプールで並列に処理します。 | Splits the range [0, count) into chunks of grainSize and processes them in parallel on the engine thread pool.
+		/// @tparam Fty チャンクを処理する関数の型 | Type of the function that processes a chunk
+		/// @param count 要素数 | Number of elements
+		/// @param f チャンクの範囲 [begin, end) を受け取る関数 | Function that takes the range [begin, end) of a chunk
+		/// @param grainSize チャンクあたりの要素数。0 の場合は自動で決定されます。 | Number of elements per chunk. If 0, it is determined automatically.
+		/// @remark 呼び出し元のスレッドもチャンクを処理し、すべてのチャンクの処理が終わるまで戻りません。 | The calling thread also processes chunks and does not return until all chunks have been processed.
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t, size_t>>* = nullptr>
+		void ParallelFor(size_t count, Fty f, size_t grainSize = 0);
 	}
 }
+
+# include "detail/Threading.ipp"
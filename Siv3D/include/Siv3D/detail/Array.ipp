@@ -1554,51 +1554,16 @@ namespace s3d
 			return 0;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
+		std::atomic<size_t> result{ 0 };
 
-		if (numThreads <= 1)
+		Threading::ParallelFor(size(), [&](const size_t first, const size_t last)
 		{
-			return count_if(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
+			const size_t n = static_cast<size_t>(std::count_if((begin() + first), (begin() + last), f));
 
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				return std::count_if(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		size_t result = 0;
-		
-		if (countLeft)
-		{
-			result = std::count_if(it, it + countLeft, f);
-		}
+			result.fetch_add(n, std::memory_order_relaxed);
+		});
 
-		for (auto& future : futures)
-		{
-			result += future.get();
-		}
-
-		return result;
+		return result.load();
 
 	# endif
 	}
@@ -1618,47 +1583,10 @@ namespace s3d
 			return;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return each(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			std::for_each(it, it + countLeft, f);
-		}
-
-		for (auto& future : futures)
+		Threading::ParallelFor(size(), [&](const size_t first, const size_t last)
 		{
-			future.get();
-		}
+			std::for_each((begin() + first), (begin() + last), f);
+		});
 
 	# endif
 	}
@@ -1678,47 +1606,10 @@ namespace s3d
 			return;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return each(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			std::for_each(it, it + countLeft, f);
-		}
-
-		for (auto& future : futures)
+		Threading::ParallelFor(size(), [&](const size_t first, const size_t last)
 		{
-			future.get();
-		}
+			std::for_each((begin() + first), (begin() + last), f);
+		});
 
 	# endif
 	}
@@ -1734,61 +1625,24 @@ namespace s3d
 			return Array<Ret>{};
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
+		if (Threading::GetConcurrency() <= 1)
 		{
 			return map(f);
 		}
 
 		Array<Ret> new_array(size());
 
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<void>> futures;
-
-		auto itDst = new_array.begin();
-		auto itSrc = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-			{
-				const auto itSrcEnd = itSrc + n;
-
-				while (itSrc != itSrcEnd)
-				{
-					*itDst++ = f(*itSrc++);
-				}
-			}));
-
-			itDst += n;
-			itSrc += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
+		Threading::ParallelFor(size(), [&](const size_t first, const size_t last)
 		{
-			const auto itSrcEnd = end();
+			auto itDst = (new_array.begin() + first);
+			auto itSrc = (begin() + first);
+			const auto itSrcEnd = (begin() + last);
 
 			while (itSrc != itSrcEnd)
 			{
 				*itDst++ = f(*itSrc++);
 			}
-		}
-
-		for (auto& future : futures)
-		{
-			future.get();
-		}
+		});
 
 		return new_array;
 	}
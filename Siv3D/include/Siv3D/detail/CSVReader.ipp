@@ -0,0 +1,33 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+
+namespace s3d
+{
+	template <class Type>
+	inline Type CSVField::get() const
+	{
+		if (const auto opt = getOpt<Type>())
+		{
+			return opt.value();
+		}
+
+		return Type();
+	}
+
+	template <class Type>
+	inline Optional<Type> CSVField::getOpt() const
+	{
+		return ParseOpt<Type>(toString());
+	}
+}
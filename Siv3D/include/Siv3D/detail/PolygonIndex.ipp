@@ -0,0 +1,107 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	namespace detail
+	{
+		template <class Shape2DType>
+		[[nodiscard]]
+		inline RectF PolygonIndexBoundingRect(const Shape2DType& shape)
+		{
+			return shape.boundingRect();
+		}
+
+		[[nodiscard]]
+		inline RectF PolygonIndexBoundingRect(const Vec2& pos) noexcept
+		{
+			return RectF{ pos, 0, 0 };
+		}
+
+		[[nodiscard]]
+		inline RectF PolygonIndexBoundingRect(const Rect& rect) noexcept
+		{
+			return RectF{ rect };
+		}
+
+		[[nodiscard]]
+		inline RectF PolygonIndexBoundingRect(const RectF& rect) noexcept
+		{
+			return rect;
+		}
+	}
+
+	template <class Shape2DType>
+	inline Array<size_t> PolygonIndex::queryIntersects(const Shape2DType& shape) const
+	{
+		Array<size_t> results;
+
+		visit(detail::PolygonIndexBoundingRect(shape), [&](const size_t index)
+		{
+			if (m_polygons[index].intersects(shape))
+			{
+				results << index;
+			}
+
+			return true;
+		});
+
+		return results.sort();
+	}
+
+	template <class Fty>
+	inline void PolygonIndex::visit(const RectF& rect, Fty f) const
+	{
+		if (m_nodes.isEmpty())
+		{
+			return;
+		}
+
+		const double left	= rect.x;
+		const double top	= rect.y;
+		const double right	= (rect.x + rect.w);
+		const double bottom	= (rect.y + rect.h);
+
+		// 各レベルで高々 (NodeCapacity - 1) 個の兄弟が積まれるため、32 レベル分あれば十分
+		uint32 stack[NodeCapacity * 32];
+		size_t stackSize = 0;
+		stack[stackSize++] = static_cast<uint32>(m_nodes.size() - 1);
+
+		while (stackSize)
+		{
+			const Node& node = m_nodes[stack[--stackSize]];
+
+			if ((right < node.minX) || (node.maxX < left)
+				|| (bottom < node.minY) || (node.maxY < top))
+			{
+				continue;
+			}
+
+			if (node.count == 0)
+			{
+				if (not f(static_cast<size_t>(node.first)))
+				{
+					return;
+				}
+
+				continue;
+			}
+
+			// 子を逆順に積み、メモリ上の並び順に探索する
+			for (uint32 i = node.count; 0 < i; --i)
+			{
+				stack[stackSize++] = (node.first + i - 1);
+			}
+		}
+	}
+}
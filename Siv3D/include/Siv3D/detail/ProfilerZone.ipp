@@ -0,0 +1,40 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+
+namespace s3d
+{
+	namespace detail
+	{
+		inline std::atomic<bool> g_profilerZoneEnabled{ false };
+
+		void RecordProfilerZone(const char32* name, uint64 beginNanosec, uint64 endNanosec) noexcept;
+	}
+
+	inline ProfilerZone::ProfilerZone(const char32* name) noexcept
+	{
+		if (detail::g_profilerZoneEnabled.load(std::memory_order_relaxed))
+		{
+			m_name = name;
+			m_beginNanosec = Time::GetNanosec();
+		}
+	}
+
+	inline ProfilerZone::~ProfilerZone()
+	{
+		if (m_name)
+		{
+			detail::RecordProfilerZone(m_name, m_beginNanosec, Time::GetNanosec());
+		}
+	}
+}
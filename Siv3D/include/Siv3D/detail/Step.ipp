@@ -1036,52 +1036,30 @@ namespace s3d
 			return 0;
 		}
 
-		N result = 0;
-		auto count_ = count();
-		auto value = startValue();
+		const size_t count_ = static_cast<size_t>(count());
+		const auto startValue_ = startValue();
 		const auto step_ = step();
 
 		numThreads = Max<size_t>(1, numThreads);
 
-		const auto n = Max<N>(1, count_ / numThreads);
+		std::atomic<size_t> result{ 0 };
 
-		N num_processed = 0;
-		const N num_all = count_;
-
-		Array<std::future<std::size_t>> futures;
-
-		for (; num_processed < num_all - n; num_processed += n)
+		Threading::ParallelFor(count_, [&](const size_t first, const size_t last)
 		{
-			futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-				{
-					size_t t_result = 0;
-
-					for (N i = 0; i < n; ++i)
-					{
-						t_result += f(value);
-
-						value += step_;
-					}
+			size_t t_result = 0;
+			T value = static_cast<T>(startValue_ + static_cast<T>(static_cast<S>(first) * step_));
 
-					return t_result;
-				}));
-
-			value += static_cast<T>(n * step_);
-		}
-
-		for (; num_processed < num_all; ++num_processed)
-		{
-			result += f(value);
+			for (size_t i = first; i < last; ++i)
+			{
+				t_result += f(value);
 
-			value += step_;
-		}
+				value += step_;
+			}
 
-		for (auto& future : futures)
-		{
-			result += future.get();
-		}
+			result.fetch_add(t_result, std::memory_order_relaxed);
+		}, ((count_ + (numThreads - 1)) / numThreads));
 
-		return result;
+		return static_cast<N>(result.load());
 	}
 
 	template <class T, class N, class S>
@@ -1093,45 +1071,23 @@ namespace s3d
 			return;
 		}
 
-		auto count_ = count();
-		auto value = startValue();
+		const size_t count_ = static_cast<size_t>(count());
+		const auto startValue_ = startValue();
 		const auto step_ = step();
 
 		numThreads = Max<size_t>(1, numThreads);
 
-		const auto n = Max<N>(1, count_ / numThreads);
-
-		N num_processed = 0;
-		const N num_all = count_;
-
-		Array<std::future<void>> futures;
-
-		for (; num_processed < num_all - n; num_processed += n)
-		{
-			futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-				{
-					for (N i = 0; i < n; ++i)
-					{
-						f(value);
-
-						value += step_;
-					}
-				}));
-
-			value += static_cast<T>(n * step_);
-		}
-
-		for (; num_processed < num_all; ++num_processed)
+		Threading::ParallelFor(count_, [&](const size_t first, const size_t last)
 		{
-			f(value);
+			T value = static_cast<T>(startValue_ + static_cast<T>(static_cast<S>(first) * step_));
 
-			value += step_;
-		}
+			for (size_t i = first; i < last; ++i)
+			{
+				f(value);
 
-		for (auto& future : futures)
-		{
-			future.wait();
-		}
+				value += step_;
+			}
+		}, ((count_ + (numThreads - 1)) / numThreads));
 	}
 
 	// parallel_map
@@ -30,4 +30,9 @@ namespace s3d
 	{
 		return send(std::addressof(from), sizeof(TriviallyCopyable));
 	}
+
+	inline bool TCPClient::sendMessage(const std::span<const Byte> message)
+	{
+		return sendMessage(message.data(), message.size());
+	}
 }
@@ -30,4 +30,9 @@ namespace s3d
 	{
 		return send(std::addressof(to), sizeof(TriviallyCopyable), id);
 	}
+
+	inline bool TCPServer::sendMessage(const std::span<const Byte> message, const Optional<TCPSessionID>& id)
+	{
+		return sendMessage(message.data(), message.size(), id);
+	}
 }
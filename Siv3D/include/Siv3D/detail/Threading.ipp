@@ -0,0 +1,56 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	namespace Threading
+	{
+		namespace detail
+		{
+			using ParallelForFunction = void(*)(void*, size_t, size_t);
+
+			void ParallelForImpl(size_t count, size_t grainSize, ParallelForFunction function, void* data);
+
+			template <class Fty>
+			void ParallelForInvoke(void* data, const size_t begin, const size_t end)
+			{
+				(*static_cast<Fty*>(data))(begin, end);
+			}
+		}
+
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t, size_t>>*>
+		inline void ParallelFor(const size_t count, Fty f, size_t grainSize)
+		{
+			if (count == 0)
+			{
+				return;
+			}
+
+			const size_t numThreads = GetConcurrency();
+
+			if (grainSize == 0)
+			{
+				// 1 スレッドあたり 4 チャンク程度に分割する
+				grainSize = (count + (numThreads * 4 - 1)) / (numThreads * 4);
+			}
+
+			if ((numThreads <= 1) || (count <= grainSize))
+			{
+				f(size_t{ 0 }, count);
+				return;
+			}
+
+			detail::ParallelForImpl(count, grainSize, &detail::ParallelForInvoke<Fty>, &f);
+		}
+	}
+}
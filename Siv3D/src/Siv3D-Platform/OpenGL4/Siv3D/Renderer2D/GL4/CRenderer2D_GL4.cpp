@@ -13,6 +13,7 @@
 # include <Siv3D/Error.hpp>
 # include <Siv3D/Resource.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/ScopeGuard.hpp>
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/ShaderCommon.hpp>
@@ -569,8 +570,15 @@ namespace s3d
 
 	void CRenderer2D_GL4::addPolygon(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		for (size_t offset = 0; offset < num_triangles;)
 		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, (indices + offset), (num_triangles - offset));
+
+			if (built == 0)
+			{
+				return;
+			}
+
 			if (not m_currentCustomVS)
 			{
 				m_commandManager.pushStandardVS(m_standardVS->spriteID);
@@ -582,6 +590,7 @@ namespace s3d
 			}
 
 			m_commandManager.pushDraw(indexCount);
+			offset += built;
 		}
 	}
 
@@ -728,8 +737,15 @@ namespace s3d
 
 	void CRenderer2D_GL4::addTexturedVertices(const Texture& texture, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		if (const auto indexCount = Vertex2DBuilder::BuildTexturedVertices(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		for (size_t offset = 0; offset < num_triangles;)
 		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildTexturedVertices(m_bufferCreator, vertices, vertexCount, (indices + offset), (num_triangles - offset));
+
+			if (built == 0)
+			{
+				return;
+			}
+
 			if (not m_currentCustomVS)
 			{
 				m_commandManager.pushStandardVS(m_standardVS->spriteID);
@@ -742,6 +758,7 @@ namespace s3d
 
 			m_commandManager.pushPSTexture(0, texture);
 			m_commandManager.pushDraw(indexCount);
+			offset += built;
 		}
 	}
 
@@ -802,7 +819,7 @@ namespace s3d
 		}
 	}
 
-	void CRenderer2D_GL4::addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
+	void CRenderer2D_GL4::addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
 		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
 	{
@@ -823,6 +840,87 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_GL4::addCircles(const Circle* circles, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		const float scale = getMaxScaling();
+
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildCircles(m_bufferCreator, (circles + offset), (count - offset), (colors ? (colors + offset) : nullptr), color, scale);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_GL4::addRects(const RectF* rects, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildRects(m_bufferCreator, (rects + offset), (count - offset), (colors ? (colors + offset) : nullptr), color);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_GL4::addTexturedQuads(const Texture& texture, const Quad* quads, const size_t count, const RectF* uvRects, const Float4& color)
+	{
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildTexturedQuads(m_bufferCreator, (quads + offset), (count - offset), (uvRects ? (uvRects + offset) : nullptr), color);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
 	Float4 CRenderer2D_GL4::getColorMul() const
 	{
 		return m_commandManager.getCurrentColorMul();
@@ -1064,6 +1162,8 @@ namespace s3d
 
 	void CRenderer2D_GL4::flush()
 	{
+		const ProfilerZone profilerZone{ U"Renderer2D::flush" };
+
 		ScopeGuard cleanUp = [this]()
 		{
 			m_batches.reset();
@@ -1126,9 +1226,9 @@ namespace s3d
 					const uint32 indexCount = draw.indexCount;
 					const uint32 startIndexLocation = batchInfo.startIndexLocation;
 					const uint32 baseVertexLocation = batchInfo.baseVertexLocation;
-					constexpr Vertex2D::IndexType* pBase = 0;
+					const uintptr_t indexByteOffset = (static_cast<uintptr_t>(startIndexLocation) * m_batches.getIndexSize());
 
-					::glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, (pBase + startIndexLocation), baseVertexLocation);
+					::glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, m_batches.getIndexType(), reinterpret_cast<const void*>(indexByteOffset), baseVertexLocation);
 					batchInfo.startIndexLocation += indexCount;
 
 					++m_stat.drawCalls;
@@ -28,8 +28,238 @@ namespace s3d
 
 			return newArraySize;
 		}
+
+		static void WidenIndices(uint32* pDst, const Vertex2D::IndexType* pSrc, const uint32 size, const uint32 baseVertex) noexcept
+		{
+			for (uint32 i = 0; i < size; ++i)
+			{
+				pDst[i] = (baseVertex + pSrc[i]);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	PersistentRingBuffer
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool GL4Vertex2DBatch::PersistentRingBuffer::init(const uint32 _elementSize, const uint32 _capacity, const uint32 _maxCapacity)
+	{
+		elementSize = _elementSize;
+		maxCapacity = _maxCapacity;
+
+		return createBuffer(_capacity);
+	}
+
+	void GL4Vertex2DBatch::PersistentRingBuffer::release()
+	{
+		for (auto& range : inFlight)
+		{
+			::glDeleteSync(range.fence);
+		}
+
+		inFlight.clear();
+
+		if (buffer)
+		{
+			// 永続マップは削除時に解除される
+			::glDeleteBuffers(1, &buffer);
+			buffer = 0;
+		}
+
+		pData = nullptr;
 	}
 
+	uint32 GL4Vertex2DBatch::PersistentRingBuffer::allocate(const uint32 count)
+	{
+		for (;;)
+		{
+			if (uint32 pos = 0;
+				tryAllocate(count, pos))
+			{
+				writePos = (pos + count);
+				frameUsed = true;
+				return pos;
+			}
+
+			if (not inFlight.empty())
+			{
+				waitOldest();
+				continue;
+			}
+
+			// 現在の flush の書き込みだけで一杯になっている
+			if (not grow(count))
+			{
+				return AllocationFailed;
+			}
+		}
+	}
+
+	void GL4Vertex2DBatch::PersistentRingBuffer::endFrame()
+	{
+		// リングが一周する前にフェンスが溜まり続けないようにする
+		retireCompleted();
+
+		if (frameUsed)
+		{
+			inFlight.push_back({ frameBegin, ::glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) });
+		}
+
+		frameBegin = writePos;
+		frameUsed = false;
+	}
+
+	bool GL4Vertex2DBatch::PersistentRingBuffer::tryAllocate(const uint32 count, uint32& pos) const noexcept
+	{
+		if (capacity < count)
+		{
+			return false;
+		}
+
+		// 終端に収まらない場合は先頭に戻る
+		const bool wrap = ((capacity - writePos) < count);
+		pos = (wrap ? 0 : writePos);
+
+		if (inFlight.empty() && (not frameUsed))
+		{
+			return true;
+		}
+
+		// 使用中の範囲は [tail, writePos) で、tail == writePos の場合はすべて使用中
+		const uint32 tail = (inFlight.empty() ? frameBegin : inFlight.front().begin);
+
+		if (wrap)
+		{
+			return ((tail < writePos) && (count <= tail));
+		}
+		else if (writePos < tail)
+		{
+			return (count <= (tail - writePos));
+		}
+		else
+		{
+			return (tail < writePos);
+		}
+	}
+
+	void GL4Vertex2DBatch::PersistentRingBuffer::waitOldest()
+	{
+		const GLsync fence = inFlight.front().fence;
+		inFlight.pop_front();
+
+		constexpr GLuint64 TimeoutNanoseconds = 1'000'000; // 1 ms
+
+		while (true)
+		{
+			const GLenum result = ::glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, TimeoutNanoseconds);
+
+			if ((result == GL_ALREADY_SIGNALED)
+				|| (result == GL_CONDITION_SATISFIED)
+				|| (result == GL_WAIT_FAILED))
+			{
+				break;
+			}
+		}
+
+		::glDeleteSync(fence);
+	}
+
+	void GL4Vertex2DBatch::PersistentRingBuffer::retireCompleted()
+	{
+		while (not inFlight.empty())
+		{
+			const GLsync fence = inFlight.front().fence;
+			const GLenum result = ::glClientWaitSync(fence, 0, 0);
+
+			if ((result != GL_ALREADY_SIGNALED)
+				&& (result != GL_CONDITION_SATISFIED)
+				&& (result != GL_WAIT_FAILED))
+			{
+				break;
+			}
+
+			::glDeleteSync(fence);
+			inFlight.pop_front();
+		}
+	}
+
+	bool GL4Vertex2DBatch::PersistentRingBuffer::grow(const uint32 count)
+	{
+		const uint32 oldCapacity = capacity;
+
+		if ((maxCapacity - oldCapacity) < count)
+		{
+			return false;
+		}
+
+		const uint32 newCapacity = static_cast<uint32>(Min<uint64>(maxCapacity, Max<uint64>((uint64{ oldCapacity } * 2), (uint64{ oldCapacity } + count))));
+		const GLuint oldBuffer = buffer;
+
+		LOG_TRACE(U"ℹ️ Resized GL4Vertex2DBatch::PersistentRingBuffer (capacity: {} -> {})"_fmt(oldCapacity, newCapacity));
+
+		if (not createBuffer(newCapacity))
+		{
+			return false;
+		}
+
+		// 現在の flush で書き込んだ頂点・インデックスの位置を変えないよう、GPU 上で同じ位置にコピーする
+		::glBindBuffer(GL_COPY_READ_BUFFER, oldBuffer);
+		::glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		::glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, (static_cast<GLsizeiptr>(elementSize) * oldCapacity));
+		::glBindBuffer(GL_COPY_READ_BUFFER, 0);
+		::glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+		// 以前の flush の描画が終わるまで、古いバッファは GL によって保持される
+		::glDeleteBuffers(1, &oldBuffer);
+
+		for (auto& range : inFlight)
+		{
+			::glDeleteSync(range.fence);
+		}
+
+		inFlight.clear();
+
+		// 新しいバッファでは [0, oldCapacity) を現在の flush が使用中とみなす
+		frameBegin = 0;
+		writePos = oldCapacity;
+		frameUsed = true;
+		return true;
+	}
+
+	bool GL4Vertex2DBatch::PersistentRingBuffer::createBuffer(const uint32 _capacity)
+	{
+		const GLsizeiptr bufferSize = (static_cast<GLsizeiptr>(elementSize) * _capacity);
+		constexpr GLbitfield Flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+		// VAO の状態を変えないよう、GL_COPY_WRITE_BUFFER に結び付けて作成する
+		GLuint newBuffer = 0;
+		::glGenBuffers(1, &newBuffer);
+		::glBindBuffer(GL_COPY_WRITE_BUFFER, newBuffer);
+		::glBufferStorage(GL_COPY_WRITE_BUFFER, bufferSize, nullptr, Flags);
+		void* const pNewData = ::glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, bufferSize, Flags);
+		::glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+		if (not pNewData)
+		{
+			::glDeleteBuffers(1, &newBuffer);
+			return false;
+		}
+
+		buffer = newBuffer;
+		pData = pNewData;
+		capacity = _capacity;
+		reallocated = true;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	GL4Vertex2DBatch
+	//
+	////////////////////////////////////////////////////////////////
+
 	GL4Vertex2DBatch::GL4Vertex2DBatch()
 		: m_vertexArray(InitialVertexArraySize)
 		, m_indexArray(InitialIndexArraySize)
@@ -40,6 +270,9 @@ namespace s3d
 
 	GL4Vertex2DBatch::~GL4Vertex2DBatch()
 	{
+		m_indexRing.release();
+		m_vertexRing.release();
+
 		if (m_indexBuffer)
 		{
 			::glDeleteBuffers(1, &m_indexBuffer);
@@ -61,38 +294,138 @@ namespace s3d
 
 	bool GL4Vertex2DBatch::init()
 	{
+		m_uint32Index = GLEW_ARB_buffer_storage;
+
 		::glGenVertexArrays(1, &m_vao);
-		::glGenBuffers(1, &m_vertexBuffer);
-		::glGenBuffers(1, &m_indexBuffer);
 
-		::glBindVertexArray(m_vao);
+		if (m_uint32Index)
 		{
+			if ((not m_vertexRing.init(sizeof(Vertex2D), VertexRingSize32, MaxVertexArraySize))
+				|| (not m_indexRing.init(sizeof(uint32), IndexRingSize32, MaxIndexArraySize)))
 			{
-				::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
-				::glBufferData(GL_ARRAY_BUFFER, (sizeof(Vertex2D) * VertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+				return false;
 			}
 
-			{
-				::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)0);	// Vertex2D::pos
-				::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)8);	// Vertex2D::tex
-				::glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)16);	// Vertex2D::color
+			m_vertexRing.reallocated = false;
+			m_indexRing.reallocated = false;
 
-				::glEnableVertexAttribArray(0);
-				::glEnableVertexAttribArray(1);
-				::glEnableVertexAttribArray(2);
-			}
+			// 頂点はリングバッファに直接書き込むため、m_vertexArray は使わない
+			m_vertexArray.release();
 
-			{
-				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
-				::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (sizeof(Vertex2D::IndexType) * IndexBufferSize), nullptr, GL_DYNAMIC_DRAW);
-			}
+			attachBuffers(m_vertexRing.buffer, m_indexRing.buffer);
+		}
+		else
+		{
+			::glGenBuffers(1, &m_vertexBuffer);
+			::glGenBuffers(1, &m_indexBuffer);
+
+			::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+			::glBufferData(GL_ARRAY_BUFFER, (sizeof(Vertex2D) * VertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+
+			attachBuffers(m_vertexBuffer, m_indexBuffer);
+
+			::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+			::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (sizeof(Vertex2D::IndexType) * IndexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+			::glBindVertexArray(0);
 		}
-		::glBindVertexArray(0);
+
+		LOG_INFO(U"ℹ️ GL4Vertex2DBatch: {}-bit index buffer"_fmt(m_uint32Index ? 32 : 16));
 
 		return true;
 	}
 
 	Vertex2DBufferPointer GL4Vertex2DBatch::requestBuffer(const uint16 vertexSize, const uint32 indexSize, GL4Renderer2DCommandManager& commandManager)
+	{
+		if (m_uint32Index)
+		{
+			return requestBuffer32(vertexSize, indexSize, commandManager);
+		}
+		else
+		{
+			return requestBuffer16(vertexSize, indexSize, commandManager);
+		}
+	}
+
+	size_t GL4Vertex2DBatch::num_batches() const noexcept
+	{
+		return m_batches.size();
+	}
+
+	void GL4Vertex2DBatch::reset()
+	{
+		m_batches.clear();
+		m_batches.emplace_back();
+
+		m_vertexArrayWritePos = 0;
+		m_indexArrayWritePos = 0;
+		m_pendingIndices = {};
+
+		if (m_uint32Index)
+		{
+			// この flush の描画コマンドはすべて発行済み
+			m_vertexRing.endFrame();
+			m_indexRing.endFrame();
+		}
+	}
+
+	void GL4Vertex2DBatch::setBuffers()
+	{
+		::glBindVertexArray(m_vao);
+		::glBindBuffer(GL_ARRAY_BUFFER, (m_uint32Index ? m_vertexRing.buffer : m_vertexBuffer));
+	}
+
+	BatchInfo2D GL4Vertex2DBatch::updateBuffers(const size_t batchIndex)
+	{
+		assert(batchIndex < m_batches.size());
+
+		::glBindVertexArray(m_vao);
+
+		if (m_uint32Index)
+		{
+			return updateBuffers32(m_batches[batchIndex]);
+		}
+		else
+		{
+			::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+			return updateBuffers16(m_batches[batchIndex]);
+		}
+	}
+
+	GLenum GL4Vertex2DBatch::getIndexType() const noexcept
+	{
+		return (m_uint32Index ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT);
+	}
+
+	uint32 GL4Vertex2DBatch::getIndexSize() const noexcept
+	{
+		return (m_uint32Index ? sizeof(uint32) : sizeof(Vertex2D::IndexType));
+	}
+
+	void GL4Vertex2DBatch::advanceArrayWritePos(const uint32 vertexSize, const uint32 indexSize) noexcept
+	{
+		m_vertexArrayWritePos	+= vertexSize;
+		m_indexArrayWritePos	+= indexSize;
+	}
+
+	void GL4Vertex2DBatch::attachBuffers(const GLuint vertexBuffer, const GLuint indexBuffer)
+	{
+		::glBindVertexArray(m_vao);
+		{
+			::glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+
+			::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)0);	// Vertex2D::pos
+			::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)8);	// Vertex2D::tex
+			::glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)16);	// Vertex2D::color
+
+			::glEnableVertexAttribArray(0);
+			::glEnableVertexAttribArray(1);
+			::glEnableVertexAttribArray(2);
+
+			::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+		}
+	}
+
+	Vertex2DBufferPointer GL4Vertex2DBatch::requestBuffer16(const uint16 vertexSize, const uint32 indexSize, GL4Renderer2DCommandManager& commandManager)
 	{
 		// VB
 		if (const uint32 vertexArrayWritePosTarget = m_vertexArrayWritePos + vertexSize;
@@ -126,13 +459,13 @@ namespace s3d
 			(VertexBufferSize < (lastbatch.vertexPos + vertexSize) || IndexBufferSize < (lastbatch.indexPos + indexSize)))
 		{
 			commandManager.pushUpdateBuffers(static_cast<uint32>(m_batches.size()));
-			m_batches.emplace_back();
+			m_batches.push_back({ m_vertexArrayWritePos, m_indexArrayWritePos });
 		}
 
 		auto& lastbatch = m_batches.back();
 		Vertex2D* const pVertex = (m_vertexArray.data() + m_vertexArrayWritePos);
 		Vertex2D::IndexType* const pIndex = (m_indexArray.data() + m_indexArrayWritePos);
-		const auto indexOffset = lastbatch.vertexPos;
+		const auto indexOffset = static_cast<Vertex2D::IndexType>(lastbatch.vertexPos);
 
 		advanceArrayWritePos(vertexSize, indexSize);
 		lastbatch.advance(vertexSize, indexSize);
@@ -140,49 +473,83 @@ namespace s3d
 		return{ pVertex, pIndex, indexOffset };
 	}
 
-	size_t GL4Vertex2DBatch::num_batches() const noexcept
+	Vertex2DBufferPointer GL4Vertex2DBatch::requestBuffer32(const uint16 vertexSize, const uint32 indexSize, GL4Renderer2DCommandManager& commandManager)
 	{
-		return m_batches.size();
-	}
+		// 前回の要求で書き込まれた 16-bit のインデックスをリングバッファに書き込み、m_indexArray を空ける
+		commitPendingIndices();
 
-	void GL4Vertex2DBatch::reset()
-	{
-		m_batches.clear();
-		m_batches.emplace_back();
+		// 16-bit のインデックスの書き込み先
+		if (m_indexArray.size() < indexSize) SIV3D_UNLIKELY
+		{
+			if (MaxIndexArraySize < indexSize) SIV3D_UNLIKELY
+			{
+				return{ nullptr, 0, 0 };
+			}
 
-		m_vertexArrayWritePos = 0;
-		m_indexArrayWritePos = 0;
-	}
+			const size_t newIndexArraySize = detail::CalculateNewArraySize(m_indexArray.size(), indexSize);
+			LOG_TRACE(U"ℹ️ Resized GL4Vertex2DBatch::m_indexArray (size: {} -> {})"_fmt(m_indexArray.size(), newIndexArraySize));
+			m_indexArray.resize(newIndexArraySize);
+		}
 
-	void GL4Vertex2DBatch::setBuffers()
-	{
-		::glBindVertexArray(m_vao);
-		::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
-	}
+		const uint32 vertexPos = m_vertexRing.allocate(vertexSize);
 
-	BatchInfo2D GL4Vertex2DBatch::updateBuffers(const size_t batchIndex)
-	{
-		assert(batchIndex < m_batches.size());
+		if (vertexPos == PersistentRingBuffer::AllocationFailed) SIV3D_UNLIKELY
+		{
+			return{ nullptr, 0, 0 };
+		}
 
-		size_t vertexArrayReadPos = 0;
-		size_t indexArrayReadPos = 0;
+		const uint32 indexPos = m_indexRing.allocate(indexSize);
 
-		for (size_t i = 0; i < batchIndex; ++i)
+		if (indexPos == PersistentRingBuffer::AllocationFailed) SIV3D_UNLIKELY
 		{
-			vertexArrayReadPos += m_batches[i].vertexPos;
-			indexArrayReadPos += m_batches[i].indexPos;
+			return{ nullptr, 0, 0 };
 		}
 
-		::glBindVertexArray(m_vao);
-		::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+		if (auto& lastbatch = m_batches.back();
+			(lastbatch.vertexPos == 0) && (lastbatch.indexPos == 0))
+		{
+			lastbatch.vertexArrayPos = vertexPos;
+			lastbatch.indexArrayPos = indexPos;
+		}
+		else if (((lastbatch.vertexArrayPos + lastbatch.vertexPos) != vertexPos) // リングバッファの先頭に戻った
+			|| ((lastbatch.indexArrayPos + lastbatch.indexPos) != indexPos)
+			|| (VertexBufferSize32 < (lastbatch.vertexPos + vertexSize))
+			|| (IndexBufferSize32 < (lastbatch.indexPos + indexSize)))
+		{
+			commandManager.pushUpdateBuffers(static_cast<uint32>(m_batches.size()));
+			m_batches.push_back({ vertexPos, indexPos });
+		}
 
+		auto& lastbatch = m_batches.back();
+
+		// 16-bit のインデックスを書き込んでもらい、次の要求時にバッチ内での頂点の位置を加えて 32-bit に変換する
+		m_pendingIndices = { indexPos, indexSize, (vertexPos - lastbatch.vertexArrayPos) };
+
+		lastbatch.advance(vertexSize, indexSize);
+
+		return{ (static_cast<Vertex2D*>(m_vertexRing.pData) + vertexPos), m_indexArray.data(), 0 };
+	}
+
+	void GL4Vertex2DBatch::commitPendingIndices()
+	{
+		if (const auto& pending = m_pendingIndices;
+			pending.indexSize)
+		{
+			detail::WidenIndices((static_cast<uint32*>(m_indexRing.pData) + pending.indexArrayPos),
+				m_indexArray.data(), pending.indexSize, pending.baseVertex);
+		}
+
+		m_pendingIndices = {};
+	}
+
+	BatchInfo2D GL4Vertex2DBatch::updateBuffers16(const BatchBufferPos& batch)
+	{
 		BatchInfo2D batchInfo;
-		const auto& currentBatch = m_batches[batchIndex];
 
 		// VB
-		if (const uint16 vertexSize = currentBatch.vertexPos)
+		if (const uint32 vertexSize = batch.vertexPos)
 		{
-			const Vertex2D* pSrc = &m_vertexArray[vertexArrayReadPos];
+			const Vertex2D* pSrc = &m_vertexArray[batch.vertexArrayPos];
 
 			if (VertexBufferSize < (m_vertexBufferWritePos + vertexSize))
 			{
@@ -202,9 +569,9 @@ namespace s3d
 		}
 
 		// IB
-		if (const uint32 indexSize = currentBatch.indexPos)
+		if (const uint32 indexSize = batch.indexPos)
 		{
-			const Vertex2D::IndexType* pSrc = &m_indexArray[indexArrayReadPos];
+			const Vertex2D::IndexType* pSrc = &m_indexArray[batch.indexArrayPos];
 
 			if (IndexBufferSize < (m_indexBufferWritePos + indexSize))
 			{
@@ -227,9 +594,23 @@ namespace s3d
 		return batchInfo;
 	}
 
-	void GL4Vertex2DBatch::advanceArrayWritePos(const uint16 vertexSize, const uint32 indexSize) noexcept
+	BatchInfo2D GL4Vertex2DBatch::updateBuffers32(const BatchBufferPos& batch)
 	{
-		m_vertexArrayWritePos	+= vertexSize;
-		m_indexArrayWritePos	+= indexSize;
+		commitPendingIndices();
+
+		// 容量を増やしたリングバッファを VAO に結び付け直す
+		if (m_vertexRing.reallocated || m_indexRing.reallocated)
+		{
+			attachBuffers(m_vertexRing.buffer, m_indexRing.buffer);
+			m_vertexRing.reallocated = false;
+			m_indexRing.reallocated = false;
+		}
+
+		// 頂点・インデックスは永続マップされたバッファに書き込み済み
+		BatchInfo2D batchInfo;
+		batchInfo.indexCount = batch.indexPos;
+		batchInfo.startIndexLocation = batch.indexArrayPos;
+		batchInfo.baseVertexLocation = batch.vertexArrayPos;
+		return batchInfo;
 	}
 }
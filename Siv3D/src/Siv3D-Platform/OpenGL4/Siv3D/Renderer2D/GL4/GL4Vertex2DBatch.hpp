@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <deque>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Common/OpenGL.hpp>
 # include <Siv3D/Vertex2D.hpp>
@@ -26,17 +27,94 @@ namespace s3d
 
 		struct BatchBufferPos
 		{
-			uint16 vertexPos = 0;
+			/// @brief バッチの先頭の頂点の位置（16-bit インデックスモードでは m_vertexArray 上、32-bit インデックスモードでは m_vertexRing 上）
+			uint32 vertexArrayPos = 0;
+
+			/// @brief バッチの先頭のインデックスの位置（16-bit インデックスモードでは m_indexArray 上、32-bit インデックスモードでは m_indexRing 上）
+			uint32 indexArrayPos = 0;
+
+			uint32 vertexPos = 0;
 
 			uint32 indexPos = 0;
 
-			void advance(uint16 vertexSize, uint32 indexSize) noexcept
+			void advance(uint32 vertexSize, uint32 indexSize) noexcept
 			{
 				vertexPos += vertexSize;
 				indexPos += indexSize;
 			}
 		};
 
+		/// @brief 永続マップされたリングバッファ
+		/// @remark 頂点・インデックスは描画コマンドの発行より前に書き込まれるため、flush 1 回分の書き込みをまとめて 1 つの範囲とし、flush の後にフェンスを置きます。
+		/// 書き込み先が以前の範囲と重なるときは、そのフェンスを待ちます。flush 1 回分の書き込みが収まらないときは容量を増やします。
+		struct PersistentRingBuffer
+		{
+			static constexpr uint32 AllocationFailed = UINT32_MAX;
+
+			GLuint buffer = 0;
+
+			void* pData = nullptr;
+
+			uint32 elementSize = 0;
+
+			uint32 capacity = 0;
+
+			uint32 maxCapacity = 0;
+
+			uint32 writePos = 0;
+
+			/// @brief 現在の flush で書き込みを始めた位置
+			uint32 frameBegin = 0;
+
+			/// @brief 現在の flush で書き込んだか
+			bool frameUsed = false;
+
+			/// @brief バッファを作り直したか（VAO に設定し直す必要がある）
+			bool reallocated = false;
+
+			struct InFlightRange
+			{
+				/// @brief 範囲の先頭の位置。範囲の終端は次の範囲の先頭（無い場合は frameBegin）
+				uint32 begin = 0;
+
+				GLsync fence = nullptr;
+			};
+
+			/// @brief GPU が読み込んでいる可能性がある、以前の flush で書き込んだ範囲（古い順）
+			std::deque<InFlightRange> inFlight;
+
+			[[nodiscard]]
+			bool init(uint32 _elementSize, uint32 _capacity, uint32 _maxCapacity);
+
+			void release();
+
+			/// @brief count 個の要素を書き込む連続した領域を確保します。
+			/// @return 確保した領域の先頭の位置（要素単位）。確保できなかった場合は AllocationFailed
+			[[nodiscard]]
+			uint32 allocate(uint32 count);
+
+			/// @brief 現在の flush で書き込んだ範囲にフェンスを置きます。
+			/// @remark 現在の flush の描画コマンドがすべて発行された後に呼びます。
+			void endFrame();
+
+		private:
+
+			[[nodiscard]]
+			bool tryAllocate(uint32 count, uint32& pos) const noexcept;
+
+			void waitOldest();
+
+			/// @brief GPU が読み終えた範囲のフェンスを、古い順に待たずに削除します。
+			void retireCompleted();
+
+			/// @brief 容量を増やします。現在の内容は同じ位置にコピーされます。
+			[[nodiscard]]
+			bool grow(uint32 count);
+
+			[[nodiscard]]
+			bool createBuffer(uint32 _capacity);
+		};
+
 		GLuint m_vao = 0;
 
 		GLuint m_vertexBuffer = 0;
@@ -51,8 +129,25 @@ namespace s3d
 		Array<Vertex2D::IndexType> m_indexArray;
 		uint32 m_indexArrayWritePos = 0;
 
+		/// @brief 32-bit インデックスモードで、まだ m_indexRing に変換して書き込んでいないインデックスの数と書き込み先、加える頂点の位置
+		/// @remark 変換前のインデックスは m_indexArray の先頭に置かれます。
+		struct PendingIndices
+		{
+			uint32 indexArrayPos = 0;
+
+			uint32 indexSize = 0;
+
+			uint32 baseVertex = 0;
+		} m_pendingIndices;
+
 		Array<BatchBufferPos> m_batches;
 
+		PersistentRingBuffer m_vertexRing;
+
+		PersistentRingBuffer m_indexRing;
+
+		bool m_uint32Index = false;
+
 		static constexpr uint32 InitialVertexArraySize	= 4096;
 		static constexpr uint32 InitialIndexArraySize	= (4096 * 8); // 32,768
 
@@ -62,7 +157,35 @@ namespace s3d
 		static constexpr uint32 VertexBufferSize		= 65535;// 65,535;
 		static constexpr uint32 IndexBufferSize			= ((VertexBufferSize + 1) * 4); // 524,288
 
-		void advanceArrayWritePos(uint16 vertexSize, uint32 indexSize) noexcept;
+		/// @brief 32-bit インデックスモードでの、1 バッチあたりの最大頂点数
+		static constexpr uint32 VertexBufferSize32		= (65536 * 4); // 262,144
+
+		/// @brief 32-bit インデックスモードでの、1 バッチあたりの最大インデックス数
+		static constexpr uint32 IndexBufferSize32		= (VertexBufferSize32 * 4); // 1,048,576
+
+		/// @brief 32-bit インデックスモードでの、頂点のリングバッファの初期容量
+		static constexpr uint32 VertexRingSize32		= (VertexBufferSize32 * 3); // 786,432
+
+		/// @brief 32-bit インデックスモードでの、インデックスのリングバッファの初期容量
+		static constexpr uint32 IndexRingSize32			= (IndexBufferSize32 * 3); // 3,145,728
+
+		void advanceArrayWritePos(uint32 vertexSize, uint32 indexSize) noexcept;
+
+		void attachBuffers(GLuint vertexBuffer, GLuint indexBuffer);
+
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer16(uint16 vertexSize, uint32 indexSize, GL4Renderer2DCommandManager& commandManager);
+
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer32(uint16 vertexSize, uint32 indexSize, GL4Renderer2DCommandManager& commandManager);
+
+		void commitPendingIndices();
+
+		[[nodiscard]]
+		BatchInfo2D updateBuffers16(const BatchBufferPos& batch);
+
+		[[nodiscard]]
+		BatchInfo2D updateBuffers32(const BatchBufferPos& batch);
 
 	public:
 
@@ -70,6 +193,8 @@ namespace s3d
 
 		~GL4Vertex2DBatch();
 
+		/// @brief 頂点バッファ・インデックスバッファを作成します。
+		/// @remark GL_ARB_buffer_storage が利用可能な場合は 32-bit インデックスと永続マップされたリングバッファを使い、1 バッチあたりの頂点数の上限を 65,535 から引き上げます。
 		[[nodiscard]]
 		bool init();
 
@@ -85,5 +210,14 @@ namespace s3d
 
 		[[nodiscard]]
 		BatchInfo2D updateBuffers(size_t batchIndex);
+
+		/// @brief インデックスバッファの要素の型を返します。
+		/// @return GL_UNSIGNED_INT または GL_UNSIGNED_SHORT
+		[[nodiscard]]
+		GLenum getIndexType() const noexcept;
+
+		/// @brief インデックスバッファの要素のサイズ（バイト）を返します。
+		[[nodiscard]]
+		uint32 getIndexSize() const noexcept;
 	};
 }
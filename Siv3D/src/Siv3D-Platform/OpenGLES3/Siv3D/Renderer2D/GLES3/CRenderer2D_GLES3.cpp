@@ -13,6 +13,7 @@
 # include <Siv3D/Error.hpp>
 # include <Siv3D/Resource.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/ScopeGuard.hpp>
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/ShaderCommon.hpp>
@@ -595,8 +596,15 @@ namespace s3d
 
 	void CRenderer2D_GLES3::addPolygon(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		for (size_t offset = 0; offset < num_triangles;)
 		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, (indices + offset), (num_triangles - offset));
+
+			if (built == 0)
+			{
+				return;
+			}
+
 			if (not m_currentCustomVS)
 			{
 				m_commandManager.pushStandardVS(m_standardVS->spriteID);
@@ -608,6 +616,7 @@ namespace s3d
 			}
 
 			m_commandManager.pushDraw(indexCount);
+			offset += built;
 		}
 	}
 
@@ -754,8 +763,15 @@ namespace s3d
 
 	void CRenderer2D_GLES3::addTexturedVertices(const Texture& texture, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		if (const auto indexCount = Vertex2DBuilder::BuildTexturedVertices(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		for (size_t offset = 0; offset < num_triangles;)
 		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildTexturedVertices(m_bufferCreator, vertices, vertexCount, (indices + offset), (num_triangles - offset));
+
+			if (built == 0)
+			{
+				return;
+			}
+
 			if (not m_currentCustomVS)
 			{
 				m_commandManager.pushStandardVS(m_standardVS->spriteID);
@@ -768,6 +784,7 @@ namespace s3d
 
 			m_commandManager.pushPSTexture(0, texture);
 			m_commandManager.pushDraw(indexCount);
+			offset += built;
 		}
 	}
 
@@ -828,7 +845,7 @@ namespace s3d
 		}
 	}
 
-	void CRenderer2D_GLES3::addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
+	void CRenderer2D_GLES3::addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
 		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
 	{
@@ -849,6 +866,87 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_GLES3::addCircles(const Circle* circles, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		const float scale = getMaxScaling();
+
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildCircles(m_bufferCreator, (circles + offset), (count - offset), (colors ? (colors + offset) : nullptr), color, scale);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_GLES3::addRects(const RectF* rects, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildRects(m_bufferCreator, (rects + offset), (count - offset), (colors ? (colors + offset) : nullptr), color);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_GLES3::addTexturedQuads(const Texture& texture, const Quad* quads, const size_t count, const RectF* uvRects, const Float4& color)
+	{
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildTexturedQuads(m_bufferCreator, (quads + offset), (count - offset), (uvRects ? (uvRects + offset) : nullptr), color);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
 	Float4 CRenderer2D_GLES3::getColorMul() const
 	{
 		return m_commandManager.getCurrentColorMul();
@@ -1090,6 +1188,8 @@ namespace s3d
 
 	void CRenderer2D_GLES3::flush()
 	{
+		const ProfilerZone profilerZone{ U"Renderer2D::flush" };
+
 		GLES3Vertex2DBatch& batch = m_batches[m_drawCount % 2];
 
 		ScopeGuard cleanUp = [this, &batch]()
@@ -200,10 +200,16 @@ namespace s3d
 
 		void addRoundRectShadow(const RoundRect& roundRect, float blur, const Float4& color, bool fill) override;
 
-		void addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
+		void addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
 			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) override;
 
+		void addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color) override;
+
+		void addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color) override;
+
+		void addTexturedQuads(const Texture& texture, const Quad* quads, size_t count, const RectF* uvRects, const Float4& color) override;
+
 
 		Float4 getColorMul() const override;
 
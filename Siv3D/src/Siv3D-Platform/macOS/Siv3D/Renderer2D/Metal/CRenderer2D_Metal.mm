@@ -13,6 +13,7 @@
 # include <Siv3D/Error.hpp>
 # include <Siv3D/Resource.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/ScopeGuard.hpp>
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/ShaderCommon.hpp>
@@ -574,8 +575,15 @@ namespace s3d
 
 	void CRenderer2D_Metal::addPolygon(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		for (size_t offset = 0; offset < num_triangles;)
 		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, (indices + offset), (num_triangles - offset));
+
+			if (built == 0)
+			{
+				return;
+			}
+
 			if (not m_currentCustomVS)
 			{
 				m_commandManager.pushStandardVS(m_standardVS->spriteID);
@@ -587,6 +595,7 @@ namespace s3d
 			}
 			
 			m_commandManager.pushDraw(indexCount);
+			offset += built;
 		}
 	}
 
@@ -681,13 +690,78 @@ namespace s3d
 
 	}
 
-	void CRenderer2D_Metal::addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
+	void CRenderer2D_Metal::addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
 		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
 	{
 
 	}
 
+	void CRenderer2D_Metal::addCircles(const Circle* circles, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		const float scale = getMaxScaling();
+
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildCircles(m_bufferCreator, (circles + offset), (count - offset), (colors ? (colors + offset) : nullptr), color, scale);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_Metal::addRects(const RectF* rects, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildRects(m_bufferCreator, (rects + offset), (count - offset), (colors ? (colors + offset) : nullptr), color);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_Metal::addTexturedQuads(const Texture& texture, const Quad* quads, const size_t count, const RectF* uvRects, const Float4& color)
+	{
+		// Metal 版はテクスチャの描画コマンドを持たないため、addTexturedQuad() と同じ結果になるよう 1 つずつ渡す
+		for (size_t i = 0; i < count; ++i)
+		{
+			const FloatRect uv = (uvRects ? FloatRect{ uvRects[i].x, uvRects[i].y, (uvRects[i].x + uvRects[i].w), (uvRects[i].y + uvRects[i].h) } : FloatRect{ 0.0f, 0.0f, 1.0f, 1.0f });
+
+			addTexturedQuad(texture, FloatQuad{ quads[i] }, uv, color);
+		}
+	}
+
 
 	Float4 CRenderer2D_Metal::getColorMul() const
 	{
@@ -884,6 +958,8 @@ namespace s3d
 
 	void CRenderer2D_Metal::flush(id<MTLCommandBuffer> commandBuffer)
 	{
+		const ProfilerZone profilerZone{ U"Renderer2D::flush" };
+
 		ScopeGuard cleanUp = [this]()
 		{
 			m_commandManager.reset();
@@ -0,0 +1,294 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <algorithm>
+# include <exception>
+# include <Siv3D/Duration.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+# include "AssetLoaderPool.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static size_t GetDefaultMaxWorkers() noexcept
+		{
+			// ロードはファイル I/O が中心なので、少数のスレッドで十分
+			const size_t concurrency = Threading::GetConcurrency();
+
+			return Clamp<size_t>((concurrency / 2), 1, 4);
+		}
+	}
+
+	AssetLoaderPool::AssetLoaderPool()
+		: m_maxWorkers{ detail::GetDefaultMaxWorkers() } {}
+
+	AssetLoaderPool::~AssetLoaderPool()
+	{
+		shutdown();
+	}
+
+	std::future<void> AssetLoaderPool::submit(const IAsset* asset, const int32 priority, std::function<void()> task, std::function<void()> onCancel)
+	{
+		std::future<void> future;
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			Job job;
+			job.asset = asset;
+			job.priority = priority;
+			job.sequence = m_sequence++;
+			job.task = std::move(task);
+			job.onCancel = std::move(onCancel);
+			future = job.promise.get_future();
+
+			m_jobs.push_back(std::move(job));
+			std::push_heap(m_jobs.begin(), m_jobs.end(), Less);
+
+			// 空いているワーカーがいなければ、上限までスレッドを増やす
+			if ((m_idleCount == 0) && (m_threads.size() < m_maxWorkers))
+			{
+				m_threads.emplace_back(&AssetLoaderPool::workerMain, this);
+
+				LOG_TRACE(U"AssetLoaderPool: Worker thread #{} started"_fmt(m_threads.size()));
+
+				SIV3D_ENGINE(AssetMonitor)->asyncLoadWorkerStarted(m_threads.size());
+			}
+		}
+
+		m_condition.notify_one();
+
+		return future;
+	}
+
+	bool AssetLoaderPool::cancel(const IAsset* asset)
+	{
+		Job job;
+
+		if (not takeJob(asset, job))
+		{
+			return false;
+		}
+
+		if (job.onCancel)
+		{
+			job.onCancel();
+		}
+
+		job.promise.set_value();
+
+		SIV3D_ENGINE(AssetMonitor)->asyncLoadCancelled();
+
+		return true;
+	}
+
+	void AssetLoaderPool::cancelAll()
+	{
+		Array<Job> jobs;
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			jobs.swap(m_jobs);
+		}
+
+		for (auto& job : jobs)
+		{
+			if (job.onCancel)
+			{
+				job.onCancel();
+			}
+
+			job.promise.set_value();
+
+			SIV3D_ENGINE(AssetMonitor)->asyncLoadCancelled();
+		}
+	}
+
+	bool AssetLoaderPool::runNow(const IAsset* asset)
+	{
+		Job job;
+
+		if (not takeJob(asset, job))
+		{
+			return false;
+		}
+
+		Run(job);
+
+		return true;
+	}
+
+	void AssetLoaderPool::setMaxWorkers(const size_t maxWorkers)
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_maxWorkers = Max<size_t>(maxWorkers, 1);
+
+			// 上限が増えた場合、待機中のジョブを実行するスレッドを追加する
+			while ((m_threads.size() < m_maxWorkers)
+				&& (m_threads.size() < (m_runningCount + m_jobs.size())))
+			{
+				m_threads.emplace_back(&AssetLoaderPool::workerMain, this);
+
+				SIV3D_ENGINE(AssetMonitor)->asyncLoadWorkerStarted(m_threads.size());
+			}
+		}
+
+		m_condition.notify_all();
+	}
+
+	size_t AssetLoaderPool::getMaxWorkers() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_maxWorkers;
+	}
+
+	size_t AssetLoaderPool::getWorkerCount() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_threads.size();
+	}
+
+	size_t AssetLoaderPool::getRunningCount() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_runningCount;
+	}
+
+	size_t AssetLoaderPool::getPendingCount() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_jobs.size();
+	}
+
+	void AssetLoaderPool::shutdown()
+	{
+		cancelAll();
+
+		Array<std::thread> threads;
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_abort = true;
+
+			threads.swap(m_threads);
+		}
+
+		m_condition.notify_all();
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	bool AssetLoaderPool::Less(const Job& a, const Job& b) noexcept
+	{
+		if (a.priority != b.priority)
+		{
+			return (a.priority < b.priority);
+		}
+
+		return (b.sequence < a.sequence);
+	}
+
+	bool AssetLoaderPool::takeJob(const IAsset* asset, Job& job)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		const auto it = std::find_if(m_jobs.begin(), m_jobs.end(), [asset](const Job& j) { return (j.asset == asset); });
+
+		if (it == m_jobs.end())
+		{
+			return false;
+		}
+
+		job = std::move(*it);
+		m_jobs.erase(it);
+		std::make_heap(m_jobs.begin(), m_jobs.end(), Less);
+
+		return true;
+	}
+
+	void AssetLoaderPool::Run(Job& job)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		try
+		{
+			job.task();
+
+			job.promise.set_value();
+		}
+		catch (...)
+		{
+			LOG_ERROR(U"✖ AssetLoaderPool: a load task threw an exception");
+
+			// 例外は future を待っている側で再送出される
+			job.promise.set_exception(std::current_exception());
+		}
+
+		SIV3D_ENGINE(AssetMonitor)->asyncLoadCompleted(std::chrono::duration_cast<Duration>(std::chrono::steady_clock::now() - start));
+	}
+
+	void AssetLoaderPool::workerMain()
+	{
+		for (;;)
+		{
+			Job job;
+
+			{
+				std::unique_lock lock{ m_mutex };
+
+				++m_idleCount;
+
+				m_condition.wait(lock, [this]() { return (m_abort || ((not m_jobs.isEmpty()) && (m_runningCount < m_maxWorkers))); });
+
+				--m_idleCount;
+
+				if (m_abort)
+				{
+					return;
+				}
+
+				std::pop_heap(m_jobs.begin(), m_jobs.end(), Less);
+				job = std::move(m_jobs.back());
+				m_jobs.pop_back();
+
+				++m_runningCount;
+			}
+
+			Run(job);
+
+			{
+				std::lock_guard lock{ m_mutex };
+
+				--m_runningCount;
+			}
+
+			// 同時実行数の上限で待機していたワーカーを起こす
+			m_condition.notify_one();
+		}
+	}
+}
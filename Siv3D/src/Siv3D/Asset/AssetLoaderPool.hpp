@@ -0,0 +1,122 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <condition_variable>
+# include <future>
+# include <mutex>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Asset.hpp>
+
+namespace s3d
+{
+	/// @brief アセットの非同期ロードを実行する、スレッド数に上限のあるワーカープール
+	/// @remark ワーカースレッドは必要になったときに上限まで作成され、優先度の高いジョブから順に実行します。
+	class AssetLoaderPool
+	{
+	public:
+
+		AssetLoaderPool();
+
+		~AssetLoaderPool();
+
+		/// @brief ロードジョブを投入します。
+		/// @param asset ジョブを識別するアセット
+		/// @param priority 優先度。大きいほど先に実行されます。
+		/// @param task ワーカースレッドで実行する関数
+		/// @param onCancel 実行前にキャンセルされた場合に呼ばれる関数
+		/// @return ジョブの完了（またはキャンセル）を待つための future。task が例外を送出した場合、その例外は future から再送出されます。
+		[[nodiscard]]
+		std::future<void> submit(const IAsset* asset, int32 priority, std::function<void()> task, std::function<void()> onCancel);
+
+		/// @brief まだ実行されていないジョブをキャンセルします。
+		/// @param asset アセット
+		/// @return キャンセルできた場合 true, ジョブが存在しないか実行中の場合は false
+		bool cancel(const IAsset* asset);
+
+		/// @brief まだ実行されていないジョブをすべてキャンセルします。
+		void cancelAll();
+
+		/// @brief まだ実行されていないジョブを、呼び出したスレッドで直ちに実行します。
+		/// @param asset アセット
+		/// @return ジョブを実行した場合 true, ジョブが存在しないか実行中の場合は false
+		bool runNow(const IAsset* asset);
+
+		/// @brief 同時にロードを実行するワーカースレッドの最大数を設定します。
+		/// @param maxWorkers ワーカースレッドの最大数
+		void setMaxWorkers(size_t maxWorkers);
+
+		[[nodiscard]]
+		size_t getMaxWorkers() const;
+
+		[[nodiscard]]
+		size_t getWorkerCount() const;
+
+		[[nodiscard]]
+		size_t getRunningCount() const;
+
+		[[nodiscard]]
+		size_t getPendingCount() const;
+
+		/// @brief すべてのジョブをキャンセルし、ワーカースレッドを終了します。
+		void shutdown();
+
+	private:
+
+		struct Job
+		{
+			const IAsset* asset = nullptr;
+
+			int32 priority = 0;
+
+			uint64 sequence = 0;
+
+			std::function<void()> task;
+
+			std::function<void()> onCancel;
+
+			std::promise<void> promise;
+		};
+
+		/// @brief 優先度が高く、先に投入されたジョブがヒープの先頭に来るようにする比較関数
+		[[nodiscard]]
+		static bool Less(const Job& a, const Job& b) noexcept;
+
+		mutable std::mutex m_mutex;
+
+		std::condition_variable m_condition;
+
+		/// @brief 実行待ちのジョブ（Less による最大ヒープ）
+		Array<Job> m_jobs;
+
+		Array<std::thread> m_threads;
+
+		size_t m_maxWorkers = 1;
+
+		size_t m_idleCount = 0;
+
+		size_t m_runningCount = 0;
+
+		uint64 m_sequence = 0;
+
+		bool m_abort = false;
+
+		[[nodiscard]]
+		bool takeJob(const IAsset* asset, Job& job);
+
+		static void Run(Job& job);
+
+		void workerMain();
+	};
+}
@@ -11,6 +11,7 @@
 
 # include "CAsset.hpp"
 # include <Siv3D/Texture/ITexture.hpp>
+# include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/EngineLog.hpp>
 
@@ -45,6 +46,9 @@ namespace s3d
 	{
 		LOG_SCOPED_TRACE(U"CAsset::~CAsset()");
 
+		// まだ開始していないロードは実行しない
+		m_loaderPool.cancelAll();
+
 		SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(Largest<size_t>);
 
 		// wait for all
@@ -55,11 +59,13 @@ namespace s3d
 				asset.second->wait();
 			}
 		}
+
+		m_loaderPool.shutdown();
 	}
 
 	void CAsset::update()
 	{
-		SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(4);
+		SIV3D_ENGINE(Texture)->updateAsyncTextureLoad(m_uploadBudget);
 	}
 
 	bool CAsset::registerAsset(const AssetType assetType, const AssetNameView name, std::unique_ptr<IAsset>&& asset)
@@ -127,7 +133,7 @@ namespace s3d
 		return it->second->load(String{ hint });
 	}
 
-	void CAsset::loadAsync(const AssetType assetType, const AssetNameView name, const StringView hint)
+	void CAsset::loadAsync(const AssetType assetType, const AssetNameView name, const StringView hint, const int32 priority)
 	{
 		auto& assetList = m_assetLists[FromEnum(assetType)];
 		const auto it = assetList.find(name);
@@ -138,9 +144,31 @@ namespace s3d
 			return;
 		}
 
+		it->second->setLoadPriority(priority);
+
 		it->second->loadAsync(String{ hint });
 	}
 
+	bool CAsset::cancelLoadAsync(const AssetType assetType, const AssetNameView name)
+	{
+		auto& assetList = m_assetLists[FromEnum(assetType)];
+		const auto it = assetList.find(name);
+
+		if (it == assetList.end())
+		{
+			return false;
+		}
+
+		if (not cancelAsyncLoad(*it->second))
+		{
+			return false;
+		}
+
+		LOG_TRACE(U"ℹ️ {}Asset: Async loading of `{}` cancelled"_fmt(detail::GetAssetTypeName(assetType), name));
+
+		return true;
+	}
+
 	void CAsset::wait(const AssetType assetType, const AssetNameView name)
 	{
 		auto& assetList = m_assetLists[FromEnum(assetType)];
@@ -244,4 +272,84 @@ namespace s3d
 
 		return result;
 	}
+
+	std::future<void> CAsset::submitAsyncLoad(const IAsset& asset, std::function<void()> task, std::function<void()> onCancel)
+	{
+		return m_loaderPool.submit(&asset, asset.getLoadPriority(), std::move(task), std::move(onCancel));
+	}
+
+	bool CAsset::cancelAsyncLoad(const IAsset& asset)
+	{
+		return m_loaderPool.cancel(&asset);
+	}
+
+	void CAsset::runPendingAsyncLoad(const IAsset& asset)
+	{
+		m_loaderPool.runNow(&asset);
+	}
+
+	void CAsset::setMaxLoaderWorkers(const size_t maxWorkers)
+	{
+		m_loaderPool.setMaxWorkers(maxWorkers);
+	}
+
+	size_t CAsset::getMaxLoaderWorkers()
+	{
+		return m_loaderPool.getMaxWorkers();
+	}
+
+	void CAsset::setUploadBudget(const size_t count)
+	{
+		m_uploadBudget = Max<size_t>(count, 1);
+	}
+
+	size_t CAsset::getUploadBudget()
+	{
+		return m_uploadBudget;
+	}
+
+	AssetLoadProgress CAsset::getLoadProgress(const AssetTag& tag)
+	{
+		AssetLoadProgress progress;
+
+		for (const auto& assetList : m_assetLists)
+		{
+			for (const auto& asset : assetList)
+			{
+				if (not asset.second->getTags().contains(tag))
+				{
+					continue;
+				}
+
+				++progress.total;
+
+				switch (asset.second->getState())
+				{
+				case AssetState::AsyncLoading:
+					++progress.loading;
+					break;
+				case AssetState::Loaded:
+					++progress.loaded;
+					break;
+				case AssetState::Failed:
+					++progress.failed;
+					break;
+				default:
+					break;
+				}
+			}
+		}
+
+		return progress;
+	}
+
+	AssetLoaderStat CAsset::getLoaderStat()
+	{
+		AssetLoaderStat stat = SIV3D_ENGINE(AssetMonitor)->getAsyncLoadStat();
+		stat.maxWorkers = m_loaderPool.getMaxWorkers();
+		stat.workerCount = m_loaderPool.getWorkerCount();
+		stat.pendingCount = m_loaderPool.getPendingCount();
+		stat.runningCount = m_loaderPool.getRunningCount();
+		return stat;
+	}
 }
@@ -13,6 +13,7 @@
 # include <Siv3D/HashTable.hpp>
 # include <Siv3D/String.hpp>
 # include "IAsset.hpp"
+# include "AssetLoaderPool.hpp"
 
 namespace s3d
 {
@@ -34,7 +35,9 @@ namespace s3d
 
 		bool load(AssetType assetType, AssetNameView name, StringView hint) override;
 
-		void loadAsync(AssetType assetType, AssetNameView name, StringView hint) override;
+		void loadAsync(AssetType assetType, AssetNameView name, StringView hint, int32 priority) override;
+
+		bool cancelLoadAsync(AssetType assetType, AssetNameView name) override;
 
 		void wait(AssetType assetType, AssetNameView name) override;
 
@@ -50,8 +53,32 @@ namespace s3d
 
 		HashTable<AssetName, AssetInfo> enumerate(AssetType assetType) override;
 
+		std::future<void> submitAsyncLoad(const IAsset& asset, std::function<void()> task, std::function<void()> onCancel) override;
+
+		bool cancelAsyncLoad(const IAsset& asset) override;
+
+		void runPendingAsyncLoad(const IAsset& asset) override;
+
+		void setMaxLoaderWorkers(size_t maxWorkers) override;
+
+		size_t getMaxLoaderWorkers() override;
+
+		void setUploadBudget(size_t count) override;
+
+		size_t getUploadBudget() override;
+
+		AssetLoadProgress getLoadProgress(const AssetTag& tag) override;
+
+		AssetLoaderStat getLoaderStat() override;
+
 	private:
 
+		// m_assetLists より先に破棄されないよう、先に宣言する
+		AssetLoaderPool m_loaderPool;
+
 		std::array<HashTable<String, std::unique_ptr<IAsset>>, 5> m_assetLists;
+
+		/// @brief 1 フレームあたりに GPU に転送する、非同期ロードしたテクスチャの最大数
+		std::atomic<size_t> m_uploadBudget{ 4 };
 	};
 }
@@ -10,8 +10,10 @@
 //-----------------------------------------------
 
 # pragma once
+# include <future>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Asset.hpp>
+# include <Siv3D/AssetLoader.hpp>
 # include <Siv3D/HashTable.hpp>
 
 namespace s3d
@@ -47,7 +49,9 @@ namespace s3d
 
 		virtual bool load(AssetType assetType, AssetNameView name, StringView hint) = 0;
 
-		virtual void loadAsync(AssetType assetType, AssetNameView name, StringView hint) = 0;
+		virtual void loadAsync(AssetType assetType, AssetNameView name, StringView hint, int32 priority) = 0;
+
+		virtual bool cancelLoadAsync(AssetType assetType, AssetNameView name) = 0;
 
 		virtual void wait(AssetType assetType, AssetNameView name) = 0;
 
@@ -62,5 +66,24 @@ namespace s3d
 		virtual void unregisterAll(AssetType assetType) = 0;
 
 		virtual HashTable<AssetName, AssetInfo> enumerate(AssetType assetType) = 0;
+
+		[[nodiscard]]
+		virtual std::future<void> submitAsyncLoad(const IAsset& asset, std::function<void()> task, std::function<void()> onCancel) = 0;
+
+		virtual bool cancelAsyncLoad(const IAsset& asset) = 0;
+
+		virtual void runPendingAsyncLoad(const IAsset& asset) = 0;
+
+		virtual void setMaxLoaderWorkers(size_t maxWorkers) = 0;
+
+		virtual size_t getMaxLoaderWorkers() = 0;
+
+		virtual void setUploadBudget(size_t count) = 0;
+
+		virtual size_t getUploadBudget() = 0;
+
+		virtual AssetLoadProgress getLoadProgress(const AssetTag& tag) = 0;
+
+		virtual AssetLoaderStat getLoaderStat() = 0;
 	};
 }
@@ -34,4 +34,14 @@ namespace s3d
 	{
 		return m_tags;
 	}
+
+	void IAsset::IAssetDetail::setLoadPriority(const int32 priority)
+	{
+		m_loadPriority = priority;
+	}
+
+	int32 IAsset::IAssetDetail::getLoadPriority() const
+	{
+		return m_loadPriority;
+	}
 }
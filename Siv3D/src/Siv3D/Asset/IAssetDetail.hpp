@@ -32,10 +32,17 @@ namespace s3d
 		[[nodiscard]]
 		const Array<AssetTag>& getTags() const;
 
+		void setLoadPriority(int32 priority);
+
+		[[nodiscard]]
+		int32 getLoadPriority() const;
+
 	private:
 
 		Array<String> m_tags;
 
+		std::atomic<int32> m_loadPriority = 0;
+
 		std::atomic<AssetState> m_state = AssetState::Uninitialized;
 	};
 }
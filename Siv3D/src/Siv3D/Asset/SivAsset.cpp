@@ -45,6 +45,16 @@ namespace s3d
 			|| (state == AssetState::Failed));
 	}
 
+	void IAsset::setLoadPriority(const int32 priority)
+	{
+		pImpl->setLoadPriority(priority);
+	}
+
+	int32 IAsset::getLoadPriority() const
+	{
+		return pImpl->getLoadPriority();
+	}
+
 	bool IAsset::isUninitialized() const
 	{
 		return (pImpl->getState() == AssetState::Uninitialized);
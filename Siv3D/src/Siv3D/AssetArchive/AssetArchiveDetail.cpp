@@ -0,0 +1,249 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <cstring>
+# include <algorithm>
+# include <Siv3D/Compression.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "AssetArchiveDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		using AssetArchiveFormat::DirectoryEntry;
+
+		[[nodiscard]]
+		static bool IsCompressed(const DirectoryEntry& entry) noexcept
+		{
+			return ((entry.flags & AssetArchiveFormat::Zstd) != 0);
+		}
+	}
+
+	AssetArchive::AssetArchiveDetail::AssetArchiveDetail() {}
+
+	AssetArchive::AssetArchiveDetail::~AssetArchiveDetail()
+	{
+		close();
+	}
+
+	bool AssetArchive::AssetArchiveDetail::open(const FilePathView path)
+	{
+		using namespace AssetArchiveFormat;
+
+		close();
+
+		auto file = std::make_shared<MemoryMappedFileView>(path);
+
+		if (not *file)
+		{
+			LOG_FAIL(U"AssetArchive::open(): Failed to open `{}`"_fmt(path));
+			return false;
+		}
+
+		const Byte* const data = file->data();
+		const uint64 fileSize = file->mappedSize();
+
+		if (fileSize < sizeof(Header))
+		{
+			LOG_FAIL(U"AssetArchive::open(): `{}` is not an asset archive"_fmt(path));
+			return false;
+		}
+
+		Header header;
+		std::memcpy(&header, data, sizeof(Header));
+
+		if (std::memcmp(header.signature, Signature, sizeof(Signature)) != 0)
+		{
+			LOG_FAIL(U"AssetArchive::open(): `{}` is not an asset archive"_fmt(path));
+			return false;
+		}
+
+		if (header.version != Version)
+		{
+			LOG_FAIL(U"AssetArchive::open(): `{}` has an unsupported version {}"_fmt(path, header.version));
+			return false;
+		}
+
+		// ディレクトリと文字列テーブルがファイル内に収まっているかを検証する
+		if (((header.directoryOffset % alignof(DirectoryEntry)) != 0)
+			|| (fileSize < header.directoryOffset)
+			|| (((fileSize - header.directoryOffset) / sizeof(DirectoryEntry)) < header.entryCount)
+			|| (fileSize < header.stringTableOffset)
+			|| ((fileSize - header.stringTableOffset) < header.stringTableSize))
+		{
+			LOG_FAIL(U"AssetArchive::open(): `{}` is corrupted"_fmt(path));
+			return false;
+		}
+
+		const auto* directory = reinterpret_cast<const DirectoryEntry*>(data + header.directoryOffset);
+		const char* stringTable = reinterpret_cast<const char*>(data + header.stringTableOffset);
+
+		// 各エントリがファイル内に収まっていて、ディレクトリがソートされているかを検証する
+		for (size_t i = 0; i < header.entryCount; ++i)
+		{
+			const DirectoryEntry& entry = directory[i];
+
+			const bool valid = ((entry.pathOffset <= header.stringTableSize)
+				&& (entry.pathLength <= (header.stringTableSize - entry.pathOffset))
+				&& (entry.dataOffset <= fileSize)
+				&& (entry.storedSize <= (fileSize - entry.dataOffset))
+				&& (detail::IsCompressed(entry) || (entry.storedSize == entry.originalSize)));
+
+			const bool sorted = ((i == 0)
+				|| (directory[i - 1].pathHash < entry.pathHash)
+				|| ((directory[i - 1].pathHash == entry.pathHash)
+					&& (std::string_view{ (stringTable + directory[i - 1].pathOffset), directory[i - 1].pathLength }
+						< std::string_view{ (stringTable + entry.pathOffset), entry.pathLength })));
+
+			if ((not valid) || (not sorted))
+			{
+				LOG_FAIL(U"AssetArchive::open(): `{}` is corrupted"_fmt(path));
+				return false;
+			}
+		}
+
+		m_file = std::move(file);
+		m_directory = directory;
+		m_entryCount = header.entryCount;
+		m_stringTable = stringTable;
+
+		m_paths.reserve(m_entryCount);
+
+		for (size_t i = 0; i < m_entryCount; ++i)
+		{
+			m_paths << Unicode::FromUTF8(getEntryPath(m_directory[i]));
+		}
+
+		LOG_TRACE(U"AssetArchive: Opened `{}` ({} entries)"_fmt(path, m_entryCount));
+
+		return true;
+	}
+
+	void AssetArchive::AssetArchiveDetail::close()
+	{
+		// 作成済みの Reader はメモリマップを共有しているため、ここで解放しても影響を受けない
+		m_file.reset();
+		m_directory = nullptr;
+		m_entryCount = 0;
+		m_stringTable = nullptr;
+		m_paths.clear();
+	}
+
+	bool AssetArchive::AssetArchiveDetail::isOpen() const noexcept
+	{
+		return static_cast<bool>(m_file);
+	}
+
+	size_t AssetArchive::AssetArchiveDetail::size() const noexcept
+	{
+		return m_entryCount;
+	}
+
+	const Array<FilePath>& AssetArchive::AssetArchiveDetail::enumPaths() const
+	{
+		return m_paths;
+	}
+
+	const AssetArchiveFormat::DirectoryEntry* AssetArchive::AssetArchiveDetail::find(const FilePathView path) const
+	{
+		if (not m_file)
+		{
+			return nullptr;
+		}
+
+		const std::string entryPath = AssetArchiveFormat::ToEntryPath(path);
+		const uint64 hash = AssetArchiveFormat::HashEntryPath(entryPath);
+
+		const auto* const last = (m_directory + m_entryCount);
+		const auto* it = std::lower_bound(m_directory, last, hash,
+			[](const AssetArchiveFormat::DirectoryEntry& entry, const uint64 value) { return (entry.pathHash < value); });
+
+		for (; (it != last) && (it->pathHash == hash); ++it)
+		{
+			if (getEntryPath(*it) == entryPath)
+			{
+				return it;
+			}
+		}
+
+		return nullptr;
+	}
+
+	AssetArchiveEntryReader AssetArchive::AssetArchiveDetail::getReader(const FilePathView path) const
+	{
+		const auto* entry = find(path);
+
+		if (not entry)
+		{
+			LOG_FAIL(U"AssetArchive::getReader(): `{}` not found in archive"_fmt(path));
+			return{};
+		}
+
+		const Byte* const storedData = (m_file->data() + entry->dataOffset);
+
+		if (not detail::IsCompressed(*entry))
+		{
+			// メモリマップを直接参照する
+			return AssetArchiveEntryReader{ m_file, storedData, static_cast<size_t>(entry->storedSize) };
+		}
+
+		auto blob = std::make_shared<Blob>();
+
+		if ((not Compression::Decompress(storedData, static_cast<size_t>(entry->storedSize), *blob))
+			|| (blob->size() != entry->originalSize))
+		{
+			LOG_FAIL(U"AssetArchive::getReader(): Failed to decompress `{}`"_fmt(path));
+			return{};
+		}
+
+		const Byte* const decompressedData = blob->data();
+		const size_t decompressedSize = blob->size();
+
+		return AssetArchiveEntryReader{ std::move(blob), decompressedData, decompressedSize };
+	}
+
+	Blob AssetArchive::AssetArchiveDetail::extractToBlob(const FilePathView path) const
+	{
+		const auto* entry = find(path);
+
+		if (not entry)
+		{
+			LOG_FAIL(U"AssetArchive::extractToBlob(): `{}` not found in archive"_fmt(path));
+			return{};
+		}
+
+		const Byte* const storedData = (m_file->data() + entry->dataOffset);
+
+		if (not detail::IsCompressed(*entry))
+		{
+			return Blob{ storedData, static_cast<size_t>(entry->storedSize) };
+		}
+
+		Blob blob;
+
+		if ((not Compression::Decompress(storedData, static_cast<size_t>(entry->storedSize), blob))
+			|| (blob.size() != entry->originalSize))
+		{
+			LOG_FAIL(U"AssetArchive::extractToBlob(): Failed to decompress `{}`"_fmt(path));
+			return{};
+		}
+
+		return blob;
+	}
+
+	std::string_view AssetArchive::AssetArchiveDetail::getEntryPath(const AssetArchiveFormat::DirectoryEntry& entry) const noexcept
+	{
+		return{ (m_stringTable + entry.pathOffset), entry.pathLength };
+	}
+}
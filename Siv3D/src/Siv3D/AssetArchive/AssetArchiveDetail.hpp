@@ -0,0 +1,68 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <Siv3D/AssetArchive.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include "AssetArchiveFormat.hpp"
+
+namespace s3d
+{
+	class AssetArchive::AssetArchiveDetail
+	{
+	public:
+
+		AssetArchiveDetail();
+
+		~AssetArchiveDetail();
+
+		bool open(FilePathView path);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		[[nodiscard]]
+		const Array<FilePath>& enumPaths() const;
+
+		/// @brief エントリを検索します。
+		/// @return エントリ。見つからない場合は nullptr
+		[[nodiscard]]
+		const AssetArchiveFormat::DirectoryEntry* find(FilePathView path) const;
+
+		[[nodiscard]]
+		AssetArchiveEntryReader getReader(FilePathView path) const;
+
+		[[nodiscard]]
+		Blob extractToBlob(FilePathView path) const;
+
+	private:
+
+		/// @brief メモリマップ。エントリの Reader と共有されるため shared_ptr で保持する
+		std::shared_ptr<MemoryMappedFileView> m_file;
+
+		const AssetArchiveFormat::DirectoryEntry* m_directory = nullptr;
+
+		size_t m_entryCount = 0;
+
+		const char* m_stringTable = nullptr;
+
+		Array<FilePath> m_paths;
+
+		[[nodiscard]]
+		std::string_view getEntryPath(const AssetArchiveFormat::DirectoryEntry& entry) const noexcept;
+	};
+}
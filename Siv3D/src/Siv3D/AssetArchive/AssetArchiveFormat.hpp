@@ -0,0 +1,103 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <string>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Hash.hpp>
+
+namespace s3d
+{
+	// アセットアーカイブのファイル形式（リトルエンディアン）
+	//
+	// [Header (64 bytes)]
+	// [Entry data ...]       各エントリは 64 バイト境界に配置
+	// [Directory]            DirectoryEntry の配列。(pathHash, path) でソート済み
+	// [String table]         エントリのパス（UTF-8, 終端文字なし）
+	namespace AssetArchiveFormat
+	{
+		inline constexpr char Signature[8] = { 'S', '3', 'D', 'A', 'R', 'C', 'H', '\0' };
+
+		inline constexpr uint32 Version = 1;
+
+		/// @brief エントリのデータの配置境界
+		inline constexpr uint64 Alignment = 64;
+
+		/// @brief 圧縮によってこの割合以下のサイズにならない場合は、非圧縮で格納する
+		inline constexpr double MaxCompressionRatio = 0.9;
+
+		enum EntryFlags : uint32
+		{
+			Zstd = (1u << 0),
+		};
+
+		struct Header
+		{
+			char signature[8];
+
+			uint32 version;
+
+			uint32 entryCount;
+
+			uint64 directoryOffset;
+
+			uint64 stringTableOffset;
+
+			uint64 stringTableSize;
+
+			uint64 reserved[3];
+		};
+		static_assert(sizeof(Header) == 64);
+
+		struct DirectoryEntry
+		{
+			uint64 pathHash;
+
+			uint32 pathOffset;
+
+			uint32 pathLength;
+
+			uint64 dataOffset;
+
+			/// @brief アーカイブ内のサイズ
+			uint64 storedSize;
+
+			/// @brief 展開後のサイズ
+			uint64 originalSize;
+
+			uint32 flags;
+
+			uint32 reserved;
+		};
+		static_assert(sizeof(DirectoryEntry) == 48);
+
+		/// @brief アーカイブ内のパス（区切り文字を '/' に統一した UTF-8 文字列）を返します。
+		[[nodiscard]]
+		inline std::string ToEntryPath(const FilePathView path)
+		{
+			return String{ path }.replace(U'\\', U'/').toUTF8();
+		}
+
+		[[nodiscard]]
+		inline uint64 HashEntryPath(const std::string& entryPath) noexcept
+		{
+			return Hash::XXHash3(entryPath.data(), entryPath.size());
+		}
+
+		[[nodiscard]]
+		constexpr uint64 AlignUp(const uint64 value) noexcept
+		{
+			return ((value + (Alignment - 1)) & ~(Alignment - 1));
+		}
+	}
+}
@@ -0,0 +1,186 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <cstring>
+# include <Siv3D/AssetArchive.hpp>
+# include <Siv3D/Utility.hpp>
+# include "AssetArchiveDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	AssetArchiveEntryReader
+	//
+	////////////////////////////////////////////////////////////////
+
+	AssetArchiveEntryReader::AssetArchiveEntryReader(std::shared_ptr<const void> owner, const Byte* data, const size_t size) noexcept
+		: m_owner{ std::move(owner) }
+		, m_ptr{ data }
+		, m_size{ static_cast<int64>(size) } {}
+
+	bool AssetArchiveEntryReader::supportsLookahead() const noexcept
+	{
+		return true;
+	}
+
+	bool AssetArchiveEntryReader::isOpen() const noexcept
+	{
+		return (m_ptr != nullptr);
+	}
+
+	int64 AssetArchiveEntryReader::size() const
+	{
+		return m_size;
+	}
+
+	int64 AssetArchiveEntryReader::getPos() const
+	{
+		return m_pos;
+	}
+
+	bool AssetArchiveEntryReader::setPos(const int64 pos)
+	{
+		if (not InRange<int64>(pos, 0, m_size))
+		{
+			return false;
+		}
+
+		m_pos = pos;
+
+		return true;
+	}
+
+	int64 AssetArchiveEntryReader::skip(const int64 offset)
+	{
+		m_pos = Clamp<int64>((m_pos + offset), 0, m_size);
+
+		return m_pos;
+	}
+
+	int64 AssetArchiveEntryReader::read(void* dst, const int64 size)
+	{
+		const int64 readSize = lookahead(dst, m_pos, size);
+
+		m_pos += readSize;
+
+		return readSize;
+	}
+
+	int64 AssetArchiveEntryReader::read(void* dst, const int64 pos, const int64 size)
+	{
+		const int64 readSize = lookahead(dst, pos, size);
+
+		if (InRange<int64>(pos, 0, m_size))
+		{
+			m_pos = (pos + readSize);
+		}
+
+		return readSize;
+	}
+
+	int64 AssetArchiveEntryReader::lookahead(void* dst, const int64 size) const
+	{
+		return lookahead(dst, m_pos, size);
+	}
+
+	int64 AssetArchiveEntryReader::lookahead(void* dst, const int64 pos, const int64 size) const
+	{
+		if ((not dst) || (not InRange<int64>(pos, 0, m_size)))
+		{
+			return 0;
+		}
+
+		const int64 readSize = Clamp<int64>(size, 0, (m_size - pos));
+
+		std::memcpy(dst, (m_ptr + pos), static_cast<size_t>(readSize));
+
+		return readSize;
+	}
+
+	const Byte* AssetArchiveEntryReader::data() const noexcept
+	{
+		return m_ptr;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	AssetArchive
+	//
+	////////////////////////////////////////////////////////////////
+
+	AssetArchive::AssetArchive()
+		: pImpl{ std::make_shared<AssetArchiveDetail>() } {}
+
+	AssetArchive::AssetArchive(const FilePathView path)
+		: AssetArchive{}
+	{
+		open(path);
+	}
+
+	AssetArchive::~AssetArchive() {}
+
+	bool AssetArchive::open(const FilePathView path)
+	{
+		return pImpl->open(path);
+	}
+
+	void AssetArchive::close()
+	{
+		pImpl->close();
+	}
+
+	bool AssetArchive::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	AssetArchive::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	size_t AssetArchive::size() const noexcept
+	{
+		return pImpl->size();
+	}
+
+	const Array<FilePath>& AssetArchive::enumPaths() const
+	{
+		return pImpl->enumPaths();
+	}
+
+	bool AssetArchive::contains(const FilePathView path) const
+	{
+		return (pImpl->find(path) != nullptr);
+	}
+
+	bool AssetArchive::isCompressed(const FilePathView path) const
+	{
+		if (const auto* entry = pImpl->find(path))
+		{
+			return ((entry->flags & AssetArchiveFormat::Zstd) != 0);
+		}
+
+		return false;
+	}
+
+	AssetArchiveEntryReader AssetArchive::getReader(const FilePathView path) const
+	{
+		return pImpl->getReader(path);
+	}
+
+	Blob AssetArchive::extractToBlob(const FilePathView path) const
+	{
+		return pImpl->extractToBlob(path);
+	}
+}
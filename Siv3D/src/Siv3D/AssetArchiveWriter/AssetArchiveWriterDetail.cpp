@@ -0,0 +1,269 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <algorithm>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/AssetArchive/AssetArchiveFormat.hpp>
+# include "AssetArchiveWriterDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief 既に圧縮されている形式であるかを返します。
+		[[nodiscard]]
+		static bool IsCompressedMedia(const FilePathView path)
+		{
+			const String extension = FileSystem::Extension(path);
+
+			for (const StringView compressed : { U"png"_sv, U"jpg"_sv, U"jpeg"_sv, U"webp"_sv, U"gif"_sv,
+				U"ogg"_sv, U"opus"_sv, U"mp3"_sv, U"m4a"_sv, U"aac"_sv, U"mp4"_sv,
+				U"zip"_sv, U"gz"_sv, U"zst"_sv, U"7z"_sv })
+			{
+				if (extension == compressed)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+	}
+
+	AssetArchiveWriter::AssetArchiveWriterDetail::AssetArchiveWriterDetail() {}
+
+	AssetArchiveWriter::AssetArchiveWriterDetail::~AssetArchiveWriterDetail() {}
+
+	bool AssetArchiveWriter::AssetArchiveWriterDetail::add(const FilePathView path, const Blob& data, const AssetArchiveCompression compression)
+	{
+		std::string entryPath;
+
+		if (not reservePath(path, entryPath))
+		{
+			return false;
+		}
+
+		m_entries << MakeEntry(std::move(entryPath), path, data, compression, m_compressionLevel);
+
+		return true;
+	}
+
+	bool AssetArchiveWriter::AssetArchiveWriterDetail::addFile(const FilePathView path, const FilePathView sourcePath, const AssetArchiveCompression compression)
+	{
+		const Blob data{ sourcePath };
+
+		if ((not data) && (FileSystem::FileSize(sourcePath) != 0))
+		{
+			LOG_FAIL(U"AssetArchiveWriter::addFile(): Failed to read `{}`"_fmt(sourcePath));
+			return false;
+		}
+
+		return add(path, data, compression);
+	}
+
+	bool AssetArchiveWriter::AssetArchiveWriterDetail::addDirectory(const FilePathView directory, const AssetArchiveCompression compression)
+	{
+		if (not FileSystem::IsDirectory(directory))
+		{
+			LOG_FAIL(U"AssetArchiveWriter::addDirectory(): `{}` is not a directory"_fmt(directory));
+			return false;
+		}
+
+		const FilePath baseDirectory = FileSystem::FullPath(directory);
+
+		struct Source
+		{
+			FilePath path;
+
+			std::string entryPath;
+
+			Blob data;
+		};
+
+		Array<Source> sources;
+		bool result = true;
+
+		for (const auto& sourcePath : FileSystem::DirectoryContents(baseDirectory, Recursive::Yes))
+		{
+			if (FileSystem::IsDirectory(sourcePath))
+			{
+				continue;
+			}
+
+			Source source;
+			source.path = FileSystem::RelativePath(sourcePath, baseDirectory);
+
+			if (not reservePath(source.path, source.entryPath))
+			{
+				result = false;
+				continue;
+			}
+
+			source.data = Blob{ sourcePath };
+			sources << std::move(source);
+		}
+
+		// 圧縮はエントリごとに独立しているので、並列に行う
+		Array<Entry> entries(sources.size());
+
+		Threading::ParallelFor(sources.size(), [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					Source& source = sources[i];
+					entries[i] = MakeEntry(std::move(source.entryPath), source.path, source.data, compression, m_compressionLevel);
+				}
+			}, 1);
+
+		m_entries.insert(m_entries.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+
+		return result;
+	}
+
+	size_t AssetArchiveWriter::AssetArchiveWriterDetail::size() const noexcept
+	{
+		return m_entries.size();
+	}
+
+	void AssetArchiveWriter::AssetArchiveWriterDetail::setCompressionLevel(const int32 compressionLevel) noexcept
+	{
+		m_compressionLevel = Clamp(compressionLevel, Compression::MinLevel, Compression::MaxLevel);
+	}
+
+	bool AssetArchiveWriter::AssetArchiveWriterDetail::save(const FilePathView path) const
+	{
+		using namespace AssetArchiveFormat;
+
+		BinaryWriter writer{ path };
+
+		if (not writer)
+		{
+			LOG_FAIL(U"AssetArchiveWriter::save(): Failed to create `{}`"_fmt(path));
+			return false;
+		}
+
+		// ディレクトリは (pathHash, path) の順にソートする
+		Array<const Entry*> sortedEntries(Arg::reserve = m_entries.size());
+
+		for (const auto& entry : m_entries)
+		{
+			sortedEntries << &entry;
+		}
+
+		std::sort(sortedEntries.begin(), sortedEntries.end(), [](const Entry* a, const Entry* b)
+			{
+				return ((a->pathHash != b->pathHash) ? (a->pathHash < b->pathHash) : (a->path < b->path));
+			});
+
+		Array<DirectoryEntry> directory(sortedEntries.size());
+		std::string stringTable;
+		uint64 offset = sizeof(Header);
+
+		for (size_t i = 0; i < sortedEntries.size(); ++i)
+		{
+			const Entry& entry = *sortedEntries[i];
+
+			offset = AlignUp(offset);
+
+			DirectoryEntry& directoryEntry = directory[i];
+			directoryEntry.pathHash = entry.pathHash;
+			directoryEntry.pathOffset = static_cast<uint32>(stringTable.size());
+			directoryEntry.pathLength = static_cast<uint32>(entry.path.size());
+			directoryEntry.dataOffset = offset;
+			directoryEntry.storedSize = entry.storedData.size();
+			directoryEntry.originalSize = entry.originalSize;
+			directoryEntry.flags = entry.flags;
+			directoryEntry.reserved = 0;
+
+			stringTable += entry.path;
+			offset += entry.storedData.size();
+		}
+
+		Header header{};
+		std::copy(std::begin(Signature), std::end(Signature), header.signature);
+		header.version = Version;
+		header.entryCount = static_cast<uint32>(directory.size());
+		header.directoryOffset = AlignUp(offset);
+		header.stringTableOffset = (header.directoryOffset + directory.size_bytes());
+		header.stringTableSize = stringTable.size();
+
+		writer.write(header);
+
+		static constexpr Byte Padding[Alignment]{};
+
+		for (size_t i = 0; i < sortedEntries.size(); ++i)
+		{
+			writer.write(Padding, static_cast<int64>(directory[i].dataOffset - writer.getPos()));
+			writer.write(sortedEntries[i]->storedData.data(), static_cast<int64>(sortedEntries[i]->storedData.size()));
+		}
+
+		writer.write(Padding, static_cast<int64>(header.directoryOffset - writer.getPos()));
+		writer.write(directory.data(), static_cast<int64>(directory.size_bytes()));
+		writer.write(stringTable.data(), static_cast<int64>(stringTable.size()));
+
+		if (writer.getPos() != static_cast<int64>(header.stringTableOffset + header.stringTableSize))
+		{
+			LOG_FAIL(U"AssetArchiveWriter::save(): Failed to write `{}`"_fmt(path));
+			return false;
+		}
+
+		LOG_TRACE(U"AssetArchiveWriter: Saved `{}` ({} entries)"_fmt(path, directory.size()));
+
+		return true;
+	}
+
+	bool AssetArchiveWriter::AssetArchiveWriterDetail::reservePath(const FilePathView path, std::string& entryPath)
+	{
+		entryPath = AssetArchiveFormat::ToEntryPath(path);
+
+		if (not m_paths.insert(entryPath).second)
+		{
+			LOG_FAIL(U"AssetArchiveWriter: `{}` is already added"_fmt(path));
+			return false;
+		}
+
+		return true;
+	}
+
+	AssetArchiveWriter::AssetArchiveWriterDetail::Entry AssetArchiveWriter::AssetArchiveWriterDetail::MakeEntry(std::string&& entryPath, const FilePathView path,
+		const Blob& data, const AssetArchiveCompression compression, const int32 compressionLevel)
+	{
+		Entry entry;
+		entry.pathHash = AssetArchiveFormat::HashEntryPath(entryPath);
+		entry.path = std::move(entryPath);
+		entry.originalSize = data.size();
+
+		const bool tryCompression = ((compression == AssetArchiveCompression::Zstd)
+			|| ((compression == AssetArchiveCompression::Auto) && (not detail::IsCompressedMedia(path))));
+
+		if (tryCompression && data)
+		{
+			Blob compressed;
+
+			if (Compression::Compress(data, compressed, compressionLevel)
+				&& ((compression == AssetArchiveCompression::Zstd)
+					|| (compressed.size() <= (data.size() * AssetArchiveFormat::MaxCompressionRatio))))
+			{
+				entry.storedData = std::move(compressed);
+				entry.flags |= AssetArchiveFormat::Zstd;
+				return entry;
+			}
+		}
+
+		entry.storedData = data;
+
+		return entry;
+	}
+}
@@ -0,0 +1,71 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <string>
+# include <Siv3D/AssetArchiveWriter.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashSet.hpp>
+
+namespace s3d
+{
+	class AssetArchiveWriter::AssetArchiveWriterDetail
+	{
+	public:
+
+		AssetArchiveWriterDetail();
+
+		~AssetArchiveWriterDetail();
+
+		bool add(FilePathView path, const Blob& data, AssetArchiveCompression compression);
+
+		bool addFile(FilePathView path, FilePathView sourcePath, AssetArchiveCompression compression);
+
+		bool addDirectory(FilePathView directory, AssetArchiveCompression compression);
+
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		void setCompressionLevel(int32 compressionLevel) noexcept;
+
+		bool save(FilePathView path) const;
+
+	private:
+
+		struct Entry
+		{
+			std::string path;
+
+			uint64 pathHash = 0;
+
+			/// @brief アーカイブに格納するデータ（圧縮されている場合は圧縮後のデータ）
+			Blob storedData;
+
+			uint64 originalSize = 0;
+
+			uint32 flags = 0;
+		};
+
+		Array<Entry> m_entries;
+
+		HashSet<std::string> m_paths;
+
+		int32 m_compressionLevel = Compression::DefaultLevel;
+
+		/// @brief パスを予約します。同じパスが既にある場合は false を返します。
+		[[nodiscard]]
+		bool reservePath(FilePathView path, std::string& entryPath);
+
+		[[nodiscard]]
+		static Entry MakeEntry(std::string&& entryPath, FilePathView path, const Blob& data, AssetArchiveCompression compression, int32 compressionLevel);
+	};
+}
@@ -0,0 +1,66 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/AssetArchiveWriter.hpp>
+# include "AssetArchiveWriterDetail.hpp"
+
+namespace s3d
+{
+	AssetArchiveWriter::AssetArchiveWriter()
+		: pImpl{ std::make_shared<AssetArchiveWriterDetail>() } {}
+
+	AssetArchiveWriter::~AssetArchiveWriter() {}
+
+	bool AssetArchiveWriter::add(const FilePathView path, const Blob& data, const AssetArchiveCompression compression)
+	{
+		return pImpl->add(path, data, compression);
+	}
+
+	bool AssetArchiveWriter::addFile(const FilePathView path, const FilePathView sourcePath, const AssetArchiveCompression compression)
+	{
+		return pImpl->addFile(path, sourcePath, compression);
+	}
+
+	bool AssetArchiveWriter::addDirectory(const FilePathView directory, const AssetArchiveCompression compression)
+	{
+		return pImpl->addDirectory(directory, compression);
+	}
+
+	size_t AssetArchiveWriter::size() const noexcept
+	{
+		return pImpl->size();
+	}
+
+	void AssetArchiveWriter::setCompressionLevel(const int32 compressionLevel) noexcept
+	{
+		pImpl->setCompressionLevel(compressionLevel);
+	}
+
+	bool AssetArchiveWriter::save(const FilePathView path) const
+	{
+		return pImpl->save(path);
+	}
+
+	bool AssetArchiveWriter::Pack(const FilePathView directory, const FilePathView archivePath, const AssetArchiveCompression compression, const int32 compressionLevel)
+	{
+		AssetArchiveWriter writer;
+
+		writer.setCompressionLevel(compressionLevel);
+
+		if (not writer.addDirectory(directory, compression))
+		{
+			return false;
+		}
+
+		return writer.save(archivePath);
+	}
+}
@@ -10,10 +10,12 @@
 //-----------------------------------------------
 
 # pragma once
+# include <array>
+# include <atomic>
 # include <memory>
 # include <mutex>
 # include <Siv3D/Common.hpp>
-# include <Siv3D/HashTable.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
@@ -21,88 +23,318 @@
 
 namespace s3d
 {
+	/// @brief アセットのデータを ID で管理するクラス
+	/// @remark ID の下位ビットはスロットのインデックス、上位ビットは世代を表します。
+	/// @remark ID からデータへのアクセスはロックを取らずに O(1) で行われ、解放済みの ID（世代の異なる ID）には Null アセットのデータを返します。
+	/// @remark 追加と削除はミューテックスで保護されます。
 	template <class IDType, class Data>
 	class AssetHandleManager
 	{
+	public:
+
+		using value_type = typename IDType::value_type;
+
+		/// @brief ID のうちスロットのインデックスに使うビット数
+		static constexpr uint32 IndexBits = ((sizeof(value_type) >= 8) ? 32 : 20);
+
+		static constexpr value_type IndexMask = ((value_type{ 1 } << IndexBits) - 1);
+
+		/// @brief 世代の最大値。すべてのビットが 1 の世代は InvalidID と重なるため使いません。
+		static constexpr value_type MaxGeneration = ((IDType::InvalidID >> IndexBits) - 1);
+
+		static constexpr uint32 PageBits = 10;
+
+		/// @brief 1 ページあたりのスロット数
+		static constexpr size_t PageSize = (size_t{ 1 } << PageBits);
+
+		static constexpr size_t MaxPages = 1024;
+
+		/// @brief 同時に存在できるアセットの最大数（Null アセットを含む）
+		static constexpr size_t MaxSlots = (PageSize * MaxPages);
+
 	private:
 
-		using MapType = HashTable<IDType, std::unique_ptr<Data>>;
+		/// @brief 空きスロットを表す ID
+		static constexpr value_type FreeID = IDType::InvalidID;
 
-		MapType m_data;
+		struct Slot
+		{
+			/// @brief このスロットに現在格納されているアセットの ID。空きスロットの場合は FreeID
+			std::atomic<value_type> id{ FreeID };
 
-		String m_assetTypeName;
+			std::atomic<Data*> data{ nullptr };
 
-		typename IDType::value_type m_idCount = 0;
+			/// @brief 次に割り当てる世代（m_mutex で保護）
+			value_type generation = 1;
+		};
 
-		bool m_idFilled = false;
+		/// @brief スロットのページ。一度確保したページは destroy() まで移動も解放もしないため、ロックなしで参照できます。
+		std::array<std::atomic<Slot*>, MaxPages> m_pages{};
 
-		std::mutex m_mutex;
+		/// @brief 使用されたことのあるスロットの数
+		std::atomic<size_t> m_slotCount{ 0 };
 
-	public:
+		std::atomic<size_t> m_size{ 0 };
 
-		using iterator = typename MapType::iterator;
-		using const_iterator = typename MapType::const_iterator;
+		/// @brief Null アセットのデータ
+		std::atomic<Data*> m_nullData{ nullptr };
 
-		explicit AssetHandleManager(const String& name)
-			: m_assetTypeName{ name } {}
+		/// @brief 再利用可能なスロットのインデックス（m_mutex で保護）
+		Array<value_type> m_freeIndices;
 
-		void setNullData(std::unique_ptr<Data>&& data)
+		String m_assetTypeName;
+
+		std::mutex m_mutex;
+
+		[[nodiscard]]
+		static constexpr value_type MakeID(const value_type generation, const value_type index) noexcept
 		{
-			m_data.emplace(IDType::NullAsset(), std::move(data));
+			return ((generation << IndexBits) | index);
+		}
 
-			LOG_TRACE(U"💠 Created {0}[0(null)]"_fmt(m_assetTypeName));
+		[[nodiscard]]
+		Slot* getSlot(const value_type index) const noexcept
+		{
+			if (MaxSlots <= index)
+			{
+				return nullptr;
+			}
+
+			if (Slot* page = m_pages[index >> PageBits].load(std::memory_order_acquire))
+			{
+				return (page + (index & (PageSize - 1)));
+			}
+
+			return nullptr;
 		}
 
 		[[nodiscard]]
-		Data* operator [](const IDType id)
+		Data* find(const IDType id) const noexcept
 		{
-			std::lock_guard lock{ m_mutex };
+			const value_type value = id.value();
+
+			const Slot* slot = getSlot(value & IndexMask);
+
+			if ((not slot) || (slot->id.load(std::memory_order_acquire) != value))
+			{
+				return nullptr;
+			}
+
+			Data* data = slot->data.load(std::memory_order_acquire);
+
+			// ID を確認してからデータを読むまでの間にスロットが解放・再利用された場合、
+			// data は別のアセットのものであるため、ID を読み直して変わっていないことを確かめる
+			if (slot->id.load(std::memory_order_acquire) != value)
+			{
+				return nullptr;
+			}
 
-			return m_data[id].get();
+			return data;
 		}
 
+		/// @brief 空きスロットを確保します。m_mutex をロックした状態で呼ぶ必要があります。
 		[[nodiscard]]
-		IDType add(std::unique_ptr<Data>&& data, [[maybe_unused]] const String& info = U"")
+		Slot* allocateSlot(value_type& index)
 		{
-			std::lock_guard lock{ m_mutex };
+			if (m_freeIndices)
+			{
+				index = m_freeIndices.back();
+				m_freeIndices.pop_back();
+				return getSlot(index);
+			}
+
+			index = m_slotCount.load(std::memory_order_relaxed);
 
-			if (++m_idCount == IDType::InvalidID)
+			if (MaxSlots <= index)
 			{
-				m_idFilled = true;
-				m_idCount = 0;
+				return nullptr;
 			}
 
-			if (not m_idFilled)
+			auto& page = m_pages[index >> PageBits];
+
+			if (page.load(std::memory_order_relaxed) == nullptr)
 			{
-				m_data.emplace(m_idCount, std::move(data));
+				page.store(new Slot[PageSize], std::memory_order_release);
+			}
+
+			m_slotCount.store((index + 1), std::memory_order_release);
 
-				LOG_TRACE(U"💠 Created {0}[{1}] {2}"_fmt(m_assetTypeName, m_idCount, info));
+			return getSlot(index);
+		}
+
+	public:
+
+		class iterator
+		{
+		public:
 
-				return IDType(m_idCount);
+			using value_type = std::pair<IDType, Data*>;
+
+			using reference = value_type&;
+
+			using pointer = value_type*;
+
+			iterator() = default;
+
+			iterator(const AssetHandleManager* manager, const size_t index)
+				: m_manager{ manager }
+				, m_index{ index }
+			{
+				skipFreeSlots();
 			}
-			else
+
+			[[nodiscard]]
+			reference operator *() noexcept
 			{
-				if (m_data.size() == (IDType::InvalidID - 1))
-				{
-					LOG_FAIL(U"❌ No more {0}s can be created"_fmt(m_assetTypeName));
+				return m_current;
+			}
 
-					return IDType::NullAsset();
-				}
+			[[nodiscard]]
+			pointer operator ->() noexcept
+			{
+				return &m_current;
+			}
+
+			iterator& operator ++()
+			{
+				++m_index;
+				skipFreeSlots();
+				return *this;
+			}
+
+			[[nodiscard]]
+			bool operator ==(const iterator& other) const noexcept
+			{
+				return (m_index == other.m_index);
+			}
+
+			[[nodiscard]]
+			bool operator !=(const iterator& other) const noexcept
+			{
+				return (m_index != other.m_index);
+			}
+
+		private:
+
+			const AssetHandleManager* m_manager = nullptr;
+
+			size_t m_index = 0;
+
+			value_type m_current;
 
-				while (++m_idCount < IDType::InvalidID)
+			void skipFreeSlots()
+			{
+				const size_t slotCount = m_manager->m_slotCount.load(std::memory_order_acquire);
+
+				for (; m_index < slotCount; ++m_index)
 				{
-					if (m_data.find(IDType(++m_idCount)) == m_data.end())
+					const Slot* slot = m_manager->getSlot(static_cast<typename IDType::value_type>(m_index));
+
+					if (const auto id = slot->id.load(std::memory_order_acquire);
+						id != FreeID)
 					{
-						m_data.emplace(m_idCount, std::move(data));
+						m_current = { IDType(id), slot->data.load(std::memory_order_acquire) };
+						return;
+					}
+				}
 
-						LOG_TRACE(U"💠 Created {0}[{1}] {2}"_fmt(m_assetTypeName, m_idCount, info));
+				m_index = Largest<size_t>;
+			}
+		};
+
+		using const_iterator = iterator;
+
+		explicit AssetHandleManager(const String& name)
+			: m_assetTypeName{ name } {}
 
-						return IDType(m_idCount);
+		~AssetHandleManager()
+		{
+			for (auto& page : m_pages)
+			{
+				if (Slot* slots = page.load(std::memory_order_relaxed))
+				{
+					for (size_t i = 0; i < PageSize; ++i)
+					{
+						delete slots[i].data.load(std::memory_order_relaxed);
 					}
+
+					delete[] slots;
 				}
+			}
+		}
+
+		AssetHandleManager(const AssetHandleManager&) = delete;
+
+		AssetHandleManager& operator =(const AssetHandleManager&) = delete;
+
+		void setNullData(std::unique_ptr<Data>&& data)
+		{
+			std::lock_guard lock{ m_mutex };
+
+			value_type index = 0;
+
+			Slot* slot = allocateSlot(index);
+
+			assert(index == IDType::NullID);
+
+			Data* pData = data.release();
+			slot->data.store(pData, std::memory_order_relaxed);
+			slot->id.store(IDType::NullID, std::memory_order_release);
+			m_nullData.store(pData, std::memory_order_release);
+			m_size.fetch_add(1, std::memory_order_relaxed);
+
+			LOG_TRACE(U"💠 Created {0}[0(null)]"_fmt(m_assetTypeName));
+		}
+
+		/// @brief ID に対応するデータを返します。
+		/// @param id ID
+		/// @return ID に対応するデータ。ID が解放済みである場合は Null アセットのデータ
+		/// @remark ロックを取りません。
+		[[nodiscard]]
+		Data* operator [](const IDType id) const noexcept
+		{
+			if (Data* data = find(id))
+			{
+				return data;
+			}
+
+			return m_nullData.load(std::memory_order_acquire);
+		}
+
+		/// @brief ID に対応するデータが存在するかを返します。
+		/// @param id ID
+		/// @return ID に対応するデータが存在する場合 true, 解放済みまたは無効な ID の場合は false
+		[[nodiscard]]
+		bool contains(const IDType id) const noexcept
+		{
+			return (find(id) != nullptr);
+		}
+
+		[[nodiscard]]
+		IDType add(std::unique_ptr<Data>&& data, [[maybe_unused]] const String& info = U"")
+		{
+			std::lock_guard lock{ m_mutex };
+
+			value_type index = 0;
+
+			Slot* slot = allocateSlot(index);
+
+			if (not slot)
+			{
+				LOG_FAIL(U"❌ No more {0}s can be created"_fmt(m_assetTypeName));
 
 				return IDType::NullAsset();
 			}
+
+			const value_type id = MakeID(slot->generation, index);
+
+			slot->data.store(data.release(), std::memory_order_relaxed);
+			slot->id.store(id, std::memory_order_release);
+			m_size.fetch_add(1, std::memory_order_relaxed);
+
+			LOG_TRACE(U"💠 Created {0}[{1}] {2}"_fmt(m_assetTypeName, id, info));
+
+			return IDType(id);
 		}
 
 		void erase(const IDType id)
@@ -114,13 +346,25 @@ namespace s3d
 
 			std::lock_guard lock{ m_mutex };
 
-			const auto it = m_data.find(id);
+			const value_type index = (id.value() & IndexMask);
 
-			assert(it != m_data.end());
+			Slot* slot = getSlot(index);
+
+			if ((not slot) || (slot->id.load(std::memory_order_relaxed) != id.value()))
+			{
+				assert(false);
+				return;
+			}
 
 			LOG_TRACE(U"♻️ Released {0}[{1}]"_fmt(m_assetTypeName, id.value()));
 
-			m_data.erase(it);
+			// 先に ID を無効にしてから、新しいリーダーがデータを参照しないようにする
+			slot->id.store(FreeID, std::memory_order_release);
+			delete slot->data.exchange(nullptr, std::memory_order_acq_rel);
+
+			slot->generation = ((slot->generation == MaxGeneration) ? 1 : (slot->generation + 1));
+			m_freeIndices.push_back(index);
+			m_size.fetch_sub(1, std::memory_order_relaxed);
 
 			SIV3D_ENGINE(AssetMonitor)->released();
 		}
@@ -129,50 +373,57 @@ namespace s3d
 		{
 			std::lock_guard lock{ m_mutex };
 
-			for (const auto& data : m_data)
+			const size_t slotCount = m_slotCount.load(std::memory_order_relaxed);
+
+			// Null アセットは最後に解放する
+			for (size_t i = slotCount; 0 < i; --i)
 			{
-				if (const auto id = data.first; !id.isNull())
-				{
-					LOG_TRACE(U"♻️ Released {0}[{1}]"_fmt(m_assetTypeName, id.value()));
-				}
-				else
+				Slot* slot = getSlot(static_cast<value_type>(i - 1));
+
+				if (const auto id = slot->id.load(std::memory_order_relaxed);
+					id != FreeID)
 				{
-					LOG_TRACE(U"♻️ Released {0}[0(null)]"_fmt(m_assetTypeName));
+					if (id != IDType::NullID)
+					{
+						LOG_TRACE(U"♻️ Released {0}[{1}]"_fmt(m_assetTypeName, id));
+					}
+					else
+					{
+						LOG_TRACE(U"♻️ Released {0}[0(null)]"_fmt(m_assetTypeName));
+					}
+
+					slot->id.store(FreeID, std::memory_order_release);
+					delete slot->data.exchange(nullptr, std::memory_order_acq_rel);
 				}
 			}
 
-			m_data.clear();
-		}
+			m_nullData.store(nullptr, std::memory_order_release);
+			m_slotCount.store(0, std::memory_order_release);
+			m_size.store(0, std::memory_order_relaxed);
+			m_freeIndices.clear();
 
-		[[nodiscard]]
-		iterator begin()
-		{
-			return m_data.begin();
-		}
-
-		[[nodiscard]]
-		iterator end()
-		{
-			return m_data.end();
+			for (auto& page : m_pages)
+			{
+				delete[] page.exchange(nullptr, std::memory_order_acq_rel);
+			}
 		}
 
 		[[nodiscard]]
-		const_iterator begin() const
+		iterator begin() const
 		{
-			return m_data.cbegin();
+			return iterator{ this, 0 };
 		}
 
 		[[nodiscard]]
-		const_iterator end() const
+		iterator end() const
 		{
-			return m_data.cend();
+			return iterator{ this, Largest<size_t> };
 		}
 
 		[[nodiscard]]
 		size_t size() const noexcept
 		{
-			return m_data.size();
+			return m_size.load(std::memory_order_relaxed);
 		}
 	};
 }
-
@@ -0,0 +1,66 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/AssetLoader.hpp>
+# include <Siv3D/Asset/IAsset.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+
+namespace s3d
+{
+	double AssetLoadProgress::ratio() const noexcept
+	{
+		if (total == 0)
+		{
+			return 1.0;
+		}
+
+		return (static_cast<double>(loaded + failed) / total);
+	}
+
+	bool AssetLoadProgress::isDone() const noexcept
+	{
+		return ((loaded + failed) == total);
+	}
+
+	namespace AssetLoader
+	{
+		void SetMaxWorkers(const size_t maxWorkers)
+		{
+			SIV3D_ENGINE(Asset)->setMaxLoaderWorkers(maxWorkers);
+		}
+
+		size_t GetMaxWorkers()
+		{
+			return SIV3D_ENGINE(Asset)->getMaxLoaderWorkers();
+		}
+
+		void SetUploadBudget(const size_t count)
+		{
+			SIV3D_ENGINE(Asset)->setUploadBudget(count);
+		}
+
+		size_t GetUploadBudget()
+		{
+			return SIV3D_ENGINE(Asset)->getUploadBudget();
+		}
+
+		AssetLoadProgress GetProgress(const AssetTag& tag)
+		{
+			return SIV3D_ENGINE(Asset)->getLoadProgress(tag);
+		}
+
+		AssetLoaderStat GetStat()
+		{
+			return SIV3D_ENGINE(Asset)->getLoaderStat();
+		}
+	}
+}
@@ -17,6 +17,15 @@ namespace s3d
 {
 	bool CAssetMonitor::update()
 	{
+		// 1 秒ごとに非同期ロードのスループットを更新する
+		if (const auto now = std::chrono::steady_clock::now();
+			std::chrono::seconds{ 1 } <= (now - m_asyncLoad.windowStart))
+		{
+			const double elapsedSec = std::chrono::duration<double>(now - m_asyncLoad.windowStart).count();
+			m_asyncLoad.loadsPerSecond = (m_asyncLoad.completedCountInWindow.exchange(0) / elapsedSec);
+			m_asyncLoad.windowStart = now;
+		}
+
 		if (m_assetCreationWarningEnabled
 			&& std::all_of(m_assetCreationCount.begin(), m_assetCreationCount.end(), [](int32 n) { return (0 < n); })
 			&& std::all_of(m_assetReleaseCount.begin(), m_assetReleaseCount.end(), [](int32 n) { return (0 < n); }))
@@ -46,4 +55,40 @@ namespace s3d
 	{
 		++m_assetReleaseCount[0];
 	}
+
+	void CAssetMonitor::asyncLoadCompleted(const Duration& loadTime)
+	{
+		++m_asyncLoad.completedCount;
+		++m_asyncLoad.completedCountInWindow;
+		m_asyncLoad.totalLoadTimeMicrosec += static_cast<uint64>(loadTime.count() * 1'000'000);
+	}
+
+	void CAssetMonitor::asyncLoadCancelled()
+	{
+		++m_asyncLoad.cancelledCount;
+	}
+
+	void CAssetMonitor::asyncLoadWorkerStarted(const size_t workerCount)
+	{
+		size_t peak = m_asyncLoad.peakWorkerCount.load();
+
+		while ((peak < workerCount)
+			&& (not m_asyncLoad.peakWorkerCount.compare_exchange_weak(peak, workerCount))) {}
+	}
+
+	AssetLoaderStat CAssetMonitor::getAsyncLoadStat() const
+	{
+		AssetLoaderStat stat;
+		stat.peakWorkerCount = m_asyncLoad.peakWorkerCount;
+		stat.completedCount = m_asyncLoad.completedCount;
+		stat.cancelledCount = m_asyncLoad.cancelledCount;
+		stat.loadsPerSecond = m_asyncLoad.loadsPerSecond;
+
+		if (stat.completedCount)
+		{
+			stat.avgLoadMillisec = (m_asyncLoad.totalLoadTimeMicrosec / 1000.0 / stat.completedCount);
+		}
+
+		return stat;
+	}
 }
@@ -11,6 +11,8 @@
 
 # pragma once
 # include <array>
+# include <atomic>
+# include <chrono>
 # include "IAssetMonitor.hpp"
 
 namespace s3d
@@ -27,6 +29,14 @@ namespace s3d
 
 		void released() override;
 
+		void asyncLoadCompleted(const Duration& loadTime) override;
+
+		void asyncLoadCancelled() override;
+
+		void asyncLoadWorkerStarted(size_t workerCount) override;
+
+		AssetLoaderStat getAsyncLoadStat() const override;
+
 	private:
 
 		static constexpr size_t MonitoringFrameCount = 30;
@@ -36,5 +46,25 @@ namespace s3d
 		std::array<uint32, MonitoringFrameCount> m_assetCreationCount{};
 
 		std::array<uint32, MonitoringFrameCount> m_assetReleaseCount{};
+
+		// 非同期ロードの統計（ワーカースレッドから更新される）
+		struct AsyncLoad
+		{
+			std::atomic<size_t> completedCount{ 0 };
+
+			std::atomic<size_t> cancelledCount{ 0 };
+
+			std::atomic<size_t> peakWorkerCount{ 0 };
+
+			std::atomic<uint64> totalLoadTimeMicrosec{ 0 };
+
+			std::atomic<size_t> completedCountInWindow{ 0 };
+
+			std::chrono::steady_clock::time_point windowStart = std::chrono::steady_clock::now();
+
+			std::atomic<double> loadsPerSecond{ 0.0 };
+		};
+
+		AsyncLoad m_asyncLoad;
 	};
 }
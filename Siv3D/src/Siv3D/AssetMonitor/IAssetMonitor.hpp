@@ -11,6 +11,8 @@
 
 # pragma once
 # include <Siv3D/Common.hpp>
+# include <Siv3D/Duration.hpp>
+# include <Siv3D/AssetLoader.hpp>
 
 namespace s3d
 {
@@ -29,5 +31,15 @@ namespace s3d
 		virtual void created() = 0;
 
 		virtual void released() = 0;
+
+		virtual void asyncLoadCompleted(const Duration& loadTime) = 0;
+
+		virtual void asyncLoadCancelled() = 0;
+
+		virtual void asyncLoadWorkerStarted(size_t workerCount) = 0;
+
+		/// @brief 非同期ロードの統計を返します。ワーカー数や待機中のロード数は含みません。
+		[[nodiscard]]
+		virtual AssetLoaderStat getAsyncLoadStat() const = 0;
 	};
 }
@@ -21,6 +21,7 @@
 # include <ThirdParty/soloud/include/soloud_wavstream.h>
 # include <ThirdParty/soloud/include/soloud_speech.h>
 # include "DynamicAudioSource.hpp"
+# include "CompressedAudioSource.hpp"
 
 namespace s3d
 {
@@ -217,6 +218,53 @@ namespace s3d
 		m_initialized = true;
 	}
 
+	AudioData::AudioData(Compressed, SoLoud::Soloud* pSoloud, CompressedAudioCache& cache, Blob&& blob, const AudioFormat format, const Optional<uint64>& loopBegin)
+		: m_pSoloud{ pSoloud }
+		, m_isStreaming{ true }
+		, m_isCompressed{ true }
+		, m_loop{ loopBegin.has_value() }
+	{
+		if (CompressedAudioSource::IsSupported(format))
+		{
+			std::unique_ptr<CompressedAudioSource> source = std::make_unique<CompressedAudioSource>(cache);
+
+			if (not source->load(std::move(blob), format))
+			{
+				return;
+			}
+
+			m_sampleRate	= static_cast<uint32>(source->mBaseSamplerate);
+			m_lengthSample	= source->sampleCount();
+			m_audioSource	= std::move(source);
+		}
+		else
+		{
+			std::unique_ptr<SoLoud::WavStream> source = std::make_unique<SoLoud::WavStream>();
+
+			m_encoded = std::move(blob);
+
+			if (SoLoud::SO_NO_ERROR != source->loadMem(
+				static_cast<const unsigned char*>(static_cast<const void*>(m_encoded.data())),
+				static_cast<uint32>(m_encoded.size()), false, false))
+			{
+				return;
+			}
+
+			m_sampleRate	= static_cast<uint32>(source->mBaseSamplerate);
+			m_lengthSample	= source->mSampleCount;
+			m_audioSource	= std::move(source);
+		}
+
+		if (loopBegin)
+		{
+			m_loopTiming = { *loopBegin, 0 };
+			m_audioSource->setLooping(true);
+			m_audioSource->setLoopPoint(static_cast<double>(*loopBegin) / m_sampleRate);
+		}
+
+		m_initialized	= true;
+	}
+
 	AudioData::~AudioData() {}
 
 	bool AudioData::isInitialized() const noexcept
@@ -244,6 +292,11 @@ namespace s3d
 		return m_isStreaming;
 	}
 
+	bool AudioData::isCompressed() const noexcept
+	{
+		return m_isCompressed;
+	}
+
 	int64 AudioData::samplesPlayed() const
 	{
 		if (not m_handle)
@@ -14,8 +14,11 @@
 # include <Siv3D/StringView.hpp>
 # include <Siv3D/Wave.hpp>
 # include <Siv3D/Audio.hpp>
+# include <Siv3D/Blob.hpp>
+# include <Siv3D/AudioFormat.hpp>
 # include <Siv3D/KlattTTSParameters.hpp>
 # include "AudioResourceHolder.hpp"
+# include "CompressedAudioCache.hpp"
 # include <ThirdParty/soloud/include/soloud.h>
 
 namespace s3d
@@ -30,6 +33,8 @@ namespace s3d
 
 		struct TextToSpeech {};
 
+		struct Compressed {};
+
 		AudioData() = default;
 
 		explicit AudioData(Null, SoLoud::Soloud* pSoloud);
@@ -44,6 +49,8 @@ namespace s3d
 
 		AudioData(TextToSpeech, SoLoud::Soloud* pSoloud, StringView text, const KlattTTSParameters& param);
 
+		AudioData(Compressed, SoLoud::Soloud* pSoloud, CompressedAudioCache& cache, Blob&& blob, AudioFormat format, const Optional<uint64>& loopBegin);
+
 		~AudioData();
 
 		[[nodiscard]]
@@ -61,6 +68,9 @@ namespace s3d
 		[[nodiscard]]
 		bool isStreaming() const noexcept;
 
+		[[nodiscard]]
+		bool isCompressed() const noexcept;
+
 		[[nodiscard]]
 		int64 samplesPlayed() const;
 
@@ -148,6 +158,9 @@ namespace s3d
 
 	# endif
 
+		// WAVE, FLAC, MP3 を圧縮したまま再生する場合、m_audioSource が参照するデータ
+		Blob m_encoded;
+
 		std::unique_ptr<SoLoud::AudioSource> m_audioSource;
 
 		SoLoud::Soloud* m_pSoloud = nullptr;
@@ -162,6 +175,8 @@ namespace s3d
 
 		bool m_isStreaming = false;
 
+		bool m_isCompressed = false;
+
 		bool m_loop = false;
 
 		SoLoud::handle m_handle = 0;
@@ -16,9 +16,12 @@
 # include <Siv3D/FFTResult.hpp>
 # include <Siv3D/FFTSampleLength.hpp>
 # include <Siv3D/AudioDecoder.hpp>
+# include <Siv3D/MemoryReader.hpp>
+# include <Siv3D/MemoryViewReader.hpp>
 # include <Siv3D/KlattTTSParameters.hpp>
 # include <Siv3D/DLL.hpp>
 # include "CAudio.hpp"
+# include "CompressedAudioSource.hpp"
 
 namespace s3d
 {
@@ -30,10 +33,10 @@ namespace s3d
 			const uint32 sampleRate = audio->sampleRate();
 			const uint32 samples = audio->samples();
 
-			return U"(sampleRate: {0}Hz, samples: {1} ({2:.1f}s), loopTiming: {3}, {4}, isStreaming: {5})"_fmt(
+			return U"(sampleRate: {0}Hz, samples: {1} ({2:.1f}s), loopTiming: {3}, {4}, isStreaming: {5}, isCompressed: {6})"_fmt(
 				sampleRate, samples,
 				(static_cast<double>(samples) / sampleRate),
-				audio->loopTiming().beginPos, audio->loopTiming().endPos, audio->isStreaming());
+				audio->loopTiming().beginPos, audio->loopTiming().endPos, audio->isStreaming(), audio->isCompressed());
 		}
 	}
 
@@ -283,6 +286,37 @@ namespace s3d
 		return m_audios.add(std::move(audio), info);
 	}
 
+	Audio::IDType CAudio::createCompressed(Blob&& blob, const Optional<uint64>& loopBegin)
+	{
+		AudioFormat format = AudioFormat::Unspecified;
+		{
+			MemoryViewReader reader{ blob.data(), blob.size() };
+			format = AudioDecoder::GetAudioFormat(reader);
+		}
+
+		// 圧縮したまま再生できない形式の場合のフォールバック
+		if ((not CompressedAudioSource::IsSupported(format))
+			&& (format != AudioFormat::WAVE)
+			&& (format != AudioFormat::MP3)
+			&& (format != AudioFormat::FLAC))
+		{
+			return create(Wave{ MemoryReader{ std::move(blob) }, format }, loopBegin.map([](uint64 pos) { return AudioLoopTiming{ pos, 0 }; }));
+		}
+
+		// Audio を作成
+		auto audio = std::make_unique<AudioData>(AudioData::Compressed{}, m_soloud.get(), m_compressedAudioCache, std::move(blob), format, loopBegin);
+
+		if (not audio->isInitialized()) // もし作成に失敗していたら
+		{
+			return Audio::IDType::NullAsset();
+		}
+
+		const String info = detail::ToInfo(audio);
+
+		// Audio を管理に登録
+		return m_audios.add(std::move(audio), info);
+	}
+
 	Audio::IDType CAudio::createDynamic(const std::shared_ptr<IAudioStream>& pAudioStream, const Arg::sampleRate_<uint32> sampleRate)
 	{
 		// Audio を作成
@@ -695,6 +729,11 @@ namespace s3d
 		return *m_soloud;
 	}
 
+	CompressedAudioCache& CAudio::getCompressedAudioCache()
+	{
+		return m_compressedAudioCache;
+	}
+
 	const SoundTouchFunctions* CAudio::getSoundTouchFunctions() const noexcept
 	{
 		if (not m_soundTouchAvailable)
@@ -14,6 +14,7 @@
 # include "IAudio.hpp"
 # include "AudioData.hpp"
 # include "AudioBus.hpp"
+# include "CompressedAudioCache.hpp"
 # include "SoundTouchFunctions.hpp"
 # include <Siv3D/DLL.hpp>
 
@@ -39,6 +40,8 @@ namespace s3d
 
 		Audio::IDType createStreamingLoop(FilePathView path, uint64 loopBegin) override;
 
+		Audio::IDType createCompressed(Blob&& blob, const Optional<uint64>& loopBegin) override;
+
 		Audio::IDType createDynamic(const std::shared_ptr<IAudioStream>& pAudioStream, Arg::sampleRate_<uint32> sampleRate) override;
 
 		void release(Audio::IDType handleID) override;
@@ -165,6 +168,8 @@ namespace s3d
 
 		SoLoud::Soloud& getSoloud() override;
 
+		CompressedAudioCache& getCompressedAudioCache() override;
+
 		const SoundTouchFunctions* getSoundTouchFunctions() const noexcept override;
 
 		bool supportsPitchShift() const noexcept override;
@@ -185,6 +190,9 @@ namespace s3d
 		static constexpr uint32 MaxActiveVoiceCount = 72; // hard limit: 1024
 
 		std::unique_ptr<SoLoud::Soloud> m_soloud;
+
+		// 圧縮オーディオのソースより後に破棄される必要がある
+		CompressedAudioCache m_compressedAudioCache;
 		
 		std::array<std::unique_ptr<AudioBus>, Audio::MaxBusCount> m_buses;
 
@@ -0,0 +1,134 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "CompressedAudioCache.hpp"
+
+namespace s3d
+{
+	uint32 CompressedAudioCache::registerSource() noexcept
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return ++m_nextSourceID;
+	}
+
+	void CompressedAudioCache::removeSource(const uint32 sourceID)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		for (auto it = m_entries.begin(); it != m_entries.end();)
+		{
+			if ((it->key >> 32) == sourceID)
+			{
+				m_usage -= SizeOf(it->block);
+				m_index.erase(it->key);
+				it = m_entries.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	CompressedAudioCache::Block CompressedAudioCache::find(const uint32 sourceID, const uint32 blockIndex)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		const auto it = m_index.find(MakeKey(sourceID, blockIndex));
+
+		if (it == m_index.end())
+		{
+			++m_missCount;
+			return nullptr;
+		}
+
+		++m_hitCount;
+
+		// 最も最近使われたブロックとして先頭に移動する
+		m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+		return it->second->block;
+	}
+
+	void CompressedAudioCache::insert(const uint32 sourceID, const uint32 blockIndex, const Block& block)
+	{
+		const size_t size = SizeOf(block);
+
+		std::lock_guard lock{ m_mutex };
+
+		if (m_capacity < size)
+		{
+			return;
+		}
+
+		const uint64 key = MakeKey(sourceID, blockIndex);
+
+		if (m_index.contains(key))
+		{
+			return;
+		}
+
+		m_entries.push_front(Entry{ key, block });
+		m_index.emplace(key, m_entries.begin());
+		m_usage += size;
+
+		evict();
+	}
+
+	void CompressedAudioCache::setCapacity(const size_t bytes)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_capacity = bytes;
+
+		evict();
+	}
+
+	size_t CompressedAudioCache::getCapacity() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_capacity;
+	}
+
+	size_t CompressedAudioCache::getUsage() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_usage;
+	}
+
+	uint64 CompressedAudioCache::getHitCount() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_hitCount;
+	}
+
+	uint64 CompressedAudioCache::getMissCount() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_missCount;
+	}
+
+	void CompressedAudioCache::evict()
+	{
+		while (m_capacity < m_usage)
+		{
+			const Entry& entry = m_entries.back();
+			m_usage -= SizeOf(entry.block);
+			m_index.erase(entry.key);
+			m_entries.pop_back();
+		}
+	}
+}
@@ -0,0 +1,121 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <mutex>
+# include <list>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashTable.hpp>
+
+namespace s3d
+{
+	/// @brief 圧縮オーディオのデコード済みブロックを保持する LRU キャッシュ
+	/// @remark 同じ圧縮オーディオを繰り返し再生する際、先頭部分の再デコードを省きます。
+	/// @remark すべての圧縮オーディオで 1 つのキャッシュを共有し、合計サイズを capacity 以下に保ちます。
+	class CompressedAudioCache
+	{
+	public:
+
+		/// @brief 1 ブロックあたりのサンプル数
+		static constexpr uint32 BlockFrames = 4096;
+
+		/// @brief デフォルトのキャッシュ容量（バイト）
+		static constexpr size_t DefaultCapacity = (4 * 1024 * 1024);
+
+		/// @brief デコード済みのブロック。左チャンネル、右チャンネルの順に並んだ float 配列
+		using Block = std::shared_ptr<const Array<float>>;
+
+		CompressedAudioCache() = default;
+
+		CompressedAudioCache(const CompressedAudioCache&) = delete;
+
+		CompressedAudioCache& operator =(const CompressedAudioCache&) = delete;
+
+		/// @brief 新しい圧縮オーディオのための ID を発行します。
+		/// @return 圧縮オーディオの ID
+		[[nodiscard]]
+		uint32 registerSource() noexcept;
+
+		/// @brief 圧縮オーディオのブロックをすべてキャッシュから削除します。
+		/// @param sourceID 圧縮オーディオの ID
+		void removeSource(uint32 sourceID);
+
+		/// @brief キャッシュからブロックを探します。
+		/// @param sourceID 圧縮オーディオの ID
+		/// @param blockIndex ブロックのインデックス
+		/// @return 見つかったブロック。見つからなかった場合は nullptr
+		[[nodiscard]]
+		Block find(uint32 sourceID, uint32 blockIndex);
+
+		/// @brief ブロックをキャッシュに追加します。
+		/// @param sourceID 圧縮オーディオの ID
+		/// @param blockIndex ブロックのインデックス
+		/// @param block ブロック
+		void insert(uint32 sourceID, uint32 blockIndex, const Block& block);
+
+		/// @brief キャッシュ容量を設定します。
+		/// @param bytes キャッシュ容量（バイト）。0 の場合はキャッシュを無効にします。
+		void setCapacity(size_t bytes);
+
+		[[nodiscard]]
+		size_t getCapacity() const;
+
+		[[nodiscard]]
+		size_t getUsage() const;
+
+		[[nodiscard]]
+		uint64 getHitCount() const;
+
+		[[nodiscard]]
+		uint64 getMissCount() const;
+
+	private:
+
+		struct Entry
+		{
+			uint64 key = 0;
+
+			Block block;
+		};
+
+		[[nodiscard]]
+		static constexpr uint64 MakeKey(uint32 sourceID, uint32 blockIndex) noexcept
+		{
+			return ((static_cast<uint64>(sourceID) << 32) | blockIndex);
+		}
+
+		[[nodiscard]]
+		static size_t SizeOf(const Block& block) noexcept
+		{
+			return (block->size() * sizeof(float));
+		}
+
+		void evict();
+
+		mutable std::mutex m_mutex;
+
+		// 先頭が最も最近使われたブロック
+		std::list<Entry> m_entries;
+
+		HashTable<uint64, std::list<Entry>::iterator> m_index;
+
+		size_t m_capacity = DefaultCapacity;
+
+		size_t m_usage = 0;
+
+		uint64 m_hitCount = 0;
+
+		uint64 m_missCount = 0;
+
+		uint32 m_nextSourceID = 0;
+	};
+}
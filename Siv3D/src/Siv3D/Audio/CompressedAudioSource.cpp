@@ -0,0 +1,511 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/MemoryViewReader.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "CompressedAudioSource.hpp"
+
+# if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
+#	include <ThirdParty-prebuilt/vorbis/vorbisfile.h>
+#	include <ThirdParty-prebuilt/ogg/ogg.h>
+#	include <ThirdParty-prebuilt/opus/opus.h>
+#	include <ThirdParty-prebuilt/opus/opus_multistream.h>
+#	include <ThirdParty-prebuilt/opus/opusfile.h>
+# else
+#	include <vorbis/vorbisfile.h>
+#	include <ogg/ogg.h>
+#	include <opus/opus.h>
+#	include <opus/opus_multistream.h>
+#	include <ThirdParty-prebuilt/opus/opusfile.h>
+# endif
+
+namespace s3d
+{
+	namespace detail
+	{
+		static size_t ReadOgg_Callback(void* dst, size_t size1, size_t size2, void* data)
+		{
+			MemoryViewReader* reader = static_cast<MemoryViewReader*>(data);
+
+			return static_cast<size_t>(reader->read(dst, static_cast<int64>(size1 * size2)));
+		}
+
+		static int SeekOgg_Callback(void* data, ogg_int64_t to, int type)
+		{
+			MemoryViewReader* reader = static_cast<MemoryViewReader*>(data);
+
+			int64 pos = 0;
+
+			switch (type)
+			{
+			case SEEK_CUR:
+				pos = (reader->getPos() + to);
+				break;
+			case SEEK_END:
+				pos = (reader->size() + to);
+				break;
+			case SEEK_SET:
+				pos = to;
+				break;
+			default:
+				return -1;
+			}
+
+			if ((pos < 0) || (reader->size() < pos))
+			{
+				return -1;
+			}
+
+			reader->setPos(pos);
+
+			return 0;
+		}
+
+		static int CloseOgg_Callback(void*)
+		{
+			return 0;
+		}
+
+		static long TellOgg_Callback(void* data)
+		{
+			MemoryViewReader* reader = static_cast<MemoryViewReader*>(data);
+
+			return static_cast<long>(reader->getPos());
+		}
+	}
+
+	class VorbisStreamDecoder final : public CompressedAudioDecoder
+	{
+	public:
+
+		explicit VorbisStreamDecoder(const Blob& blob)
+			: m_reader{ blob.data(), blob.size() }
+		{
+			ov_callbacks callbacks;
+			callbacks.read_func = detail::ReadOgg_Callback;
+			callbacks.seek_func = detail::SeekOgg_Callback;
+			callbacks.close_func = detail::CloseOgg_Callback;
+			callbacks.tell_func = detail::TellOgg_Callback;
+
+			if (::ov_open_callbacks(&m_reader, &m_vf, nullptr, -1, callbacks) != 0)
+			{
+				return;
+			}
+
+			m_opened = true;
+			m_channels = ::ov_info(&m_vf, -1)->channels;
+		}
+
+		~VorbisStreamDecoder() override
+		{
+			if (m_opened)
+			{
+				::ov_clear(&m_vf);
+			}
+		}
+
+		[[nodiscard]]
+		explicit operator bool() const noexcept
+		{
+			return (m_opened && (1 <= m_channels));
+		}
+
+		[[nodiscard]]
+		uint32 sampleRate()
+		{
+			return static_cast<uint32>(::ov_info(&m_vf, -1)->rate);
+		}
+
+		[[nodiscard]]
+		uint32 sampleCount()
+		{
+			const int64 total = ::ov_pcm_total(&m_vf, -1);
+
+			return ((0 < total) ? static_cast<uint32>(total) : 0);
+		}
+
+		bool seek(const uint64 frame) override
+		{
+			return (::ov_pcm_seek(&m_vf, static_cast<ogg_int64_t>(frame)) == 0);
+		}
+
+		uint32 read(float* left, float* right, const uint32 frames) override
+		{
+			float** pcm = nullptr;
+			int bitstream = 0;
+
+			const long result = ::ov_read_float(&m_vf, &pcm, static_cast<int>(frames), &bitstream);
+
+			if (result <= 0)
+			{
+				return 0;
+			}
+
+			// 3 チャンネル以上の場合は先頭の 2 チャンネルを使う
+			std::memcpy(left, pcm[0], (sizeof(float) * result));
+			std::memcpy(right, pcm[(m_channels == 1) ? 0 : 1], (sizeof(float) * result));
+
+			return static_cast<uint32>(result);
+		}
+
+	private:
+
+		MemoryViewReader m_reader;
+
+		OggVorbis_File m_vf;
+
+		int32 m_channels = 0;
+
+		bool m_opened = false;
+	};
+
+	class OpusStreamDecoder final : public CompressedAudioDecoder
+	{
+	public:
+
+		// Opus は常に 48 kHz でデコードされる
+		static constexpr uint32 SampleRate = 48000;
+
+		explicit OpusStreamDecoder(const Blob& blob)
+		{
+			int error = 0;
+			m_opus = ::op_open_memory(static_cast<const unsigned char*>(static_cast<const void*>(blob.data())), blob.size(), &error);
+		}
+
+		~OpusStreamDecoder() override
+		{
+			if (m_opus)
+			{
+				::op_free(m_opus);
+			}
+		}
+
+		[[nodiscard]]
+		explicit operator bool() const noexcept
+		{
+			return (m_opus != nullptr);
+		}
+
+		[[nodiscard]]
+		uint32 sampleCount() const
+		{
+			const int64 total = ::op_pcm_total(m_opus, -1);
+
+			return ((0 < total) ? static_cast<uint32>(total) : 0);
+		}
+
+		bool seek(const uint64 frame) override
+		{
+			return (::op_pcm_seek(m_opus, static_cast<ogg_int64_t>(frame)) == 0);
+		}
+
+		uint32 read(float* left, float* right, const uint32 frames) override
+		{
+			uint32 decoded = 0;
+
+			while (decoded < frames)
+			{
+				const int32 request = static_cast<int32>(Min<size_t>((frames - decoded), (std::size(m_buffer) / 2)));
+
+				// モノラルはステレオに変換される
+				const int32 result = ::op_read_float_stereo(m_opus, m_buffer, (request * 2));
+
+				if (result <= 0)
+				{
+					break;
+				}
+
+				for (int32 i = 0; i < result; ++i)
+				{
+					left[decoded + i] = m_buffer[i * 2];
+					right[decoded + i] = m_buffer[i * 2 + 1];
+				}
+
+				decoded += static_cast<uint32>(result);
+			}
+
+			return decoded;
+		}
+
+	private:
+
+		OggOpusFile* m_opus = nullptr;
+
+		float m_buffer[2048 * 2];
+	};
+
+	class CompressedAudioInstance : public SoLoud::AudioSourceInstance
+	{
+	public:
+
+		explicit CompressedAudioInstance(const CompressedAudioSource* pParent)
+			: m_pParent{ pParent }
+		{
+			mChannels = 2;
+		}
+
+		unsigned int getAudio(float* aBuffer, unsigned int aSamplesToRead, unsigned int aBufferSize) override
+		{
+			const uint32 sampleCount = m_pParent->sampleCount();
+			uint32 written = 0;
+
+			while ((written < aSamplesToRead) && (m_frame < sampleCount))
+			{
+				const uint32 blockIndex = (m_frame / CompressedAudioCache::BlockFrames);
+
+				if (blockIndex != m_blockIndex)
+				{
+					m_block = acquireBlock(blockIndex);
+					m_blockIndex = blockIndex;
+				}
+
+				if (not m_block)
+				{
+					break;
+				}
+
+				const uint32 blockFrames = static_cast<uint32>(m_block->size() / 2);
+				const uint32 offset = (m_frame - (blockIndex * CompressedAudioCache::BlockFrames));
+
+				if (blockFrames <= offset)
+				{
+					break;
+				}
+
+				const uint32 count = Min((aSamplesToRead - written), (blockFrames - offset));
+				const float* pSrc = m_block->data();
+
+				std::memcpy((aBuffer + written), (pSrc + offset), (sizeof(float) * count));
+				std::memcpy((aBuffer + aBufferSize + written), (pSrc + blockFrames + offset), (sizeof(float) * count));
+
+				written += count;
+				m_frame += count;
+			}
+
+			return written;
+		}
+
+		bool hasEnded() override
+		{
+			return (m_pParent->sampleCount() <= m_frame);
+		}
+
+		SoLoud::result seek(SoLoud::time aSeconds, float*, unsigned int) override
+		{
+			const double frame = Max(0.0, (aSeconds * mBaseSamplerate));
+
+			m_frame = static_cast<uint32>(Min(frame, static_cast<double>(m_pParent->sampleCount())));
+			mStreamPosition = aSeconds;
+
+			return SoLoud::SO_NO_ERROR;
+		}
+
+		SoLoud::result rewind() override
+		{
+			m_frame = 0;
+			mStreamPosition = 0.0;
+
+			return SoLoud::SO_NO_ERROR;
+		}
+
+	private:
+
+		static constexpr uint32 InvalidBlockIndex = UINT32_MAX;
+
+		const CompressedAudioSource* m_pParent = nullptr;
+
+		// デコーダはキャッシュに無いブロックが必要になるまで作成しない
+		std::unique_ptr<CompressedAudioDecoder> m_decoder;
+
+		uint64 m_decoderFrame = 0;
+
+		CompressedAudioCache::Block m_block;
+
+		uint32 m_blockIndex = InvalidBlockIndex;
+
+		uint32 m_frame = 0;
+
+		[[nodiscard]]
+		CompressedAudioCache::Block acquireBlock(const uint32 blockIndex)
+		{
+			if (auto block = m_pParent->getBlock(blockIndex))
+			{
+				return block;
+			}
+
+			const uint64 blockBegin = (static_cast<uint64>(blockIndex) * CompressedAudioCache::BlockFrames);
+
+			if (not m_decoder)
+			{
+				if (m_decoder = m_pParent->createDecoder();
+					not m_decoder)
+				{
+					return nullptr;
+				}
+
+				m_decoderFrame = 0;
+			}
+
+			if (m_decoderFrame != blockBegin)
+			{
+				if (not m_decoder->seek(blockBegin))
+				{
+					return nullptr;
+				}
+
+				m_decoderFrame = blockBegin;
+			}
+
+			const uint32 frames = static_cast<uint32>(Min<uint64>(CompressedAudioCache::BlockFrames, (m_pParent->sampleCount() - blockBegin)));
+			Array<float> samples(frames * 2);
+
+			const uint32 decoded = decode(samples.data(), (samples.data() + frames), frames);
+			m_decoderFrame += decoded;
+
+			if (decoded < frames)
+			{
+				// 長さの情報よりデータが短い場合は無音で埋める
+				std::fill((samples.begin() + decoded), (samples.begin() + frames), 0.0f);
+				std::fill((samples.begin() + frames + decoded), samples.end(), 0.0f);
+			}
+
+			auto block = std::make_shared<const Array<float>>(std::move(samples));
+			m_pParent->addBlock(blockIndex, block);
+
+			return block;
+		}
+
+		uint32 decode(float* left, float* right, const uint32 frames)
+		{
+			uint32 decoded = 0;
+
+			while (decoded < frames)
+			{
+				const uint32 result = m_decoder->read((left + decoded), (right + decoded), (frames - decoded));
+
+				if (result == 0)
+				{
+					break;
+				}
+
+				decoded += result;
+			}
+
+			return decoded;
+		}
+	};
+
+	bool CompressedAudioSource::IsSupported(const AudioFormat format) noexcept
+	{
+		return ((format == AudioFormat::OggVorbis)
+			|| (format == AudioFormat::Opus));
+	}
+
+	CompressedAudioSource::CompressedAudioSource(CompressedAudioCache& cache)
+		: m_cache{ cache }
+		, m_sourceID{ cache.registerSource() }
+	{
+		mChannels = 2;
+	}
+
+	CompressedAudioSource::~CompressedAudioSource()
+	{
+		stop();
+
+		m_cache.removeSource(m_sourceID);
+	}
+
+	bool CompressedAudioSource::load(Blob&& blob, const AudioFormat format)
+	{
+		m_encoded = std::move(blob);
+		m_format = format;
+
+		if (format == AudioFormat::OggVorbis)
+		{
+			VorbisStreamDecoder decoder{ m_encoded };
+
+			if (not decoder)
+			{
+				LOG_FAIL(U"❌ CompressedAudioSource::load(): Failed to open OggVorbis data");
+				return false;
+			}
+
+			mBaseSamplerate = static_cast<float>(decoder.sampleRate());
+			m_sampleCount = decoder.sampleCount();
+		}
+		else if (format == AudioFormat::Opus)
+		{
+			const OpusStreamDecoder decoder{ m_encoded };
+
+			if (not decoder)
+			{
+				LOG_FAIL(U"❌ CompressedAudioSource::load(): Failed to open Opus data");
+				return false;
+			}
+
+			mBaseSamplerate = static_cast<float>(OpusStreamDecoder::SampleRate);
+			m_sampleCount = decoder.sampleCount();
+		}
+		else
+		{
+			return false;
+		}
+
+		return (m_sampleCount != 0);
+	}
+
+	SoLoud::AudioSourceInstance* CompressedAudioSource::createInstance()
+	{
+		return new CompressedAudioInstance(this);
+	}
+
+	uint32 CompressedAudioSource::sampleCount() const noexcept
+	{
+		return m_sampleCount;
+	}
+
+	size_t CompressedAudioSource::encodedSize() const noexcept
+	{
+		return m_encoded.size();
+	}
+
+	std::unique_ptr<CompressedAudioDecoder> CompressedAudioSource::createDecoder() const
+	{
+		if (m_format == AudioFormat::OggVorbis)
+		{
+			if (auto decoder = std::make_unique<VorbisStreamDecoder>(m_encoded);
+				*decoder)
+			{
+				return decoder;
+			}
+		}
+		else if (m_format == AudioFormat::Opus)
+		{
+			if (auto decoder = std::make_unique<OpusStreamDecoder>(m_encoded);
+				*decoder)
+			{
+				return decoder;
+			}
+		}
+
+		return nullptr;
+	}
+
+	CompressedAudioCache::Block CompressedAudioSource::getBlock(const uint32 blockIndex) const
+	{
+		return m_cache.find(m_sourceID, blockIndex);
+	}
+
+	void CompressedAudioSource::addBlock(const uint32 blockIndex, const CompressedAudioCache::Block& block) const
+	{
+		m_cache.insert(m_sourceID, blockIndex, block);
+	}
+}
@@ -0,0 +1,92 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Blob.hpp>
+# include <Siv3D/AudioFormat.hpp>
+# include <ThirdParty/soloud/include/soloud.h>
+# include "CompressedAudioCache.hpp"
+
+namespace s3d
+{
+	/// @brief 圧縮オーディオのデコーダ
+	class CompressedAudioDecoder
+	{
+	public:
+
+		virtual ~CompressedAudioDecoder() = default;
+
+		/// @brief デコード位置を変更します。
+		/// @param frame デコード位置（サンプル）
+		/// @return 成功した場合 true, それ以外の場合は false
+		virtual bool seek(uint64 frame) = 0;
+
+		/// @brief 左右のチャンネルに分けてデコードします。
+		/// @param left 左チャンネルの書き込み先
+		/// @param right 右チャンネルの書き込み先
+		/// @param frames デコードするサンプル数
+		/// @return デコードしたサンプル数。終端に達した場合は 0
+		virtual uint32 read(float* left, float* right, uint32 frames) = 0;
+	};
+
+	/// @brief エンコードされたデータをメモリ上に保持し、ミキサースレッドで少しずつデコードするオーディオソース
+	/// @remark OggVorbis と Opus に対応します。
+	class CompressedAudioSource : public SoLoud::AudioSource
+	{
+	public:
+
+		/// @brief 対応する形式であるかを返します。
+		/// @param format オーディオフォーマット
+		/// @return 対応する形式である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		static bool IsSupported(AudioFormat format) noexcept;
+
+		explicit CompressedAudioSource(CompressedAudioCache& cache);
+
+		virtual ~CompressedAudioSource();
+
+		/// @brief エンコードされたデータを読み込みます。
+		/// @param blob エンコードされたデータ
+		/// @param format オーディオフォーマット
+		/// @return 成功した場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool load(Blob&& blob, AudioFormat format);
+
+		virtual SoLoud::AudioSourceInstance* createInstance();
+
+		[[nodiscard]]
+		uint32 sampleCount() const noexcept;
+
+		[[nodiscard]]
+		size_t encodedSize() const noexcept;
+
+		[[nodiscard]]
+		std::unique_ptr<CompressedAudioDecoder> createDecoder() const;
+
+		[[nodiscard]]
+		CompressedAudioCache::Block getBlock(uint32 blockIndex) const;
+
+		void addBlock(uint32 blockIndex, const CompressedAudioCache::Block& block) const;
+
+	private:
+
+		CompressedAudioCache& m_cache;
+
+		Blob m_encoded;
+
+		AudioFormat m_format = AudioFormat::Unspecified;
+
+		uint32 m_sampleCount = 0;
+
+		uint32 m_sourceID = 0;
+	};
+}
@@ -21,6 +21,8 @@ namespace SoLoud
 namespace s3d
 {
 	class AudioBus;
+	class Blob;
+	class CompressedAudioCache;
 	struct FFTResult;
 	struct SoundTouchFunctions;
 	struct KlattTTSParameters;
@@ -45,6 +47,8 @@ namespace s3d
 
 		virtual Audio::IDType createStreamingLoop(FilePathView path, uint64 loopBegin) = 0;
 
+		virtual Audio::IDType createCompressed(Blob&& blob, const Optional<uint64>& loopBegin) = 0;
+
 		virtual Audio::IDType createDynamic(const std::shared_ptr<IAudioStream>& pAudioStream, Arg::sampleRate_<uint32> sampleRate) = 0;
 
 		virtual void release(Audio::IDType handleID) = 0;
@@ -171,6 +175,8 @@ namespace s3d
 
 		virtual SoLoud::Soloud& getSoloud() = 0;
 
+		virtual CompressedAudioCache& getCompressedAudioCache() = 0;
+
 		virtual const SoundTouchFunctions* getSoundTouchFunctions() const noexcept = 0;
 
 		virtual bool supportsPitchShift() const noexcept = 0;
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/Audio.hpp>
+# include <Siv3D/Blob.hpp>
 # include <Siv3D/Audio/IAudio.hpp>
 # include <Siv3D/Troubleshooting/Troubleshooting.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
@@ -143,6 +144,31 @@ namespace s3d
 		SIV3D_ENGINE(AssetMonitor)->created();
 	}
 
+	Audio::Audio(CompressedInMemory, const FilePathView path)
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Audio)->createCompressed(Blob{ path }, none))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
+
+	Audio::Audio(CompressedInMemory, const FilePathView path, const Loop loop)
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(
+			SIV3D_ENGINE(Audio)->createCompressed(Blob{ path }, (loop ? Optional<uint64>{ 0 } : none)))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
+
+	Audio::Audio(CompressedInMemory, const FilePathView path, const Arg::loopBegin_<uint64> loopBegin)
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Audio)->createCompressed(Blob{ path }, *loopBegin))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
+
+	Audio::Audio(CompressedInMemory, IReader&& reader)
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Audio)->createCompressed(Blob{ reader }, none))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
+
 	Audio::Audio(const GMInstrument instrument, const uint8 key, const Duration& duration, const double velocity, const Arg::sampleRate_<uint32> sampleRate)
 		: Audio{ (detail::CheckEngine(), Wave{ instrument, key, duration, velocity, sampleRate }) } {}
 
@@ -240,9 +240,14 @@ namespace s3d
 		return SIV3D_ENGINE(Asset)->load(AssetType::Audio, name, {});
 	}
 
-	void AudioAsset::LoadAsync(const AssetNameView name)
+	void AudioAsset::LoadAsync(const AssetNameView name, const int32 priority)
 	{
-		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Audio, name, {});
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Audio, name, {}, priority);
+	}
+
+	bool AudioAsset::CancelLoadAsync(const AssetNameView name)
+	{
+		return SIV3D_ENGINE(Asset)->cancelLoadAsync(AssetType::Audio, name);
 	}
 
 	void AudioAsset::Wait(const AssetNameView name)
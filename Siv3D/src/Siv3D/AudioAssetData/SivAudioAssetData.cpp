@@ -10,6 +10,9 @@
 //-----------------------------------------------
 
 # include <Siv3D/AudioAssetData.hpp>
+# include <Siv3D/ProfilerZone.hpp>
+# include <Siv3D/Asset/IAsset.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
 
 namespace s3d
 {
@@ -44,6 +47,8 @@ namespace s3d
 	{
 		if (isUninitialized())
 		{
+			const ProfilerZone profilerZone{ U"AudioAsset::load" };
+
 			if (onLoad(*this, hint))
 			{
 				setState(AssetState::Loaded);
@@ -70,9 +75,17 @@ namespace s3d
 		{
 			setState(AssetState::AsyncLoading);
 
-			m_task = Async([this, hint = hint]()
+			// CAsset のローダープールで、優先度順に実行される
+			m_task = SIV3D_ENGINE(Asset)->submitAsyncLoad(*this,
+				[this, hint = hint]()
 				{
+					const ProfilerZone profilerZone{ U"AudioAsset::load" };
+
 					setState(onLoad(*this, hint) ? AssetState::Loaded : AssetState::Failed);
+				},
+				[this]()
+				{
+					setState(AssetState::Uninitialized);
 				});
 		}
 	}
@@ -81,6 +94,9 @@ namespace s3d
 	{
 		if (m_task.isValid())
 		{
+			// まだ開始していなければ、このスレッドで直ちにロードする
+			SIV3D_ENGINE(Asset)->runPendingAsyncLoad(*this);
+
 			m_task.get();
 		}
 	}
@@ -94,7 +110,15 @@ namespace s3d
 
 		if (isAsyncLoading())
 		{
+			// まだ開始していないロードはキャンセルする
+			SIV3D_ENGINE(Asset)->cancelAsyncLoad(*this);
+
 			wait();
+
+			if (isUninitialized())
+			{
+				return;
+			}
 		}
 
 		onRelease(*this);
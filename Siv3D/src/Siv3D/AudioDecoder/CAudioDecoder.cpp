@@ -12,6 +12,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include "CAudioDecoder.hpp"
 # include <Siv3D/AudioFormat/WAVEDecoder.hpp>
 # include <Siv3D/AudioFormat/OggVorbisDecoder.hpp>
@@ -92,6 +93,7 @@ namespace s3d
 	Wave CAudioDecoder::decode(IReader& reader, const FilePathView pathHint, const AudioFormat imageFormat)
 	{
 		LOG_SCOPED_TRACE(U"CAudioDecoder::decode()");
+		const ProfilerZone profilerZone{ U"AudioDecoder::decode" };
 
 		auto it = findDecoder(imageFormat);
 
@@ -113,6 +115,7 @@ namespace s3d
 	Wave CAudioDecoder::decode(IReader& reader, const StringView decoderName)
 	{
 		LOG_SCOPED_TRACE(U"CAudioDecoder::decode({})"_fmt(decoderName));
+		const ProfilerZone profilerZone{ U"AudioDecoder::decode" };
 
 		const auto it = findDecoder(decoderName);
 
@@ -0,0 +1,422 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/CSVReader.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/EngineLog.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static constexpr bool IsEscaped(const char ch, const char quote, const char separator, const char escape) noexcept
+		{
+			return ((ch == 'n') || (ch == quote) || (ch == separator) || (ch == escape));
+		}
+
+		[[nodiscard]]
+		static const char* FindLineEnd(const char* begin, const char* end) noexcept
+		{
+			if (const void* p = std::memchr(begin, '\n', (end - begin)))
+			{
+				return static_cast<const char*>(p);
+			}
+
+			return end;
+		}
+
+		// 値を Array<CSVField> に分割する。未知のエスケープシーケンスがあった場合は false を返す
+		static bool SplitFields(const char* begin, const char* end, const char separator, const char quote, const char escape, const bool hasEscape, Array<CSVField>& fields)
+		{
+			fields.clear();
+
+			if (begin == end)
+			{
+				return true;
+			}
+
+			const char* fieldBegin = begin;
+			bool inQuote = false;
+			bool plain = true;
+
+			for (const char* p = begin; p != end; ++p)
+			{
+				const char ch = *p;
+
+				if (hasEscape && (ch == escape))
+				{
+					if (((p + 1) == end) || (not IsEscaped(*(p + 1), quote, separator, escape)))
+					{
+						return false;
+					}
+
+					++p;
+					plain = false;
+				}
+				else if (ch == separator)
+				{
+					if (not inQuote)
+					{
+						fields.emplace_back(std::string_view{ fieldBegin, static_cast<size_t>(p - fieldBegin) }, quote, escape, hasEscape, plain);
+						fieldBegin = (p + 1);
+						plain = true;
+					}
+				}
+				else if (ch == quote)
+				{
+					inQuote = (not inQuote);
+					plain = false;
+				}
+			}
+
+			fields.emplace_back(std::string_view{ fieldBegin, static_cast<size_t>(end - fieldBegin) }, quote, escape, hasEscape, plain);
+
+			return true;
+		}
+
+		[[nodiscard]]
+		static Optional<char> ToASCII(const char32 ch)
+		{
+			if (0x80 <= ch)
+			{
+				return none;
+			}
+
+			return static_cast<char>(ch);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	CSVField
+	//
+	////////////////////////////////////////////////////////////////
+
+	CSVField::CSVField(const std::string_view raw, const char quote, const char escape, const bool hasEscape, const bool plain) noexcept
+		: m_raw{ raw }
+		, m_quote{ quote }
+		, m_escape{ escape }
+		, m_hasEscape{ hasEscape }
+		, m_plain{ plain } {}
+
+	std::string_view CSVField::raw() const noexcept
+	{
+		return m_raw;
+	}
+
+	bool CSVField::isPlain() const noexcept
+	{
+		return m_plain;
+	}
+
+	bool CSVField::isEmpty() const noexcept
+	{
+		if (m_plain)
+		{
+			return m_raw.empty();
+		}
+
+		return toUTF8().empty();
+	}
+
+	std::string CSVField::toUTF8() const
+	{
+		if (m_plain)
+		{
+			return std::string(m_raw);
+		}
+
+		std::string result;
+		result.reserve(m_raw.size());
+
+		for (size_t i = 0; i < m_raw.size(); ++i)
+		{
+			const char ch = m_raw[i];
+
+			if (m_hasEscape && (ch == m_escape) && ((i + 1) < m_raw.size()))
+			{
+				const char next = m_raw[++i];
+				result.push_back((next == 'n') ? '\n' : next);
+			}
+			else if (ch != m_quote)
+			{
+				result.push_back(ch);
+			}
+		}
+
+		return result;
+	}
+
+	String CSVField::toString() const
+	{
+		if (m_plain)
+		{
+			return Unicode::FromUTF8(m_raw);
+		}
+
+		return Unicode::FromUTF8(toUTF8());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	CSVRowView
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t CSVRowView::size() const noexcept
+	{
+		return m_fields.size();
+	}
+
+	bool CSVRowView::isEmpty() const noexcept
+	{
+		return m_fields.isEmpty();
+	}
+
+	const CSVField& CSVRowView::operator [](const size_t index) const noexcept
+	{
+		return m_fields[index];
+	}
+
+	CSVRowView::iterator CSVRowView::begin() const noexcept
+	{
+		return m_fields.begin();
+	}
+
+	CSVRowView::iterator CSVRowView::end() const noexcept
+	{
+		return m_fields.end();
+	}
+
+	size_t CSVRowView::offset() const noexcept
+	{
+		return m_offset;
+	}
+
+	Array<String> CSVRowView::toArray() const
+	{
+		return m_fields.map([](const CSVField& field) { return field.toString(); });
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	CSVChunk
+	//
+	////////////////////////////////////////////////////////////////
+
+	CSVChunk::CSVChunk(const char* fileBegin, const char* begin, const char* end, const char separator, const char quote, const char escape) noexcept
+		: m_fileBegin{ fileBegin }
+		, m_begin{ begin }
+		, m_end{ end }
+		, m_pos{ begin }
+		, m_separator{ separator }
+		, m_quote{ quote }
+		, m_escape{ escape } {}
+
+	bool CSVChunk::readRow(CSVRowView& row)
+	{
+		if (m_pos == m_end)
+		{
+			return false;
+		}
+
+		const char* lineBegin = m_pos;
+		const char* lineEnd = detail::FindLineEnd(lineBegin, m_end);
+		m_pos = ((lineEnd == m_end) ? m_end : (lineEnd + 1));
+
+		if ((lineBegin != lineEnd) && (*(lineEnd - 1) == '\r'))
+		{
+			--lineEnd;
+		}
+
+		row.m_offset = static_cast<size_t>(lineBegin - m_fileBegin);
+
+		// CSV と同じく、未知のエスケープシーケンスを含む行ではエスケープ記号を通常の文字として扱う
+		if (not detail::SplitFields(lineBegin, lineEnd, m_separator, m_quote, m_escape, true, row.m_fields))
+		{
+			detail::SplitFields(lineBegin, lineEnd, m_separator, m_quote, m_escape, false, row.m_fields);
+		}
+
+		return true;
+	}
+
+	void CSVChunk::rewind() noexcept
+	{
+		m_pos = m_begin;
+	}
+
+	size_t CSVChunk::offset() const noexcept
+	{
+		return static_cast<size_t>(m_begin - m_fileBegin);
+	}
+
+	size_t CSVChunk::size() const noexcept
+	{
+		return static_cast<size_t>(m_end - m_begin);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	CSVReader
+	//
+	////////////////////////////////////////////////////////////////
+
+	CSVReader::CSVReader(const FilePathView path, const char32 separator, const char32 quote, const char32 escape)
+	{
+		open(path, separator, quote, escape);
+	}
+
+	bool CSVReader::open(const FilePathView path, const char32 separator, const char32 quote, const char32 escape)
+	{
+		close();
+
+		const Optional<char> separatorChar = detail::ToASCII(separator);
+		const Optional<char> quoteChar = detail::ToASCII(quote);
+		const Optional<char> escapeChar = detail::ToASCII(escape);
+
+		if ((not separatorChar) || (not quoteChar) || (not escapeChar))
+		{
+			LOG_FAIL(U"CSVReader::open(): separator, quote and escape must be ASCII characters");
+			return false;
+		}
+
+		if (not m_file.open(path))
+		{
+			return false;
+		}
+
+		m_separator = *separatorChar;
+		m_quote = *quoteChar;
+		m_escape = *escapeChar;
+
+		const char* fileBegin = reinterpret_cast<const char*>(m_file.data());
+		const char* fileEnd = (fileBegin + m_file.mappedSize());
+		const char* begin = fileBegin;
+
+		// UTF-8 BOM
+		if ((3 <= m_file.mappedSize())
+			&& (static_cast<uint8>(begin[0]) == 0xEF) && (static_cast<uint8>(begin[1]) == 0xBB) && (static_cast<uint8>(begin[2]) == 0xBF))
+		{
+			begin += 3;
+		}
+
+		m_all = CSVChunk{ fileBegin, begin, fileEnd, m_separator, m_quote, m_escape };
+
+		return true;
+	}
+
+	void CSVReader::close()
+	{
+		m_file.close();
+
+		m_all = CSVChunk{};
+	}
+
+	bool CSVReader::isOpen() const noexcept
+	{
+		return m_file.isOpen();
+	}
+
+	CSVReader::operator bool() const noexcept
+	{
+		return isOpen();
+	}
+
+	size_t CSVReader::size() const noexcept
+	{
+		return m_file.mappedSize();
+	}
+
+	bool CSVReader::readRow(CSVRowView& row)
+	{
+		return m_all.readRow(row);
+	}
+
+	void CSVReader::rewind() noexcept
+	{
+		m_all.rewind();
+	}
+
+	Array<CSVChunk> CSVReader::split(size_t count) const
+	{
+		Array<CSVChunk> chunks;
+
+		if ((not isOpen()) || (m_all.size() == 0))
+		{
+			return chunks;
+		}
+
+		count = Max<size_t>(count, 1);
+
+		const char* fileBegin = reinterpret_cast<const char*>(m_file.data());
+		const char* const begin = (fileBegin + m_all.offset());
+		const char* const end = (begin + m_all.size());
+		const size_t size = m_all.size();
+		const char* chunkBegin = begin;
+
+		for (size_t i = 1; (i <= count) && (chunkBegin != end); ++i)
+		{
+			const char* chunkEnd = end;
+
+			if (i < count)
+			{
+				// 分割位置を含む行の終わりまで延ばす
+				const char* target = (begin + (size / count * i));
+
+				if (target < chunkBegin)
+				{
+					continue;
+				}
+
+				chunkEnd = detail::FindLineEnd(target, end);
+
+				if (chunkEnd != end)
+				{
+					++chunkEnd;
+				}
+			}
+
+			chunks.emplace_back(fileBegin, chunkBegin, chunkEnd, m_separator, m_quote, m_escape);
+			chunkBegin = chunkEnd;
+		}
+
+		return chunks;
+	}
+
+	size_t CSVReader::parallelForEachRow(const std::function<void(const CSVRowView&, size_t)>& f, size_t chunkCount) const
+	{
+		if (chunkCount == 0)
+		{
+			// 1 チャンクあたり 1 MiB 以上、1 スレッドあたり 4 チャンク程度
+			chunkCount = Clamp<size_t>((m_all.size() >> 20), 1, (Threading::GetConcurrency() * 4));
+		}
+
+		Array<CSVChunk> chunks = split(chunkCount);
+
+		Threading::ParallelFor(chunks.size(), [&](const size_t begin, const size_t end)
+		{
+			CSVRowView row;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				while (chunks[i].readRow(row))
+				{
+					f(row, i);
+				}
+			}
+		}, 1);
+
+		return chunks.size();
+	}
+}
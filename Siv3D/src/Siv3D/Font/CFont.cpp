@@ -352,6 +352,56 @@ namespace s3d
 		return font->getGlyphCache().preload(*font, chars);
 	}
 
+	bool CFont::prewarm(const Font::IDType handleID, const StringView chars)
+	{
+		const auto& font = m_fonts[handleID];
+
+		// フォールバックフォントのグリフも含めて、グリフクラスタをフォントごとに振り分ける
+		Array<Array<GlyphCluster>> clustersPerFont(1);
+
+		for (const auto& cluster : font->getGlyphClusters(chars, true, Ligature::Yes))
+		{
+			if (clustersPerFont.size() <= cluster.fontIndex)
+			{
+				clustersPerFont.resize(cluster.fontIndex + 1);
+			}
+
+			clustersPerFont[cluster.fontIndex] << cluster;
+		}
+
+		bool result = font->getGlyphCache().prewarm(*font, clustersPerFont.front());
+
+		for (size_t fontIndex = 1; fontIndex < clustersPerFont.size(); ++fontIndex)
+		{
+			if (clustersPerFont[fontIndex].isEmpty())
+			{
+				continue;
+			}
+
+			if (const auto fallbackFont = font->getFallbackFont(fontIndex - 1).lock())
+			{
+				const auto& fallback = m_fonts[fallbackFont->id()];
+				result &= fallback->getGlyphCache().prewarm(*fallback, clustersPerFont[fontIndex]);
+			}
+		}
+
+		return result;
+	}
+
+	bool CFont::saveGlyphCache(const Font::IDType handleID, const FilePathView path)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return font->getGlyphCache().saveAtlas(*font, path);
+	}
+
+	bool CFont::loadGlyphCache(const Font::IDType handleID, const FilePathView path)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return font->getGlyphCache().loadAtlas(*font, path);
+	}
+
 	const Texture& CFont::getTexture(const Font::IDType handleID)
 	{
 		return m_fonts[handleID]->getGlyphCache().getTexture();
@@ -515,6 +565,41 @@ namespace s3d
 		}
 	}
 
+	bool CFont::layout(const Font::IDType handleID, const StringView s, const Array<GlyphCluster>& clusters, const size_t firstCluster, const double fontSize, const double lineHeightScale, Array<TextLayoutGlyph>& glyphs)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return m_fonts[handleID]->getGlyphCache().layout(*font, s, clusters, firstCluster, fontSize, lineHeightScale, glyphs);
+	}
+
+	void CFont::drawLayout(const Font::IDType handleID, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Vec2& pos, const double fontSize, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
+	{
+		const auto& font = m_fonts[handleID];
+		const HasColor hasColor{ font->getProperty().hasColor };
+
+		if (textStyle.type != TextStyle::Type::Default && (not hasColor))
+		{
+			if (font->getMethod() == FontMethod::SDF)
+			{
+				Graphics2D::SetSDFParameters(textStyle);
+			}
+			else
+			{
+				Graphics2D::SetMSDFParameters(textStyle);
+			}
+		}
+
+		if (textStyle.type == TextStyle::Type::CustomShader)
+		{
+			m_fonts[handleID]->getGlyphCache().drawLayout(*font, clusters, glyphs, pos, fontSize, textStyle, (hasColor ? ColorF{ 1.0, color.a } : color), lineHeightScale);
+		}
+		else
+		{
+			ScopedCustomShader2D ps{ m_shader->getFontShader(font->getMethod(), textStyle.type, hasColor) };
+			m_fonts[handleID]->getGlyphCache().drawLayout(*font, clusters, glyphs, pos, fontSize, textStyle, (hasColor ? ColorF{ 1.0, color.a } : color), lineHeightScale);
+		}
+	}
+
 	RectF CFont::drawFallback(const Font::IDType handleID, const GlyphCluster& cluster, const Vec2& pos, const double fontSize, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
 	{
 		const auto& font = m_fonts[handleID];
@@ -107,6 +107,12 @@ namespace s3d
 	
 		bool preload(Font::IDType handleID, StringView chars) override;
 
+		bool prewarm(Font::IDType handleID, StringView chars) override;
+
+		bool saveGlyphCache(Font::IDType handleID, FilePathView path) override;
+
+		bool loadGlyphCache(Font::IDType handleID, FilePathView path) override;
+
 		const Texture& getTexture(Font::IDType handleID) override;
 
 		Glyph getGlyph(Font::IDType handleID, StringView ch) override;
@@ -128,6 +134,10 @@ namespace s3d
 		bool draw(Font::IDType handleID, StringView s, const Array<GlyphCluster>& clusters, const RectF& area, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) override;
 
 		RectF drawBase(Font::IDType handleID, StringView s, const Array<GlyphCluster>& clusters, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) override;
+
+		bool layout(Font::IDType handleID, StringView s, const Array<GlyphCluster>& clusters, size_t firstCluster, double fontSize, double lineHeightScale, Array<TextLayoutGlyph>& glyphs) override;
+
+		void drawLayout(Font::IDType handleID, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) override;
 	
 		RectF drawFallback(Font::IDType handleID, const GlyphCluster& cluster, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) override;
 
@@ -268,6 +268,56 @@ namespace s3d
 		return font->getGlyphCache().preload(*font, chars);
 	}
 
+	bool CFont_Headless::prewarm(const Font::IDType handleID, const StringView chars)
+	{
+		const auto& font = m_fonts[handleID];
+
+		// フォールバックフォントのグリフも含めて、グリフクラスタをフォントごとに振り分ける
+		Array<Array<GlyphCluster>> clustersPerFont(1);
+
+		for (const auto& cluster : font->getGlyphClusters(chars, true, Ligature::Yes))
+		{
+			if (clustersPerFont.size() <= cluster.fontIndex)
+			{
+				clustersPerFont.resize(cluster.fontIndex + 1);
+			}
+
+			clustersPerFont[cluster.fontIndex] << cluster;
+		}
+
+		bool result = font->getGlyphCache().prewarm(*font, clustersPerFont.front());
+
+		for (size_t fontIndex = 1; fontIndex < clustersPerFont.size(); ++fontIndex)
+		{
+			if (clustersPerFont[fontIndex].isEmpty())
+			{
+				continue;
+			}
+
+			if (const auto fallbackFont = font->getFallbackFont(fontIndex - 1).lock())
+			{
+				const auto& fallback = m_fonts[fallbackFont->id()];
+				result &= fallback->getGlyphCache().prewarm(*fallback, clustersPerFont[fontIndex]);
+			}
+		}
+
+		return result;
+	}
+
+	bool CFont_Headless::saveGlyphCache(const Font::IDType handleID, const FilePathView path)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return font->getGlyphCache().saveAtlas(*font, path);
+	}
+
+	bool CFont_Headless::loadGlyphCache(const Font::IDType handleID, const FilePathView path)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return font->getGlyphCache().loadAtlas(*font, path);
+	}
+
 	const Texture& CFont_Headless::getTexture(const Font::IDType handleID)
 	{
 		return m_fonts[handleID]->getGlyphCache().getTexture();
@@ -362,6 +412,18 @@ namespace s3d
 		}
 	}
 
+	bool CFont_Headless::layout(const Font::IDType handleID, const StringView s, const Array<GlyphCluster>& clusters, const size_t firstCluster, const double fontSize, const double lineHeightScale, Array<TextLayoutGlyph>& glyphs)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return m_fonts[handleID]->getGlyphCache().layout(*font, s, clusters, firstCluster, fontSize, lineHeightScale, glyphs);
+	}
+
+	void CFont_Headless::drawLayout(const Font::IDType, const Array<GlyphCluster>&, const Array<TextLayoutGlyph>&, const Vec2&, const double, const TextStyle&, const ColorF&, const double)
+	{
+		// do nothing
+	}
+
 	RectF CFont_Headless::drawFallback(const Font::IDType handleID, const GlyphCluster& cluster, const Vec2& pos, const double fontSize, const TextStyle&, const ColorF&, const double lineHeightScale)
 	{
 		const auto& font = m_fonts[handleID];
@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Hash.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
 # include <Siv3D/PolygonGlyph.hpp>
 # include <Siv3D/Font/IFont.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
@@ -63,6 +65,9 @@ namespace s3d
 
 	# endif
 
+		m_path = path;
+		m_faceIndex = faceIndex;
+
 		if (((fontMethod == FontMethod::SDF) || (fontMethod == FontMethod::MSDF))
 			&& (not FT_IS_SCALABLE(m_fontFace.getFT_Face())))
 		{
@@ -113,6 +118,40 @@ namespace s3d
 		return m_method;
 	}
 
+	size_t FontData::getFaceIndex() const noexcept
+	{
+		return m_faceIndex;
+	}
+
+	uint64 FontData::getFontFileHash() const
+	{
+		if (m_fontFileHash)
+		{
+			return *m_fontFileHash;
+		}
+
+	# if SIV3D_PLATFORM(WINDOWS)
+
+		if (m_resource.data())
+		{
+			m_fontFileHash = Hash::XXHash3(m_resource.data(), static_cast<size_t>(m_resource.size()));
+			return *m_fontFileHash;
+		}
+
+	# endif
+
+		// 大きなフォントファイルでもコピーせずにハッシュ値を計算できるよう、メモリマップを使う
+		const MemoryMappedFileView file{ m_path };
+
+		if ((not file) || (file.mappedSize() == 0))
+		{
+			return 0;
+		}
+
+		m_fontFileHash = Hash::XXHash3(file.data(), file.mappedSize());
+		return *m_fontFileHash;
+	}
+
 	bool FontData::hasGlyph(const StringView ch)
 	{
 		const HBGlyphInfo glyphInfo = m_fontFace.getHBGlyphInfo(ch, Ligature::Yes);
@@ -325,6 +364,16 @@ namespace s3d
 		return RenderMSDFGlyph(m_fontFace.getFT_Face(), glyphIndex, buffer, m_fontFace.getProperty());
 	}
 
+	PreparedSDFGlyph FontData::prepareSDFByGlyphIndex(const GlyphIndex glyphIndex, const int32 buffer) const
+	{
+		return PrepareSDFGlyph(m_fontFace.getFT_Face(), glyphIndex, buffer, m_fontFace.getProperty());
+	}
+
+	PreparedMSDFGlyph FontData::prepareMSDFByGlyphIndex(const GlyphIndex glyphIndex, const int32 buffer) const
+	{
+		return PrepareMSDFGlyph(m_fontFace.getFT_Face(), glyphIndex, buffer, m_fontFace.getProperty());
+	}
+
 	IGlyphCache& FontData::getGlyphCache() const
 	{
 		return *m_glyphCache;
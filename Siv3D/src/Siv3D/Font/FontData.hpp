@@ -12,9 +12,12 @@
 # pragma once
 # include <Siv3D/Common.hpp>
 # include <Siv3D/StringView.hpp>
+# include <Siv3D/Optional.hpp>
 # include <Siv3D/Font.hpp>
 # include "FontResourceHolder.hpp"
 # include "FontFace.hpp"
+# include "GlyphRenderer/SDFGlyphRenderer.hpp"
+# include "GlyphRenderer/MSDFGlyphRenderer.hpp"
 
 namespace s3d
 {
@@ -45,6 +48,15 @@ namespace s3d
 		[[nodiscard]]
 		FontMethod getMethod() const;
 
+		[[nodiscard]]
+		size_t getFaceIndex() const noexcept;
+
+		/// @brief フォントファイルのハッシュ値を返します。
+		/// @remark 初回の呼び出しでファイル全体を読み込んで計算します。
+		/// @return フォントファイルのハッシュ値。ファイルを読み込めなかった場合は 0
+		[[nodiscard]]
+		uint64 getFontFileHash() const;
+
 		[[nodiscard]]
 		bool hasGlyph(StringView ch);
 
@@ -78,6 +90,12 @@ namespace s3d
 		[[nodiscard]]
 		MSDFGlyph renderMSDFByGlyphIndex(GlyphIndex glyphIndex, int32 buffer) const;
 
+		[[nodiscard]]
+		PreparedSDFGlyph prepareSDFByGlyphIndex(GlyphIndex glyphIndex, int32 buffer) const;
+
+		[[nodiscard]]
+		PreparedMSDFGlyph prepareMSDFByGlyphIndex(GlyphIndex glyphIndex, int32 buffer) const;
+
 		[[nodiscard]]
 		IGlyphCache& getGlyphCache() const;
 
@@ -97,6 +115,12 @@ namespace s3d
 
 		FontFace m_fontFace;
 
+		FilePath m_path;
+
+		size_t m_faceIndex = 0;
+
+		mutable Optional<uint64> m_fontFileHash;
+
 		Array<std::weak_ptr<AssetHandle<Font>::AssetIDWrapperType>> m_fallbackFonts;
 
 		FontMethod m_method = FontMethod::Bitmap;
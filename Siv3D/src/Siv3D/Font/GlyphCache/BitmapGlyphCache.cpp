@@ -583,6 +583,31 @@ namespace s3d
 		return{ topLeft, (xMax - basePos.x), (lineCount * prop.height() * scale * lineHeightScale) };
 	}
 
+	bool BitmapGlyphCache::layout(const FontData& font, const StringView s, const Array<GlyphCluster>& clusters, const size_t firstCluster, const double size, const double lineHeightScale, Array<TextLayoutGlyph>& glyphs)
+	{
+		if (firstCluster == 0)
+		{
+			if (not prerender(font, clusters, true))
+			{
+				return false;
+			}
+		}
+		else if (not prerender(font, clusters.slice(firstCluster), true))
+		{
+			return false;
+		}
+
+		LayoutGlyphs(font, s, clusters, firstCluster, size, lineHeightScale, m_glyphTable, glyphs);
+		return true;
+	}
+
+	void BitmapGlyphCache::drawLayout(const FontData& font, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Vec2& pos, const double size, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
+	{
+		updateTexture();
+
+		DrawLayoutGlyphs(font, clusters, glyphs, m_texture, true, pos, size, textStyle, color, lineHeightScale);
+	}
+
 	void BitmapGlyphCache::setBufferWidth(int32)
 	{
 		// do nothing
@@ -598,6 +623,22 @@ namespace s3d
 		return prerender(font, font.getGlyphClusters(s, false, Ligature::Yes), true);
 	}
 
+	bool BitmapGlyphCache::prewarm(const FontData& font, const Array<GlyphCluster>& clusters)
+	{
+		return prerender(font, clusters, false);
+	}
+
+	bool BitmapGlyphCache::saveAtlas(const FontData&, FilePathView)
+	{
+		// ビットマップのグリフは生成のコストが小さいため、保存には対応しない
+		return false;
+	}
+
+	bool BitmapGlyphCache::loadAtlas(const FontData&, FilePathView)
+	{
+		return false;
+	}
+
 	const Texture& BitmapGlyphCache::getTexture() noexcept
 	{
 		updateTexture();
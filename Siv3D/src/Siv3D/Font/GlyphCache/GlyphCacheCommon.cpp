@@ -9,10 +9,53 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/TextureRegion.hpp>
+# include <Siv3D/Math.hpp>
+# include <Siv3D/Font/IFont.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
 # include "GlyphCacheCommon.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		static constexpr uint8 GlyphAtlasSignature[8] = { 'S', '3', 'D', 'G', 'L', 'Y', 'P', 'H' };
+
+		// ファイルの形式を変更したら増やす
+		static constexpr uint32 GlyphAtlasVersion = 1;
+
+		struct GlyphAtlasHeader
+		{
+			uint8 signature[8];
+
+			uint32 version;
+
+			uint32 glyphCacheSize;
+
+			GlyphAtlasKey key;
+
+			int32 imageWidth;
+
+			int32 imageHeight;
+
+			int32 penPosX;
+
+			int32 penPosY;
+
+			int32 currentMaxHeight;
+
+			uint32 glyphCount;
+		};
+
+		static_assert(sizeof(GlyphAtlasHeader) == 64);
+		static_assert(std::is_trivially_copyable_v<GlyphCache>);
+	}
+
 	double GetTabAdvance(const double spaceWidth, const double scale, const double baseX, const double currentX, const int32 indentSize)
 	{
 		const double maxTabWidth = (spaceWidth * scale * indentSize);
@@ -53,7 +96,7 @@ namespace s3d
 		return true;
 	}
 
-	bool CacheGlyph(const FontData& font, const Image& image, const GlyphInfo& glyphInfo,
+	Optional<Point> ReserveGlyph(const FontData& font, const Size& imageSize, const GlyphInfo& glyphInfo,
 		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable)
 	{
 		if (not buffer.image)
@@ -71,8 +114,8 @@ namespace s3d
 
 		buffer.penPos.x += buffer.padding;
 
-		const int32 bitmapWidth		= image.width();
-		const int32 bitmapHeight	= image.height();
+		const int32 bitmapWidth		= imageSize.x;
+		const int32 bitmapHeight	= imageSize.y;
 
 		if (buffer.image.width() < (buffer.penPos.x + (bitmapWidth + buffer.padding)))
 		{
@@ -87,18 +130,18 @@ namespace s3d
 
 			if (BufferImage::MaxImageHeight < newHeight)
 			{
-				return false;
+				return none;
 			}
 
 			buffer.image.resizeRows(newHeight, buffer.backgroundColor);
 		}
 
-		image.overwrite(buffer.image, buffer.penPos);
+		const Point pos = buffer.penPos;
 
 		GlyphCache cache;
 		cache.info					= glyphInfo;
-		cache.textureRegionLeft		= static_cast<int16>(buffer.penPos.x);
-		cache.textureRegionTop		= static_cast<int16>(buffer.penPos.y);
+		cache.textureRegionLeft		= static_cast<int16>(pos.x);
+		cache.textureRegionTop		= static_cast<int16>(pos.y);
 		cache.textureRegionWidth	= static_cast<int16>(bitmapWidth);
 		cache.textureRegionHeight	= static_cast<int16>(bitmapHeight);
 		glyphTable.emplace(glyphInfo.glyphIndex, cache);
@@ -106,6 +149,325 @@ namespace s3d
 		buffer.currentMaxHeight = Max(buffer.currentMaxHeight, bitmapHeight);
 		buffer.penPos.x += (bitmapWidth + buffer.padding);
 
+		return pos;
+	}
+
+	void LayoutGlyphs(const FontData& font, const StringView s, const Array<GlyphCluster>& clusters, const size_t firstCluster, const double size, const double lineHeightScale,
+		const HashTable<GlyphIndex, GlyphCache>& glyphTable, Array<TextLayoutGlyph>& glyphs)
+	{
+		assert(firstCluster <= clusters.size());
+
+		const auto& prop = font.getProperty();
+		const double scale = (size / prop.fontPixelSize);
+		const Vec2 basePos{ 0, 0 };
+
+		glyphs.resize(clusters.size() + 1);
+
+		if (firstCluster == 0)
+		{
+			glyphs.front() = TextLayoutGlyph{};
+		}
+
+		Vec2 penPos = glyphs[firstCluster].penPos;
+		int32 lineCount = glyphs[firstCluster].lineCount;
+		double xMax = glyphs[firstCluster].xMax;
+
+		for (size_t i = firstCluster; i < clusters.size(); ++i)
+		{
+			const auto& cluster = clusters[i];
+			TextLayoutGlyph& glyph = glyphs[i];
+			glyph = TextLayoutGlyph{ .penPos = penPos, .xMax = xMax, .lineCount = lineCount };
+
+			if (ProcessControlCharacter(s[cluster.pos], penPos, lineCount, basePos, scale, lineHeightScale, prop))
+			{
+				xMax = Max(xMax, penPos.x);
+				continue;
+			}
+
+			if (cluster.fontIndex != 0)
+			{
+				const size_t fallbackIndex = (cluster.fontIndex - 1);
+				const RectF rect = SIV3D_ENGINE(Font)->regionBaseFallback(font.getFallbackFont(fallbackIndex).lock()->id(),
+					cluster, penPos.movedBy(0, prop.ascender * scale), size, lineHeightScale);
+
+				glyph.type = TextLayoutGlyph::Type::Fallback;
+				penPos.x += rect.w;
+				xMax = Max(xMax, penPos.x);
+				continue;
+			}
+
+			const auto& cache = glyphTable.find(cluster.glyphIndex)->second;
+			glyph.type = TextLayoutGlyph::Type::Glyph;
+			glyph.textureRegionLeft = cache.textureRegionLeft;
+			glyph.textureRegionTop = cache.textureRegionTop;
+			glyph.textureRegionWidth = cache.textureRegionWidth;
+			glyph.textureRegionHeight = cache.textureRegionHeight;
+			glyph.drawPos = (penPos + cache.info.getOffset(scale));
+
+			penPos.x += (cache.info.xAdvance * scale);
+			xMax = Max(xMax, penPos.x);
+		}
+
+		glyphs.back() = TextLayoutGlyph{ .penPos = penPos, .xMax = xMax, .lineCount = lineCount };
+	}
+
+	void DrawLayoutGlyphs(const FontData& font, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Texture& texture, const bool roundPos,
+		const Vec2& pos, const double size, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
+	{
+		assert(glyphs.size() == (clusters.size() + 1));
+
+		const auto& prop = font.getProperty();
+		const double scale = (size / prop.fontPixelSize);
+		const bool noScaling = (size == prop.fontPixelSize);
+
+		for (size_t i = 0; i < clusters.size(); ++i)
+		{
+			const TextLayoutGlyph& glyph = glyphs[i];
+
+			if (glyph.type == TextLayoutGlyph::Type::Glyph)
+			{
+				const TextureRegion textureRegion = texture(glyph.textureRegionLeft, glyph.textureRegionTop, glyph.textureRegionWidth, glyph.textureRegionHeight);
+				const Vec2 drawPos = (pos + glyph.drawPos);
+
+				if (noScaling)
+				{
+					textureRegion
+						.draw((roundPos ? Math::Round(drawPos) : drawPos), color);
+				}
+				else
+				{
+					textureRegion
+						.scaled(scale)
+						.draw(drawPos, color);
+				}
+			}
+			else if (glyph.type == TextLayoutGlyph::Type::Fallback)
+			{
+				const size_t fallbackIndex = (clusters[i].fontIndex - 1);
+				SIV3D_ENGINE(Font)->drawBaseFallback(font.getFallbackFont(fallbackIndex).lock()->id(),
+					clusters[i], (pos + glyph.penPos).movedBy(0, prop.ascender * scale), size, textStyle, color, lineHeightScale);
+			}
+		}
+	}
+
+	bool CacheGlyph(const FontData& font, const Image& image, const GlyphInfo& glyphInfo,
+		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		const Optional<Point> pos = ReserveGlyph(font, image.size(), glyphInfo, buffer, glyphTable);
+
+		if (not pos)
+		{
+			return false;
+		}
+
+		image.overwrite(buffer.image, *pos);
+
 		return true;
 	}
+
+	GlyphAtlasKey MakeGlyphAtlasKey(const FontData& font, const int32 bufferWidth)
+	{
+		const auto& prop = font.getProperty();
+
+		return{
+			.fontFileHash	= font.getFontFileHash(),
+			.faceIndex		= static_cast<uint32>(font.getFaceIndex()),
+			.fontPixelSize	= prop.fontPixelSize,
+			.method			= font.getMethod(),
+			.style			= prop.style,
+			.bufferWidth	= bufferWidth,
+		};
+	}
+
+	bool SaveGlyphAtlas(const FilePathView path, const GlyphAtlasKey& key, const BufferImage& buffer, const HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		if ((key.fontFileHash == 0) || (not buffer.image) || glyphTable.empty())
+		{
+			return false;
+		}
+
+		BinaryWriter writer{ path };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		detail::GlyphAtlasHeader header{};
+		std::memcpy(header.signature, detail::GlyphAtlasSignature, sizeof(header.signature));
+		header.version			= detail::GlyphAtlasVersion;
+		header.glyphCacheSize	= sizeof(GlyphCache);
+		header.key				= key;
+		header.imageWidth		= buffer.image.width();
+		header.imageHeight		= buffer.image.height();
+		header.penPosX			= buffer.penPos.x;
+		header.penPosY			= buffer.penPos.y;
+		header.currentMaxHeight	= buffer.currentMaxHeight;
+		header.glyphCount		= static_cast<uint32>(glyphTable.size());
+
+		if (not writer.write(header))
+		{
+			return false;
+		}
+
+		// 同じキャッシュから同じファイルが作られるよう、グリフインデックス順に書き込む
+		Array<GlyphCache> glyphs(Arg::reserve = glyphTable.size());
+
+		for (const auto& glyph : glyphTable)
+		{
+			glyphs << glyph.second;
+		}
+
+		glyphs.sort_by([](const GlyphCache& a, const GlyphCache& b) { return (a.info.glyphIndex < b.info.glyphIndex); });
+
+		const int64 glyphsSize = static_cast<int64>(glyphs.size_bytes());
+		const int64 imageSize = static_cast<int64>(buffer.image.size_bytes());
+
+		return ((writer.write(glyphs.data(), glyphsSize) == glyphsSize)
+			&& (writer.write(buffer.image.data(), imageSize) == imageSize));
+	}
+
+	bool LoadGlyphAtlas(const FilePathView path, const GlyphAtlasKey& key, BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		if (key.fontFileHash == 0)
+		{
+			return false;
+		}
+
+		const MemoryMappedFileView file{ path };
+
+		if ((not file) || (file.mappedSize() < sizeof(detail::GlyphAtlasHeader)))
+		{
+			return false;
+		}
+
+		detail::GlyphAtlasHeader header;
+		std::memcpy(static_cast<void*>(&header), file.data(), sizeof(header));
+
+		if ((std::memcmp(header.signature, detail::GlyphAtlasSignature, sizeof(header.signature)) != 0)
+			|| (header.version != detail::GlyphAtlasVersion)
+			|| (header.glyphCacheSize != sizeof(GlyphCache)))
+		{
+			LOG_FAIL(U"LoadGlyphAtlas(): `{}` is not a glyph atlas file of this version"_fmt(path));
+			return false;
+		}
+
+		if (header.key != key)
+		{
+			LOG_INFO(U"LoadGlyphAtlas(): `{}` was created from a different font or settings"_fmt(path));
+			return false;
+		}
+
+		if ((header.imageWidth <= 0) || (Image::MaxWidth < header.imageWidth)
+			|| (header.imageHeight <= 0) || (BufferImage::MaxImageHeight < header.imageHeight))
+		{
+			return false;
+		}
+
+		const size_t glyphsSize = (header.glyphCount * sizeof(GlyphCache));
+		const size_t imageSize = (static_cast<size_t>(header.imageWidth) * header.imageHeight * sizeof(Color));
+
+		if (file.mappedSize() != (sizeof(header) + glyphsSize + imageSize))
+		{
+			return false;
+		}
+
+		const Byte* pGlyphs = (file.data() + sizeof(header));
+		HashTable<GlyphIndex, GlyphCache> newGlyphTable;
+		newGlyphTable.reserve(header.glyphCount);
+
+		for (uint32 i = 0; i < header.glyphCount; ++i)
+		{
+			GlyphCache glyph;
+			std::memcpy(static_cast<void*>(&glyph), (pGlyphs + (i * sizeof(GlyphCache))), sizeof(GlyphCache));
+			newGlyphTable.emplace(glyph.info.glyphIndex, glyph);
+		}
+
+		Image image(header.imageWidth, header.imageHeight);
+		std::memcpy(image.data(), (pGlyphs + glyphsSize), imageSize);
+
+		buffer.image			= std::move(image);
+		buffer.penPos			= Point{ header.penPosX, header.penPosY };
+		buffer.currentMaxHeight	= header.currentMaxHeight;
+		glyphTable				= std::move(newGlyphTable);
+
+		return true;
+	}
+
+	void GlyphRasterizationQueue::submit(const Point& pos, std::function<Image()> render)
+	{
+		auto job = std::make_shared<Job>();
+		job->pos = pos;
+		job->render = std::move(render);
+
+		m_jobs << job;
+
+		Threading::Submit([job = std::move(job)]()
+		{
+			job->run();
+		});
+	}
+
+	bool GlyphRasterizationQueue::isEmpty() const noexcept
+	{
+		return m_jobs.isEmpty();
+	}
+
+	bool GlyphRasterizationQueue::collect(BufferImage& buffer)
+	{
+		bool collected = false;
+
+		m_jobs.remove_if([&](const std::shared_ptr<Job>& job)
+		{
+			if (job->state.load(std::memory_order_acquire) != Job::Done)
+			{
+				return false;
+			}
+
+			job->image.overwrite(buffer.image, job->pos);
+			collected = true;
+			return true;
+		});
+
+		return collected;
+	}
+
+	bool GlyphRasterizationQueue::wait(BufferImage& buffer)
+	{
+		for (const auto& job : m_jobs)
+		{
+			job->wait();
+		}
+
+		return collect(buffer);
+	}
+
+	void GlyphRasterizationQueue::Job::run()
+	{
+		uint32 expected = Pending;
+
+		// 呼び出し元のスレッドとワーカースレッドのうち、先に取得した側だけが生成する
+		if (not state.compare_exchange_strong(expected, Running, std::memory_order_acq_rel))
+		{
+			return;
+		}
+
+		image = render();
+		render = nullptr;
+
+		state.store(Done, std::memory_order_release);
+		state.notify_all();
+	}
+
+	void GlyphRasterizationQueue::Job::wait()
+	{
+		run();
+
+		for (uint32 current = state.load(std::memory_order_acquire);
+			current != Done;
+			current = state.load(std::memory_order_acquire))
+		{
+			state.wait(current, std::memory_order_acquire);
+		}
+	}
 }
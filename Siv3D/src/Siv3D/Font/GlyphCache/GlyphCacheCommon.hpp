@@ -10,11 +10,19 @@
 //-----------------------------------------------
 
 # pragma once
+# include <atomic>
+# include <functional>
+# include <memory>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/GlyphInfo.hpp>
 # include <Siv3D/Image.hpp>
 # include <Siv3D/HashTable.hpp>
 # include <Siv3D/Char.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/FontMethod.hpp>
+# include <Siv3D/FontStyle.hpp>
+# include <Siv3D/Texture.hpp>
+# include <Siv3D/TextStyle.hpp>
 # include "../FontData.hpp"
 
 namespace s3d
@@ -49,13 +57,153 @@ namespace s3d
 		int32 currentMaxHeight = 0;
 	};
 
+	/// @brief TextLayout における、クラスタ 1 つ分のレイアウト
+	struct TextLayoutGlyph
+	{
+		enum class Type : uint8
+		{
+			/// @brief 制御文字。何も描画しない
+			Control,
+
+			/// @brief このフォントのグリフ
+			Glyph,
+
+			/// @brief フォールバックフォントのグリフ
+			Fallback,
+		};
+
+		/// @brief このクラスタの直前のペンの位置（テキストの左上が原点）
+		Vec2 penPos{ 0, 0 };
+
+		/// @brief このクラスタの直前までの X 座標の最大値
+		double xMax = 0.0;
+
+		/// @brief このクラスタの直前までの行数
+		int32 lineCount = 1;
+
+		Type type = Type::Control;
+
+		int16 textureRegionLeft = 0;
+
+		int16 textureRegionTop = 0;
+
+		int16 textureRegionWidth = 0;
+
+		int16 textureRegionHeight = 0;
+
+		/// @brief グリフを描画する位置（テキストの左上が原点）
+		Vec2 drawPos{ 0, 0 };
+	};
+
+	/// @brief 保存したグリフのアトラスが、どのフォントと設定で作られたものかを識別するキー
+	struct GlyphAtlasKey
+	{
+		uint64 fontFileHash = 0;
+
+		uint32 faceIndex = 0;
+
+		int32 fontPixelSize = 0;
+
+		FontMethod method = FontMethod::Bitmap;
+
+		FontStyle style = FontStyle::Default;
+
+		uint16 reserved = 0;
+
+		int32 bufferWidth = 0;
+
+		[[nodiscard]]
+		friend bool operator ==(const GlyphAtlasKey&, const GlyphAtlasKey&) = default;
+	};
+
 	[[nodiscard]]
 	double GetTabAdvance(double spaceWidth, double scale, double baseX, double currentX, int32 indentSize);
 
 	[[nodiscard]]
 	bool ProcessControlCharacter(char32 ch, Vec2& penPos, int32& line, const Vec2& basePos, double scale, double lineHeightScale, const FontFaceProperty& prop);
 
+	/// @brief グリフの画像を書き込む領域をバッファに確保し、グリフの情報を登録します。
+	/// @param imageSize グリフの画像の大きさ
+	/// @return 確保した領域の左上の座標。バッファが足りない場合は none
+	[[nodiscard]]
+	Optional<Point> ReserveGlyph(const FontData& font, const Size& imageSize, const GlyphInfo& glyphInfo,
+		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable);
+
+	/// @brief テキストのレイアウトを、firstCluster 番目のクラスタから計算し直します。
+	/// @param firstCluster 計算を始めるクラスタのインデックス。glyphs[firstCluster] のペンの状態から再開します。
+	/// @param glyphs レイアウトの格納先。(clusters.size() + 1) 個の要素になり、最後の要素は末尾のペンの状態を表します。
+	/// @remark clusters のグリフは、あらかじめ glyphTable に登録されている必要があります。
+	void LayoutGlyphs(const FontData& font, StringView s, const Array<GlyphCluster>& clusters, size_t firstCluster, double size, double lineHeightScale,
+		const HashTable<GlyphIndex, GlyphCache>& glyphTable, Array<TextLayoutGlyph>& glyphs);
+
+	/// @brief LayoutGlyphs() で計算したレイアウトでテキストを描画します。
+	/// @param roundPos 拡大縮小しない場合に、描画位置を整数に丸めるか
+	void DrawLayoutGlyphs(const FontData& font, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Texture& texture, bool roundPos,
+		const Vec2& pos, double size, const TextStyle& textStyle, const ColorF& color, double lineHeightScale);
+
 	[[nodiscard]]
 	bool CacheGlyph(const FontData& font, const Image& image, const GlyphInfo& glyphInfo,
 		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable);
+
+	[[nodiscard]]
+	GlyphAtlasKey MakeGlyphAtlasKey(const FontData& font, int32 bufferWidth);
+
+	/// @brief グリフのアトラスとグリフの情報をファイルに保存します。
+	/// @return 保存に成功した場合 true, それ以外の場合は false
+	bool SaveGlyphAtlas(FilePathView path, const GlyphAtlasKey& key, const BufferImage& buffer, const HashTable<GlyphIndex, GlyphCache>& glyphTable);
+
+	/// @brief SaveGlyphAtlas() で保存したファイルを読み込みます。
+	/// @remark バージョンやキーが一致しない場合は失敗し、buffer と glyphTable は変更されません。
+	/// @return 読み込みに成功した場合 true, それ以外の場合は false
+	[[nodiscard]]
+	bool LoadGlyphAtlas(FilePathView path, const GlyphAtlasKey& key, BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable);
+
+	/// @brief グリフの画像をワーカースレッドで生成し、完成したものからバッファに書き込むキュー
+	class GlyphRasterizationQueue
+	{
+	public:
+
+		/// @brief グリフの画像の生成をスレッドプールに投入します。
+		/// @param pos 画像を書き込むバッファ上の座標
+		/// @param render 画像を生成する関数
+		void submit(const Point& pos, std::function<Image()> render);
+
+		/// @brief 生成中のグリフが無いかを返します。
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 生成が完了したグリフの画像をバッファに書き込みます。
+		/// @return 1 つ以上書き込んだ場合 true
+		bool collect(BufferImage& buffer);
+
+		/// @brief すべてのグリフの生成の完了を待ち、バッファに書き込みます。
+		/// @remark まだ開始されていない生成は、呼び出し元のスレッドで実行します。
+		/// @return 1 つ以上書き込んだ場合 true
+		bool wait(BufferImage& buffer);
+
+	private:
+
+		struct Job
+		{
+			static constexpr uint32 Pending = 0;
+
+			static constexpr uint32 Running = 1;
+
+			static constexpr uint32 Done = 2;
+
+			Point pos{ 0, 0 };
+
+			std::function<Image()> render;
+
+			Image image;
+
+			std::atomic<uint32> state{ Pending };
+
+			void run();
+
+			void wait();
+		};
+
+		Array<std::shared_ptr<Job>> m_jobs;
+	};
 }
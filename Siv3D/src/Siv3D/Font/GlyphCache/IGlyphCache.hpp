@@ -15,6 +15,7 @@
 # include <Siv3D/Texture.hpp>
 # include <Siv3D/Font.hpp>
 # include "../FontData.hpp"
+# include "GlyphCacheCommon.hpp"
 
 namespace s3d
 {
@@ -44,12 +45,34 @@ namespace s3d
 		[[nodiscard]]
 		virtual RectF regionFallback(const FontData& font, const GlyphCluster& cluster, bool useBasePos, const Vec2& pos, const double size, double lineHeightScale) = 0;
 
+		/// @brief テキストのレイアウトを、firstCluster 番目のクラスタから計算し直します。
+		/// @return 成功した場合 true, それ以外の場合は false
+		/// @remark glyphs の仕様は LayoutGlyphs() を参照してください。
+		virtual bool layout(const FontData& font, StringView s, const Array<GlyphCluster>& clusters, size_t firstCluster, double size, double lineHeightScale, Array<TextLayoutGlyph>& glyphs) = 0;
+
+		/// @brief layout() で計算したレイアウトでテキストを描画します。
+		virtual void drawLayout(const FontData& font, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Vec2& pos, double size, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) = 0;
+
 		virtual void setBufferWidth(int32 width) = 0;
 
 		virtual int32 getBufferWidth() const noexcept = 0;
 
 		virtual bool preload(const FontData& font, StringView s) = 0;
 
+		/// @brief このフォントのグリフとして、指定したグリフをキャッシュに追加し、完了するまで待ちます。
+		/// @param font フォント
+		/// @param clusters グリフクラスタ。fontIndex は無視されます。
+		/// @return 成功した場合 true, それ以外の場合は false
+		virtual bool prewarm(const FontData& font, const Array<GlyphCluster>& clusters) = 0;
+
+		/// @brief キャッシュされているグリフのアトラスと情報をファイルに保存します。
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		virtual bool saveAtlas(const FontData& font, FilePathView path) = 0;
+
+		/// @brief saveAtlas() で保存したファイルから、グリフのキャッシュを復元します。
+		/// @return 復元に成功した場合 true, それ以外の場合は false
+		virtual bool loadAtlas(const FontData& font, FilePathView path) = 0;
+
 		[[nodiscard]]
 		virtual const Texture& getTexture() noexcept = 0;
 
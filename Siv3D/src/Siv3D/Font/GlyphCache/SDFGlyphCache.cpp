@@ -12,6 +12,7 @@
 # include <Siv3D/TextureRegion.hpp>
 # include <Siv3D/SDFGlyph.hpp>
 # include <Siv3D/System.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/Font/IFont.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include "SDFGlyphCache.hpp"
@@ -583,6 +584,31 @@ namespace s3d
 		return{ topLeft, (xMax - basePos.x), (lineCount * prop.height() * scale * lineHeightScale) };
 	}
 
+	bool SDFGlyphCache::layout(const FontData& font, const StringView s, const Array<GlyphCluster>& clusters, const size_t firstCluster, const double size, const double lineHeightScale, Array<TextLayoutGlyph>& glyphs)
+	{
+		if (firstCluster == 0)
+		{
+			if (not prerender(font, clusters, true))
+			{
+				return false;
+			}
+		}
+		else if (not prerender(font, clusters.slice(firstCluster), true))
+		{
+			return false;
+		}
+
+		LayoutGlyphs(font, s, clusters, firstCluster, size, lineHeightScale, m_glyphTable, glyphs);
+		return true;
+	}
+
+	void SDFGlyphCache::drawLayout(const FontData& font, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Vec2& pos, const double size, const TextStyle& textStyle, const ColorF& color, const double lineHeightScale)
+	{
+		updateTexture();
+
+		DrawLayoutGlyphs(font, clusters, glyphs, m_texture, false, pos, size, textStyle, color, lineHeightScale);
+	}
+
 	void SDFGlyphCache::setBufferWidth(const int32 width)
 	{
 		m_buffer.bufferWidth = Max(width, 0);
@@ -595,11 +621,66 @@ namespace s3d
 
 	bool SDFGlyphCache::preload(const FontData& font, const StringView s)
 	{
-		return prerender(font, font.getGlyphClusters(s, false, Ligature::Yes), true);
+		if (not prerender(font, font.getGlyphClusters(s, false, Ligature::Yes), true))
+		{
+			return false;
+		}
+
+		finishRasterization();
+		return true;
+	}
+
+	bool SDFGlyphCache::prewarm(const FontData& font, const Array<GlyphCluster>& clusters)
+	{
+		if (not prerender(font, clusters, false))
+		{
+			return false;
+		}
+
+		finishRasterization();
+		return true;
+	}
+
+	bool SDFGlyphCache::saveAtlas(const FontData& font, const FilePathView path)
+	{
+		if (m_rasterizationQueue.wait(m_buffer))
+		{
+			m_hasDirty = true;
+		}
+
+		return SaveGlyphAtlas(path, MakeGlyphAtlasKey(font, m_buffer.bufferWidth), m_buffer, m_glyphTable);
+	}
+
+	bool SDFGlyphCache::loadAtlas(const FontData& font, const FilePathView path)
+	{
+		// 生成中のグリフが古いアトラスに書き込まれないよう、先に完了させる
+		if (m_rasterizationQueue.wait(m_buffer))
+		{
+			m_hasDirty = true;
+		}
+
+		if (not LoadGlyphAtlas(path, MakeGlyphAtlasKey(font, m_buffer.bufferWidth), m_buffer, m_glyphTable))
+		{
+			return false;
+		}
+
+		m_hasDirty = true;
+
+		// texture content can be updated in a different thread
+		if (System::GetRendererType() == EngineOption::Renderer::Direct3D11)
+		{
+			updateTexture();
+		}
+
+		return true;
 	}
 
 	const Texture& SDFGlyphCache::getTexture() noexcept
 	{
+		if (m_rasterizationQueue.wait(m_buffer))
+		{
+			m_hasDirty = true;
+		}
 		updateTexture();
 
 		return m_texture;
@@ -611,6 +692,11 @@ namespace s3d
 		{
 			return{};
 		}
+
+		if (m_rasterizationQueue.wait(m_buffer))
+		{
+			m_hasDirty = true;
+		}
 		updateTexture();
 
 		const auto& cache = m_glyphTable.find(glyphIndex)->second;
@@ -630,16 +716,14 @@ namespace s3d
 
 	bool SDFGlyphCache::prerender(const FontData& font, const Array<GlyphCluster>& clusters, const bool isMainFont)
 	{
+		const ProfilerZone profilerZone{ U"Font::SDFGlyphCache::prerender" };
+
 		if (m_glyphTable.empty())
 		{
-			const SDFGlyph glyph = font.renderSDFByGlyphIndex(0, m_buffer.bufferWidth);
-
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not cacheGlyph(font, 0))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		for (const auto& cluster : clusters)
@@ -654,19 +738,10 @@ namespace s3d
 				continue;
 			}
 
-			const SDFGlyph glyph = font.renderSDFByGlyphIndex(cluster.glyphIndex, m_buffer.bufferWidth);
-
-			if (m_glyphTable.contains(glyph.glyphIndex))
-			{
-				continue;
-			}
-
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not cacheGlyph(font, cluster.glyphIndex))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		// texture content can be updated in a different thread
@@ -678,8 +753,56 @@ namespace s3d
 		return true;
 	}
 
+	bool SDFGlyphCache::cacheGlyph(const FontData& font, const GlyphIndex glyphIndex)
+	{
+		// アウトラインの読み込みと領域の確保はこのスレッドで行い、距離場の生成だけをワーカースレッドに任せる
+		PreparedSDFGlyph prepared = font.prepareSDFByGlyphIndex(glyphIndex, m_buffer.bufferWidth);
+
+		if (m_glyphTable.contains(prepared.glyph.glyphIndex))
+		{
+			return true;
+		}
+
+		const SDFGlyph& glyph = prepared.glyph;
+		const Size imageSize = (prepared.render ? Size{ (glyph.width + (2 * glyph.buffer)), (glyph.height + (2 * glyph.buffer)) } : Size{ 0, 0 });
+		const Optional<Point> pos = ReserveGlyph(font, imageSize, glyph, m_buffer, m_glyphTable);
+
+		if (not pos)
+		{
+			return false;
+		}
+
+		if (prepared.render)
+		{
+			m_rasterizationQueue.submit(*pos, std::move(prepared.render));
+		}
+
+		m_hasDirty = true;
+		return true;
+	}
+
+	void SDFGlyphCache::finishRasterization()
+	{
+		if (m_rasterizationQueue.wait(m_buffer))
+		{
+			m_hasDirty = true;
+		}
+
+		// texture content can be updated in a different thread
+		if (System::GetRendererType() == EngineOption::Renderer::Direct3D11)
+		{
+			updateTexture();
+		}
+	}
+
 	void SDFGlyphCache::updateTexture()
 	{
+		// ワーカースレッドで生成が完了したグリフをアトラスに書き込む
+		if (m_rasterizationQueue.collect(m_buffer))
+		{
+			m_hasDirty = true;
+		}
+
 		if (not m_hasDirty)
 		{
 			return;
@@ -45,6 +45,10 @@ namespace s3d
 		[[nodiscard]]
 		RectF regionFallback(const FontData& font, const GlyphCluster& cluster, bool usebasePos, const Vec2& pos, double size, double lineHeightScale) override;
 
+		bool layout(const FontData& font, StringView s, const Array<GlyphCluster>& clusters, size_t firstCluster, double size, double lineHeightScale, Array<TextLayoutGlyph>& glyphs) override;
+
+		void drawLayout(const FontData& font, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Vec2& pos, double size, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) override;
+
 		void setBufferWidth(int32 width) override;
 
 		[[nodiscard]]
@@ -52,6 +56,12 @@ namespace s3d
 
 		bool preload(const FontData& font, StringView s) override;
 
+		bool prewarm(const FontData& font, const Array<GlyphCluster>& clusters) override;
+
+		bool saveAtlas(const FontData& font, FilePathView path) override;
+
+		bool loadAtlas(const FontData& font, FilePathView path) override;
+
 		[[nodiscard]]
 		const Texture& getTexture() noexcept override;
 
@@ -70,10 +80,17 @@ namespace s3d
 		bool m_hasDirty = false;
 
 		BufferImage m_buffer = {};
+
+		GlyphRasterizationQueue m_rasterizationQueue;
 	
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
 
+		[[nodiscard]]
+		bool cacheGlyph(const FontData& font, GlyphIndex glyphIndex);
+
+		void finishRasterization();
+
 		void updateTexture();
 	};
 }
@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/ProfilerZone.hpp>
 # include "GlyphRenderer.hpp"
 # include "BitmapGlyphRenderer.hpp"
 # include "../FreeType.hpp"
@@ -17,6 +18,8 @@ namespace s3d
 {
 	BitmapGlyph RenderBitmapGlyph(FT_Face face, const GlyphIndex glyphIndex, const FontFaceProperty& prop)
 	{
+		const ProfilerZone profilerZone{ U"Font::RenderBitmapGlyph" };
+
 		const bool hasColor = prop.hasColor;
 
 		if (hasColor)
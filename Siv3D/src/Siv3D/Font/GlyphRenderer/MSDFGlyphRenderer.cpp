@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/ProfilerZone.hpp>
 # include "GlyphRenderer.hpp"
 # include "MSDFGlyphRenderer.hpp"
 # include "../FreeType.hpp"
@@ -140,8 +141,10 @@ namespace s3d
 		}
 	}
 
-	MSDFGlyph RenderMSDFGlyph(FT_Face face, const GlyphIndex glyphIndex, int32 buffer, const FontFaceProperty& prop)
+	PreparedMSDFGlyph PrepareMSDFGlyph(FT_Face face, const GlyphIndex glyphIndex, int32 buffer, const FontFaceProperty& prop)
 	{
+		const ProfilerZone profilerZone{ U"Font::PrepareMSDFGlyph" };
+
 		if (not LoadOutlineGlyph(face, glyphIndex, prop.style))
 		{
 			return{};
@@ -149,35 +152,44 @@ namespace s3d
 
 		buffer = Max(buffer, 0);
 
-		msdfgen::Shape shape;
-		if (not detail::GetShape(face, shape))
+		// 距離場の生成は FT_Face を参照しないため、アウトラインを共有してほかのスレッドで実行できるようにする
+		auto shape = std::make_shared<msdfgen::Shape>();
+		if (not detail::GetShape(face, *shape))
 		{
 			return{};
 		}
 
-		const GlyphBBox bbox = detail::GetBound(shape);
+		const GlyphBBox bbox = detail::GetBound(*shape);
+
+		PreparedMSDFGlyph result;
+		result.glyph.glyphIndex	= glyphIndex;
+		result.glyph.buffer		= buffer;
+		result.glyph.xAdvance	= (face->glyph->metrics.horiAdvance / 64.0);
+		result.glyph.yAdvance	= (face->glyph->metrics.vertAdvance / 64.0);
+		result.glyph.ascender	= prop.ascender;
+		result.glyph.descender	= prop.descender;
 
 		if (std::isinf(bbox.xMin) || std::isinf(bbox.xMax) || std::isinf(bbox.yMin) || std::isinf(bbox.yMax))
 		{
-			MSDFGlyph result;
-			result.glyphIndex	= glyphIndex;
-			result.buffer		= buffer;
-			result.left			= 0;
-			result.top			= 0;
-			result.width		= 0;
-			result.height		= 0;
-			result.xAdvance		= (face->glyph->metrics.horiAdvance / 64.0);
-			result.yAdvance		= (face->glyph->metrics.vertAdvance / 64.0);
-			result.ascender		= prop.ascender;
-			result.descender	= prop.descender;
-			result.image		= {};
+			result.glyph.left	= 0;
+			result.glyph.top	= 0;
+			result.glyph.width	= 0;
+			result.glyph.height	= 0;
 			return result;
 		}
-		else
+
+		const int32 width		= static_cast<int32>(bbox.xMax - bbox.xMin);
+		const int32 height		= static_cast<int32>(bbox.yMax - bbox.yMin);
+		result.glyph.left		= static_cast<int16>(bbox.xMin);
+		result.glyph.top		= static_cast<int16>(bbox.yMax);
+		result.glyph.width		= static_cast<int16>(width);
+		result.glyph.height		= static_cast<int16>(height);
+
+		result.render = [shape, bbox, width, height, buffer]()
 		{
-			const int32 width		= static_cast<int32>(bbox.xMax - bbox.xMin);
-			const int32 height		= static_cast<int32>(bbox.yMax - bbox.yMin);
-			const Vec2 offset{ (-bbox.xMin+ buffer), (-bbox.yMin + buffer) };
+			const ProfilerZone profilerZone{ U"Font::GenerateMSDF" };
+
+			const Vec2 offset{ (-bbox.xMin + buffer), (-bbox.yMin + buffer) };
 			const msdfgen::Projection projection{ 1.0, msdfgen::Vector2{ offset.x, offset.y } };
 			msdfgen::MSDFGeneratorConfig generatorConfig;
 			generatorConfig.overlapSupport = false;
@@ -185,21 +197,25 @@ namespace s3d
 			generatorConfig.errorCorrection.distanceCheckMode = msdfgen::ErrorCorrectionConfig::CHECK_DISTANCE_AT_EDGE;
 
 			msdfgen::Bitmap<float, 3> bitmap{ (width + (2 * buffer)), (height + (2 * buffer)) };
-			msdfgen::generateMSDF(bitmap, shape, projection, 4.0, generatorConfig);
-
-			MSDFGlyph result;
-			result.glyphIndex	= glyphIndex;
-			result.buffer		= buffer;
-			result.left			= static_cast<int16>(bbox.xMin);
-			result.top			= static_cast<int16>(bbox.yMax);
-			result.width		= static_cast<int16>(width);
-			result.height		= static_cast<int16>(height);
-			result.xAdvance		= (face->glyph->metrics.horiAdvance / 64.0);
-			result.yAdvance		= (face->glyph->metrics.vertAdvance / 64.0);
-			result.ascender		= prop.ascender;
-			result.descender	= prop.descender;
-			result.image		= detail::RenderMSDF(bitmap);
-			return result;
+			msdfgen::generateMSDF(bitmap, *shape, projection, 4.0, generatorConfig);
+
+			return detail::RenderMSDF(bitmap);
+		};
+
+		return result;
+	}
+
+	MSDFGlyph RenderMSDFGlyph(FT_Face face, const GlyphIndex glyphIndex, const int32 buffer, const FontFaceProperty& prop)
+	{
+		const ProfilerZone profilerZone{ U"Font::RenderMSDFGlyph" };
+
+		PreparedMSDFGlyph prepared = PrepareMSDFGlyph(face, glyphIndex, buffer, prop);
+
+		if (prepared.render)
+		{
+			prepared.glyph.image = prepared.render();
 		}
+
+		return prepared.glyph;
 	}
 }
@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/ProfilerZone.hpp>
 # include "GlyphRenderer.hpp"
 # include "OutlineGlyphRenderer.hpp"
 # include "../FreeType.hpp"
@@ -226,6 +227,8 @@ namespace s3d
 
 	OutlineGlyph RenderOutlineGlyph(FT_Face face, const GlyphIndex glyphIndex, const CloseRing closeRing, const FontFaceProperty& prop)
 	{
+		const ProfilerZone profilerZone{ U"Font::RenderOutlineGlyph" };
+
 		if (not LoadOutlineGlyph(face, glyphIndex, prop.style))
 		{
 			return{};
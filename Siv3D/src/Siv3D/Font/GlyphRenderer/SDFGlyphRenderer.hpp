@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <functional>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/SDFGlyph.hpp>
 
@@ -20,6 +21,21 @@ namespace s3d
 {
 	struct FontFaceProperty;
 
+	/// @brief アウトラインの読み込みを終え、画像の生成を待っているグリフ
+	struct PreparedSDFGlyph
+	{
+		/// @brief 画像以外の情報を設定したグリフ
+		SDFGlyph glyph;
+
+		/// @brief グリフの画像を生成する関数。FT_Face を参照しないため、ほかのスレッドで実行できます。画像が無いグリフでは空です。
+		std::function<Image()> render;
+	};
+
+	/// @brief グリフのアウトラインを読み込み、画像を生成する準備をします。
+	/// @remark FT_Face を操作するため、フォントを所有するスレッドから呼ぶ必要があります。
+	[[nodiscard]]
+	PreparedSDFGlyph PrepareSDFGlyph(FT_Face face, GlyphIndex glyphIndex, int32 buffer, const FontFaceProperty& prop);
+
 	[[nodiscard]]
 	SDFGlyph RenderSDFGlyph(FT_Face face, GlyphIndex glyphIndex, int32 buffer, const FontFaceProperty& prop);
 }
@@ -18,6 +18,8 @@
 
 namespace s3d
 {
+	struct TextLayoutGlyph;
+
 	class SIV3D_NOVTABLE ISiv3DFont
 	{
 	public:
@@ -84,6 +86,12 @@ namespace s3d
 
 		virtual bool preload(Font::IDType handleID, StringView chars) = 0;
 
+		virtual bool prewarm(Font::IDType handleID, StringView chars) = 0;
+
+		virtual bool saveGlyphCache(Font::IDType handleID, FilePathView path) = 0;
+
+		virtual bool loadGlyphCache(Font::IDType handleID, FilePathView path) = 0;
+
 		virtual const Texture& getTexture(Font::IDType handleID) = 0;
 
 		virtual Glyph getGlyph(Font::IDType handleID, StringView ch) = 0;
@@ -105,6 +113,10 @@ namespace s3d
 		virtual bool draw(Font::IDType handleID, StringView s, const Array<GlyphCluster>& clusters, const RectF& area, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) = 0;
 
 		virtual RectF drawBase(Font::IDType handleID, StringView s, const Array<GlyphCluster>& clusters, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) = 0;
+
+		virtual bool layout(Font::IDType handleID, StringView s, const Array<GlyphCluster>& clusters, size_t firstCluster, double fontSize, double lineHeightScale, Array<TextLayoutGlyph>& glyphs) = 0;
+
+		virtual void drawLayout(Font::IDType handleID, const Array<GlyphCluster>& clusters, const Array<TextLayoutGlyph>& glyphs, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) = 0;
 	
 		virtual RectF drawFallback(Font::IDType handleID, const GlyphCluster& cluster, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ColorF& color, double lineHeightScale) = 0;
 
@@ -398,6 +398,47 @@ namespace s3d
 		return SIV3D_ENGINE(Font)->preload(m_handle->id(), chars);
 	}
 
+	bool Font::prewarm(const StringView chars) const
+	{
+		return SIV3D_ENGINE(Font)->prewarm(m_handle->id(), chars);
+	}
+
+	bool Font::prewarm(const char32 first, const char32 last) const
+	{
+		if (last < first)
+		{
+			return true;
+		}
+
+		String chars;
+		chars.reserve(last - first + 1);
+
+		for (char32 ch = first; ; ++ch)
+		{
+			if ((ch < 0xD800) || (0xDFFF < ch))
+			{
+				chars.push_back(ch);
+			}
+
+			if (ch == last)
+			{
+				break;
+			}
+		}
+
+		return SIV3D_ENGINE(Font)->prewarm(m_handle->id(), chars);
+	}
+
+	bool Font::saveGlyphCache(const FilePathView path) const
+	{
+		return SIV3D_ENGINE(Font)->saveGlyphCache(m_handle->id(), path);
+	}
+
+	bool Font::loadGlyphCache(const FilePathView path) const
+	{
+		return SIV3D_ENGINE(Font)->loadGlyphCache(m_handle->id(), path);
+	}
+
 	const Texture& Font::getTexture() const
 	{
 		return SIV3D_ENGINE(Font)->getTexture(m_handle->id());
@@ -139,9 +139,14 @@ namespace s3d
 		return SIV3D_ENGINE(Asset)->load(AssetType::Font, name, preloadText);
 	}
 
-	void FontAsset::LoadAsync(const AssetNameView name, const StringView preloadText)
+	void FontAsset::LoadAsync(const AssetNameView name, const StringView preloadText, const int32 priority)
 	{
-		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Font, name, preloadText);
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Font, name, preloadText, priority);
+	}
+
+	bool FontAsset::CancelLoadAsync(const AssetNameView name)
+	{
+		return SIV3D_ENGINE(Asset)->cancelLoadAsync(AssetType::Font, name);
 	}
 
 	void FontAsset::Wait(const AssetNameView name)
@@ -980,23 +980,7 @@ namespace s3d
 
 		bool Intersect(const Vec2& a, const Polygon& b) noexcept
 		{
-			if ((not b)
-				|| (not Intersect(a, b.boundingRect())))
-			{
-				return false;
-			}
-
-			const size_t num_triangles = b.num_triangles();
-
-			for (size_t i = 0; i < num_triangles; ++i)
-			{
-				if (Intersect(a, b.triangle(i)))
-				{
-					return true;
-				}
-			}
-
-			return false;
+			return b._detail()->contains(a);
 		}
 
 		bool Intersect(const Vec2& a, const MultiPolygon& b) noexcept
@@ -1484,23 +1468,7 @@ namespace s3d
 
 		bool Intersect(const Circle& a, const Polygon& b) noexcept
 		{
-			if ((not b)
-				|| (not Intersect(a, b.boundingRect())))
-			{
-				return false;
-			}
-
-			const size_t num_triangles = b.num_triangles();
-
-			for (size_t i = 0; i < num_triangles; ++i)
-			{
-				if (Intersect(a, b.triangle(i)))
-				{
-					return true;
-				}
-			}
-
-			return false;
+			return b._detail()->intersects(a);
 		}
 
 		bool Intersect(const Circle& a, const MultiPolygon& b) noexcept
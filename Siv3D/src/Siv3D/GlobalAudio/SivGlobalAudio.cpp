@@ -11,6 +11,7 @@
 
 # include <Siv3D/GlobalAudio.hpp>
 # include <Siv3D/Audio/IAudio.hpp>
+# include <Siv3D/Audio/CompressedAudioCache.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/EngineLog.hpp>
 
@@ -33,6 +34,16 @@ namespace s3d
 			SIV3D_ENGINE(Audio)->globalResume();
 		}
 
+		size_t GetCompressedCacheCapacity()
+		{
+			return SIV3D_ENGINE(Audio)->getCompressedAudioCache().getCapacity();
+		}
+
+		void SetCompressedCacheCapacity(const size_t bytes)
+		{
+			SIV3D_ENGINE(Audio)->getCompressedAudioCache().setCapacity(bytes);
+		}
+
 		double GetVolume()
 		{
 			return SIV3D_ENGINE(Audio)->getGlobalVolume();
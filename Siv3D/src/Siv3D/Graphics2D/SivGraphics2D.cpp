@@ -12,6 +12,7 @@
 # include <Siv3D/Graphics2D.hpp>
 # include <Siv3D/Scene.hpp>
 # include <Siv3D/TextStyle.hpp>
+# include <Siv3D/2DShapes.hpp>
 # include <Siv3D/Renderer2D/IRenderer2D.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 
@@ -136,6 +137,36 @@ namespace s3d
 			SIV3D_ENGINE(Renderer2D)->addNullVertices(count * 3);
 		}
 
+		void DrawCircles(const Array<Circle>& circles, const ColorF& color)
+		{
+			SIV3D_ENGINE(Renderer2D)->addCircles(circles.data(), circles.size(), nullptr, color.toFloat4());
+		}
+
+		void DrawCircles(const Array<Circle>& circles, const Array<ColorF>& colors)
+		{
+			SIV3D_ENGINE(Renderer2D)->addCircles(circles.data(), Min(circles.size(), colors.size()), colors.data(), Float4{ 1.0f, 1.0f, 1.0f, 1.0f });
+		}
+
+		void DrawRects(const Array<RectF>& rects, const ColorF& color)
+		{
+			SIV3D_ENGINE(Renderer2D)->addRects(rects.data(), rects.size(), nullptr, color.toFloat4());
+		}
+
+		void DrawRects(const Array<RectF>& rects, const Array<ColorF>& colors)
+		{
+			SIV3D_ENGINE(Renderer2D)->addRects(rects.data(), Min(rects.size(), colors.size()), colors.data(), Float4{ 1.0f, 1.0f, 1.0f, 1.0f });
+		}
+
+		void DrawTexturedQuads(const Texture& texture, const Array<Quad>& quads, const ColorF& diffuse)
+		{
+			SIV3D_ENGINE(Renderer2D)->addTexturedQuads(texture, quads.data(), quads.size(), nullptr, diffuse.toFloat4());
+		}
+
+		void DrawTexturedQuads(const Texture& texture, const Array<Quad>& quads, const Array<RectF>& uvRects, const ColorF& diffuse)
+		{
+			SIV3D_ENGINE(Renderer2D)->addTexturedQuads(texture, quads.data(), Min(quads.size(), uvRects.size()), uvRects.data(), diffuse.toFloat4());
+		}
+
 		void SetSDFParameters(const TextStyle& textStyle)
 		{
 			Float4 param = textStyle.param;
@@ -0,0 +1,339 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/SIMD.hpp>
+# include "ImagePixelOps.hpp"
+
+namespace s3d
+{
+	namespace ImagePixelOps
+	{
+		namespace detail
+		{
+			// 1 回の SIMD 処理で扱うピクセル数
+			static constexpr size_t Lanes = 4;
+
+			[[nodiscard]]
+			inline __m128i Load(const Color* p) noexcept
+			{
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			}
+
+			inline void Store(Color* p, const __m128i v) noexcept
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+			}
+
+			// 4 ピクセル分の 32-bit 整数レーンを、double 2 つずつの組に変換する
+			inline void ToDouble(const __m128i v, __m128d& lo, __m128d& hi) noexcept
+			{
+				lo = _mm_cvtepi32_pd(v);
+				hi = _mm_cvtepi32_pd(_mm_srli_si128(v, 8));
+			}
+
+			// double 2 つずつの組を、切り捨てて 4 つの 32-bit 整数レーンにする
+			[[nodiscard]]
+			inline __m128i ToInt32(const __m128d lo, const __m128d hi) noexcept
+			{
+				return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+			}
+
+			inline void SplitRGB(const __m128i v, __m128i& r, __m128i& g, __m128i& b) noexcept
+			{
+				const __m128i mask = _mm_set1_epi32(0xFF);
+				r = _mm_and_si128(v, mask);
+				g = _mm_and_si128(_mm_srli_epi32(v, 8), mask);
+				b = _mm_and_si128(_mm_srli_epi32(v, 16), mask);
+			}
+
+			[[nodiscard]]
+			inline __m128i AlphaOf(const __m128i v) noexcept
+			{
+				return _mm_and_si128(v, _mm_set1_epi32(static_cast<int32>(0xFF000000)));
+			}
+
+			[[nodiscard]]
+			inline Color MakeSepia(Color color) noexcept
+			{
+				const double tr = Min(((0.393 * color.r) + (0.769 * color.g) + (0.189 * color.b)), 255.0);
+				const double tg = Min(((0.349 * color.r) + (0.686 * color.g) + (0.168 * color.b)), 255.0);
+				const double tb = Min(((0.272 * color.r) + (0.534 * color.g) + (0.131 * color.b)), 255.0);
+
+				color.r = static_cast<uint8>(tr);
+				color.g = static_cast<uint8>(tg);
+				color.b = static_cast<uint8>(tb);
+				return color;
+			}
+
+			// (c0 * r + c1 * g) + c2 * b をスカラー版と同じ順序で計算する
+			template <bool Clamp255>
+			[[nodiscard]]
+			inline __m128i WeightedSum(const __m128i r, const __m128i g, const __m128i b,
+				const double c0, const double c1, const double c2) noexcept
+			{
+				__m128d rLo, rHi, gLo, gHi, bLo, bHi;
+				ToDouble(r, rLo, rHi);
+				ToDouble(g, gLo, gHi);
+				ToDouble(b, bLo, bHi);
+
+				const __m128d v0 = _mm_set1_pd(c0), v1 = _mm_set1_pd(c1), v2 = _mm_set1_pd(c2);
+				__m128d lo = _mm_add_pd(_mm_add_pd(_mm_mul_pd(v0, rLo), _mm_mul_pd(v1, gLo)), _mm_mul_pd(v2, bLo));
+				__m128d hi = _mm_add_pd(_mm_add_pd(_mm_mul_pd(v0, rHi), _mm_mul_pd(v1, gHi)), _mm_mul_pd(v2, bHi));
+
+				if constexpr (Clamp255)
+				{
+					lo = _mm_min_pd(lo, _mm_set1_pd(255.0));
+					hi = _mm_min_pd(hi, _mm_set1_pd(255.0));
+				}
+
+				return ToInt32(lo, hi);
+			}
+		}
+
+		void Negate(Color* pixels, const size_t count) noexcept
+		{
+			const __m128i mask = _mm_set1_epi32(0x00FFFFFF);
+			size_t i = 0;
+
+			for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+			{
+				detail::Store((pixels + i), _mm_xor_si128(detail::Load(pixels + i), mask));
+			}
+
+			for (; i < count; ++i)
+			{
+				pixels[i] = ~pixels[i];
+			}
+		}
+
+		void Grayscale(Color* pixels, const size_t count) noexcept
+		{
+			const __m128i rgbScale = _mm_set1_epi32(0x010101);
+			size_t i = 0;
+
+			for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+			{
+				const __m128i v = detail::Load(pixels + i);
+
+				__m128i r, g, b;
+				detail::SplitRGB(v, r, g, b);
+
+				const __m128i gray = detail::WeightedSum<false>(r, g, b, 0.299, 0.587, 0.114);
+				detail::Store((pixels + i), _mm_or_si128(_mm_mullo_epi32(gray, rgbScale), detail::AlphaOf(v)));
+			}
+
+			for (; i < count; ++i)
+			{
+				Color& pixel = pixels[i];
+				const uint8 gray = pixel.grayscale0_255();
+				pixel.r = gray;
+				pixel.g = gray;
+				pixel.b = gray;
+			}
+		}
+
+		void Sepia(Color* pixels, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+			for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+			{
+				const __m128i v = detail::Load(pixels + i);
+
+				__m128i r, g, b;
+				detail::SplitRGB(v, r, g, b);
+
+				const __m128i tr = detail::WeightedSum<true>(r, g, b, 0.393, 0.769, 0.189);
+				const __m128i tg = detail::WeightedSum<true>(r, g, b, 0.349, 0.686, 0.168);
+				const __m128i tb = detail::WeightedSum<true>(r, g, b, 0.272, 0.534, 0.131);
+
+				const __m128i rgb = _mm_or_si128(tr, _mm_or_si128(_mm_slli_epi32(tg, 8), _mm_slli_epi32(tb, 16)));
+				detail::Store((pixels + i), _mm_or_si128(rgb, detail::AlphaOf(v)));
+			}
+
+			for (; i < count; ++i)
+			{
+				pixels[i] = detail::MakeSepia(pixels[i]);
+			}
+		}
+
+		void ApplyTableRGB(Color* pixels, const size_t count, const uint8 table[256]) noexcept
+		{
+			// テーブル参照は SIMD 化しても速くならないため、スカラーで処理する
+			for (size_t i = 0; i < count; ++i)
+			{
+				Color& pixel = pixels[i];
+				pixel.r = table[pixel.r];
+				pixel.g = table[pixel.g];
+				pixel.b = table[pixel.b];
+			}
+		}
+
+		void Brighten(Color* pixels, const size_t count, const int32 level) noexcept
+		{
+			if (level == 0)
+			{
+				return;
+			}
+
+			const uint32 amount = static_cast<uint32>(Min<int64>(((level < 0) ? -static_cast<int64>(level) : level), 255));
+			const __m128i add = _mm_set1_epi32(static_cast<int32>(amount * 0x010101));
+			size_t i = 0;
+
+			if (level < 0)
+			{
+				for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+				{
+					detail::Store((pixels + i), _mm_subs_epu8(detail::Load(pixels + i), add));
+				}
+
+				for (; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
+					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
+					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
+				}
+			}
+			else
+			{
+				for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+				{
+					detail::Store((pixels + i), _mm_adds_epu8(detail::Load(pixels + i), add));
+				}
+
+				for (; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
+					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
+					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
+				}
+			}
+		}
+
+		void Threshold(Color* pixels, const size_t count, const uint8 threshold, const bool invertColor) noexcept
+		{
+			const double thresholdF = (threshold / 255.0);
+			const uint32 over = (invertColor ? 0 : 255);
+			const uint32 under = (255 - over);
+			const __m128d vThreshold = _mm_set1_pd(thresholdF);
+			const __m128i vOver = _mm_set1_epi32(static_cast<int32>(over * 0x010101));
+			const __m128i vUnder = _mm_set1_epi32(static_cast<int32>(under * 0x010101));
+			size_t i = 0;
+
+			for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+			{
+				const __m128i v = detail::Load(pixels + i);
+
+				__m128i r, g, b;
+				detail::SplitRGB(v, r, g, b);
+
+				__m128d rLo, rHi, gLo, gHi, bLo, bHi;
+				detail::ToDouble(r, rLo, rHi);
+				detail::ToDouble(g, gLo, gHi);
+				detail::ToDouble(b, bLo, bHi);
+
+				// Color::grayscale() と同じ順序で計算する
+				const __m128d c0 = _mm_set1_pd(0.299 / 255.0), c1 = _mm_set1_pd(0.587 / 255.0), c2 = _mm_set1_pd(0.114 / 255.0);
+				const __m128d grayLo = _mm_add_pd(_mm_add_pd(_mm_mul_pd(c0, rLo), _mm_mul_pd(c1, gLo)), _mm_mul_pd(c2, bLo));
+				const __m128d grayHi = _mm_add_pd(_mm_add_pd(_mm_mul_pd(c0, rHi), _mm_mul_pd(c1, gHi)), _mm_mul_pd(c2, bHi));
+
+				// 64-bit のマスクを 32-bit のマスクに詰める
+				const __m128 maskLo = _mm_castpd_ps(_mm_cmplt_pd(vThreshold, grayLo));
+				const __m128 maskHi = _mm_castpd_ps(_mm_cmplt_pd(vThreshold, grayHi));
+				const __m128i mask = _mm_castps_si128(_mm_shuffle_ps(maskLo, maskHi, _MM_SHUFFLE(2, 0, 2, 0)));
+
+				const __m128i rgb = _mm_blendv_epi8(vUnder, vOver, mask);
+				detail::Store((pixels + i), _mm_or_si128(rgb, detail::AlphaOf(v)));
+			}
+
+			for (; i < count; ++i)
+			{
+				Color& pixel = pixels[i];
+
+				if (thresholdF < pixel.grayscale())
+				{
+					pixel.setRGB(over);
+				}
+				else
+				{
+					pixel.setRGB(under);
+				}
+			}
+		}
+
+		void SwapRB(Color* pixels, const size_t count) noexcept
+		{
+			const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+			size_t i = 0;
+
+			for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+			{
+				detail::Store((pixels + i), _mm_shuffle_epi8(detail::Load(pixels + i), shuffle));
+			}
+
+			for (; i < count; ++i)
+			{
+				Color& pixel = pixels[i];
+				const uint8 t = pixel.r;
+				pixel.r = pixel.b;
+				pixel.b = t;
+			}
+		}
+
+		void SwapReversed(Color* pFront, Color* pBackEnd, const size_t count) noexcept
+		{
+			size_t i = 0;
+
+			// 前方と後方から 4 ピクセルずつ反転して入れ替える
+			for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+			{
+				pBackEnd -= detail::Lanes;
+
+				const __m128i front = _mm_shuffle_epi32(detail::Load(pFront), _MM_SHUFFLE(0, 1, 2, 3));
+				const __m128i back = _mm_shuffle_epi32(detail::Load(pBackEnd), _MM_SHUFFLE(0, 1, 2, 3));
+				detail::Store(pFront, back);
+				detail::Store(pBackEnd, front);
+
+				pFront += detail::Lanes;
+			}
+
+			for (; i < count; ++i)
+			{
+				std::swap(*pFront++, *--pBackEnd);
+			}
+		}
+
+		void Reverse(Color* pixels, const size_t count) noexcept
+		{
+			SwapReversed(pixels, (pixels + count), (count / 2));
+		}
+
+		void ReverseCopy(const Color* pSrc, Color* pDst, const size_t count) noexcept
+		{
+			const Color* pSrcEnd = (pSrc + count);
+			size_t i = 0;
+
+			for (; (i + detail::Lanes) <= count; i += detail::Lanes)
+			{
+				pSrcEnd -= detail::Lanes;
+				detail::Store((pDst + i), _mm_shuffle_epi32(detail::Load(pSrcEnd), _MM_SHUFFLE(0, 1, 2, 3)));
+			}
+
+			for (; i < count; ++i)
+			{
+				pDst[i] = *--pSrcEnd;
+			}
+		}
+	}
+}
@@ -0,0 +1,42 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <Siv3D/Image.hpp>
+
+namespace s3d
+{
+	// Image のピクセル単位の処理（SIMD 版）
+	// いずれもスカラー版の処理とビット単位で同じ結果を返す
+	namespace ImagePixelOps
+	{
+		void Negate(Color* pixels, size_t count) noexcept;
+
+		void Grayscale(Color* pixels, size_t count) noexcept;
+
+		void Sepia(Color* pixels, size_t count) noexcept;
+
+		void ApplyTableRGB(Color* pixels, size_t count, const uint8 table[256]) noexcept;
+
+		void Brighten(Color* pixels, size_t count, int32 level) noexcept;
+
+		void Threshold(Color* pixels, size_t count, uint8 threshold, bool invertColor) noexcept;
+
+		void SwapRB(Color* pixels, size_t count) noexcept;
+
+		void SwapReversed(Color* pFront, Color* pBackEnd, size_t count) noexcept;
+
+		void Reverse(Color* pixels, size_t count) noexcept;
+
+		void ReverseCopy(const Color* pSrc, Color* pDst, size_t count) noexcept;
+	}
+}
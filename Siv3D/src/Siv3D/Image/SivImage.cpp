@@ -21,6 +21,8 @@
 # include <Siv3D/ImageDecoder.hpp>
 # include <Siv3D/ImageEncoder.hpp>
 # include <Siv3D/Dialog.hpp>
+# include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/ImageFormat/PNGEncoder.hpp>
 # include <Siv3D/ImageFormat/JPEGEncoder.hpp>
@@ -28,6 +30,7 @@
 # include <Siv3D/ImageFormat/WebPEncoder.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 # include "ImagePainting.hpp"
+# include "ImagePixelOps.hpp"
 
 namespace s3d
 {
@@ -56,17 +59,142 @@ namespace s3d
 			return (px * py * (c1 - c2 - c3 + c4) + px * (c2 - c1) + py * (c3 - c1) + c1);
 		}
 
-		[[nodiscard]]
-		static Color MakeSepia(Color color) noexcept
+		// 並列処理を行う最小のピクセル数
+		inline constexpr size_t ParallelMinPixels = (256 * 256);
+
+		// 並列処理で 1 つのチャンクが扱うピクセル数の目安
+		inline constexpr size_t ParallelGrainPixels = (64 * 1024);
+
+		// [0, count) の要素（1 要素あたり pixelsPerItem ピクセル）を処理する。並列処理が有効な場合はチャンクに分割して並列に処理する
+		template <class Fty>
+		static void ForEachChunk(const size_t count, const size_t pixelsPerItem, Fty f)
+		{
+			if (ImageProcessing::IsParallelEnabled()
+				&& (ParallelMinPixels <= (count * pixelsPerItem)))
+			{
+				Threading::ParallelFor(count, f, Max<size_t>(1, (ParallelGrainPixels / pixelsPerItem)));
+			}
+			else
+			{
+				f(size_t{ 0 }, count);
+			}
+		}
+
+		// 画像の全ピクセルに op(Color*, size_t) を適用する
+		template <class Fty>
+		static void ApplyPixelOp(Image& image, Fty op)
+		{
+			Color* const pData = image.data();
+
+			ForEachChunk(image.num_pixels(), 1, [pData, &op](const size_t first, const size_t last)
+			{
+				op((pData + first), (last - first));
+			});
+		}
+
+		// 正方形の画像を 90° 回転する
+		template <bool Clockwise>
+		static void Rotate90Square(Color* const pData, const size_t size)
+		{
+			constexpr size_t BlockSize = 8;
+			const size_t halfHeight = (size / 2);
+			const size_t halfWidth = (halfHeight + size % 2);
+			const size_t blockCount = ((halfWidth + (BlockSize - 1)) / BlockSize);
+
+			// 以下のように画像を4つの領域 A, B, C, D に分け、
+			// 時計回りの場合は各画素を A←B, B←C, C←D, D←A と、
+			// 反時計回りの場合は各画素を A←D, D←C, C←B, B←A とそれぞれコピーする
+			//     AADD    AAADD
+			//     AADD    AAADD
+			//     BBCC    BB.DD
+			//     BBCC    BBCCC
+			//             BBCCC
+			ForEachChunk(blockCount, (BlockSize * halfHeight * 4), [=](const size_t first, const size_t last)
+			{
+				for (size_t i = first; i < last; ++i)
+				{
+					const size_t b = (i * BlockSize);
+
+					for (size_t y = 0; y < halfHeight; ++y)
+					{
+						Color* p1 = (pData + y * size + b);
+						Color* p2 = (pData + (size - b - 1) * size + y);
+						Color* p3 = (pData + (size - y) * size - b - 1);
+						Color* p4 = (pData + (b + 1) * size - y - 1);
+						const size_t w = Min((halfWidth - b), BlockSize);
+
+						for (size_t x = 0; x < w; ++x)
+						{
+							const Color tmp = *p1;
+
+							if constexpr (Clockwise)
+							{
+								*p1 = *p2;
+								*p2 = *p3;
+								*p3 = *p4;
+								*p4 = tmp;
+							}
+							else
+							{
+								*p1 = *p4;
+								*p4 = *p3;
+								*p3 = *p2;
+								*p2 = tmp;
+							}
+
+							++p1;
+							p2 -= size;
+							--p3;
+							p4 += size;
+						}
+					}
+				}
+			});
+		}
+
+		// width x height の画像を 90° 回転して、height x width の画像にコピーする
+		template <bool Clockwise>
+		static void Rotate90Copy(const Color* const pSrcBase, Color* const pDstBase, const size_t width, const size_t height)
 		{
-			const double tr = Min(((0.393 * color.r) + (0.769 * color.g) + (0.189 * color.b)), 255.0);
-			const double tg = Min(((0.349 * color.r) + (0.686 * color.g) + (0.168 * color.b)), 255.0);
-			const double tb = Min(((0.272 * color.r) + (0.534 * color.g) + (0.131 * color.b)), 255.0);
+			constexpr size_t BlockSize = 8;
+			const size_t blockCount = ((width + (BlockSize - 1)) / BlockSize);
+
+			ForEachChunk(blockCount, (BlockSize * height), [=](const size_t first, const size_t last)
+			{
+				for (size_t i = first; i < last; ++i)
+				{
+					const size_t b = (i * BlockSize);
+					const size_t w = Min((width - b), BlockSize);
+
+					for (size_t y = 0; y < height; ++y)
+					{
+						const Color* pSrc = (pSrcBase + y * width + b);
+
+						if constexpr (Clockwise)
+						{
+							Color* pDst = (pDstBase + b * height + (height - y - 1));
+
+							for (size_t x = 0; x < w; ++x)
+							{
+								*pDst = *pSrc;
+								++pSrc;
+								pDst += height;
+							}
+						}
+						else
+						{
+							Color* pDst = (pDstBase + (width - b - 1) * height + y);
 
-			color.r = static_cast<uint8>(tr);
-			color.g = static_cast<uint8>(tg);
-			color.b = static_cast<uint8>(tb);
-			return color;
+							for (size_t x = 0; x < w; ++x)
+							{
+								*pDst = *pSrc;
+								++pSrc;
+								pDst -= height;
+							}
+						}
+					}
+				}
+			});
 		}
 
 		static void InitPosterizeTable(const int32 level, uint8 table[256]) noexcept
@@ -812,16 +940,7 @@ namespace s3d
 
 	Image& Image::RGBAtoBGRA()
 	{
-		Color* p = m_data.data();
-		const Color* pEnd = (p + num_pixels());
-
-		while (p != pEnd)
-		{
-			const uint8 t = p->r;
-			p->r = p->b;
-			p->b = t;
-			++p;
-		}
+		detail::ApplyPixelOp(*this, ImagePixelOps::SwapRB);
 
 		return *this;
 	}
@@ -946,10 +1065,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = ~pixel;
-			}
+			detail::ApplyPixelOp(*this, ImagePixelOps::Negate);
 		}
 
 		return *this;
@@ -969,10 +1085,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = ~pixel;
-			}
+			detail::ApplyPixelOp(image, ImagePixelOps::Negate);
 
 			return image;
 		}
@@ -995,13 +1108,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			detail::ApplyPixelOp(*this, ImagePixelOps::Grayscale);
 		}
 
 		return *this;
@@ -1021,13 +1128,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			detail::ApplyPixelOp(image, ImagePixelOps::Grayscale);
 
 			return image;
 		}
@@ -1050,10 +1151,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			detail::ApplyPixelOp(*this, ImagePixelOps::Sepia);
 		}
 
 		return *this;
@@ -1073,10 +1171,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			detail::ApplyPixelOp(image, ImagePixelOps::Sepia);
 
 			return image;
 		}
@@ -1102,12 +1197,10 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitPosterizeTable(level, colorTable);
 
-			for (auto& pixel : m_data)
+			detail::ApplyPixelOp(*this, [&colorTable](Color* pixels, const size_t count)
 			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+				ImagePixelOps::ApplyTableRGB(pixels, count, colorTable);
+			});
 		}
 
 		return *this;
@@ -1130,12 +1223,10 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitPosterizeTable(level, colorTable);
 
-			for (auto& pixel : image)
+			detail::ApplyPixelOp(image, [&colorTable](Color* pixels, const size_t count)
 			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+				ImagePixelOps::ApplyTableRGB(pixels, count, colorTable);
+			});
 
 			return image;
 		}
@@ -1158,24 +1249,10 @@ namespace s3d
 
 		// 2. 処理
 		{
-			if (level < 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
+			detail::ApplyPixelOp(*this, [level](Color* pixels, const size_t count)
 			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+				ImagePixelOps::Brighten(pixels, count, level);
+			});
 		}
 
 		return *this;
@@ -1195,24 +1272,10 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			if (level < 0)
+			detail::ApplyPixelOp(image, [level](Color* pixels, const size_t count)
 			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+				ImagePixelOps::Brighten(pixels, count, level);
+			});
 
 			return image;
 		}
@@ -1235,14 +1298,16 @@ namespace s3d
 
 		// 2. 処理
 		{
-			const size_t imageWidth = m_width;
-			Color* p = m_data.data();
+			const size_t width = m_width;
+			Color* const pData = data();
 
-			for (uint32 y = 0; y < m_height; ++y)
+			detail::ForEachChunk(m_height, width, [=](const size_t first, const size_t last)
 			{
-				std::reverse(p, p + imageWidth);
-				p += imageWidth;
-			}
+				for (size_t y = first; y < last; ++y)
+				{
+					ImagePixelOps::Reverse((pData + width * y), width);
+				}
+			});
 		}
 
 		return *this;
@@ -1262,20 +1327,17 @@ namespace s3d
 		{
 			Image image{ m_width, m_height };
 
-			const Color* pSrc = data();
-			Color* pDst = image.data();
+			const Color* const pSrc = data();
+			Color* const pDst = image.data();
 			const size_t width = m_width;
 
-			for (size_t y = 0; y < m_height; ++y)
+			detail::ForEachChunk(m_height, width, [=](const size_t first, const size_t last)
 			{
-				const Color* pSrcLine = (pSrc + width * y + width - 1);
-				Color* pDstLine = (pDst + width * y);
-
-				for (size_t x = 0; x < m_width; ++x)
+				for (size_t y = first; y < last; ++y)
 				{
-					*(pDstLine + x) = *(pSrcLine - x);
+					ImagePixelOps::ReverseCopy((pSrc + width * y), (pDst + width * y), width);
 				}
-			}
+			});
 
 			return image;
 		}
@@ -1296,18 +1358,21 @@ namespace s3d
 			}
 		}
 
-		// 2. 処理A
+		// 2. 処理
 		{
-			const size_t imageWidth = m_width;
-			Color* pLineFrom = data();
-			Color* pLineTo = pLineFrom + (imageWidth * (m_height - 1));
+			const size_t width = m_width;
+			const size_t height = m_height;
+			Color* const pData = data();
 
-			for (uint32 y = 0; y < (m_height / 2); ++y)
+			detail::ForEachChunk((height / 2), width, [=](const size_t first, const size_t last)
 			{
-				std::swap_ranges(pLineFrom, pLineFrom + imageWidth, pLineTo);
-				pLineFrom += imageWidth;
-				pLineTo -= imageWidth;
-			}
+				for (size_t y = first; y < last; ++y)
+				{
+					Color* const pLineFrom = (pData + width * y);
+					Color* const pLineTo = (pData + width * (height - y - 1));
+					std::swap_ranges(pLineFrom, (pLineFrom + width), pLineTo);
+				}
+			});
 		}
 
 		return *this;
@@ -1327,16 +1392,19 @@ namespace s3d
 		{
 			Image image{ m_width, m_height };
 
+			const size_t width = m_width;
+			const size_t height = m_height;
 			const size_t stride_bytes = stride();
-			const Color* pSrc = data() + (m_height - 1) * m_width;
-			Color* pDst = image.data();
+			const Color* const pSrc = data();
+			Color* const pDst = image.data();
 
-			for (size_t y = 0; y < m_height; ++y)
+			detail::ForEachChunk(height, width, [=](const size_t first, const size_t last)
 			{
-				std::memcpy(pDst, pSrc, stride_bytes);
-				pDst += m_width;
-				pSrc -= m_width;
-			}
+				for (size_t y = first; y < last; ++y)
+				{
+					std::memcpy((pDst + width * y), (pSrc + width * (height - y - 1)), stride_bytes);
+				}
+			});
 
 			return image;
 		}
@@ -1359,70 +1427,15 @@ namespace s3d
 
 		// 2. 処理
 		{
-			constexpr size_t BlockSize = 8;
-
 			if (m_width == m_height)
 			{
-				Color* const pData = data();
-				const size_t halfHeight = (m_height / 2);
-				const size_t halfWidth = (halfHeight + m_height % 2);
-
-				// 以下のように画像を4つの領域 A, B, C, D に分け、各画素を A←B, B←C, C←D, D←A とそれぞれコピーする
-				//     AADD    AAADD
-				//     AADD    AAADD
-				//     BBCC    BB.DD
-				//     BBCC    BBCCC
-				//             BBCCC
-				for (size_t b = 0; b < halfWidth; b += BlockSize)
-				{
-					for (size_t y = 0; y < halfHeight; ++y)
-					{
-						Color* p1 = (pData + y * m_width + b);
-						Color* p2 = (pData + (m_height - b - 1) * m_width + y);
-						Color* p3 = (pData + (m_height - y) * m_width - b - 1);
-						Color* p4 = (pData + (b + 1) * m_width - y - 1);
-						const size_t w = Min((halfWidth - b), BlockSize);
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							const Color tmp = *p1;
-							*p1 = *p2;
-							*p2 = *p3;
-							*p3 = *p4;
-							*p4 = tmp;
-							++p1;
-							p2 -= m_width;
-							--p3;
-							p4 += m_width;
-						}
-					}
-				}
+				detail::Rotate90Square<true>(data(), m_width);
 			}
 			else
 			{
 				Image tmp{ m_height, m_width };
 
-				const Color* const pData = data();
-				Color* const pDstBase = tmp.data();
-
-				for (size_t b = 0; b < m_width; b += BlockSize)
-				{
-					Color* const pDstLine = (pDstBase + b * m_height);
-					const size_t w = Min((m_width - b), BlockSize);
-
-					for (size_t y = 0; y < m_height; ++y)
-					{
-						const Color* pSrc = (pData + y * m_width + b);
-						Color* pDst = (pDstLine + (m_height - y - 1));
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							*pDst = *pSrc;
-							++pSrc;
-							pDst += m_height;
-						}
-					}
-				}
+				detail::Rotate90Copy<true>(data(), tmp.data(), m_width, m_height);
 
 				swap(tmp);
 			}
@@ -1461,46 +1474,11 @@ namespace s3d
 
 		// 2. 処理
 		{
-			constexpr size_t BlockSize = 8;
-
 			if (m_width == m_height)
 			{
 				Image image = *this;
 
-				Color* const pData = image.data();
-				const size_t halfHeight = (m_height / 2);
-				const size_t halfWidth = (halfHeight + m_height % 2);
-
-				// 以下のように画像を4つの領域 A, B, C, D に分け、各画素を A←B, B←C, C←D, D←A とそれぞれコピーする
-				//     AADD    AAADD
-				//     AADD    AAADD
-				//     BBCC    BB.DD
-				//     BBCC    BBCCC
-				//             BBCCC
-				for (size_t b = 0; b < halfWidth; b += BlockSize)
-				{
-					for (size_t y = 0; y < halfHeight; ++y)
-					{
-						Color* p1 = (pData + y * m_width + b);
-						Color* p2 = (pData + (m_height - b - 1) * m_width + y);
-						Color* p3 = (pData + (m_height - y) * m_width - b - 1);
-						Color* p4 = (pData + (b + 1) * m_width - y - 1);
-						const size_t w = Min((halfWidth - b), BlockSize);
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							const Color tmp = *p1;
-							*p1 = *p2;
-							*p2 = *p3;
-							*p3 = *p4;
-							*p4 = tmp;
-							++p1;
-							p2 -= m_width;
-							--p3;
-							p4 += m_width;
-						}
-					}
-				}
+				detail::Rotate90Square<true>(image.data(), m_width);
 
 				return image;
 			}
@@ -1508,27 +1486,7 @@ namespace s3d
 			{
 				Image image{ m_height, m_width };
 
-				const Color* const pData = data();
-				Color* const pDstBase = image.data();
-
-				for (size_t b = 0; b < m_width; b += BlockSize)
-				{
-					Color* const pDstLine = (pDstBase + b * m_height);
-					const size_t w = Min((m_width - b), BlockSize);
-
-					for (size_t y = 0; y < m_height; ++y)
-					{
-						const Color* pSrc = (pData + y * m_width + b);
-						Color* pDst = (pDstLine + (m_height - y - 1));
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							*pDst = *pSrc;
-							++pSrc;
-							pDst += m_height;
-						}
-					}
-				}
+				detail::Rotate90Copy<true>(data(), image.data(), m_width, m_height);
 
 				return image;
 			}
@@ -1578,7 +1536,25 @@ namespace s3d
 
 	Image& Image::rotate180()
 	{
-		std::reverse(begin(), end());
+		// 1. パラメータチェック
+		{
+			if (isEmpty())
+			{
+				return *this;
+			}
+		}
+
+		// 2. 処理
+		{
+			const size_t num = num_pixels();
+			Color* const pData = data();
+
+			// 前半と後半のピクセルを反転しながら入れ替える
+			detail::ForEachChunk((num / 2), 2, [=](const size_t first, const size_t last)
+			{
+				ImagePixelOps::SwapReversed((pData + first), (pData + num - first), (last - first));
+			});
+		}
 
 		return *this;
 	}
@@ -1597,14 +1573,14 @@ namespace s3d
 		{
 			Image image{ m_width, m_height };
 
-			const Color* pSrc = data() + num_pixels() - 1;
-			Color* pDst = image.data();
-			const Color* const pDstEnd = pDst + image.num_pixels();
+			const size_t num = num_pixels();
+			const Color* const pSrc = data();
+			Color* const pDst = image.data();
 
-			while (pDst != pDstEnd)
+			detail::ForEachChunk(num, 1, [=](const size_t first, const size_t last)
 			{
-				*pDst++ = *pSrc--;
-			}
+				ImagePixelOps::ReverseCopy((pSrc + (num - last)), (pDst + first), (last - first));
+			});
 
 			return image;
 		}
@@ -1627,70 +1603,15 @@ namespace s3d
 
 		// 2. 処理
 		{
-			constexpr size_t BlockSize = 8;
-
 			if (m_width == m_height)
 			{
-				Color* const pData = data();
-				const size_t halfHeight = (m_height / 2);
-				const size_t halfWidth = (halfHeight + m_height % 2);
-
-				// 以下のように画像を4つの領域 A, B, C, D に分け、各画素を A←D, D←C, C←B, B←A とそれぞれコピーする
-				//     AADD    AAADD
-				//     AADD    AAADD
-				//     BBCC    BB.DD
-				//     BBCC    BBCCC
-				//             BBCCC
-				for (size_t b = 0; b < halfWidth; b += BlockSize)
-				{
-					for (size_t y = 0; y < halfHeight; ++y)
-					{
-						Color* p1 = (pData + y * m_width + b);
-						Color* p2 = (pData + (m_height - b - 1) * m_width + y);
-						Color* p3 = (pData + (m_height - y) * m_width - b - 1);
-						Color* p4 = (pData + (b + 1) * m_width - y - 1);
-						const size_t w = Min((halfWidth - b), BlockSize);
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							const Color tmp = *p1;
-							*p1 = *p4;
-							*p4 = *p3;
-							*p3 = *p2;
-							*p2 = tmp;
-							++p1;
-							p2 -= m_width;
-							--p3;
-							p4 += m_width;
-						}
-					}
-				}
+				detail::Rotate90Square<false>(data(), m_width);
 			}
 			else
 			{
 				Image tmp{ m_height, m_width };
 
-				const Color* const pData = data();
-				Color* const pDstBase = tmp.data();
-
-				for (size_t b = 0; b < m_width; b += BlockSize)
-				{
-					Color* const pDstLine = (pDstBase + (m_width - b - 1) * m_height);
-					const size_t w = Min((m_width - b), BlockSize);
-
-					for (size_t y = 0; y < m_height; ++y)
-					{
-						const Color* pSrc = (pData + y * m_width + b);
-						Color* pDst = (pDstLine + y);
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							*pDst = *pSrc;
-							++pSrc;
-							pDst -= m_height;
-						}
-					}
-				}
+				detail::Rotate90Copy<false>(data(), tmp.data(), m_width, m_height);
 
 				swap(tmp);
 			}
@@ -1711,46 +1632,11 @@ namespace s3d
 
 		// 2. 処理
 		{
-			constexpr size_t BlockSize = 8;
-
 			if (m_width == m_height)
 			{
 				Image image = *this;
 
-				Color* const pData = image.data();
-				const size_t halfHeight = (m_height / 2);
-				const size_t halfWidth = (halfHeight + m_height % 2);
-
-				// 以下のように画像を4つの領域 A, B, C, D に分け、各画素を A←D, D←C, C←B, B←A とそれぞれコピーする
-				//     AADD    AAADD
-				//     AADD    AAADD
-				//     BBCC    BB.DD
-				//     BBCC    BBCCC
-				//             BBCCC
-				for (size_t b = 0; b < halfWidth; b += BlockSize)
-				{
-					for (size_t y = 0; y < halfHeight; ++y)
-					{
-						Color* p1 = (pData + y * m_width + b);
-						Color* p2 = (pData + (m_height - b - 1) * m_width + y);
-						Color* p3 = (pData + (m_height - y) * m_width - b - 1);
-						Color* p4 = (pData + (b + 1) * m_width - y - 1);
-						const size_t w = Min((halfWidth - b), BlockSize);
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							const Color tmp = *p1;
-							*p1 = *p4;
-							*p4 = *p3;
-							*p3 = *p2;
-							*p2 = tmp;
-							++p1;
-							p2 -= m_width;
-							--p3;
-							p4 += m_width;
-						}
-					}
-				}
+				detail::Rotate90Square<false>(image.data(), m_width);
 
 				return image;
 			}
@@ -1758,27 +1644,7 @@ namespace s3d
 			{
 				Image image{ m_height, m_width };
 
-				const Color* const pData = data();
-				Color* const pDstBase = image.data();
-
-				for (size_t b = 0; b < m_width; b += BlockSize)
-				{
-					Color* const pDstLine = (pDstBase + (m_width - b - 1) * m_height);
-					const size_t w = Min((m_width - b), BlockSize);
-
-					for (size_t y = 0; y < m_height; ++y)
-					{
-						const Color* pSrc = (pData + y * m_width + b);
-						Color* pDst = (pDstLine + y);
-
-						for (size_t x = 0; x < w; ++x)
-						{
-							*pDst = *pSrc;
-							++pSrc;
-							pDst -= m_height;
-						}
-					}
-				}
+				detail::Rotate90Copy<false>(data(), image.data(), m_width, m_height);
 
 				return image;
 			}
@@ -1805,12 +1671,10 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitGammmaTable(gamma, colorTable);
 
-			for (auto& pixel : m_data)
+			detail::ApplyPixelOp(*this, [&colorTable](Color* pixels, const size_t count)
 			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+				ImagePixelOps::ApplyTableRGB(pixels, count, colorTable);
+			});
 		}
 
 		return *this;
@@ -1833,12 +1697,10 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitGammmaTable(gamma, colorTable);
 
-			for (auto& pixel : image)
+			detail::ApplyPixelOp(image, [&colorTable](Color* pixels, const size_t count)
 			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+				ImagePixelOps::ApplyTableRGB(pixels, count, colorTable);
+			});
 
 			return image;
 		}
@@ -1861,42 +1723,10 @@ namespace s3d
 
 		// 2. 処理
 		{
-			Color* pDst = data();
-			const Color* pDstEnd = pDst + num_pixels();
-			const double thresholdF = (threshold / 255.0);
-
-			if (invertColor)
+			detail::ApplyPixelOp(*this, [threshold, invertColor](Color* pixels, const size_t count)
 			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(0);
-					}
-					else
-					{
-						pDst->setRGB(255);
-					}
-
-					++pDst;
-				}
-			}
-			else
-			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(255);
-					}
-					else
-					{
-						pDst->setRGB(0);
-					}
-
-					++pDst;
-				}
-			}
+				ImagePixelOps::Threshold(pixels, count, threshold, invertColor.getBool());
+			});
 		}
 
 		return *this;
@@ -1916,42 +1746,10 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			Color* pDst = image.data();
-			const Color* pDstEnd = pDst + num_pixels();
-			const double thresholdF = (threshold / 255.0);
-
-			if (invertColor)
+			detail::ApplyPixelOp(image, [threshold, invertColor](Color* pixels, const size_t count)
 			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(0);
-					}
-					else
-					{
-						pDst->setRGB(255);
-					}
-
-					++pDst;
-				}
-			}
-			else
-			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(255);
-					}
-					else
-					{
-						pDst->setRGB(0);
-					}
-
-					++pDst;
-				}
-			}
+				ImagePixelOps::Threshold(pixels, count, threshold, invertColor.getBool());
+			});
 
 			return image;
 		}
@@ -3363,13 +3161,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				*p = detail::MakeSepia(*p);
-				++p;
-			}
+			ImagePixelOps::Sepia(pLine, region.w);
 
 			pLine += imageWidth;
 		}
@@ -3392,15 +3184,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				p->r = colorTable[p->r];
-				p->g = colorTable[p->g];
-				p->b = colorTable[p->b];
-				++p;
-			}
+			ImagePixelOps::ApplyTableRGB(pLine, region.w, colorTable);
 
 			pLine += imageWidth;
 		}
@@ -3423,15 +3207,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				p->r = colorTable[p->r];
-				p->g = colorTable[p->g];
-				p->b = colorTable[p->b];
-				++p;
-			}
+			ImagePixelOps::ApplyTableRGB(pLine, region.w, colorTable);
 
 			pLine += imageWidth;
 		}
@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <atomic>
 # include <Siv3D/ImageProcessing.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 
@@ -16,6 +17,8 @@ namespace s3d
 {
 	namespace detail
 	{
+		static std::atomic<bool> g_parallelEnabled{ false };
+
 		static Image GenerateMip(const Image& src)
 		{
 			if (not src)
@@ -405,5 +408,15 @@ namespace s3d
 				OpenCV_Bridge::FromMatVec3b(matDst, result, OverwriteAlpha::Yes);
 			}
 		}
+
+		void SetParallelEnabled(const bool enabled) noexcept
+		{
+			detail::g_parallelEnabled.store(enabled, std::memory_order_relaxed);
+		}
+
+		bool IsParallelEnabled() noexcept
+		{
+			return detail::g_parallelEnabled.load(std::memory_order_relaxed);
+		}
 	}
 }
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/MultiPolygon.hpp>
+# include <Siv3D/PolygonIndex.hpp>
 # include <Siv3D/FastMath.hpp>
 # include <Siv3D/Mouse.hpp>
 # include <Siv3D/Cursor.hpp>
@@ -362,6 +363,11 @@ namespace s3d
 		return Geometry2D::ConvexHull(points);
 	}
 
+	PolygonIndex MultiPolygon::buildIndex() const
+	{
+		return PolygonIndex{ *this };
+	}
+
 	RectF MultiPolygon::computeBoundingRect() const noexcept
 	{
 		if (isEmpty())
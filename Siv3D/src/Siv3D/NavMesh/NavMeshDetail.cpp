@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/Threading.hpp>
 # include "NavMeshDetail.hpp"
 
 namespace s3d
@@ -105,6 +106,130 @@ namespace s3d
 
 			return cfg;
 		}
+
+		inline constexpr Float3 Extent2D{ 2.0f, 0.0f, 2.0f };
+
+		inline constexpr Float3 Extent3D{ 2.0f, 4.0f, 2.0f };
+
+		[[nodiscard]]
+		inline constexpr Float3 ToFloat3(const Float2& pos) noexcept
+		{
+			return{ pos.x, 0.0f, pos.y };
+		}
+
+		[[nodiscard]]
+		inline Float3 ToFloat3(const Vec2& pos) noexcept
+		{
+			return{ static_cast<float>(pos.x), 0.0f, static_cast<float>(pos.y) };
+		}
+
+		[[nodiscard]]
+		static dtQueryFilter MakeQueryFilter(const Array<std::pair<int32, double>>& areaCosts)
+		{
+			dtQueryFilter filter;
+
+			for (const auto& areaCost : areaCosts)
+			{
+				if (areaCost.first <= RC_WALKABLE_AREA)
+				{
+					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
+				}
+			}
+
+			return filter;
+		}
+
+		/// @brief 経路を探索し、経路の頂点を context.vertexBuffer に書き込みます。
+		/// @return 経路の頂点数。経路が見つからない場合は 0
+		[[nodiscard]]
+		static int32 FindStraightPath(NavMeshQueryContext& context, const Float3& start, const Float3& end, const Float3& extent, const dtQueryFilter& filter)
+		{
+			const dtNavMeshQuery& navmeshQuery = context.navmeshQuery;
+
+			dtPolyRef startpoly;
+			{
+				if (dtStatusFailed(navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
+				{
+					return 0;
+				}
+
+				if (startpoly == 0)
+				{
+					return 0;
+				}
+			}
+
+			dtPolyRef endpoly;
+			{
+				if (dtStatusFailed(navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
+				{
+					return 0;
+				}
+
+				if (endpoly == 0)
+				{
+					return 0;
+				}
+			}
+
+			int32 npolys = 0;
+			{
+				if (dtStatusFailed(navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter,
+					context.polygonBuffer.data(), &npolys, static_cast<int32>(context.polygonBuffer.size()))))
+				{
+					return 0;
+				}
+
+				if (npolys <= 0)
+				{
+					return 0;
+				}
+			}
+
+			float end2[3] = { end.x, end.y, end.z };
+
+			if (context.polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
+			{
+				bool posOverPoly;
+				navmeshQuery.closestPointOnPoly(context.polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
+			}
+
+			int32 nvertices = 0;
+			navmeshQuery.findStraightPath(&start.x, end2, context.polygonBuffer.data(), npolys,
+				&context.vertexBuffer[0].x, 0, 0, &nvertices, static_cast<int32>(context.vertexBuffer.size()));
+
+			return nvertices;
+		}
+
+		static void CopyPath(const Array<Float3>& vertices, const int32 nvertices, Array<Vec2>& dst)
+		{
+			dst.resize(nvertices);
+
+			const Float3* pSrc = vertices.data();
+			const Float3* pSrcEnd = (pSrc + nvertices);
+			Vec2* pDst = dst.data();
+
+			while (pSrc != pSrcEnd)
+			{
+				pDst->set(pSrc->x, pSrc->z);
+				++pDst;
+				++pSrc;
+			}
+		}
+
+		static void CopyPath(const Array<Float3>& vertices, const int32 nvertices, Array<Vec3>& dst)
+		{
+			dst.resize(nvertices);
+
+			const Float3* pSrc = vertices.data();
+			const Float3* pSrcEnd = (pSrc + nvertices);
+			Vec3* pDst = dst.data();
+
+			while (pSrc != pSrcEnd)
+			{
+				*pDst++ = *pSrc++;
+			}
+		}
 	}
 
 	NavMesh::NavMeshDetail::NavMeshDetail()
@@ -189,7 +314,7 @@ namespace s3d
 		return true;
 	}
 
-	void NavMesh::NavMeshDetail::query(const Float2& _start, const Float2& _end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec2>& dst) const
+	void NavMesh::NavMeshDetail::query(const Float2& start, const Float2& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec2>& dst) const
 	{
 		dst.clear();
 
@@ -198,176 +323,105 @@ namespace s3d
 			return;
 		}
 
-		dtQueryFilter filter;
-		{
-			for (const auto& areaCost : areaCosts)
-			{
-				if (areaCost.first <= RC_WALKABLE_AREA)
-				{
-					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
-				}
-			}
-		}
-
-		const Float3 start{ _start.x, 0.0f, _start.y }, end{ _end.x, 0.0f, _end.y };
-		constexpr Float3 extent{ 2.0f, 0.0f, 2.0f };
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
 
-		dtPolyRef startpoly;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
-			{
-				return;
-			}
-
-			if (startpoly == 0)
-			{
-				return;
-			}
-		}
+		const int32 nvertices = detail::FindStraightPath(m_queryContext, detail::ToFloat3(start), detail::ToFloat3(end), detail::Extent2D, filter);
 
-		dtPolyRef endpoly;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
-			{
-				return;
-			}
-
-			if (endpoly == 0)
-			{
-				return;
-			}
-		}
-
-		int32 npolys = 0;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, m_polygonBuffer.data(), &npolys, PolygonBufferSize)))
-			{
-				return;
-			}
-
-			if (npolys <= 0)
-			{
-				return;
-			}
-		}
+		detail::CopyPath(m_queryContext.vertexBuffer, nvertices, dst);
+	}
 
-		float end2[3] = { end.x, end.y, end.z };
+	void NavMesh::NavMeshDetail::query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const
+	{
+		dst.clear();
 
-		if (m_polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
+		if (not m_built)
 		{
-			bool posOverPoly;
-			m_data.navmeshQuery.closestPointOnPoly(m_polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
+			return;
 		}
 
-		{
-			int32 nvertices = 0;
-			m_data.navmeshQuery.findStraightPath(&start.x, end2, m_polygonBuffer.data(), npolys, &m_buffer[0].x, 0, 0, &nvertices, MaxVertices);
-
-			if (nvertices)
-			{
-				dst.resize(nvertices);
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
 
-				const Float3* pSrc = m_buffer.data();
-				const Float3* pSrcEnd = (pSrc + nvertices);
-				Vec2* pDst = dst.data();
+		const int32 nvertices = detail::FindStraightPath(m_queryContext, start, end, detail::Extent3D, filter);
 
-				while (pSrc != pSrcEnd)
-				{
-					pDst->set(pSrc->x, pSrc->z);
-					++pDst;
-					++pSrc;
-				}
-			}
-		}
+		detail::CopyPath(m_queryContext.vertexBuffer, nvertices, dst);
 	}
 
-	void NavMesh::NavMeshDetail::query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const
+	void NavMesh::NavMeshDetail::queryMany(const Array<Vec2>& starts, const Array<Vec2>& ends, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec2>>& paths) const
 	{
-		dst.clear();
+		const size_t count = Min(starts.size(), ends.size());
 
-		if (not m_built)
+		// 内側の配列は容量を保ったまま再利用する
+		paths.resize(count);
+
+		for (auto& path : paths)
 		{
-			return;
+			path.clear();
 		}
 
-		dtQueryFilter filter;
+		if (not m_built)
 		{
-			for (const auto& areaCost : areaCosts)
-			{
-				if (areaCost.first <= RC_WALKABLE_AREA)
-				{
-					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
-				}
-			}
+			return;
 		}
 
-		constexpr Float3 extent{ 2.0f, 4.0f, 2.0f };
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
 
-		dtPolyRef startpoly;
+		Threading::ParallelFor(count, [&](const size_t begin, const size_t end)
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
-			{
-				return;
-			}
+			std::unique_ptr<NavMeshQueryContext> context = acquireQueryContext();
 
-			if (startpoly == 0)
+			if (not context)
 			{
 				return;
 			}
-		}
 
-		dtPolyRef endpoly;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
+			for (size_t i = begin; i < end; ++i)
 			{
-				return;
-			}
+				const int32 nvertices = detail::FindStraightPath(*context, detail::ToFloat3(starts[i]), detail::ToFloat3(ends[i]), detail::Extent2D, filter);
 
-			if (endpoly == 0)
-			{
-				return;
+				detail::CopyPath(context->vertexBuffer, nvertices, paths[i]);
 			}
-		}
 
-		int32 npolys = 0;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, m_polygonBuffer.data(), &npolys, PolygonBufferSize)))
-			{
-				return;
-			}
+			releaseQueryContext(std::move(context));
+		}, QueryManyGrainSize);
+	}
 
-			if (npolys <= 0)
-			{
-				return;
-			}
-		}
+	void NavMesh::NavMeshDetail::queryMany(const Array<Vec3>& starts, const Array<Vec3>& ends, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec3>>& paths) const
+	{
+		const size_t count = Min(starts.size(), ends.size());
 
-		float end2[3] = { end.x, end.y, end.z };
+		// 内側の配列は容量を保ったまま再利用する
+		paths.resize(count);
 
-		if (m_polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
+		for (auto& path : paths)
 		{
-			bool posOverPoly;
-			m_data.navmeshQuery.closestPointOnPoly(m_polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
+			path.clear();
 		}
 
+		if (not m_built)
 		{
-			int32 nvertices = 0;
-			m_data.navmeshQuery.findStraightPath(&start.x, end2, m_polygonBuffer.data(), npolys, &m_buffer[0].x, 0, 0, &nvertices, MaxVertices);
+			return;
+		}
+
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
+
+		Threading::ParallelFor(count, [&](const size_t begin, const size_t end)
+		{
+			std::unique_ptr<NavMeshQueryContext> context = acquireQueryContext();
 
-			if (nvertices)
+			if (not context)
 			{
-				dst.resize(nvertices);
+				return;
+			}
 
-				const Float3* pSrc = m_buffer.data();
-				const Float3* pSrcEnd = (pSrc + nvertices);
-				Vec3* pDst = dst.data();
+			for (size_t i = begin; i < end; ++i)
+			{
+				const int32 nvertices = detail::FindStraightPath(*context, Float3{ starts[i] }, Float3{ ends[i] }, detail::Extent3D, filter);
 
-				while (pSrc != pSrcEnd)
-				{
-					*pDst++ = *pSrc++;
-				}
+				detail::CopyPath(context->vertexBuffer, nvertices, paths[i]);
 			}
-		}
+
+			releaseQueryContext(std::move(context));
+		}, QueryManyGrainSize);
 	}
 
 	bool NavMesh::NavMeshDetail::build(const NavMeshConfig& config, const NavMeshAABB& aabb,
@@ -468,15 +522,11 @@ namespace s3d
 
 		m_data.navmesh->init(m_navData, m_navDataSize, DT_TILE_FREE_DATA);
 
-		if (dtStatusFailed(m_data.navmeshQuery.init(m_data.navmesh.get(), 2048)))
+		if (not initQueryContext(m_queryContext))
 		{
 			return false;
 		}
 
-		m_buffer.resize(MaxVertices);
-
-		m_polygonBuffer.resize(PolygonBufferSize);
-
 		m_built = true;
 
 		return true;
@@ -526,6 +576,51 @@ namespace s3d
 		}
 	}
 
+	bool NavMesh::NavMeshDetail::initQueryContext(NavMeshQueryContext& context) const
+	{
+		if (dtStatusFailed(context.navmeshQuery.init(m_data.navmesh.get(), MaxSearchNodes)))
+		{
+			return false;
+		}
+
+		context.vertexBuffer.resize(MaxVertices);
+
+		context.polygonBuffer.resize(PolygonBufferSize);
+
+		return true;
+	}
+
+	std::unique_ptr<NavMeshQueryContext> NavMesh::NavMeshDetail::acquireQueryContext() const
+	{
+		{
+			std::lock_guard lock{ m_queryPoolMutex };
+
+			if (m_queryPool)
+			{
+				std::unique_ptr<NavMeshQueryContext> context = std::move(m_queryPool.back());
+				m_queryPool.pop_back();
+				return context;
+			}
+		}
+
+		// 同時に処理しているタスクの数だけ作られる
+		auto context = std::make_unique<NavMeshQueryContext>();
+
+		if (not initQueryContext(*context))
+		{
+			return nullptr;
+		}
+
+		return context;
+	}
+
+	void NavMesh::NavMeshDetail::releaseQueryContext(std::unique_ptr<NavMeshQueryContext>&& context) const
+	{
+		std::lock_guard lock{ m_queryPoolMutex };
+
+		m_queryPool.push_back(std::move(context));
+	}
+
 	void NavMesh::NavMeshDetail::release()
 	{
 		if (not m_built)
@@ -533,6 +628,12 @@ namespace s3d
 			return;
 		}
 
+		{
+			std::lock_guard lock{ m_queryPoolMutex };
+
+			m_queryPool.clear();
+		}
+
 		m_data.navmesh.reset();
 
 		if (m_data.dmesh)
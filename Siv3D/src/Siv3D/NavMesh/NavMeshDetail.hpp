@@ -11,6 +11,7 @@
 
 # pragma once
 # include <cfloat>
+# include <mutex>
 # include <Siv3D/NavMesh.hpp>
 # include <RecastDetour/Recast.h>
 # include <RecastDetour/DetourCommon.h>
@@ -27,6 +28,16 @@ namespace s3d
 		float bmax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
 	};
 
+	/// @brief 経路探索の作業領域。同時に 1 つのスレッドからのみ使います。
+	struct NavMeshQueryContext
+	{
+		dtNavMeshQuery navmeshQuery;
+
+		Array<Float3> vertexBuffer;
+
+		Array<dtPolyRef> polygonBuffer;
+	};
+
 	class NavMesh::NavMeshDetail
 	{
 	public:
@@ -45,12 +56,21 @@ namespace s3d
 
 		void query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const;
 
+		void queryMany(const Array<Vec2>& starts, const Array<Vec2>& ends, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec2>>& paths) const;
+
+		void queryMany(const Array<Vec3>& starts, const Array<Vec3>& ends, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec3>>& paths) const;
+
 	private:
 
 		static constexpr int32 MaxVertices = 8192;
 
 		static constexpr int32 PolygonBufferSize = 8192;
 
+		static constexpr int32 MaxSearchNodes = 2048;
+
+		// queryMany() で 1 つのタスクが処理する経路の数
+		static constexpr size_t QueryManyGrainSize = 16;
+
 		struct Data
 		{
 			rcContext ctx;
@@ -67,8 +87,6 @@ namespace s3d
 
 			std::shared_ptr<dtNavMesh> navmesh;
 
-			dtNavMeshQuery navmeshQuery;
-
 		} m_data;
 
 		unsigned char* m_navData = nullptr;
@@ -77,9 +95,21 @@ namespace s3d
 
 		bool m_built = false;
 
-		mutable Array<Float3> m_buffer;
+		// query() で使う作業領域
+		mutable NavMeshQueryContext m_queryContext;
+
+		// queryMany() で使う作業領域。スレッドごとに貸し出し、使い終わったら戻して再利用する
+		mutable std::mutex m_queryPoolMutex;
+
+		mutable Array<std::unique_ptr<NavMeshQueryContext>> m_queryPool;
+
+		[[nodiscard]]
+		bool initQueryContext(NavMeshQueryContext& context) const;
+
+		[[nodiscard]]
+		std::unique_ptr<NavMeshQueryContext> acquireQueryContext() const;
 
-		mutable Array<dtPolyRef> m_polygonBuffer;
+		void releaseQueryContext(std::unique_ptr<NavMeshQueryContext>&& context) const;
 
 		bool build(const NavMeshConfig& config, const NavMeshAABB& aabb,
 			const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs);
@@ -128,4 +128,54 @@ namespace s3d
 	{
 		pImpl->query(start, end, areaCosts, dst);
 	}
+
+	Array<Array<Vec2>> NavMesh::queryMany(const Array<Vec2>& starts, const Array<Vec2>& ends, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		Array<Array<Vec2>> paths;
+
+		pImpl->queryMany(starts, ends, areaCosts, paths);
+
+		return paths;
+	}
+
+	void NavMesh::queryMany(const Array<Vec2>& starts, const Array<Vec2>& ends, Array<Array<Vec2>>& paths, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->queryMany(starts, ends, areaCosts, paths);
+	}
+
+	Array<Array<Vec3>> NavMesh::queryMany(const Array<Vec3>& starts, const Array<Vec3>& ends, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		Array<Array<Vec3>> paths;
+
+		pImpl->queryMany(starts, ends, areaCosts, paths);
+
+		return paths;
+	}
+
+	void NavMesh::queryMany(const Array<Vec3>& starts, const Array<Vec3>& ends, Array<Array<Vec3>>& paths, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->queryMany(starts, ends, areaCosts, paths);
+	}
+
+	AsyncTask<Array<Array<Vec2>>> NavMesh::queryManyAsync(Array<Vec2> starts, Array<Vec2> ends, Array<std::pair<int32, double>> areaCosts, Array<Array<Vec2>> paths) const
+	{
+		// タスクの実行中にこの NavMesh が破棄されても、内部データは保持される
+		return Async([pImpl = pImpl, starts = std::move(starts), ends = std::move(ends), areaCosts = std::move(areaCosts), paths = std::move(paths)]() mutable
+		{
+			pImpl->queryMany(starts, ends, areaCosts, paths);
+
+			return std::move(paths);
+		});
+	}
+
+	AsyncTask<Array<Array<Vec3>>> NavMesh::queryManyAsync(Array<Vec3> starts, Array<Vec3> ends, Array<std::pair<int32, double>> areaCosts, Array<Array<Vec3>> paths) const
+	{
+		// タスクの実行中にこの NavMesh が破棄されても、内部データは保持される
+		return Async([pImpl = pImpl, starts = std::move(starts), ends = std::move(ends), areaCosts = std::move(areaCosts), paths = std::move(paths)]() mutable
+		{
+			pImpl->queryMany(starts, ends, areaCosts, paths);
+
+			return std::move(paths);
+		});
+	}
 }
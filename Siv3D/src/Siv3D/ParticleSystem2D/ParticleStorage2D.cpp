@@ -0,0 +1,271 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/SIMD.hpp>
+# include "ParticleStorage2D.hpp"
+
+namespace s3d
+{
+	size_t ParticleStorage2D::size() const noexcept
+	{
+		return m_remainingLifeTime.size();
+	}
+
+	bool ParticleStorage2D::isEmpty() const noexcept
+	{
+		return m_remainingLifeTime.isEmpty();
+	}
+
+	void ParticleStorage2D::clear() noexcept
+	{
+		resize(0);
+	}
+
+	void ParticleStorage2D::reserve(const size_t n)
+	{
+		m_positionX.reserve(n);
+		m_positionY.reserve(n);
+		m_velocityX.reserve(n);
+		m_velocityY.reserve(n);
+		m_startColor.reserve(n);
+		m_startSize.reserve(n);
+		m_rotation.reserve(n);
+		m_startAngularVelocity.reserve(n);
+		m_startLifeTime.reserve(n);
+		m_remainingLifeTime.reserve(n);
+	}
+
+	void ParticleStorage2D::push_back(const Particle2D& particle)
+	{
+		m_positionX.push_back(particle.position.x);
+		m_positionY.push_back(particle.position.y);
+		m_velocityX.push_back(particle.velocity.x);
+		m_velocityY.push_back(particle.velocity.y);
+		m_startColor.push_back(particle.startColor);
+		m_startSize.push_back(particle.startSize);
+		m_rotation.push_back(particle.rotation);
+		m_startAngularVelocity.push_back(particle.startAngularVelocity);
+		m_startLifeTime.push_back(particle.startLifeTime);
+		m_remainingLifeTime.push_back(particle.remainingLifeTime);
+	}
+
+	Particle2D ParticleStorage2D::operator [](const size_t i) const noexcept
+	{
+		Particle2D particle;
+		particle.position.set(m_positionX[i], m_positionY[i]);
+		particle.velocity.set(m_velocityX[i], m_velocityY[i]);
+		particle.startColor = m_startColor[i];
+		particle.startSize = m_startSize[i];
+		particle.rotation = m_rotation[i];
+		particle.startAngularVelocity = m_startAngularVelocity[i];
+		particle.startLifeTime = m_startLifeTime[i];
+		particle.remainingLifeTime = m_remainingLifeTime[i];
+		return particle;
+	}
+
+	void ParticleStorage2D::update(const float deltaTime, const Float2& deltaVelocity) noexcept
+	{
+		const size_t count = size();
+		float* const pPositionX = m_positionX.data();
+		float* const pPositionY = m_positionY.data();
+		float* const pVelocityX = m_velocityX.data();
+		float* const pVelocityY = m_velocityY.data();
+		float* const pRotation = m_rotation.data();
+		const float* const pAngularVelocity = m_startAngularVelocity.data();
+		float* const pRemainingLifeTime = m_remainingLifeTime.data();
+
+		size_t i = 0;
+
+	# if SIV3D_INTRINSIC(SSE)
+
+		{
+			const __m128 dt = _mm_set1_ps(deltaTime);
+			const __m128 dvx = _mm_set1_ps(deltaVelocity.x);
+			const __m128 dvy = _mm_set1_ps(deltaVelocity.y);
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				_mm_storeu_ps((pRemainingLifeTime + i), _mm_sub_ps(_mm_loadu_ps(pRemainingLifeTime + i), dt));
+
+				const __m128 vx = _mm_add_ps(_mm_loadu_ps(pVelocityX + i), dvx);
+				const __m128 vy = _mm_add_ps(_mm_loadu_ps(pVelocityY + i), dvy);
+				_mm_storeu_ps((pVelocityX + i), vx);
+				_mm_storeu_ps((pVelocityY + i), vy);
+				_mm_storeu_ps((pPositionX + i), _mm_add_ps(_mm_loadu_ps(pPositionX + i), _mm_mul_ps(vx, dt)));
+				_mm_storeu_ps((pPositionY + i), _mm_add_ps(_mm_loadu_ps(pPositionY + i), _mm_mul_ps(vy, dt)));
+				_mm_storeu_ps((pRotation + i), _mm_add_ps(_mm_loadu_ps(pRotation + i), _mm_mul_ps(_mm_loadu_ps(pAngularVelocity + i), dt)));
+			}
+		}
+
+	# endif
+
+		for (; i < count; ++i)
+		{
+			pRemainingLifeTime[i] -= deltaTime;
+			pVelocityX[i] += deltaVelocity.x;
+			pVelocityY[i] += deltaVelocity.y;
+			pPositionX[i] += (pVelocityX[i] * deltaTime);
+			pPositionY[i] += (pVelocityY[i] * deltaTime);
+			pRotation[i] += (pAngularVelocity[i] * deltaTime);
+		}
+	}
+
+	void ParticleStorage2D::removeDead() noexcept
+	{
+		size_t count = size();
+		const float* const pRemainingLifeTime = m_remainingLifeTime.data();
+		size_t i = 0;
+
+		while (i < count)
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			// 4 個とも生きていれば、まとめて読み飛ばす
+			if (((i + 4) <= count)
+				&& (_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(pRemainingLifeTime + i), _mm_setzero_ps())) == 0))
+			{
+				i += 4;
+				continue;
+			}
+
+		# endif
+
+			if (pRemainingLifeTime[i] < 0.0f)
+			{
+				// 末尾のパーティクルで埋める。埋めたパーティクルも続けて調べる
+				moveParticle(--count, i);
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		resize(count);
+	}
+
+	void ParticleStorage2D::removeOldest(const size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		if (size() <= count)
+		{
+			clear();
+			return;
+		}
+
+		// count 番目に短い残りの寿命を求める
+		m_lifeTimeBuffer.assign(m_remainingLifeTime.begin(), m_remainingLifeTime.end());
+		std::nth_element(m_lifeTimeBuffer.begin(), (m_lifeTimeBuffer.begin() + (count - 1)), m_lifeTimeBuffer.end());
+		const float threshold = m_lifeTimeBuffer[count - 1];
+
+		// threshold と等しいものは、取り除く個数に達するまで取り除く
+		size_t numEquals = (count - static_cast<size_t>(std::count_if(m_remainingLifeTime.begin(), m_remainingLifeTime.end(),
+			[=](const float remainingLifeTime) { return (remainingLifeTime < threshold); })));
+
+		size_t n = size();
+		size_t i = 0;
+
+		while (i < n)
+		{
+			const float remainingLifeTime = m_remainingLifeTime[i];
+			bool remove = (remainingLifeTime < threshold);
+
+			if ((not remove) && (remainingLifeTime == threshold) && numEquals)
+			{
+				--numEquals;
+				remove = true;
+			}
+
+			if (remove)
+			{
+				moveParticle(--n, i);
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		resize(n);
+	}
+
+	const float* ParticleStorage2D::positionX() const noexcept
+	{
+		return m_positionX.data();
+	}
+
+	const float* ParticleStorage2D::positionY() const noexcept
+	{
+		return m_positionY.data();
+	}
+
+	const Float4* ParticleStorage2D::startColor() const noexcept
+	{
+		return m_startColor.data();
+	}
+
+	const float* ParticleStorage2D::startSize() const noexcept
+	{
+		return m_startSize.data();
+	}
+
+	const float* ParticleStorage2D::rotation() const noexcept
+	{
+		return m_rotation.data();
+	}
+
+	const float* ParticleStorage2D::startLifeTime() const noexcept
+	{
+		return m_startLifeTime.data();
+	}
+
+	const float* ParticleStorage2D::remainingLifeTime() const noexcept
+	{
+		return m_remainingLifeTime.data();
+	}
+
+	void ParticleStorage2D::moveParticle(const size_t from, const size_t to) noexcept
+	{
+		if (from == to)
+		{
+			return;
+		}
+
+		m_positionX[to] = m_positionX[from];
+		m_positionY[to] = m_positionY[from];
+		m_velocityX[to] = m_velocityX[from];
+		m_velocityY[to] = m_velocityY[from];
+		m_startColor[to] = m_startColor[from];
+		m_startSize[to] = m_startSize[from];
+		m_rotation[to] = m_rotation[from];
+		m_startAngularVelocity[to] = m_startAngularVelocity[from];
+		m_startLifeTime[to] = m_startLifeTime[from];
+		m_remainingLifeTime[to] = m_remainingLifeTime[from];
+	}
+
+	void ParticleStorage2D::resize(const size_t n)
+	{
+		m_positionX.resize(n);
+		m_positionY.resize(n);
+		m_velocityX.resize(n);
+		m_velocityY.resize(n);
+		m_startColor.resize(n);
+		m_startSize.resize(n);
+		m_rotation.resize(n);
+		m_startAngularVelocity.resize(n);
+		m_startLifeTime.resize(n);
+		m_remainingLifeTime.resize(n);
+	}
+}
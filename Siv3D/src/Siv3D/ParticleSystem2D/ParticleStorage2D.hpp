@@ -0,0 +1,105 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/PointVector.hpp>
+# include <Siv3D/Particle2D.hpp>
+
+namespace s3d
+{
+	/// @brief パーティクルを成分ごとの配列（SoA）で保持するクラス
+	/// @remark 更新は成分ごとの配列に対して SIMD でまとめて行い、寿命が尽きたパーティクルは末尾の要素と入れ替えて取り除きます。
+	/// @remark そのため、パーティクルの並び順は生成順とは限りません。
+	class ParticleStorage2D
+	{
+	public:
+
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		void clear() noexcept;
+
+		void reserve(size_t n);
+
+		void push_back(const Particle2D& particle);
+
+		/// @brief i 番目のパーティクルを返します。
+		[[nodiscard]]
+		Particle2D operator [](size_t i) const noexcept;
+
+		/// @brief すべてのパーティクルを移動させ、寿命を減らします。
+		/// @param deltaTime 経過時間（秒）
+		/// @param deltaVelocity 経過時間の間に加わる速度
+		void update(float deltaTime, const Float2& deltaVelocity) noexcept;
+
+		/// @brief 寿命が尽きたパーティクルを取り除きます。
+		void removeDead() noexcept;
+
+		/// @brief 残りの寿命が短いものから順に、指定した個数のパーティクルを取り除きます。
+		/// @param count 取り除く個数
+		void removeOldest(size_t count);
+
+		[[nodiscard]]
+		const float* positionX() const noexcept;
+
+		[[nodiscard]]
+		const float* positionY() const noexcept;
+
+		[[nodiscard]]
+		const Float4* startColor() const noexcept;
+
+		[[nodiscard]]
+		const float* startSize() const noexcept;
+
+		[[nodiscard]]
+		const float* rotation() const noexcept;
+
+		[[nodiscard]]
+		const float* startLifeTime() const noexcept;
+
+		[[nodiscard]]
+		const float* remainingLifeTime() const noexcept;
+
+	private:
+
+		Array<float> m_positionX;
+
+		Array<float> m_positionY;
+
+		Array<float> m_velocityX;
+
+		Array<float> m_velocityY;
+
+		Array<Float4> m_startColor;
+
+		Array<float> m_startSize;
+
+		Array<float> m_rotation;
+
+		Array<float> m_startAngularVelocity;
+
+		Array<float> m_startLifeTime;
+
+		Array<float> m_remainingLifeTime;
+
+		// removeOldest() の作業領域
+		Array<float> m_lifeTimeBuffer;
+
+		void moveParticle(size_t from, size_t to) noexcept;
+
+		void resize(size_t n);
+	};
+}
@@ -146,12 +146,9 @@ namespace s3d
 	{
 		const Float2 deltaVelocity = (m_force * deltaTime);
 
-		for (auto& particle : m_particles)
-		{
-			particle.update(deltaTime, deltaVelocity);
-		}
+		m_particles.update(deltaTime, deltaVelocity);
 
-		m_particles.remove_if([](const Particle2D& p) { return p.isDead(); });
+		m_particles.removeDead();
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::addParticles(const ParticleSystem2DParameters& params)
@@ -183,12 +180,13 @@ namespace s3d
 
 			const float perParticledeltaTime = (particle.startLifeTime - particle.remainingLifeTime);
 			particle.advance(perParticledeltaTime, m_force * perParticledeltaTime);
-			m_particles << particle;
+			m_particles.push_back(particle);
 		}
 
+		// 並び順は生成順ではないため、残りの寿命が短いものを古いパーティクルとして取り除く
 		if (const size_t maxParticles = static_cast<size_t>(params.maxParticles); m_particles.size() > maxParticles)
 		{
-			m_particles.erase(m_particles.begin(), m_particles.begin() + (m_particles.size() - maxParticles));
+			m_particles.removeOldest(m_particles.size() - maxParticles);
 		}
 	}
 
@@ -199,8 +197,9 @@ namespace s3d
 		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
 			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
 
-		for (const auto& particle : m_particles)
+		for (size_t i = 0; i < m_particles.size(); ++i)
 		{
+			const Particle2D particle = m_particles[i];
 			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
 			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
 
@@ -227,8 +226,9 @@ namespace s3d
 		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
 			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
 
-		for (const auto& particle : m_particles)
+		for (size_t i = 0; i < m_particles.size(); ++i)
 		{
+			const Particle2D particle = m_particles[i];
 			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
 			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
 
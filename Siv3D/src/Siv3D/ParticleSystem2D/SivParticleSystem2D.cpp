@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/ParticleSystem2D.hpp>
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/ParticleSystem2D/ParticleSystem2DDetail.hpp>
 
 namespace s3d
@@ -75,4 +76,16 @@ namespace s3d
 	{
 		pImpl->drawDebug();
 	}
+
+	void ParticleSystem2D::UpdateMany(Array<ParticleSystem2D>& systems, const double deltaTime)
+	{
+		// パーティクルシステムごとに 1 つのタスクとして処理する
+		Threading::ParallelFor(systems.size(), [&](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				systems[i].update(deltaTime);
+			}
+		}, 1);
+	}
 }
@@ -331,6 +331,7 @@ namespace s3d
 		}
 
 		pImpl->getBody().SetTransform(detail::ToB2Vec2(pos), pImpl->getBody().GetAngle());
+		pImpl->storePreviousTransform();
 		return *this;
 	}
 
@@ -352,6 +353,7 @@ namespace s3d
 		}
 
 		pImpl->getBody().SetTransform(pImpl->getBody().GetPosition(), static_cast<float>(angle));
+		pImpl->storePreviousTransform();
 		return *this;
 	}
 
@@ -373,6 +375,7 @@ namespace s3d
 		}
 
 		pImpl->getBody().SetTransform(detail::ToB2Vec2(pos), static_cast<float>(angle));
+		pImpl->storePreviousTransform();
 		return *this;
 	}
 
@@ -494,6 +497,36 @@ namespace s3d
 		return{ detail::ToVec2(pImpl->getBody().GetPosition()), pImpl->getBody().GetAngle() };
 	}
 
+	Vec2 P2Body::getInterpolatedPos() const noexcept
+	{
+		if (isEmpty())
+		{
+			return{ 0, 0 };
+		}
+
+		return pImpl->getInterpolatedPos();
+	}
+
+	double P2Body::getInterpolatedAngle() const noexcept
+	{
+		if (isEmpty())
+		{
+			return 0.0;
+		}
+
+		return pImpl->getInterpolatedAngle();
+	}
+
+	std::pair<Vec2, double> P2Body::getInterpolatedTransform() const noexcept
+	{
+		if (isEmpty())
+		{
+			return{ Vec2{ 0, 0 }, 0.0 };
+		}
+
+		return{ pImpl->getInterpolatedPos(), pImpl->getInterpolatedAngle() };
+	}
+
 	P2Body& P2Body::setVelocity(const Vec2 v) noexcept
 	{
 		if (isEmpty())
@@ -17,6 +17,7 @@
 # include <Siv3D/Physics2D/P2Triangle.hpp>
 # include <Siv3D/Physics2D/P2Quad.hpp>
 # include <Siv3D/Physics2D/P2Polygon.hpp>
+# include <Siv3D/Interpolation.hpp>
 # include "P2BodyDetail.hpp"
 # include "P2WorldDetail.hpp"
 # include "P2Common.hpp"
@@ -37,6 +38,7 @@ namespace s3d
 		bodyDef.position	= detail::ToB2Vec2(center);
 		m_body = m_world->getWorldPtr()->CreateBody(&bodyDef);
 		m_body->SetUserData(this);
+		storePreviousTransform();
 	}
 
 	P2Body::P2BodyDetail::~P2BodyDetail()
@@ -177,4 +179,34 @@ namespace s3d
 	{
 		return m_shapes;
 	}
+
+	void P2Body::P2BodyDetail::storePreviousTransform() noexcept
+	{
+		assert(m_body);
+
+		m_previousPos = m_body->GetPosition();
+		m_previousAngle = m_body->GetAngle();
+	}
+
+	void P2Body::P2BodyDetail::shiftPreviousPos(const b2Vec2& newOrigin) noexcept
+	{
+		m_previousPos -= newOrigin;
+	}
+
+	Vec2 P2Body::P2BodyDetail::getInterpolatedPos() const noexcept
+	{
+		assert(m_body);
+
+		const double alpha = m_world->getInterpolationAlpha();
+		return detail::ToVec2(m_previousPos).lerp(detail::ToVec2(m_body->GetPosition()), alpha);
+	}
+
+	double P2Body::P2BodyDetail::getInterpolatedAngle() const noexcept
+	{
+		assert(m_body);
+
+		// Box2D の角度は [-π, π) に正規化されないため、そのまま線形補間できる
+		const double alpha = m_world->getInterpolationAlpha();
+		return Math::Lerp(static_cast<double>(m_previousAngle), static_cast<double>(m_body->GetAngle()), alpha);
+	}
 }
@@ -69,6 +69,16 @@ namespace s3d
 		[[nodiscard]]
 		const Array<std::shared_ptr<P2Shape>>& getShapes() const noexcept;
 
+		void storePreviousTransform() noexcept;
+
+		void shiftPreviousPos(const b2Vec2& newOrigin) noexcept;
+
+		[[nodiscard]]
+		Vec2 getInterpolatedPos() const noexcept;
+
+		[[nodiscard]]
+		double getInterpolatedAngle() const noexcept;
+
 	private:
 
 		std::shared_ptr<detail::P2WorldDetail> m_world;
@@ -77,6 +87,11 @@ namespace s3d
 
 		b2Body* m_body = nullptr;
 
+		// 直前のステップの開始時点の姿勢（描画時の補間用）
+		b2Vec2 m_previousPos = { 0.0f, 0.0f };
+
+		float m_previousAngle = 0.0f;
+
 		Array<std::shared_ptr<P2Shape>> m_shapes;
 	};
 }
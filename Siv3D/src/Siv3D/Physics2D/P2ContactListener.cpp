@@ -9,13 +9,39 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/Time.hpp>
 # include "P2BodyDetail.hpp"
 # include "P2ContactListener.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		class P2CallbackTimer
+		{
+		public:
+
+			explicit P2CallbackTimer(uint64& accumulated) noexcept
+				: m_accumulated{ accumulated }
+				, m_start{ Time::GetNanosec() } {}
+
+			~P2CallbackTimer()
+			{
+				m_accumulated += (Time::GetNanosec() - m_start);
+			}
+
+		private:
+
+			uint64& m_accumulated;
+
+			uint64 m_start;
+		};
+	}
+
 	void detail::P2ContactListener::BeginContact(b2Contact* contact)
 	{
+		const P2CallbackTimer timer{ m_callbackNanosec };
+
 		const P2Body::P2BodyDetail* pBodyA = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureA()->GetBody()->GetUserData().pBody);
 		const P2Body::P2BodyDetail* pBodyB = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureB()->GetBody()->GetUserData().pBody);
 		const P2ContactPair pair{ pBodyA->id(), pBodyB->id() };
@@ -32,6 +58,8 @@ namespace s3d
 
 	void detail::P2ContactListener::PostSolve(b2Contact* contact, const b2ContactImpulse* impulse)
 	{
+		const P2CallbackTimer timer{ m_callbackNanosec };
+
 		const P2Body::P2BodyDetail* pBodyA = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureA()->GetBody()->GetUserData().pBody);
 		const P2Body::P2BodyDetail* pBodyB = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureB()->GetBody()->GetUserData().pBody);
 		const P2ContactPair pair{ pBodyA->id(), pBodyB->id() };
@@ -63,6 +91,8 @@ namespace s3d
 
 	void detail::P2ContactListener::EndContact(b2Contact* contact)
 	{
+		const P2CallbackTimer timer{ m_callbackNanosec };
+
 		const P2Body::P2BodyDetail* pBodyA = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureA()->GetBody()->GetUserData().pBody);
 		const P2Body::P2BodyDetail* pBodyB = static_cast<const P2Body::P2BodyDetail*>(contact->GetFixtureB()->GetBody()->GetUserData().pBody);		const P2ContactPair pair{ pBodyA->id(), pBodyB->id() };
 
@@ -80,6 +110,16 @@ namespace s3d
 		return m_collisions;
 	}
 
+	uint64 detail::P2ContactListener::getCallbackNanosec() const noexcept
+	{
+		return m_callbackNanosec;
+	}
+
+	void detail::P2ContactListener::resetCallbackNanosec() noexcept
+	{
+		m_callbackNanosec = 0;
+	}
+
 	void detail::P2ContactListener::clearContacts()
 	{
 		const auto itEnd = m_collisions.end();
@@ -27,10 +27,17 @@ namespace s3d
 
 			void clearContacts();
 
+			[[nodiscard]]
+			uint64 getCallbackNanosec() const noexcept;
+
+			void resetCallbackNanosec() noexcept;
+
 		private:
 
 			HashTable<P2ContactPair, P2Collision> m_collisions;
 
+			uint64 m_callbackNanosec = 0;
+
 			void BeginContact(b2Contact* contact) override;
 
 			void PostSolve(b2Contact* contact, const b2ContactImpulse* impulse) override;
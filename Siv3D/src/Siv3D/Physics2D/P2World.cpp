@@ -26,6 +26,31 @@ namespace s3d
 		return pImpl->update(timeStep, velocityIterations, positionIterations);
 	}
 
+	size_t P2World::updateFixed(const double deltaTime, const double fixedTimeStep, const size_t maxSubSteps, const int32 velocityIterations, const int32 positionIterations) const
+	{
+		return pImpl->updateFixed(deltaTime, fixedTimeStep, maxSubSteps, velocityIterations, positionIterations);
+	}
+
+	double P2World::getInterpolationAlpha() const noexcept
+	{
+		return pImpl->getInterpolationAlpha();
+	}
+
+	void P2World::resetAccumulator()
+	{
+		pImpl->resetAccumulator();
+	}
+
+	uint64 P2World::getStepCount() const noexcept
+	{
+		return pImpl->getStepCount();
+	}
+
+	const P2StepStat& P2World::getStepStat() const noexcept
+	{
+		return pImpl->getStepStat();
+	}
+
 	void P2World::setSleepEnabled(const bool enabled)
 	{
 		pImpl->getData().SetAllowSleeping(enabled);
@@ -53,7 +78,7 @@ namespace s3d
 
 	void P2World::shiftOrigin(const Vec2& newOrigin)
 	{
-		pImpl->getData().ShiftOrigin(detail::ToB2Vec2(newOrigin));
+		pImpl->shiftOrigin(newOrigin);
 	}
 
 	P2Body P2World::createPlaceholder(const P2BodyType bodyType, const Vec2& worldPos)
@@ -255,4 +280,48 @@ namespace s3d
 	{
 		return pImpl->getCollisions();
 	}
+
+	Array<P2BodyID> P2World::queryAABB(const RectF& rect, const P2QueryFilter& filter) const
+	{
+		return pImpl->queryAABB(rect, filter);
+	}
+
+	Optional<P2RaycastHit> P2World::raycast(const Vec2& start, const Vec2& end, const P2QueryFilter& filter) const
+	{
+		return pImpl->raycast(start, end, filter);
+	}
+
+	Array<P2RaycastHit> P2World::raycastAll(const Vec2& start, const Vec2& end, const P2QueryFilter& filter) const
+	{
+		return pImpl->raycastAll(start, end, filter);
+	}
+
+	void P2World::raycastMany(const Array<Line>& rays, Array<Optional<P2RaycastHit>>& results, const P2QueryFilter& filter) const
+	{
+		pImpl->raycastMany(rays, results, filter);
+	}
+
+	Array<Optional<P2RaycastHit>> P2World::raycastMany(const Array<Line>& rays, const P2QueryFilter& filter) const
+	{
+		Array<Optional<P2RaycastHit>> results;
+
+		pImpl->raycastMany(rays, results, filter);
+
+		return results;
+	}
+
+	Array<P2BodyID> P2World::overlapCircle(const Circle& circle, const P2QueryFilter& filter) const
+	{
+		return pImpl->overlapCircle(circle, filter);
+	}
+
+	Array<P2BodyID> P2World::overlapPolygon(const Polygon& polygon, const P2QueryFilter& filter) const
+	{
+		return pImpl->overlapPolygon(polygon, filter);
+	}
+
+	Array<P2BodyID> P2World::pointQuery(const Vec2& pos, const P2QueryFilter& filter) const
+	{
+		return pImpl->pointQuery(pos, filter);
+	}
 }
@@ -10,11 +10,166 @@
 //-----------------------------------------------
 
 # include <Siv3D/Physics2D/P2Body.hpp>
+# include <Siv3D/Polygon.hpp>
+# include <Siv3D/Threading.hpp>
 # include "P2WorldDetail.hpp"
+# include "P2BodyDetail.hpp"
 # include "P2Common.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		// これより少ないレイの数では並列化しない
+		inline constexpr size_t P2RaycastManyGrainSize = 64;
+
+		[[nodiscard]]
+		static bool MatchQueryFilter(b2Fixture* fixture, const P2QueryFilter& filter) noexcept
+		{
+			if (fixture->IsSensor() && (not filter.includeSensors))
+			{
+				return false;
+			}
+
+			if ((fixture->GetFilterData().categoryBits & filter.maskBits) == 0)
+			{
+				return false;
+			}
+
+			if (filter.ignoreBodyID && (P2WorldDetail::GetBodyID(fixture) == filter.ignoreBodyID))
+			{
+				return false;
+			}
+
+			return true;
+		}
+
+		[[nodiscard]]
+		static b2AABB ToB2AABB(const RectF& rect) noexcept
+		{
+			b2AABB aabb;
+			aabb.lowerBound = ToB2Vec2(rect.tl());
+			aabb.upperBound = ToB2Vec2(rect.br());
+			return aabb;
+		}
+
+		[[nodiscard]]
+		static bool TestOverlap(const b2Shape& shape, b2Fixture* fixture)
+		{
+			const b2Shape* fixtureShape = fixture->GetShape();
+			const b2Transform& transform = fixture->GetBody()->GetTransform();
+			const int32 childCount = fixtureShape->GetChildCount();
+
+			b2Transform identity;
+			identity.SetIdentity();
+
+			for (int32 i = 0; i < childCount; ++i)
+			{
+				if (b2TestOverlap(&shape, 0, fixtureShape, i, identity, transform))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/// @brief 範囲内の部品ごとに関数を呼ぶ b2QueryCallback
+		template <class Fty>
+		class P2QueryCallback : public b2QueryCallback
+		{
+		public:
+
+			explicit P2QueryCallback(Fty f)
+				: m_f{ std::move(f) } {}
+
+			bool ReportFixture(b2Fixture* fixture) override
+			{
+				m_f(fixture);
+				return true;
+			}
+
+		private:
+
+			Fty m_f;
+		};
+
+		template <class Fty>
+		static void QueryFixtures(const b2World& world, const RectF& rect, Fty f)
+		{
+			P2QueryCallback<Fty> callback{ std::move(f) };
+
+			world.QueryAABB(&callback, ToB2AABB(rect));
+		}
+
+		/// @brief 始点に最も近い交差を求める b2RayCastCallback
+		class P2ClosestRaycastCallback : public b2RayCastCallback
+		{
+		public:
+
+			explicit P2ClosestRaycastCallback(const P2QueryFilter& filter) noexcept
+				: m_filter{ filter } {}
+
+			float ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, const float fraction) override
+			{
+				if (not MatchQueryFilter(fixture, m_filter))
+				{
+					return -1.0f;
+				}
+
+				m_fixture	= fixture;
+				m_point		= point;
+				m_normal	= normal;
+				m_fraction	= fraction;
+
+				// 以降はこの交差より近いものだけを探す
+				return fraction;
+			}
+
+			b2Fixture* m_fixture = nullptr;
+
+			b2Vec2 m_point = { 0.0f, 0.0f };
+
+			b2Vec2 m_normal = { 0.0f, 0.0f };
+
+			float m_fraction = 1.0f;
+
+		private:
+
+			const P2QueryFilter& m_filter;
+		};
+
+		/// @brief すべての交差を求める b2RayCastCallback
+		class P2AllRaycastCallback : public b2RayCastCallback
+		{
+		public:
+
+			P2AllRaycastCallback(const P2QueryFilter& filter, const double length) noexcept
+				: m_filter{ filter }
+				, m_length{ length } {}
+
+			float ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, const float fraction) override
+			{
+				if (not MatchQueryFilter(fixture, m_filter))
+				{
+					return -1.0f;
+				}
+
+				m_hits.push_back(P2RaycastHit{ P2WorldDetail::GetBodyID(fixture), ToVec2(point), ToVec2(normal), (fraction * m_length) });
+
+				return 1.0f;
+			}
+
+			Array<P2RaycastHit> m_hits;
+
+		private:
+
+			const P2QueryFilter& m_filter;
+
+			double m_length = 0.0;
+		};
+	}
+
 	detail::P2WorldDetail::P2WorldDetail(const Vec2 gravity)
 		: m_world{ detail::ToB2Vec2(gravity) }
 	{
@@ -24,8 +179,107 @@ namespace s3d
 	void detail::P2WorldDetail::update(const double timeStep, const int32 velocityIterations, const int32 positionIterations)
 	{
 		m_contactListner.clearContacts();
+		m_stepStat = {};
+
+		step(static_cast<float>(timeStep), velocityIterations, positionIterations);
+
+		m_interpolationAlpha = 1.0;
+	}
+
+	size_t detail::P2WorldDetail::updateFixed(const double deltaTime, const double fixedTimeStep, const size_t maxSubSteps, const int32 velocityIterations, const int32 positionIterations)
+	{
+		m_contactListner.clearContacts();
+		m_stepStat = {};
+
+		if (not (0.0 < fixedTimeStep))
+		{
+			return 0;
+		}
 
-		m_world.Step(static_cast<float>(timeStep), velocityIterations, positionIterations);
+		m_accumulator += Max(deltaTime, 0.0);
+
+		// 実行するステップ数を先に決め、補間用の姿勢は最後のステップの直前にのみ保存する
+		size_t numSteps = 0;
+		{
+			double accumulator = m_accumulator;
+
+			while ((fixedTimeStep <= accumulator) && (numSteps < maxSubSteps))
+			{
+				accumulator -= fixedTimeStep;
+				++numSteps;
+			}
+
+			if (fixedTimeStep <= accumulator)
+			{
+				const double remainder = std::fmod(accumulator, fixedTimeStep);
+				m_stepStat.droppedTime = (accumulator - remainder);
+				accumulator = remainder;
+			}
+
+			m_accumulator = accumulator;
+		}
+
+		if (numSteps)
+		{
+			// すべてのサブステップに同じ力を適用するため、力のクリアは最後にまとめて行う
+			const bool autoClearForces = m_world.GetAutoClearForces();
+			m_world.SetAutoClearForces(false);
+
+			const float timeStep = static_cast<float>(fixedTimeStep);
+
+			for (size_t i = 0; i < numSteps; ++i)
+			{
+				if (i == (numSteps - 1))
+				{
+					storePreviousTransforms();
+				}
+
+				step(timeStep, velocityIterations, positionIterations);
+			}
+
+			m_world.SetAutoClearForces(autoClearForces);
+			m_world.ClearForces();
+		}
+
+		m_interpolationAlpha = (m_accumulator / fixedTimeStep);
+
+		return numSteps;
+	}
+
+	double detail::P2WorldDetail::getInterpolationAlpha() const noexcept
+	{
+		return m_interpolationAlpha;
+	}
+
+	void detail::P2WorldDetail::resetAccumulator() noexcept
+	{
+		m_accumulator = 0.0;
+		m_interpolationAlpha = 1.0;
+	}
+
+	uint64 detail::P2WorldDetail::getStepCount() const noexcept
+	{
+		return m_stepCount;
+	}
+
+	const P2StepStat& detail::P2WorldDetail::getStepStat() const noexcept
+	{
+		return m_stepStat;
+	}
+
+	void detail::P2WorldDetail::shiftOrigin(const Vec2& newOrigin)
+	{
+		const b2Vec2 origin = detail::ToB2Vec2(newOrigin);
+
+		m_world.ShiftOrigin(origin);
+
+		for (b2Body* body = m_world.GetBodyList(); body; body = body->GetNext())
+		{
+			if (auto pBody = static_cast<P2Body::P2BodyDetail*>(body->GetUserData().pBody))
+			{
+				pBody->shiftPreviousPos(origin);
+			}
+		}
 	}
 
 	P2Body detail::P2WorldDetail::createPlaceholder(const std::shared_ptr<P2WorldDetail>& world, const P2BodyType bodyType, const Vec2& center)
@@ -207,6 +461,196 @@ namespace s3d
 		return m_contactListner.getCollisions();
 	}
 
+	Array<P2BodyID> detail::P2WorldDetail::queryAABB(const RectF& rect, const P2QueryFilter& filter) const
+	{
+		const b2AABB aabb = ToB2AABB(rect);
+
+		Array<P2BodyID> ids;
+
+		QueryFixtures(m_world, rect, [&](b2Fixture* fixture)
+		{
+			if (not MatchQueryFilter(fixture, filter))
+			{
+				return;
+			}
+
+			// 動的木は余白を持たせたバウンディングボックスで管理されているため、部品のバウンディングボックスで判定し直す
+			const int32 childCount = fixture->GetShape()->GetChildCount();
+
+			for (int32 i = 0; i < childCount; ++i)
+			{
+				if (b2TestOverlap(aabb, fixture->GetAABB(i)))
+				{
+					ids.push_back(GetBodyID(fixture));
+					break;
+				}
+			}
+		});
+
+		return ids.sort_and_unique();
+	}
+
+	Optional<P2RaycastHit> detail::P2WorldDetail::raycast(const Vec2& start, const Vec2& end, const P2QueryFilter& filter) const
+	{
+		const double length = start.distanceFrom(end);
+
+		if (length == 0.0)
+		{
+			return none;
+		}
+
+		P2ClosestRaycastCallback callback{ filter };
+
+		m_world.RayCast(&callback, ToB2Vec2(start), ToB2Vec2(end));
+
+		if (not callback.m_fixture)
+		{
+			return none;
+		}
+
+		return P2RaycastHit{ GetBodyID(callback.m_fixture), ToVec2(callback.m_point), ToVec2(callback.m_normal), (callback.m_fraction * length) };
+	}
+
+	Array<P2RaycastHit> detail::P2WorldDetail::raycastAll(const Vec2& start, const Vec2& end, const P2QueryFilter& filter) const
+	{
+		const double length = start.distanceFrom(end);
+
+		if (length == 0.0)
+		{
+			return{};
+		}
+
+		P2AllRaycastCallback callback{ filter, length };
+
+		m_world.RayCast(&callback, ToB2Vec2(start), ToB2Vec2(end));
+
+		Array<P2RaycastHit>& hits = callback.m_hits;
+
+		// 物体ごとに最も近い交差だけを残す
+		std::sort(hits.begin(), hits.end(), [](const P2RaycastHit& a, const P2RaycastHit& b)
+		{
+			return ((a.id < b.id) || ((a.id == b.id) && (a.distance < b.distance)));
+		});
+
+		hits.erase(std::unique(hits.begin(), hits.end(), [](const P2RaycastHit& a, const P2RaycastHit& b)
+		{
+			return (a.id == b.id);
+		}), hits.end());
+
+		std::sort(hits.begin(), hits.end(), [](const P2RaycastHit& a, const P2RaycastHit& b)
+		{
+			return (a.distance < b.distance);
+		});
+
+		return std::move(hits);
+	}
+
+	void detail::P2WorldDetail::raycastMany(const Array<Line>& rays, Array<Optional<P2RaycastHit>>& results, const P2QueryFilter& filter) const
+	{
+		results.resize(rays.size());
+
+		// b2World のレイキャストは読み取りのみなので、複数のスレッドから同時に呼べる
+		Threading::ParallelFor(rays.size(), [&](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				results[i] = raycast(rays[i].begin, rays[i].end, filter);
+			}
+		}, P2RaycastManyGrainSize);
+	}
+
+	Array<P2BodyID> detail::P2WorldDetail::overlapCircle(const Circle& circle, const P2QueryFilter& filter) const
+	{
+		b2CircleShape shape;
+		shape.m_p		= ToB2Vec2(circle.center);
+		shape.m_radius	= static_cast<float>(circle.r);
+
+		Array<P2BodyID> ids;
+
+		QueryFixtures(m_world, circle.boundingRect(), [&](b2Fixture* fixture)
+		{
+			if (MatchQueryFilter(fixture, filter)
+				&& TestOverlap(shape, fixture))
+			{
+				ids.push_back(GetBodyID(fixture));
+			}
+		});
+
+		return ids.sort_and_unique();
+	}
+
+	Array<P2BodyID> detail::P2WorldDetail::overlapPolygon(const Polygon& polygon, const P2QueryFilter& filter) const
+	{
+		// 凹多角形にも対応するため、三角形に分割して判定する
+		Array<b2PolygonShape> shapes(Arg::reserve = polygon.num_triangles());
+
+		for (size_t i = 0; i < polygon.num_triangles(); ++i)
+		{
+			const Triangle triangle = polygon.triangle(i);
+
+			// b2PolygonShape にできない、潰れた三角形は無視する
+			if (triangle.area() < (b2_linearSlop * b2_linearSlop))
+			{
+				continue;
+			}
+
+			const b2Vec2 points[3] = { ToB2Vec2(triangle.p0), ToB2Vec2(triangle.p1), ToB2Vec2(triangle.p2) };
+
+			b2PolygonShape shape;
+			shape.Set(points, 3);
+			shapes.push_back(shape);
+		}
+
+		Array<P2BodyID> ids;
+
+		if (not shapes)
+		{
+			return ids;
+		}
+
+		QueryFixtures(m_world, polygon.boundingRect(), [&](b2Fixture* fixture)
+		{
+			if (not MatchQueryFilter(fixture, filter))
+			{
+				return;
+			}
+
+			for (const auto& shape : shapes)
+			{
+				if (TestOverlap(shape, fixture))
+				{
+					ids.push_back(GetBodyID(fixture));
+					break;
+				}
+			}
+		});
+
+		return ids.sort_and_unique();
+	}
+
+	Array<P2BodyID> detail::P2WorldDetail::pointQuery(const Vec2& pos, const P2QueryFilter& filter) const
+	{
+		const b2Vec2 point = ToB2Vec2(pos);
+
+		Array<P2BodyID> ids;
+
+		QueryFixtures(m_world, RectF{ pos, 0.0 }, [&](b2Fixture* fixture)
+		{
+			if (MatchQueryFilter(fixture, filter)
+				&& fixture->TestPoint(point))
+			{
+				ids.push_back(GetBodyID(fixture));
+			}
+		});
+
+		return ids.sort_and_unique();
+	}
+
+	P2BodyID detail::P2WorldDetail::GetBodyID(b2Fixture* fixture) noexcept
+	{
+		return static_cast<const P2Body::P2BodyDetail*>(fixture->GetBody()->GetUserData().pBody)->id();
+	}
+
 	b2World& detail::P2WorldDetail::getData() noexcept
 	{
 		return m_world;
@@ -226,4 +670,40 @@ namespace s3d
 	{
 		return ++m_currentID;
 	}
+
+	void detail::P2WorldDetail::step(const float timeStep, const int32 velocityIterations, const int32 positionIterations)
+	{
+		m_contactListner.resetCallbackNanosec();
+
+		m_world.Step(timeStep, velocityIterations, positionIterations);
+
+		const b2Profile& profile = m_world.GetProfile();
+		++m_stepStat.steps;
+		m_stepStat.stepMillisec				+= profile.step;
+		m_stepStat.broadphaseMillisec		+= profile.broadphase;
+		m_stepStat.collideMillisec			+= profile.collide;
+		m_stepStat.solveMillisec			+= profile.solve;
+		m_stepStat.solveTOIMillisec			+= profile.solveTOI;
+		m_stepStat.contactListenerMillisec	+= (m_contactListner.getCallbackNanosec() / 1'000'000.0);
+
+		++m_stepCount;
+	}
+
+	void detail::P2WorldDetail::storePreviousTransforms()
+	{
+		for (b2Body* body = m_world.GetBodyList(); body; body = body->GetNext())
+		{
+			// 静的な物体は setPos() などでのみ移動し、そのときに補間用の姿勢もリセットされる
+			if (body->GetType() == b2_staticBody)
+			{
+				continue;
+			}
+
+			// P2MouseJoint が内部で作成する物体は P2BodyDetail を持たない
+			if (auto pBody = static_cast<P2Body::P2BodyDetail*>(body->GetUserData().pBody))
+			{
+				pBody->storePreviousTransform();
+			}
+		}
+	}
 }
@@ -24,6 +24,21 @@ namespace s3d
 
 		void update(double timeStep, int32 velocityIterations, int32 positionIterations);
 
+		size_t updateFixed(double deltaTime, double fixedTimeStep, size_t maxSubSteps, int32 velocityIterations, int32 positionIterations);
+
+		[[nodiscard]]
+		double getInterpolationAlpha() const noexcept;
+
+		void resetAccumulator() noexcept;
+
+		[[nodiscard]]
+		uint64 getStepCount() const noexcept;
+
+		[[nodiscard]]
+		const P2StepStat& getStepStat() const noexcept;
+
+		void shiftOrigin(const Vec2& newOrigin);
+
 		[[nodiscard]]
 		P2Body createPlaceholder(const std::shared_ptr<P2WorldDetail>& world, P2BodyType bodyType, const Vec2& worldPos);
 
@@ -93,6 +108,29 @@ namespace s3d
 		[[nodiscard]]
 		const HashTable<P2ContactPair, P2Collision>& getCollisions() const noexcept;
 
+		[[nodiscard]]
+		Array<P2BodyID> queryAABB(const RectF& rect, const P2QueryFilter& filter) const;
+
+		[[nodiscard]]
+		Optional<P2RaycastHit> raycast(const Vec2& start, const Vec2& end, const P2QueryFilter& filter) const;
+
+		[[nodiscard]]
+		Array<P2RaycastHit> raycastAll(const Vec2& start, const Vec2& end, const P2QueryFilter& filter) const;
+
+		void raycastMany(const Array<Line>& rays, Array<Optional<P2RaycastHit>>& results, const P2QueryFilter& filter) const;
+
+		[[nodiscard]]
+		Array<P2BodyID> overlapCircle(const Circle& circle, const P2QueryFilter& filter) const;
+
+		[[nodiscard]]
+		Array<P2BodyID> overlapPolygon(const Polygon& polygon, const P2QueryFilter& filter) const;
+
+		[[nodiscard]]
+		Array<P2BodyID> pointQuery(const Vec2& pos, const P2QueryFilter& filter) const;
+
+		[[nodiscard]]
+		static P2BodyID GetBodyID(b2Fixture* fixture) noexcept;
+
 		[[nodiscard]]
 		b2World& getData() noexcept;
 
@@ -110,7 +148,19 @@ namespace s3d
 
 		std::atomic<P2BodyID> m_currentID = { 0 };
 
+		double m_accumulator = 0.0;
+
+		double m_interpolationAlpha = 1.0;
+
+		uint64 m_stepCount = 0;
+
+		P2StepStat m_stepStat;
+
 		[[nodiscard]]
 		P2BodyID generateNextID() noexcept;
+
+		void step(float timeStep, int32 velocityIterations, int32 positionIterations);
+
+		void storePreviousTransforms();
 	};
 }
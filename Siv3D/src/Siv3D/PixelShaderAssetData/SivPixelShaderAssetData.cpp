@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/PixelShaderAssetData.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/System.hpp>
 
 namespace s3d
@@ -57,6 +58,8 @@ namespace s3d
 	{
 		if (isUninitialized())
 		{
+			const ProfilerZone profilerZone{ U"PixelShaderAsset::load" };
+
 			if (onLoad(*this, hint))
 			{
 				setState(AssetState::Loaded);
@@ -85,6 +88,8 @@ namespace s3d
 
 			m_task = Async([this, hint = hint]()
 				{
+					const ProfilerZone profilerZone{ U"PixelShaderAsset::load" };
+
 					setState(onLoad(*this, hint) ? AssetState::Loaded : AssetState::Failed);
 				});
 		}
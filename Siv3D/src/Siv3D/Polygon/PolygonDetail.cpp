@@ -63,6 +63,45 @@ namespace s3d
 		{
 			return std::abs((p0.x - p2.x) * (p1.y - p0.y) - (p0.x - p1.x) * (p2.y - p0.y)) * 0.5;
 		}
+
+		/// @brief 点が閉じた頂点列の内側にあるかを、交差数判定で調べます。
+		[[nodiscard]]
+		static bool RingContains(const Array<Vec2>& ring, const Vec2& pos) noexcept
+		{
+			const size_t num_points = ring.size();
+			bool inside = false;
+
+			for (size_t i = 0, k = (num_points - 1); i < num_points; k = i++)
+			{
+				const Vec2& p0 = ring[i];
+				const Vec2& p1 = ring[k];
+
+				if (((pos.y < p0.y) != (pos.y < p1.y))
+					&& (pos.x < (p0.x + (pos.y - p0.y) * (p1.x - p0.x) / (p1.y - p0.y))))
+				{
+					inside = (not inside);
+				}
+			}
+
+			return inside;
+		}
+
+		template <class Shape2DType>
+		[[nodiscard]]
+		static bool RingEdgesIntersect(const Array<Vec2>& ring, const Shape2DType& shape) noexcept
+		{
+			const size_t num_points = ring.size();
+
+			for (size_t i = 0, k = (num_points - 1); i < num_points; k = i++)
+			{
+				if (Geometry2D::Intersect(Line{ ring[k], ring[i] }, shape))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
 	}
 
 	Polygon::PolygonDetail::PolygonDetail()
@@ -102,14 +141,7 @@ namespace s3d
 		m_holes = std::move(holes);
 
 		// [3 of 5], [4 of 5]
-		{
-			Array<Vertex2D::IndexType> indices;
-			detail::Triangulate(m_polygon.outer(), m_holes, m_vertices, indices);
-			assert(indices.size() % 3 == 0);
-			m_indices.resize(indices.size() / 3);
-			assert(m_indices.size_bytes() == indices.size_bytes());
-			std::memcpy(m_indices.data(), indices.data(), indices.size_bytes());
-		}
+		// triangulate() で必要になったときに行う
 
 		// [5 of 5]
 		m_boundingRect = detail::CalculateBoundingRect(pOuterVertex, vertexSize);
@@ -145,6 +177,8 @@ namespace s3d
 
 		// [5 of 5]
 		m_boundingRect = boundingRect;
+
+		m_triangulated.store(true, std::memory_order_relaxed);
 	}
 
 	Polygon::PolygonDetail::PolygonDetail(const Array<Vec2>& outer, Array<Array<Vec2>> holes, Array<Float2> vertices, Array<TriangleIndex> indices, const RectF& boundingRect, const SkipValidation skipValidation)
@@ -186,6 +220,8 @@ namespace s3d
 
 		// [5 of 5]
 		m_boundingRect = boundingRect;
+
+		m_triangulated.store(true, std::memory_order_relaxed);
 	}
 
 	Polygon::PolygonDetail::PolygonDetail(const Float2* pOuterVertex, const size_t vertexSize, Array<TriangleIndex> indices)
@@ -209,6 +245,44 @@ namespace s3d
 
 		// [5 of 5]
 		m_boundingRect = detail::CalculateBoundingRect(m_polygon.outer().data(), m_polygon.outer().size());
+
+		m_triangulated.store(true, std::memory_order_relaxed);
+	}
+
+	Polygon::PolygonDetail::PolygonDetail(const PolygonDetail& other)
+		: m_polygon{ other.m_polygon }
+		, m_holes{ other.m_holes }
+		, m_boundingRect{ other.m_boundingRect }
+	{
+		// 分割済みであれば結果を引き継ぎ、分割のやり直しを避ける
+		if (other.m_triangulated.load(std::memory_order_acquire))
+		{
+			m_vertices = other.m_vertices;
+			m_indices = other.m_indices;
+			m_triangulated.store(true, std::memory_order_relaxed);
+		}
+	}
+
+	Polygon::PolygonDetail& Polygon::PolygonDetail::operator =(const PolygonDetail& other)
+	{
+		if (this != &other)
+		{
+			*this = PolygonDetail{ other };
+		}
+
+		return *this;
+	}
+
+	Polygon::PolygonDetail& Polygon::PolygonDetail::operator =(PolygonDetail&& other) noexcept
+	{
+		m_polygon		= std::move(other.m_polygon);
+		m_holes			= std::move(other.m_holes);
+		m_boundingRect	= other.m_boundingRect;
+		m_vertices		= std::move(other.m_vertices);
+		m_indices		= std::move(other.m_indices);
+		m_triangulated.store(other.m_triangulated.load(std::memory_order_acquire), std::memory_order_release);
+
+		return *this;
 	}
 
 	const Array<Vec2>& Polygon::PolygonDetail::outer() const noexcept
@@ -223,11 +297,15 @@ namespace s3d
 
 	const Array<Float2>& Polygon::PolygonDetail::vertices() const noexcept
 	{
+		triangulate();
+
 		return m_vertices;
 	}
 
 	const Array<TriangleIndex>& Polygon::PolygonDetail::indices() const noexcept
 	{
+		triangulate();
+
 		return m_indices;
 	}
 
@@ -236,6 +314,11 @@ namespace s3d
 		return m_boundingRect;
 	}
 
+	bool Polygon::PolygonDetail::isTriangulated() const noexcept
+	{
+		return m_triangulated.load(std::memory_order_acquire);
+	}
+
 	void Polygon::PolygonDetail::moveBy(const Vec2 v) noexcept
 	{
 		if (outer().isEmpty())
@@ -575,6 +658,8 @@ namespace s3d
 
 	double Polygon::PolygonDetail::area() const noexcept
 	{
+		triangulate();
+
 		const size_t _num_triangles = m_indices.size();
 
 		double result = 0.0;
@@ -881,6 +966,30 @@ namespace s3d
 		return true;
 	}
 
+	bool Polygon::PolygonDetail::contains(const Vec2& pos) const noexcept
+	{
+		if (outer().isEmpty()
+			|| (not Geometry2D::Intersect(pos, m_boundingRect)))
+		{
+			return false;
+		}
+
+		if (not detail::RingContains(m_polygon.outer(), pos))
+		{
+			return false;
+		}
+
+		for (const auto& hole : m_holes)
+		{
+			if (detail::RingContains(hole, pos))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	bool Polygon::PolygonDetail::intersects(const Line& other) const
 	{
 		if (outer().isEmpty()
@@ -889,13 +998,50 @@ namespace s3d
 			return false;
 		}
 
-		const Float2* pVertex = m_vertices.data();
+		// 三角形分割を使わず、始点の内外判定と辺との交差判定を行う
+		if (contains(other.begin))
+		{
+			return true;
+		}
+
+		if (detail::RingEdgesIntersect(m_polygon.outer(), other))
+		{
+			return true;
+		}
+
+		for (const auto& hole : m_holes)
+		{
+			if (detail::RingEdgesIntersect(hole, other))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool Polygon::PolygonDetail::intersects(const Circle& other) const
+	{
+		if (outer().isEmpty()
+			|| (not Geometry2D::Intersect(other, m_boundingRect)))
+		{
+			return false;
+		}
+
+		// 三角形分割を使わず、中心の内外判定と辺との交差判定を行う
+		if (contains(other.center))
+		{
+			return true;
+		}
 
-		for (const auto& triangleIndex : m_indices)
+		if (detail::RingEdgesIntersect(m_polygon.outer(), other))
 		{
-			const Triangle triangle{ pVertex[triangleIndex.i0], pVertex[triangleIndex.i1], pVertex[triangleIndex.i2] };
+			return true;
+		}
 
-			if (Geometry2D::Intersect(other, triangle))
+		for (const auto& hole : m_holes)
+		{
+			if (detail::RingEdgesIntersect(hole, other))
 			{
 				return true;
 			}
@@ -931,11 +1077,15 @@ namespace s3d
 
 	void Polygon::PolygonDetail::draw(const ColorF& color) const
 	{
+		triangulate();
+
 		SIV3D_ENGINE(Renderer2D)->addPolygon(m_vertices, m_indices, none, color.toFloat4());
 	}
 
 	void Polygon::PolygonDetail::draw(const Vec2& offset, const ColorF& color) const
 	{
+		triangulate();
+
 		SIV3D_ENGINE(Renderer2D)->addPolygon(m_vertices, m_indices, Float2{ offset }, color.toFloat4());
 	}
 
@@ -1007,6 +1157,8 @@ namespace s3d
 
 	void Polygon::PolygonDetail::drawTransformed(const double s, const double c, const Vec2& pos, const ColorF& color) const
 	{
+		triangulate();
+
 		SIV3D_ENGINE(Renderer2D)->addPolygonTransformed(m_vertices, m_indices,
 			static_cast<float>(s), static_cast<float>(c),
 			Float2{ pos },
@@ -1017,6 +1169,34 @@ namespace s3d
 	{
 		return m_polygon;
 	}
+
+	void Polygon::PolygonDetail::triangulate() const
+	{
+		if (m_triangulated.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		// 共有されている多角形が複数のスレッドから同時に参照される場合に備える
+		std::lock_guard lock{ m_triangulationMutex };
+
+		if (m_triangulated.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		if (not m_polygon.outer().isEmpty())
+		{
+			Array<Vertex2D::IndexType> indices;
+			detail::Triangulate(m_polygon.outer(), m_holes, m_vertices, indices);
+			assert(indices.size() % 3 == 0);
+			m_indices.resize(indices.size() / 3);
+			assert(m_indices.size_bytes() == indices.size_bytes());
+			std::memcpy(m_indices.data(), indices.data(), indices.size_bytes());
+		}
+
+		m_triangulated.store(true, std::memory_order_release);
+	}
 }
 
 
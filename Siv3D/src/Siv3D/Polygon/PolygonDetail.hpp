@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # pragma once
+# include <atomic>
+# include <mutex>
 # include <Siv3D/Common.hpp>
 
 # ifdef __clang__
@@ -63,16 +65,26 @@ namespace s3d
 
 		Array<Array<Vec2>> m_holes;
 
-		Array<Float2> m_vertices;
+		RectF m_boundingRect = RectF::Empty();
 
-		Array<TriangleIndex> m_indices;
+		// 三角形分割は、描画や三角形へのアクセスで初めて必要になったときに行う
+		// 分割前は m_vertices, m_indices は空
+		mutable Array<Float2> m_vertices;
 
-		RectF m_boundingRect = RectF::Empty();
+		mutable Array<TriangleIndex> m_indices;
+
+		mutable std::atomic<bool> m_triangulated{ false };
+
+		mutable std::mutex m_triangulationMutex;
+
+		void triangulate() const;
 
 	public:
 
 		PolygonDetail();
 
+		PolygonDetail(const PolygonDetail& other);
+
 		PolygonDetail(const Vec2* pVertex, size_t vertexSize, Array<Array<Vec2>> holes, SkipValidation skipValidation);
 
 		PolygonDetail(const Vec2* pOuterVertex, size_t vertexSize, Array<TriangleIndex> indices, const RectF& boundingRect, SkipValidation skipValidation);
@@ -81,6 +93,10 @@ namespace s3d
 
 		PolygonDetail(const Float2* pOuterVertex, size_t vertexSize, Array<TriangleIndex> indices);
 
+		PolygonDetail& operator =(const PolygonDetail& other);
+
+		PolygonDetail& operator =(PolygonDetail&& other) noexcept;
+
 		[[nodiscard]]
 		const Array<Vec2>& outer() const noexcept;
 
@@ -96,6 +112,9 @@ namespace s3d
 		[[nodiscard]]
 		const RectF& boundingRect() const noexcept;
 
+		[[nodiscard]]
+		bool isTriangulated() const noexcept;
+
 		void moveBy(Vec2 v) noexcept;
 
 		void rotateAt(Vec2 pos, double angle);
@@ -128,8 +147,12 @@ namespace s3d
 
 		bool append(const Polygon& other);
 
+		bool contains(const Vec2& pos) const noexcept;
+
 		bool intersects(const Line& other) const;
 
+		bool intersects(const Circle& other) const;
+
 		bool intersects(const RectF& other) const;
 
 		bool intersects(const PolygonDetail& other) const;
@@ -84,13 +84,13 @@ namespace s3d
 	}
 
 	Polygon::Polygon()
-		: pImpl{ std::make_unique<PolygonDetail>() }
+		: pImpl{ _emptyDetail() }
 	{
 
 	}
 
 	Polygon::Polygon(const Polygon& polygon)
-		: pImpl{ std::make_unique<PolygonDetail>(*polygon.pImpl) }
+		: pImpl{ polygon.pImpl }
 	{
 
 	}
@@ -98,41 +98,41 @@ namespace s3d
 	Polygon::Polygon(Polygon&& polygon) noexcept
 		: pImpl{ std::move(polygon.pImpl) }
 	{
-		polygon.pImpl = std::make_unique<PolygonDetail>();
+		polygon.pImpl = _emptyDetail();
 	}
 
 	Polygon::Polygon(const Vec2* outer, const size_t size, Array<Array<Vec2>> holes, const SkipValidation skipValidation)
-		: pImpl{ std::make_unique<PolygonDetail>(outer, size, std::move(holes), skipValidation) }
+		: pImpl{ std::make_shared<PolygonDetail>(outer, size, std::move(holes), skipValidation) }
 	{
 
 	}
 
 	Polygon::Polygon(const Array<Vec2>& outer, Array<Array<Vec2>> holes, const SkipValidation skipValidation)
-		: pImpl{ std::make_unique<PolygonDetail>(outer.data(), outer.size(), std::move(holes), skipValidation) }
+		: pImpl{ std::make_shared<PolygonDetail>(outer.data(), outer.size(), std::move(holes), skipValidation) }
 	{
 
 	}
 
 	Polygon::Polygon(const Array<Vec2>& outer, const Array<TriangleIndex>& indices, const RectF& boundingRect, const SkipValidation skipValidation)
-		: pImpl{ std::make_unique<PolygonDetail>(outer.data(), outer.size(), indices, boundingRect, skipValidation) }
+		: pImpl{ std::make_shared<PolygonDetail>(outer.data(), outer.size(), indices, boundingRect, skipValidation) }
 	{
 
 	}
 
 	Polygon::Polygon(const Array<Vec2>& outer, Array<Array<Vec2>> holes, const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const RectF& boundingRect, const SkipValidation skipValidation)
-		: pImpl{ std::make_unique<PolygonDetail>(outer, std::move(holes), vertices, indices, boundingRect, skipValidation) }
+		: pImpl{ std::make_shared<PolygonDetail>(outer, std::move(holes), vertices, indices, boundingRect, skipValidation) }
 	{
 
 	}
 
 	Polygon::Polygon(std::initializer_list<Vec2> outer, const SkipValidation skipValidation)
-		: pImpl{ std::make_unique<PolygonDetail>(outer.begin(), outer.size(), Array<Array<Vec2>>{}, skipValidation) }
+		: pImpl{ std::make_shared<PolygonDetail>(outer.begin(), outer.size(), Array<Array<Vec2>>{}, skipValidation) }
 	{
 
 	}
 
 	Polygon::Polygon(const Shape2D& shape)
-		: pImpl(std::make_unique<PolygonDetail>(shape.vertices().data(), shape.vertices().size(), shape.indices()))
+		: pImpl(std::make_shared<PolygonDetail>(shape.vertices().data(), shape.vertices().size(), shape.indices()))
 	{
 
 	}
@@ -144,14 +144,18 @@ namespace s3d
 
 	Polygon& Polygon::operator =(const Polygon& polygon)
 	{
-		*pImpl = *polygon.pImpl;
+		pImpl = polygon.pImpl;
 		
 		return *this;
 	}
 
 	Polygon& Polygon::operator =(Polygon&& polygon) noexcept
 	{
-		pImpl = std::move(polygon.pImpl);
+		if (this != &polygon)
+		{
+			pImpl = std::move(polygon.pImpl);
+			polygon.pImpl = _emptyDetail();
+		}
 
 		return *this;
 	}
@@ -515,7 +519,7 @@ namespace s3d
 
 	Polygon& Polygon::moveBy(const Vec2 v) noexcept
 	{
-		pImpl->moveBy(v);
+		_mutableDetail().moveBy(v);
 
 		return *this;
 	}
@@ -566,7 +570,7 @@ namespace s3d
 
 	Polygon& Polygon::rotateAt(const Vec2 pos, const double angle)
 	{
-		pImpl->rotateAt(pos, angle);
+		_mutableDetail().rotateAt(pos, angle);
 
 		return *this;
 	}
@@ -587,7 +591,7 @@ namespace s3d
 
 	Polygon& Polygon::transform(const double s, const double c, const Vec2& pos)
 	{
-		pImpl->transform(s, c, pos);
+		_mutableDetail().transform(s, c, pos);
 
 		return *this;
 	}
@@ -632,7 +636,7 @@ namespace s3d
 
 	Polygon& Polygon::scale(const double s)
 	{
-		pImpl->scale(s);
+		_mutableDetail().scale(s);
 
 		return *this;
 	}
@@ -644,7 +648,7 @@ namespace s3d
 
 	Polygon& Polygon::scale(const Vec2 s)
 	{
-		pImpl->scale(s);
+		_mutableDetail().scale(s);
 
 		return *this;
 	}
@@ -665,7 +669,7 @@ namespace s3d
 
 	Polygon& Polygon::scaleAt(const Vec2 pos, const double s)
 	{
-		pImpl->scaleAt(pos, s);
+		_mutableDetail().scaleAt(pos, s);
 
 		return *this;
 	}
@@ -701,7 +705,7 @@ namespace s3d
 
 	Polygon& Polygon::scaleAt(const Vec2 pos, const Vec2 s)
 	{
-		pImpl->scaleAt(pos, s);
+		_mutableDetail().scaleAt(pos, s);
 
 		return *this;
 	}
@@ -854,12 +858,12 @@ namespace s3d
 
 	bool Polygon::append(const RectF& other)
 	{
-		return pImpl->append(other);
+		return _mutableDetail().append(other);
 	}
 
 	bool Polygon::append(const Polygon& other)
 	{
-		return pImpl->append(other);
+		return _mutableDetail().append(other);
 	}
 
 	bool Polygon::intersects(const Line& other) const
@@ -1195,6 +1199,24 @@ namespace s3d
 		return CorrectOne(vertices.data(), vertices.size(), holes);
 	}
 
+	Polygon::PolygonDetail& Polygon::_mutableDetail()
+	{
+		// 他の Polygon と共有している場合は、変更の前に複製する
+		if (pImpl.use_count() != 1)
+		{
+			pImpl = std::make_shared<PolygonDetail>(*pImpl);
+		}
+
+		return *pImpl;
+	}
+
+	const std::shared_ptr<Polygon::PolygonDetail>& Polygon::_emptyDetail()
+	{
+		static const std::shared_ptr<PolygonDetail> empty = std::make_shared<PolygonDetail>();
+
+		return empty;
+	}
+
 	void Formatter(FormatData& formatData, const Polygon& value)
 	{
 		std::stringstream ss;
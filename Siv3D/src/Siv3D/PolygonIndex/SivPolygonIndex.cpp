@@ -0,0 +1,278 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <queue>
+# include <Siv3D/PolygonIndex.hpp>
+# include <Siv3D/MultiPolygon.hpp>
+# include <Siv3D/Geometry2D.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Error.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		constexpr size_t PolygonIndexQueryAllGrainSize = 256;
+
+		// float に丸めたときにバウンディングボックスが縮まないようにする
+		[[nodiscard]]
+		static float RoundDown(const double value) noexcept
+		{
+			const float f = static_cast<float>(value);
+			return (value < f) ? std::nextafter(f, -std::numeric_limits<float>::infinity()) : f;
+		}
+
+		[[nodiscard]]
+		static float RoundUp(const double value) noexcept
+		{
+			const float f = static_cast<float>(value);
+			return (f < value) ? std::nextafter(f, std::numeric_limits<float>::infinity()) : f;
+		}
+
+		[[nodiscard]]
+		static double BoxDistance(const float minX, const float minY, const float maxX, const float maxY, const Vec2& pos) noexcept
+		{
+			const double dx = Max({ (minX - pos.x), 0.0, (pos.x - maxX) });
+			const double dy = Max({ (minY - pos.y), 0.0, (pos.y - maxY) });
+			return std::sqrt(dx * dx + dy * dy);
+		}
+	}
+
+	PolygonIndex::PolygonIndex(const MultiPolygon& polygons)
+		: m_polygons{ polygons.asArray() }
+	{
+		build();
+	}
+
+	PolygonIndex::PolygonIndex(const Array<Polygon>& polygons)
+		: m_polygons{ polygons }
+	{
+		build();
+	}
+
+	bool PolygonIndex::isEmpty() const noexcept
+	{
+		return m_polygons.isEmpty();
+	}
+
+	size_t PolygonIndex::size() const noexcept
+	{
+		return m_polygons.size();
+	}
+
+	const Array<Polygon>& PolygonIndex::polygons() const noexcept
+	{
+		return m_polygons;
+	}
+
+	Array<size_t> PolygonIndex::queryRect(const RectF& rect) const
+	{
+		Array<size_t> results;
+
+		visit(rect, [&](const size_t index)
+		{
+			if (m_polygons[index].boundingRect().intersects(rect))
+			{
+				results << index;
+			}
+
+			return true;
+		});
+
+		return results.sort();
+	}
+
+	Array<size_t> PolygonIndex::queryContains(const Vec2& pos) const
+	{
+		Array<size_t> results;
+
+		visit(RectF{ pos, 0, 0 }, [&](const size_t index)
+		{
+			if (m_polygons[index].contains(pos))
+			{
+				results << index;
+			}
+
+			return true;
+		});
+
+		return results.sort();
+	}
+
+	Optional<size_t> PolygonIndex::nearest(const Vec2& pos) const
+	{
+		if (m_nodes.isEmpty())
+		{
+			return none;
+		}
+
+		// バウンディングボックスまでの距離を下界とする最良優先探索
+		using Item = std::pair<double, uint32>;
+		std::priority_queue<Item, Array<Item>, std::greater<Item>> queue;
+
+		{
+			const Node& root = m_nodes.back();
+			queue.emplace(detail::BoxDistance(root.minX, root.minY, root.maxX, root.maxY, pos), static_cast<uint32>(m_nodes.size() - 1));
+		}
+
+		double bestDistance = std::numeric_limits<double>::infinity();
+		Optional<size_t> bestIndex;
+
+		while (not queue.empty())
+		{
+			const auto [distance, position] = queue.top();
+			queue.pop();
+
+			if (bestDistance < distance)
+			{
+				break;
+			}
+
+			const Node& node = m_nodes[position];
+
+			if (node.count == 0)
+			{
+				const size_t index = node.first;
+				const double polygonDistance = Geometry2D::Distance(pos, m_polygons[index]);
+
+				if ((polygonDistance < bestDistance)
+					|| ((polygonDistance == bestDistance) && (index < *bestIndex)))
+				{
+					bestDistance = polygonDistance;
+					bestIndex = index;
+				}
+
+				continue;
+			}
+
+			for (uint32 i = node.first; i < (node.first + node.count); ++i)
+			{
+				const Node& child = m_nodes[i];
+				const double childDistance = detail::BoxDistance(child.minX, child.minY, child.maxX, child.maxY, pos);
+
+				if (childDistance <= bestDistance)
+				{
+					queue.emplace(childDistance, i);
+				}
+			}
+		}
+
+		return bestIndex;
+	}
+
+	Array<Optional<size_t>> PolygonIndex::queryAll(const Array<Vec2>& points) const
+	{
+		Array<Optional<size_t>> results(points.size());
+
+		Threading::ParallelFor(points.size(), [&](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const Vec2 pos = points[i];
+				Optional<size_t> result;
+
+				visit(RectF{ pos, 0, 0 }, [&](const size_t index)
+				{
+					if (((not result) || (index < *result))
+						&& m_polygons[index].contains(pos))
+					{
+						result = index;
+					}
+
+					return true;
+				});
+
+				results[i] = result;
+			}
+		}, detail::PolygonIndexQueryAllGrainSize);
+
+		return results;
+	}
+
+	void PolygonIndex::release()
+	{
+		m_polygons.release();
+		m_nodes.release();
+	}
+
+	void PolygonIndex::build()
+	{
+		// ノードの総数は多角形の数の高々 2 倍
+		if ((std::numeric_limits<uint32>::max() / 2) <= m_polygons.size())
+		{
+			throw Error{ U"PolygonIndex: too many polygons" };
+		}
+
+		m_nodes.reserve(m_polygons.size() + (m_polygons.size() / (NodeCapacity - 1)) + 32);
+
+		// [1] 葉: 空でない多角形ごとに 1 つ
+		for (size_t i = 0; i < m_polygons.size(); ++i)
+		{
+			const Polygon& polygon = m_polygons[i];
+
+			if (not polygon)
+			{
+				continue;
+			}
+
+			const RectF rect = polygon.boundingRect();
+			m_nodes.push_back(Node{ detail::RoundDown(rect.x), detail::RoundDown(rect.y),
+				detail::RoundUp(rect.x + rect.w), detail::RoundUp(rect.y + rect.h), static_cast<uint32>(i), 0 });
+		}
+
+		// [2] STR: x で縦の帯に分け、帯ごとに y で並べて NodeCapacity 個ずつ親にまとめる。根が 1 つになるまで繰り返す
+		size_t levelBegin = 0;
+		size_t levelEnd = m_nodes.size();
+
+		while (1 < (levelEnd - levelBegin))
+		{
+			const size_t count = (levelEnd - levelBegin);
+			const size_t parentCount = ((count + NodeCapacity - 1) / NodeCapacity);
+			const size_t sliceCount = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(parentCount))));
+			const size_t sliceSize = (sliceCount * NodeCapacity);
+
+			const auto itBegin = (m_nodes.begin() + levelBegin);
+			const auto itEnd = (m_nodes.begin() + levelEnd);
+
+			std::sort(itBegin, itEnd, [](const Node& a, const Node& b) { return ((a.minX + a.maxX) < (b.minX + b.maxX)); });
+
+			for (size_t i = 0; i < count; i += sliceSize)
+			{
+				std::sort((itBegin + i), (itBegin + Min((i + sliceSize), count)),
+					[](const Node& a, const Node& b) { return ((a.minY + a.maxY) < (b.minY + b.maxY)); });
+			}
+
+			for (size_t i = levelBegin; i < levelEnd; i += NodeCapacity)
+			{
+				const size_t childCount = Min(NodeCapacity, (levelEnd - i));
+				Node parent = m_nodes[i];
+
+				for (size_t k = (i + 1); k < (i + childCount); ++k)
+				{
+					const Node& child = m_nodes[k];
+					parent.minX = Min(parent.minX, child.minX);
+					parent.minY = Min(parent.minY, child.minY);
+					parent.maxX = Max(parent.maxX, child.maxX);
+					parent.maxY = Max(parent.maxY, child.maxY);
+				}
+
+				parent.first = static_cast<uint32>(i);
+				parent.count = static_cast<uint32>(childCount);
+				m_nodes.push_back(parent);
+			}
+
+			levelBegin = levelEnd;
+			levelEnd = m_nodes.size();
+		}
+
+		m_nodes.shrink_to_fit();
+	}
+}
@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # include <Siv3D/String.hpp>
+# include <Siv3D/TextWriter.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/PointVector.hpp>
 # include <Siv3D/FormatLiteral.hpp>
 # include <Siv3D/WindowState.hpp>
@@ -24,9 +26,51 @@
 # include <Siv3D/Audio/IAudio.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include "CProfiler.hpp"
+# include "ProfilerZoneBuffer.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		// 1 フレーム全体の時間を記録するゾーンの名前
+		static constexpr const char32* FrameZoneName = U"Frame";
+
+		static void AppendJSONString(String& output, const StringView s)
+		{
+			output.push_back(U'"');
+
+			for (const char32 ch : s)
+			{
+				switch (ch)
+				{
+				case U'"':
+					output.append(U"\\\"");
+					break;
+				case U'\\':
+					output.append(U"\\\\");
+					break;
+				case U'\n':
+					output.append(U"\\n");
+					break;
+				case U'\t':
+					output.append(U"\\t");
+					break;
+				default:
+					if (ch < 0x20)
+					{
+						output.append(U"\\u{:04X}"_fmt(static_cast<uint32>(ch)));
+					}
+					else
+					{
+						output.push_back(ch);
+					}
+				}
+			}
+
+			output.push_back(U'"');
+		}
+	}
+
 	void CProfiler::init()
 	{
 		LOG_SCOPED_TRACE(U"CProfiler::init()");
@@ -54,9 +98,9 @@ namespace s3d
 		// Stat
 		{
 			{
-				const auto stat = SIV3D_ENGINE(Renderer2D)->getStat();
-				m_stat.drawCalls = stat.drawCalls;
-				m_stat.triangleCount = stat.triangleCount;
+				m_renderer2DStat = SIV3D_ENGINE(Renderer2D)->getStat();
+				m_stat.drawCalls = m_renderer2DStat.drawCalls;
+				m_stat.triangleCount = m_renderer2DStat.triangleCount;
 			}
 
 			m_stat.textureCount	= static_cast<uint32>(SIV3D_ENGINE(Texture)->getTextureCount());
@@ -68,7 +112,7 @@ namespace s3d
 
 	void CProfiler::endFrame()
 	{
-
+		updateZones();
 	}
 
 	int32 CProfiler::getFPS() const noexcept
@@ -92,4 +136,242 @@ namespace s3d
 	{
 		return m_stat;
 	}
+
+	const Renderer2DStat& CProfiler::getRenderer2DStat() const
+	{
+		return m_renderer2DStat;
+	}
+
+	Array<ProfilerZoneStat> CProfiler::getZoneStats() const
+	{
+		Array<ProfilerZoneStat> results;
+
+		Array<uint64> durations;
+
+		for (const auto& zone : m_zones)
+		{
+			durations.clear();
+
+			uint64 totalCalls = 0;
+
+			for (const auto& sample : zone.samples)
+			{
+				if ((sample.frameIndex + ZoneStatFrameCount) < m_frameIndex)
+				{
+					continue;
+				}
+
+				durations << sample.totalNanosec;
+				totalCalls += sample.calls;
+			}
+
+			if (not durations)
+			{
+				continue;
+			}
+
+			std::sort(durations.begin(), durations.end());
+
+			const size_t frameCount = durations.size();
+			const double sum = static_cast<double>(durations.sum());
+			const size_t p99Index = (((frameCount * 99) + 99) / 100 - 1);
+
+			ProfilerZoneStat stat;
+			stat.name			= zone.name;
+			stat.frameCount		= static_cast<uint32>(frameCount);
+			stat.callsPerFrame	= (static_cast<double>(totalCalls) / frameCount);
+			stat.minMillisec	= (durations.front() / 1'000'000.0);
+			stat.avgMillisec	= (sum / frameCount / 1'000'000.0);
+			stat.maxMillisec	= (durations.back() / 1'000'000.0);
+			stat.p99Millisec	= (durations[p99Index] / 1'000'000.0);
+			results << std::move(stat);
+		}
+
+		return results;
+	}
+
+	bool CProfiler::exportChromeTrace(const FilePathView path) const
+	{
+		TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		String output = U"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool first = true;
+
+		for (const auto& [threadIndex, threadName] : m_threadNames)
+		{
+			output.append(first ? U"\n" : U",\n");
+			output.append(U"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":"_fmt(threadIndex));
+			detail::AppendJSONString(output, threadName);
+			output.append(U"}}");
+			first = false;
+		}
+
+		for (const auto& events : m_traceFrames)
+		{
+			for (const auto& event : events)
+			{
+				output.append(first ? U"\n" : U",\n");
+				output.append(U"{\"name\":");
+				detail::AppendJSONString(output, event.name);
+				output.append(U",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}"_fmt(
+					event.threadIndex, (event.beginNanosec / 1000.0), ((event.endNanosec - event.beginNanosec) / 1000.0)));
+				first = false;
+
+				// ファイルへの書き込みをまとめて行う
+				if (output.size() >= (1 << 16))
+				{
+					writer.write(output);
+					output.clear();
+				}
+			}
+		}
+
+		output.append(U"\n]}\n");
+		writer.write(output);
+
+		return true;
+	}
+
+	void CProfiler::clearZoneHistory()
+	{
+		// まだ集計されていないイベントも破棄する
+		ProfilerZoneRegistry::ForEachBuffer([](ProfilerZoneBuffer& buffer)
+		{
+			buffer.consume([](const ProfilerZoneEvent&) {});
+			(void)buffer.takeDroppedCount();
+		});
+
+		for (auto& zone : m_zones)
+		{
+			zone.samples.clear();
+			zone.currentTotalNanosec = 0;
+			zone.currentCalls = 0;
+		}
+
+		m_currentZones.clear();
+
+		m_traceFrames.clear();
+	}
+
+	void CProfiler::updateZones()
+	{
+		const bool enabled = detail::g_profilerZoneEnabled.load(std::memory_order_relaxed);
+
+		if ((not enabled) && (not m_zoneProfilingActive))
+		{
+			return;
+		}
+
+		const uint64 frameEndNanosec = Time::GetNanosec();
+		const std::thread::id mainThreadID = std::this_thread::get_id();
+		Array<TraceEvent> traceEvents;
+		uint64 droppedCount = 0;
+
+		ProfilerZoneRegistry::ForEachBuffer([&](ProfilerZoneBuffer& buffer)
+		{
+			const uint32 threadIndex = buffer.threadIndex();
+
+			if (not m_threadNames.contains(threadIndex))
+			{
+				const String threadName = ((buffer.threadID() == mainThreadID) ? U"Main thread"
+					: buffer.isWorkerThread() ? U"Worker thread {}"_fmt(threadIndex) : U"Thread {}"_fmt(threadIndex));
+				m_threadNames.emplace(threadIndex, threadName);
+			}
+
+			buffer.consume([&](const ProfilerZoneEvent& event)
+			{
+				addZoneSample(event.name, (event.endNanosec - event.beginNanosec));
+				traceEvents.push_back({ event.name, threadIndex, event.beginNanosec, event.endNanosec });
+			});
+
+			droppedCount += buffer.takeDroppedCount();
+		});
+
+		if (droppedCount)
+		{
+			LOG_WARNING(U"ProfilerZone: {} events were dropped because the buffer was full"_fmt(droppedCount));
+		}
+
+		// 前のフレームの終わりからこのフレームの終わりまでを 1 フレームとして記録する
+		if (enabled && m_zoneProfilingActive)
+		{
+			addZoneSample(detail::FrameZoneName, (frameEndNanosec - m_frameEndNanosec));
+			traceEvents.push_back({ detail::FrameZoneName, ProfilerZoneRegistry::GetThreadBuffer().threadIndex(), m_frameEndNanosec, frameEndNanosec });
+		}
+
+		for (const size_t zoneIndex : m_currentZones)
+		{
+			ZoneHistory& zone = m_zones[zoneIndex];
+
+			zone.samples.push_back({ m_frameIndex, zone.currentTotalNanosec, zone.currentCalls });
+			zone.currentTotalNanosec = 0;
+			zone.currentCalls = 0;
+
+			while (zone.samples.size() > ZoneStatFrameCount)
+			{
+				zone.samples.pop_front();
+			}
+		}
+
+		m_currentZones.clear();
+
+		m_traceFrames.push_back(std::move(traceEvents));
+
+		while (m_traceFrames.size() > TraceFrameCount)
+		{
+			m_traceFrames.pop_front();
+		}
+
+		++m_frameIndex;
+		m_frameEndNanosec = frameEndNanosec;
+		m_zoneProfilingActive = enabled;
+	}
+
+	void CProfiler::addZoneSample(const char32* name, const uint64 durationNanosec)
+	{
+		size_t zoneIndex;
+
+		if (auto it = m_zoneIndicesByPointer.find(name);
+			it != m_zoneIndicesByPointer.end())
+		{
+			zoneIndex = it->second;
+		}
+		else
+		{
+			// 同じ名前の文字列が異なるアドレスにある場合は、同じゾーンとして扱う
+			String zoneName{ name };
+
+			if (auto it2 = m_zoneIndicesByName.find(zoneName);
+				it2 != m_zoneIndicesByName.end())
+			{
+				zoneIndex = it2->second;
+			}
+			else
+			{
+				zoneIndex = m_zones.size();
+
+				ZoneHistory zone;
+				zone.name = zoneName;
+				m_zones << std::move(zone);
+				m_zoneIndicesByName.emplace(std::move(zoneName), zoneIndex);
+			}
+
+			m_zoneIndicesByPointer.emplace(name, zoneIndex);
+		}
+
+		ZoneHistory& zone = m_zones[zoneIndex];
+
+		if (zone.currentCalls == 0)
+		{
+			m_currentZones << zoneIndex;
+		}
+
+		zone.currentTotalNanosec += durationNanosec;
+		++zone.currentCalls;
+	}
 }
@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # pragma once
+# include <deque>
+# include <Siv3D/HashTable.hpp>
 # include "IProfiler.hpp"
 
 namespace s3d
@@ -30,8 +32,53 @@ namespace s3d
 
 		const ProfilerStat& getStat() const override;
 
+		Array<ProfilerZoneStat> getZoneStats() const override;
+
+		bool exportChromeTrace(FilePathView path) const override;
+
+		void clearZoneHistory() override;
+
+		const Renderer2DStat& getRenderer2DStat() const override;
+
 	private:
 
+		/// @brief 統計の計算に使う直近のフレーム数
+		static constexpr uint64 ZoneStatFrameCount = 120;
+
+		/// @brief Chrome trace として保存する直近のフレーム数
+		static constexpr size_t TraceFrameCount = 300;
+
+		struct ZoneSample
+		{
+			uint64 frameIndex = 0;
+
+			uint64 totalNanosec = 0;
+
+			uint32 calls = 0;
+		};
+
+		struct ZoneHistory
+		{
+			String name;
+
+			std::deque<ZoneSample> samples;
+
+			uint64 currentTotalNanosec = 0;
+
+			uint32 currentCalls = 0;
+		};
+
+		struct TraceEvent
+		{
+			const char32* name = nullptr;
+
+			uint32 threadIndex = 0;
+
+			uint64 beginNanosec = 0;
+
+			uint64 endNanosec = 0;
+		};
+
 		//
 		//	FPS
 		//
@@ -45,5 +92,32 @@ namespace s3d
 		//	Stat
 		//
 		ProfilerStat m_stat;
+
+		Renderer2DStat m_renderer2DStat;
+
+		//
+		//	Zone
+		//
+		bool m_zoneProfilingActive = false;
+
+		uint64 m_frameIndex = 0;
+
+		uint64 m_frameEndNanosec = 0;
+
+		HashTable<const char32*, size_t> m_zoneIndicesByPointer;
+
+		HashTable<String, size_t> m_zoneIndicesByName;
+
+		Array<ZoneHistory> m_zones;
+
+		Array<size_t> m_currentZones;
+
+		std::deque<Array<TraceEvent>> m_traceFrames;
+
+		HashTable<uint32, String> m_threadNames;
+
+		void updateZones();
+
+		void addZoneSample(const char32* name, uint64 durationNanosec);
 	};
 }
@@ -11,7 +11,10 @@
 
 # pragma once
 # include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/ProfilerStat.hpp>
+# include <Siv3D/ProfilerZoneStat.hpp>
+# include <Siv3D/Renderer2DStat.hpp>
 
 namespace s3d
 {
@@ -36,5 +39,13 @@ namespace s3d
 		virtual String getSimpleStatistics() const = 0;
 
 		virtual const ProfilerStat& getStat() const = 0;
+
+		virtual Array<ProfilerZoneStat> getZoneStats() const = 0;
+
+		virtual bool exportChromeTrace(FilePathView path) const = 0;
+
+		virtual void clearZoneHistory() = 0;
+
+		virtual const Renderer2DStat& getRenderer2DStat() const = 0;
 	};
 }
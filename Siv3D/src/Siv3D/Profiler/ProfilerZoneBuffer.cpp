@@ -0,0 +1,134 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <mutex>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Threading.hpp>
+# include "ProfilerZoneBuffer.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		struct ProfilerZoneBufferList
+		{
+			std::mutex mutex;
+
+			Array<std::shared_ptr<ProfilerZoneBuffer>> buffers;
+
+			uint32 nextThreadIndex = 0;
+		};
+
+		[[nodiscard]]
+		static ProfilerZoneBufferList& GetBufferList()
+		{
+			// スレッドの終了時に参照される可能性があるため、破棄しない
+			static ProfilerZoneBufferList* const list = new ProfilerZoneBufferList;
+			return *list;
+		}
+
+		[[nodiscard]]
+		static std::shared_ptr<ProfilerZoneBuffer> CreateThreadBuffer()
+		{
+			ProfilerZoneBufferList& list = GetBufferList();
+
+			std::lock_guard lock{ list.mutex };
+
+			auto buffer = std::make_shared<ProfilerZoneBuffer>(list.nextThreadIndex++, std::this_thread::get_id(), Threading::IsWorkerThread());
+
+			list.buffers << buffer;
+
+			return buffer;
+		}
+	}
+
+	ProfilerZoneBuffer::ProfilerZoneBuffer(const uint32 threadIndex, const std::thread::id threadID, const bool isWorkerThread)
+		: m_events{ std::make_unique<ProfilerZoneEvent[]>(Capacity) }
+		, m_threadIndex{ threadIndex }
+		, m_threadID{ threadID }
+		, m_isWorkerThread{ isWorkerThread } {}
+
+	void ProfilerZoneBuffer::push(const ProfilerZoneEvent& event) noexcept
+	{
+		const uint64 head = m_head.load(std::memory_order_relaxed);
+
+		if ((head - m_tail.load(std::memory_order_acquire)) >= Capacity)
+		{
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		m_events[head & (Capacity - 1)] = event;
+
+		m_head.store((head + 1), std::memory_order_release);
+	}
+
+	bool ProfilerZoneBuffer::isEmpty() const noexcept
+	{
+		return (m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_relaxed));
+	}
+
+	uint64 ProfilerZoneBuffer::takeDroppedCount() noexcept
+	{
+		return m_dropped.exchange(0, std::memory_order_relaxed);
+	}
+
+	uint32 ProfilerZoneBuffer::threadIndex() const noexcept
+	{
+		return m_threadIndex;
+	}
+
+	std::thread::id ProfilerZoneBuffer::threadID() const noexcept
+	{
+		return m_threadID;
+	}
+
+	bool ProfilerZoneBuffer::isWorkerThread() const noexcept
+	{
+		return m_isWorkerThread;
+	}
+
+	namespace ProfilerZoneRegistry
+	{
+		ProfilerZoneBuffer& GetThreadBuffer()
+		{
+			thread_local const std::shared_ptr<ProfilerZoneBuffer> buffer = detail::CreateThreadBuffer();
+			return *buffer;
+		}
+
+		void ForEachBuffer(void(*f)(ProfilerZoneBuffer&, void*), void* data)
+		{
+			detail::ProfilerZoneBufferList& list = detail::GetBufferList();
+
+			std::lock_guard lock{ list.mutex };
+
+			for (const auto& buffer : list.buffers)
+			{
+				f(*buffer, data);
+			}
+
+			// 終了したスレッドのバッファを解放する
+			list.buffers.remove_if([](const std::shared_ptr<ProfilerZoneBuffer>& buffer)
+				{
+					return ((buffer.use_count() == 1) && buffer->isEmpty());
+				});
+		}
+	}
+
+	namespace detail
+	{
+		void RecordProfilerZone(const char32* name, const uint64 beginNanosec, const uint64 endNanosec) noexcept
+		{
+			ProfilerZoneRegistry::GetThreadBuffer().push({ name, beginNanosec, endNanosec });
+		}
+	}
+}
@@ -0,0 +1,110 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <atomic>
+# include <memory>
+# include <thread>
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	struct ProfilerZoneEvent
+	{
+		const char32* name = nullptr;
+
+		uint64 beginNanosec = 0;
+
+		uint64 endNanosec = 0;
+	};
+
+	/// @brief 1 つのスレッドが書き込み、プロファイラーが読み出すロックフリーのリングバッファ
+	class ProfilerZoneBuffer
+	{
+	public:
+
+		static constexpr size_t Capacity = 8192;
+
+		ProfilerZoneBuffer(uint32 threadIndex, std::thread::id threadID, bool isWorkerThread);
+
+		/// @brief イベントを追加します。書き込むスレッドからのみ呼び出せます。
+		/// @param event イベント
+		/// @remark バッファが一杯の場合、イベントは破棄されます。
+		void push(const ProfilerZoneEvent& event) noexcept;
+
+		/// @brief 追加されたイベントをすべて取り出します。読み出すスレッドからのみ呼び出せます。
+		/// @param f 各イベントに対して呼ばれる関数
+		template <class Fty>
+		void consume(Fty f)
+		{
+			const uint64 tail = m_tail.load(std::memory_order_relaxed);
+			const uint64 head = m_head.load(std::memory_order_acquire);
+
+			for (uint64 i = tail; i < head; ++i)
+			{
+				f(m_events[i & (Capacity - 1)]);
+			}
+
+			m_tail.store(head, std::memory_order_release);
+		}
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		[[nodiscard]]
+		uint64 takeDroppedCount() noexcept;
+
+		[[nodiscard]]
+		uint32 threadIndex() const noexcept;
+
+		[[nodiscard]]
+		std::thread::id threadID() const noexcept;
+
+		[[nodiscard]]
+		bool isWorkerThread() const noexcept;
+
+	private:
+
+		std::unique_ptr<ProfilerZoneEvent[]> m_events;
+
+		alignas(64) std::atomic<uint64> m_head{ 0 };
+
+		alignas(64) std::atomic<uint64> m_tail{ 0 };
+
+		std::atomic<uint64> m_dropped{ 0 };
+
+		uint32 m_threadIndex = 0;
+
+		std::thread::id m_threadID;
+
+		bool m_isWorkerThread = false;
+	};
+
+	namespace ProfilerZoneRegistry
+	{
+		/// @brief 現在のスレッドのバッファを返します。初めて呼ばれたときにバッファを作成して登録します。
+		/// @return 現在のスレッドのバッファ
+		[[nodiscard]]
+		ProfilerZoneBuffer& GetThreadBuffer();
+
+		/// @brief 登録されているすべてのバッファに対して f を呼び出します。
+		/// @param f バッファを受け取る関数
+		/// @remark 終了したスレッドのバッファは、空になったあとに登録が解除されます。
+		void ForEachBuffer(void(*f)(ProfilerZoneBuffer&, void*), void* data);
+
+		template <class Fty>
+		void ForEachBuffer(Fty f)
+		{
+			ForEachBuffer([](ProfilerZoneBuffer& buffer, void* data) { (*static_cast<Fty*>(data))(buffer); }, &f);
+		}
+	}
+}
@@ -12,6 +12,7 @@
 # include <Siv3D/Profiler.hpp>
 # include <Siv3D/Profiler/IProfiler.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
+# include <Siv3D/Renderer2D/IRenderer2D.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 
 namespace s3d
@@ -32,5 +33,40 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(Profiler)->getStat();
 		}
+
+		void EnableZoneProfiling(const bool enabled) noexcept
+		{
+			detail::g_profilerZoneEnabled.store(enabled, std::memory_order_relaxed);
+		}
+
+		bool IsZoneProfilingEnabled() noexcept
+		{
+			return detail::g_profilerZoneEnabled.load(std::memory_order_relaxed);
+		}
+
+		Array<ProfilerZoneStat> GetZoneStats()
+		{
+			return SIV3D_ENGINE(Profiler)->getZoneStats();
+		}
+
+		bool ExportChromeTrace(const FilePathView path)
+		{
+			return SIV3D_ENGINE(Profiler)->exportChromeTrace(path);
+		}
+
+		void ClearZoneHistory()
+		{
+			SIV3D_ENGINE(Profiler)->clearZoneHistory();
+		}
+
+		const Renderer2DStat& GetRenderer2DStat()
+		{
+			return SIV3D_ENGINE(Profiler)->getRenderer2DStat();
+		}
+
+		bool CaptureRenderer2DFrame(const FilePathView path)
+		{
+			return SIV3D_ENGINE(Renderer2D)->captureNextFrame(path);
+		}
 	}
 }
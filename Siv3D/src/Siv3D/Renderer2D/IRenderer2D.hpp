@@ -29,20 +29,15 @@
 # include <Siv3D/RenderTexture.hpp>
 # include <Siv3D/ConstantBuffer.hpp>
 # include <Siv3D/Mat3x2.hpp>
-# include <Siv3D/Particle2D.hpp>
+# include <Siv3D/ParticleSystem2D/ParticleStorage2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
+# include <Siv3D/Renderer2DStat.hpp>
 
 namespace s3d
 {
 	struct FloatRect;
 	struct ColorF;
 
-	struct Renderer2DStat
-	{
-		uint32 drawCalls = 0;
-		uint32 triangleCount = 0;
-	};
-
 	class SIV3D_NOVTABLE ISiv3DRenderer2D
 	{
 	public:
@@ -57,6 +52,8 @@ namespace s3d
 
 		virtual const Renderer2DStat& getStat() const = 0;
 
+		virtual bool captureNextFrame(FilePathView) { return false; }
+
 		virtual void addLine(const LineStyle& style, const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2]) = 0;
 
 		virtual void addTriangle(const Float2(&points)[3], const Float4& color) = 0;
@@ -129,10 +126,16 @@ namespace s3d
 
 		virtual void addRoundRectShadow(const RoundRect& roundRect, float blur, const Float4& color, bool fill) = 0;
 
-		virtual void addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
+		virtual void addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
 			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) = 0;
 
+		virtual void addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color) = 0;
+
+		virtual void addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color) = 0;
+
+		virtual void addTexturedQuads(const Texture& texture, const Quad* quads, size_t count, const RectF* uvRects, const Float4& color) = 0;
+
 
 		virtual Float4 getColorMul() const = 0;
 
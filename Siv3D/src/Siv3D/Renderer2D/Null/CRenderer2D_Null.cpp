@@ -9,12 +9,60 @@
 //
 //-----------------------------------------------
 
+
 # include "CRenderer2D_Null.hpp"
 # include <Siv3D/Error.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerZone.hpp>
+# include <Siv3D/ScopeGuard.hpp>
+# include <Siv3D/TextWriter.hpp>
+# include <Siv3D/FormatFloat.hpp>
 
 namespace s3d
 {
+	namespace detail
+	{
+		// キャプチャした浮動小数点数の小数点以下の最大桁数
+		static constexpr int32 CaptureDecimalPlace = 6;
+
+		[[nodiscard]]
+		static String ToCaptureString(const float value)
+		{
+			return ToString(value, CaptureDecimalPlace);
+		}
+
+		[[nodiscard]]
+		static String ToCaptureString(const Float4& value)
+		{
+			return U"{} {} {} {}"_fmt(ToCaptureString(value.x), ToCaptureString(value.y), ToCaptureString(value.z), ToCaptureString(value.w));
+		}
+
+		[[nodiscard]]
+		static String ToCaptureString(const Rect& rect)
+		{
+			return U"{} {} {} {}"_fmt(rect.x, rect.y, rect.w, rect.h);
+		}
+
+		[[nodiscard]]
+		static String ToCaptureString(const SamplerState& state)
+		{
+			const auto value = state.asValue();
+			return U"{:08X}{:08X}{:08X}{:08X}{:08X}{:08X}"_fmt(value[0], value[1], value[2], value[3], value[4], value[5]);
+		}
+
+		template <class IDType>
+		[[nodiscard]]
+		static String ToCaptureString(const IDType& id)
+		{
+			if (id.isInvalid())
+			{
+				return U"none";
+			}
+
+			return Format(id.value());
+		}
+	}
+
 	CRenderer2D_Null::CRenderer2D_Null()
 	{
 		// do nothing
@@ -29,7 +77,16 @@ namespace s3d
 	{
 		LOG_SCOPED_TRACE(U"CRenderer2D_Null::init()");
 
-		m_emptyTexture = std::make_unique<Texture>();
+		m_standardVS = std::make_unique<NullStandardVS2D>();
+		m_standardPS = std::make_unique<NullStandardPS2D>();
+
+		// バッファ作成関数を作成
+		m_bufferCreator = [this](Vertex2D::IndexType vertexSize, Vertex2D::IndexType indexSize)
+		{
+			return m_batches.requestBuffer(vertexSize, indexSize, m_commandManager);
+		};
+
+		m_boxShadowTexture = std::make_unique<Texture>();
 	}
 
 	void CRenderer2D_Null::update()
@@ -42,353 +99,1469 @@ namespace s3d
 		return m_stat;
 	}
 
-	void CRenderer2D_Null::addLine(const LineStyle&, const Float2&, const Float2&, float, const Float4(&)[2])
+	bool CRenderer2D_Null::captureNextFrame(const FilePathView path)
 	{
-		// do nothing
+		if (not path)
+		{
+			return false;
+		}
+
+		m_capturePath = path;
+
+		return true;
 	}
 
-	void CRenderer2D_Null::addTriangle(const Float2(&)[3], const Float4&)
+	void CRenderer2D_Null::addLine(const LineStyle& style, const Float2& begin, const Float2& end, const float thickness, const Float4(&colors)[2])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildLine(style, m_bufferCreator, begin, end, thickness, colors, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				if (style.hasSquareDot())
+				{
+					m_commandManager.pushStandardPS(m_standardPS->square_dotID);
+				}
+				else if (style.hasRoundDot())
+				{
+					m_commandManager.pushStandardPS(m_standardPS->round_dotID);
+				}
+				else
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addTriangle(const Float2(&)[3], const Float4(&)[3])
+	void CRenderer2D_Null::addTriangle(const Float2(&points)[3], const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(m_bufferCreator, points, color))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRect(const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTriangle(const Float2(&points)[3], const Float4(&colors)[3])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(m_bufferCreator, points, colors))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRect(const FloatRect&, const Float4(&)[4])
+	void CRenderer2D_Null::addRect(const FloatRect& rect, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(m_bufferCreator, rect, color))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRectFrame(const FloatRect&, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRect(const FloatRect& rect, const Float4(&colors)[4])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(m_bufferCreator, rect, colors))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRectFrameTB(const FloatRect&, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRectFrame(const FloatRect& rect, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrame(m_bufferCreator, rect, thickness, innerColor, outerColor))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addCircle(const Float2&, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRectFrameTB(const FloatRect& rect, const float thickness, const Float4& topColor, const Float4& bottomColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrameTB(m_bufferCreator, rect, thickness, topColor, bottomColor))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addCircleFrame(const Float2&, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCircle(const Float2& center, const float r, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircle(m_bufferCreator, center, r, innerColor, outerColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addCirclePie(const Float2&, const float, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(m_bufferCreator, center, rInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addCircleArc(const LineStyle&, const Float2&, const float, const float, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCirclePie(const Float2& center, const float r, const float startAngle, const float angle, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCirclePie(m_bufferCreator, center, r, startAngle, angle, innerColor, outerColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addCircleSegment(const Float2&, const float, const float, const float, const Float4&)
+	void CRenderer2D_Null::addCircleArc(const LineStyle& style, const Float2& center, const float rInner, const float startAngle, const float angle, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleArc(m_bufferCreator, style, center, rInner, startAngle, angle, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addEllipse(const Float2&, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCircleSegment(const Float2& center, const float r, const float startAngle, const float angle, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleSegment(m_bufferCreator, center, r, startAngle, angle, color, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addEllipseFrame(const Float2&, const float, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addEllipse(const Float2& center, const float a, const float b, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipse(m_bufferCreator, center, a, b, innerColor, outerColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addQuad(const FloatQuad&, const Float4&)
+	void CRenderer2D_Null::addEllipseFrame(const Float2& center, const float aInner, const float bInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipseFrame(m_bufferCreator, center, aInner, bInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addQuad(const FloatQuad&, const Float4(&)[4])
+	void CRenderer2D_Null::addQuad(const FloatQuad& quad, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(m_bufferCreator, quad, color))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRect(const FloatRect&, const float, const float, const float, const Float4&)
+	void CRenderer2D_Null::addQuad(const FloatQuad& quad, const Float4(&colors)[4])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(m_bufferCreator, quad, colors))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRect(const FloatRect&, float, float, float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRoundRect(const FloatRect& rect, const float w, const float h, const float r, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, color, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRectFrame(const RoundRect&, const RoundRect&, const Float4&)
+	void CRenderer2D_Null::addRoundRect(const FloatRect& rect, const float w, const float h, const float r, const Float4& topColor, const Float4& bottomColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, topColor, bottomColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRectFrame(const RoundRect&, const RoundRect&, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRoundRectFrame(const RoundRect& outer, const RoundRect& inner, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(m_bufferCreator, m_buffer, outer, inner, color, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addLineString(const LineStyle&, const Vec2*, const size_t, const Optional<Float2>&, const float, const bool, const Float4&, const CloseRing)
+	void CRenderer2D_Null::addRoundRectFrame(const RoundRect& outer, const RoundRect& inner, const Float4& topColor, const Float4& bottomColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(m_bufferCreator, m_buffer, outer, inner, topColor, bottomColor, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addLineString(const Vec2*, const ColorF*, const size_t, const Optional<Float2>&, const float, const bool, const CloseRing)
+	void CRenderer2D_Null::addLineString(const LineStyle& style, const Vec2* points, const size_t size, const Optional<Float2>& offset, const float thickness, const bool inner, const Float4& color, const CloseRing closeRing)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildLineString(m_bufferCreator, m_buffer, style, points, size, offset, thickness, inner, color, closeRing, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addPolygon(const Array<Float2>&, const Array<TriangleIndex>&, const Optional<Float2>&, const Float4&)
+	void CRenderer2D_Null::addLineString(const Vec2* points, const ColorF* colors, size_t size, const Optional<Float2>& offset, const float thickness, const bool inner, const CloseRing closeRing)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildDefaultLineString(m_bufferCreator, points, colors, size, offset, thickness, inner, closeRing, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addPolygon(const Vertex2D*, const size_t, const TriangleIndex*, const size_t)
+	void CRenderer2D_Null::addPolygon(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Optional<Float2>& offset, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, indices, offset, color))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addPolygonTransformed(const Array<Float2>&, const Array<TriangleIndex>&, const float, const float, const Float2&, const Float4&)
+	void CRenderer2D_Null::addPolygon(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		// do nothing
+		for (size_t offset = 0; offset < num_triangles;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, (indices + offset), (num_triangles - offset));
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
 	}
 
-	void CRenderer2D_Null::addPolygonFrame(const Float2*, const size_t, const float, const Float4&)
+	void CRenderer2D_Null::addPolygonTransformed(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, float s, float c, const Float2& offset, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygonTransformed(m_bufferCreator, vertices, indices, s, c, offset, color))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addNullVertices(const uint32)
+	void CRenderer2D_Null::addPolygonFrame(const Float2* points, const size_t size, const float thickness, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygonFrame(m_bufferCreator, m_buffer, points, size, thickness, color, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addTextureRegion(const Texture&, const FloatRect&, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addNullVertices(const uint32 count)
 	{
-		// do nothing
+		if (not m_currentCustomPS)
+		{
+			m_commandManager.pushStandardPS(m_standardPS->shapeID);
+		}
+
+		m_commandManager.pushNullVertices(count);
 	}
 
-	void CRenderer2D_Null::addTextureRegion(const Texture&, const FloatRect&, const FloatRect&, const Float4(&)[4])
+	void CRenderer2D_Null::addTextureRegion(const Texture& texture, const FloatRect& rect, const FloatRect& uv, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTextureRegion(m_bufferCreator, rect, uv, color))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedCircle(const Texture&, const Circle&, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTextureRegion(const Texture& texture, const FloatRect& rect, const FloatRect& uv, const Float4(&colors)[4])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTextureRegion(m_bufferCreator, rect, uv, colors))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedQuad(const Texture&, const FloatQuad&, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTexturedCircle(const Texture& texture, const Circle& circle, const FloatRect& uv, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedCircle(m_bufferCreator, circle, uv, color, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedRoundRect(const Texture&, const FloatRect&, const float, const float, const float, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTexturedQuad(const Texture& texture, const FloatQuad& quad, const FloatRect& uv, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedQuad(m_bufferCreator, quad, uv, color))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedVertices(const Texture&, const Vertex2D*, const size_t, const TriangleIndex*, const size_t)
+	void CRenderer2D_Null::addTexturedRoundRect(const Texture& texture, const FloatRect& rect, const float w, const float h, const float r, const FloatRect& uvRect, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, uvRect, color, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRectShadow(const FloatRect&, const float, const Float4&, bool)
+	void CRenderer2D_Null::addTexturedVertices(const Texture& texture, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		// do nothing
+		for (size_t offset = 0; offset < num_triangles;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildTexturedVertices(m_bufferCreator, vertices, vertexCount, (indices + offset), (num_triangles - offset));
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
 	}
 
-	void CRenderer2D_Null::addCircleShadow(const Circle&, const float, const Float4&)
+	void CRenderer2D_Null::addRectShadow(const FloatRect& rect, const float blur, const Float4& color, const bool fill)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRectShadow(m_bufferCreator, rect, blur, color, fill))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, getBoxShadowTexture());
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRectShadow(const RoundRect&, const float, const Float4&, const bool)
+	void CRenderer2D_Null::addCircleShadow(const Circle& circle, const float blur, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleShadow(m_bufferCreator, circle, blur, color, getMaxScaling()))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, getBoxShadowTexture());
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedParticles(const Texture&, const Array<Particle2D>&,
-		ParticleSystem2DParameters::SizeOverLifeTimeFunc,
-		ParticleSystem2DParameters::ColorOverLifeTimeFunc)
+	void CRenderer2D_Null::addRoundRectShadow(const RoundRect& roundRect, const float blur, const Float4& color, const bool fill)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectShadow(m_bufferCreator, roundRect, blur, color, getMaxScaling(), fill))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, getBoxShadowTexture());
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
+	void CRenderer2D_Null::addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
+		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
+		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedParticles(m_bufferCreator, particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
 	}
 
+	void CRenderer2D_Null::addCircles(const Circle* circles, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		const float scale = getMaxScaling();
+
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildCircles(m_bufferCreator, (circles + offset), (count - offset), (colors ? (colors + offset) : nullptr), color, scale);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_Null::addRects(const RectF* rects, const size_t count, const ColorF* colors, const Float4& color)
+	{
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildRects(m_bufferCreator, (rects + offset), (count - offset), (colors ? (colors + offset) : nullptr), color);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->shapeID);
+			}
+
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
+
+	void CRenderer2D_Null::addTexturedQuads(const Texture& texture, const Quad* quads, const size_t count, const RectF* uvRects, const Float4& color)
+	{
+		for (size_t offset = 0; offset < count;)
+		{
+			const auto [indexCount, built] = Vertex2DBuilder::BuildTexturedQuads(m_bufferCreator, (quads + offset), (count - offset), (uvRects ? (uvRects + offset) : nullptr), color);
+
+			if (built == 0)
+			{
+				return;
+			}
+
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+			offset += built;
+		}
+	}
 
 	Float4 CRenderer2D_Null::getColorMul() const
 	{
-		return{ 1.0, 1.0, 1.0, 1.0 };
+		return m_commandManager.getCurrentColorMul();
 	}
 
 	Float4 CRenderer2D_Null::getColorAdd() const
 	{
-		return{ 0.0, 0.0, 0.0, 0.0 };
+		return m_commandManager.getCurrentColorAdd();
 	}
 
-	void CRenderer2D_Null::setColorMul(const Float4&)
+	void CRenderer2D_Null::setColorMul(const Float4& color)
 	{
-		// do nothing
+		m_commandManager.pushColorMul(color);
 	}
 
-	void CRenderer2D_Null::setColorAdd(const Float4&)
+	void CRenderer2D_Null::setColorAdd(const Float4& color)
 	{
-		// do nothing
+		m_commandManager.pushColorAdd(color);
 	}
 
 	BlendState CRenderer2D_Null::getBlendState() const
 	{
-		return BlendState::Default2D;
+		return m_commandManager.getCurrentBlendState();
 	}
 
 	RasterizerState CRenderer2D_Null::getRasterizerState() const
 	{
-		return RasterizerState::Default2D;
+		return m_commandManager.getCurrentRasterizerState();
 	}
 
-	SamplerState CRenderer2D_Null::getSamplerState(const ShaderStage, const uint32) const
+	SamplerState CRenderer2D_Null::getSamplerState(const ShaderStage shaderStage, const uint32 slot) const
 	{
-		return SamplerState::Default2D;
+		if (shaderStage == ShaderStage::Vertex)
+		{
+			return m_commandManager.getVSCurrentSamplerState(slot);
+		}
+		else
+		{
+			return m_commandManager.getPSCurrentSamplerState(slot);
+		}
 	}
 
-	void CRenderer2D_Null::setBlendState(const BlendState&)
+	void CRenderer2D_Null::setBlendState(const BlendState& state)
 	{
-		// do nothing
+		m_commandManager.pushBlendState(state);
 	}
 
-	void CRenderer2D_Null::setRasterizerState(const RasterizerState&)
+	void CRenderer2D_Null::setRasterizerState(const RasterizerState& state)
 	{
-		// do nothing
+		m_commandManager.pushRasterizerState(state);
 	}
 
-	void CRenderer2D_Null::setSamplerState(const ShaderStage, const uint32, const SamplerState&)
+	void CRenderer2D_Null::setSamplerState(const ShaderStage shaderStage, const uint32 slot, const SamplerState& state)
 	{
-		// do nothing
+		if (shaderStage == ShaderStage::Vertex)
+		{
+			m_commandManager.pushVSSamplerState(state, slot);
+		}
+		else
+		{
+			m_commandManager.pushPSSamplerState(state, slot);
+		}
 	}
 
-	void CRenderer2D_Null::setScissorRect(const Rect&)
+	void CRenderer2D_Null::setScissorRect(const Rect& rect)
 	{
-		// do nothing
+		m_commandManager.pushScissorRect(rect);
 	}
 
 	Rect CRenderer2D_Null::getScissorRect() const
 	{
-		return Rect::Empty();
+		return m_commandManager.getCurrentScissorRect();
 	}
 
-	void CRenderer2D_Null::setViewport(const Optional<Rect>&)
+	void CRenderer2D_Null::setViewport(const Optional<Rect>& viewport)
 	{
-		// do nothing
+		m_commandManager.pushViewport(viewport);
 	}
 
 	Optional<Rect> CRenderer2D_Null::getViewport() const
 	{
-		return none;
+		return m_commandManager.getCurrentViewport();
 	}
 
-	void CRenderer2D_Null::setSDFParameters(const std::array<Float4, 3>&)
+	void CRenderer2D_Null::setSDFParameters(const std::array<Float4, 3>& params)
 	{
-		// do nothing
+		m_commandManager.pushSDFParameters(params);
 	}
 
-	void CRenderer2D_Null::setInternalPSConstants(const Float4&)
+	void CRenderer2D_Null::setInternalPSConstants(const Float4& value)
 	{
-		// do nothing
+		m_commandManager.pushInternalPSConstants(value);
 	}
 
 	Optional<VertexShader> CRenderer2D_Null::getCustomVS() const
 	{
-		return none;
+		return m_currentCustomVS;
 	}
 
 	Optional<PixelShader> CRenderer2D_Null::getCustomPS() const
 	{
-		return none;
+		return m_currentCustomPS;
 	}
 
-	void CRenderer2D_Null::setCustomVS(const Optional<VertexShader>&)
+	void CRenderer2D_Null::setCustomVS(const Optional<VertexShader>& vs)
 	{
-		// do nothing
+		if (vs && (not vs->isEmpty()))
+		{
+			m_currentCustomVS = *vs;
+			m_commandManager.pushCustomVS(*vs);
+		}
+		else
+		{
+			m_currentCustomVS.reset();
+		}
 	}
 
-	void CRenderer2D_Null::setCustomPS(const Optional<PixelShader>&)
+	void CRenderer2D_Null::setCustomPS(const Optional<PixelShader>& ps)
 	{
-		// do nothing
+		if (ps && (not ps->isEmpty()))
+		{
+			m_currentCustomPS = *ps;
+			m_commandManager.pushCustomPS(*ps);
+		}
+		else
+		{
+			m_currentCustomPS.reset();
+		}
 	}
 
 	const Mat3x2& CRenderer2D_Null::getLocalTransform() const
 	{
-		static constexpr Mat3x2 m = Mat3x2::Identity();
-		return m;
+		return m_commandManager.getCurrentLocalTransform();
 	}
 
 	const Mat3x2& CRenderer2D_Null::getCameraTransform() const
 	{
-		static constexpr Mat3x2 m = Mat3x2::Identity();
-		return m;
+		return m_commandManager.getCurrentCameraTransform();
 	}
 
-	void CRenderer2D_Null::setLocalTransform(const Mat3x2&)
+	void CRenderer2D_Null::setLocalTransform(const Mat3x2& matrix)
 	{
-		// do nothing
+		m_commandManager.pushLocalTransform(matrix);
 	}
 
-	void CRenderer2D_Null::setCameraTransform(const Mat3x2&)
+	void CRenderer2D_Null::setCameraTransform(const Mat3x2& matrix)
 	{
-		// do nothing
+		m_commandManager.pushCameraTransform(matrix);
 	}
 
 	float CRenderer2D_Null::getMaxScaling() const noexcept
 	{
-		return 1.0f;
+		return m_commandManager.getCurrentMaxScaling();
 	}
 
-	void CRenderer2D_Null::setVSTexture(uint32, const Optional<Texture>&)
+	void CRenderer2D_Null::setVSTexture(const uint32 slot, const Optional<Texture>& texture)
 	{
-		// do nothing
+		if (texture)
+		{
+			m_commandManager.pushVSTexture(slot, *texture);
+		}
+		else
+		{
+			m_commandManager.pushVSTextureUnbind(slot);
+		}
 	}
 
-	void CRenderer2D_Null::setPSTexture(uint32, const Optional<Texture>&)
+	void CRenderer2D_Null::setPSTexture(const uint32 slot, const Optional<Texture>& texture)
 	{
-		// do nothing
+		if (texture)
+		{
+			m_commandManager.pushPSTexture(slot, *texture);
+		}
+		else
+		{
+			m_commandManager.pushPSTextureUnbind(slot);
+		}
 	}
 
-	void CRenderer2D_Null::setRenderTarget(const Optional<RenderTexture>&)
+	void CRenderer2D_Null::setRenderTarget(const Optional<RenderTexture>& rt)
 	{
+		if (rt)
+		{
+			bool hasChanged = false;
+			const Texture::IDType textureID = rt->id();
+
+			// バインドされていたら解除
+			{
+				{
+					const auto& currentPSTextures = m_commandManager.getCurrentPSTextures();
+
+					for (uint32 slot = 0; slot < currentPSTextures.size(); ++slot)
+					{
+						if (currentPSTextures[slot] == textureID)
+						{
+							m_commandManager.pushPSTextureUnbind(slot);
+							hasChanged = true;
+						}
+					}
+				}
 
+				{
+					const auto& currentVSTextures = m_commandManager.getCurrentVSTextures();
+
+					for (uint32 slot = 0; slot < currentVSTextures.size(); ++slot)
+					{
+						if (currentVSTextures[slot] == textureID)
+						{
+							m_commandManager.pushVSTextureUnbind(slot);
+							hasChanged = true;
+						}
+					}
+				}
+			}
+
+			if (hasChanged)
+			{
+				m_commandManager.flush();
+			}
+		}
+
+		m_commandManager.pushRT(rt);
 	}
 
 	Optional<RenderTexture> CRenderer2D_Null::getRenderTarget() const
 	{
-		return none;
+		return m_commandManager.getCurrentRT();
 	}
 
-	void CRenderer2D_Null::setConstantBuffer(ShaderStage, uint32, const ConstantBufferBase&, const float*, uint32)
+	void CRenderer2D_Null::setConstantBuffer(const ShaderStage stage, const uint32 slot, const ConstantBufferBase& buffer, const float* data, const uint32 num_vectors)
 	{
-		// do nothing
+		m_commandManager.pushConstantBuffer(stage, slot, buffer, data, num_vectors);
 	}
 
 	const Texture& CRenderer2D_Null::getBoxShadowTexture() const noexcept
 	{
-		return *m_emptyTexture;
+		return *m_boxShadowTexture;
 	}
 
 	void CRenderer2D_Null::flush()
 	{
-		// do nothing
+		const ProfilerZone profilerZone{ U"Renderer2D::flush" };
+
+		const bool capturing = (not m_capturePath.isEmpty());
+
+		ScopeGuard cleanUp = [this]()
+		{
+			m_batches.reset();
+			m_commandManager.reset();
+			m_currentCustomVS.reset();
+			m_currentCustomPS.reset();
+		};
+
+		m_commandManager.flush();
+
+		if (capturing)
+		{
+			m_captureText = U"# Siv3D Renderer2D capture (Null)\n";
+		}
+
+		const auto& commands = m_commandManager.getCommands();
+		Renderer2DStateChangeStat& stateChanges = m_stat.stateChanges;
+		BatchInfo2D batchInfo;
+
+		m_stat.commandCount += static_cast<uint32>(commands.size());
+
+		for (const auto& command : commands)
+		{
+			if (capturing)
+			{
+				captureCommand(command);
+			}
+
+			switch (command.type)
+			{
+			case NullRenderer2DCommandType::Null:
+			case NullRenderer2DCommandType::SetBuffers:
+				{
+					break;
+				}
+			case NullRenderer2DCommandType::UpdateBuffers:
+				{
+					batchInfo = m_batches.updateBuffers(command.index);
+
+					const auto [pVertex, vertexCount] = m_batches.getVertices(command.index);
+					++m_stat.batchCount;
+					m_stat.vertexCount += vertexCount;
+					m_stat.indexCount += batchInfo.indexCount;
+
+					if (capturing)
+					{
+						captureBatch(command.index);
+					}
+
+					break;
+				}
+			case NullRenderer2DCommandType::Draw:
+				{
+					const NullDrawCommand& draw = m_commandManager.getDraw(command.index);
+					const uint32 indexCount = draw.indexCount;
+					batchInfo.startIndexLocation += indexCount;
+
+					++m_stat.drawCalls;
+					m_stat.triangleCount += (indexCount / 3);
+					break;
+				}
+			case NullRenderer2DCommandType::DrawNull:
+				{
+					const uint32 draw = m_commandManager.getNullDraw(command.index);
+
+					++m_stat.drawCalls;
+					m_stat.triangleCount += (draw / 3);
+					break;
+				}
+			case NullRenderer2DCommandType::ColorMul:
+				{
+					++stateChanges.colorMul;
+					break;
+				}
+			case NullRenderer2DCommandType::ColorAdd:
+				{
+					++stateChanges.colorAdd;
+					break;
+				}
+			case NullRenderer2DCommandType::BlendState:
+				{
+					++stateChanges.blendState;
+					break;
+				}
+			case NullRenderer2DCommandType::RasterizerState:
+				{
+					++stateChanges.rasterizerState;
+					break;
+				}
+			case NullRenderer2DCommandType::VSSamplerState0:
+			case NullRenderer2DCommandType::VSSamplerState1:
+			case NullRenderer2DCommandType::VSSamplerState2:
+			case NullRenderer2DCommandType::VSSamplerState3:
+			case NullRenderer2DCommandType::VSSamplerState4:
+			case NullRenderer2DCommandType::VSSamplerState5:
+			case NullRenderer2DCommandType::VSSamplerState6:
+			case NullRenderer2DCommandType::VSSamplerState7:
+			case NullRenderer2DCommandType::PSSamplerState0:
+			case NullRenderer2DCommandType::PSSamplerState1:
+			case NullRenderer2DCommandType::PSSamplerState2:
+			case NullRenderer2DCommandType::PSSamplerState3:
+			case NullRenderer2DCommandType::PSSamplerState4:
+			case NullRenderer2DCommandType::PSSamplerState5:
+			case NullRenderer2DCommandType::PSSamplerState6:
+			case NullRenderer2DCommandType::PSSamplerState7:
+				{
+					++stateChanges.samplerState;
+					break;
+				}
+			case NullRenderer2DCommandType::ScissorRect:
+				{
+					++stateChanges.scissorRect;
+					break;
+				}
+			case NullRenderer2DCommandType::Viewport:
+				{
+					++stateChanges.viewport;
+					break;
+				}
+			case NullRenderer2DCommandType::SDFParams:
+				{
+					++stateChanges.sdfParams;
+					break;
+				}
+			case NullRenderer2DCommandType::InternalPSConstants:
+				{
+					++stateChanges.internalPSConstants;
+					break;
+				}
+			case NullRenderer2DCommandType::SetRT:
+				{
+					++stateChanges.renderTarget;
+					break;
+				}
+			case NullRenderer2DCommandType::SetVS:
+				{
+					++stateChanges.vertexShader;
+					break;
+				}
+			case NullRenderer2DCommandType::SetPS:
+				{
+					++stateChanges.pixelShader;
+					break;
+				}
+			case NullRenderer2DCommandType::Transform:
+				{
+					++stateChanges.transform;
+					break;
+				}
+			case NullRenderer2DCommandType::SetConstantBuffer:
+				{
+					++stateChanges.constantBuffer;
+					break;
+				}
+			case NullRenderer2DCommandType::VSTexture0:
+			case NullRenderer2DCommandType::VSTexture1:
+			case NullRenderer2DCommandType::VSTexture2:
+			case NullRenderer2DCommandType::VSTexture3:
+			case NullRenderer2DCommandType::VSTexture4:
+			case NullRenderer2DCommandType::VSTexture5:
+			case NullRenderer2DCommandType::VSTexture6:
+			case NullRenderer2DCommandType::VSTexture7:
+			case NullRenderer2DCommandType::PSTexture0:
+			case NullRenderer2DCommandType::PSTexture1:
+			case NullRenderer2DCommandType::PSTexture2:
+			case NullRenderer2DCommandType::PSTexture3:
+			case NullRenderer2DCommandType::PSTexture4:
+			case NullRenderer2DCommandType::PSTexture5:
+			case NullRenderer2DCommandType::PSTexture6:
+			case NullRenderer2DCommandType::PSTexture7:
+				{
+					++stateChanges.texture;
+					break;
+				}
+			}
+		}
+
+		if (capturing)
+		{
+			writeCapture();
+		}
+	}
+
+	void CRenderer2D_Null::captureCommand(const NullRenderer2DCommand& command)
+	{
+		const uint32 index = command.index;
+		String& out = m_captureText;
+
+		switch (command.type)
+		{
+		case NullRenderer2DCommandType::Null:
+			{
+				out += U"Null\n";
+				break;
+			}
+		case NullRenderer2DCommandType::SetBuffers:
+			{
+				out += U"SetBuffers {}\n"_fmt(index);
+				break;
+			}
+		case NullRenderer2DCommandType::UpdateBuffers:
+			{
+				out += U"UpdateBuffers {}\n"_fmt(index);
+				break;
+			}
+		case NullRenderer2DCommandType::Draw:
+			{
+				out += U"Draw {}\n"_fmt(m_commandManager.getDraw(index).indexCount);
+				break;
+			}
+		case NullRenderer2DCommandType::DrawNull:
+			{
+				out += U"DrawNull {}\n"_fmt(m_commandManager.getNullDraw(index));
+				break;
+			}
+		case NullRenderer2DCommandType::ColorMul:
+			{
+				out += U"ColorMul {}\n"_fmt(detail::ToCaptureString(m_commandManager.getColorMul(index)));
+				break;
+			}
+		case NullRenderer2DCommandType::ColorAdd:
+			{
+				out += U"ColorAdd {}\n"_fmt(detail::ToCaptureString(m_commandManager.getColorAdd(index)));
+				break;
+			}
+		case NullRenderer2DCommandType::BlendState:
+			{
+				out += U"BlendState {:08X}\n"_fmt(m_commandManager.getBlendState(index).asValue());
+				break;
+			}
+		case NullRenderer2DCommandType::RasterizerState:
+			{
+				out += U"RasterizerState {:016X}\n"_fmt(m_commandManager.getRasterizerState(index).asValue());
+				break;
+			}
+		case NullRenderer2DCommandType::VSSamplerState0:
+		case NullRenderer2DCommandType::VSSamplerState1:
+		case NullRenderer2DCommandType::VSSamplerState2:
+		case NullRenderer2DCommandType::VSSamplerState3:
+		case NullRenderer2DCommandType::VSSamplerState4:
+		case NullRenderer2DCommandType::VSSamplerState5:
+		case NullRenderer2DCommandType::VSSamplerState6:
+		case NullRenderer2DCommandType::VSSamplerState7:
+			{
+				const uint32 slot = (FromEnum(command.type) - FromEnum(NullRenderer2DCommandType::VSSamplerState0));
+				out += U"VSSamplerState {} {}\n"_fmt(slot, detail::ToCaptureString(m_commandManager.getVSSamplerState(slot, index)));
+				break;
+			}
+		case NullRenderer2DCommandType::PSSamplerState0:
+		case NullRenderer2DCommandType::PSSamplerState1:
+		case NullRenderer2DCommandType::PSSamplerState2:
+		case NullRenderer2DCommandType::PSSamplerState3:
+		case NullRenderer2DCommandType::PSSamplerState4:
+		case NullRenderer2DCommandType::PSSamplerState5:
+		case NullRenderer2DCommandType::PSSamplerState6:
+		case NullRenderer2DCommandType::PSSamplerState7:
+			{
+				const uint32 slot = (FromEnum(command.type) - FromEnum(NullRenderer2DCommandType::PSSamplerState0));
+				out += U"PSSamplerState {} {}\n"_fmt(slot, detail::ToCaptureString(m_commandManager.getPSSamplerState(slot, index)));
+				break;
+			}
+		case NullRenderer2DCommandType::ScissorRect:
+			{
+				out += U"ScissorRect {}\n"_fmt(detail::ToCaptureString(m_commandManager.getScissorRect(index)));
+				break;
+			}
+		case NullRenderer2DCommandType::Viewport:
+			{
+				if (const auto& viewport = m_commandManager.getViewport(index))
+				{
+					out += U"Viewport {}\n"_fmt(detail::ToCaptureString(*viewport));
+				}
+				else
+				{
+					out += U"Viewport none\n";
+				}
+				break;
+			}
+		case NullRenderer2DCommandType::SDFParams:
+			{
+				const auto& sdfParams = m_commandManager.getSDFParameters(index);
+				out += U"SDFParams {} {} {}\n"_fmt(detail::ToCaptureString(sdfParams[0]), detail::ToCaptureString(sdfParams[1]), detail::ToCaptureString(sdfParams[2]));
+				break;
+			}
+		case NullRenderer2DCommandType::InternalPSConstants:
+			{
+				out += U"InternalPSConstants {}\n"_fmt(detail::ToCaptureString(m_commandManager.getInternalPSConstants(index)));
+				break;
+			}
+		case NullRenderer2DCommandType::SetRT:
+			{
+				if (const auto& rt = m_commandManager.getRT(index))
+				{
+					out += U"SetRT {}\n"_fmt(rt->id().value());
+				}
+				else
+				{
+					out += U"SetRT none\n";
+				}
+				break;
+			}
+		case NullRenderer2DCommandType::SetVS:
+			{
+				const auto& vsID = m_commandManager.getVS(index);
+				out += U"SetVS {}\n"_fmt((vsID == m_standardVS->spriteID) ? U"sprite"_s : detail::ToCaptureString(vsID));
+				break;
+			}
+		case NullRenderer2DCommandType::SetPS:
+			{
+				const auto& psID = m_commandManager.getPS(index);
+				String name;
+
+				if (psID == m_standardPS->shapeID)
+				{
+					name = U"shape";
+				}
+				else if (psID == m_standardPS->square_dotID)
+				{
+					name = U"square_dot";
+				}
+				else if (psID == m_standardPS->round_dotID)
+				{
+					name = U"round_dot";
+				}
+				else if (psID == m_standardPS->textureID)
+				{
+					name = U"texture";
+				}
+				else
+				{
+					name = detail::ToCaptureString(psID);
+				}
+
+				out += U"SetPS {}\n"_fmt(name);
+				break;
+			}
+		case NullRenderer2DCommandType::Transform:
+			{
+				const Mat3x2& m = m_commandManager.getCombinedTransform(index);
+				out += U"Transform {} {} {} {} {} {}\n"_fmt(detail::ToCaptureString(m._11), detail::ToCaptureString(m._12), detail::ToCaptureString(m._21), detail::ToCaptureString(m._22), detail::ToCaptureString(m._31), detail::ToCaptureString(m._32));
+				break;
+			}
+		case NullRenderer2DCommandType::SetConstantBuffer:
+			{
+				const auto& cb = m_commandManager.getConstantBuffer(index);
+				const float* p = reinterpret_cast<const float*>(m_commandManager.getConstantBufferPtr(cb.offset));
+				out += U"SetConstantBuffer {} {} {}"_fmt(FromEnum(cb.stage), cb.slot, cb.num_vectors);
+
+				for (uint32 i = 0; i < (cb.num_vectors * 4); ++i)
+				{
+					out += U' ';
+					out += detail::ToCaptureString(p[i]);
+				}
+
+				out += U'\n';
+				break;
+			}
+		case NullRenderer2DCommandType::VSTexture0:
+		case NullRenderer2DCommandType::VSTexture1:
+		case NullRenderer2DCommandType::VSTexture2:
+		case NullRenderer2DCommandType::VSTexture3:
+		case NullRenderer2DCommandType::VSTexture4:
+		case NullRenderer2DCommandType::VSTexture5:
+		case NullRenderer2DCommandType::VSTexture6:
+		case NullRenderer2DCommandType::VSTexture7:
+			{
+				const uint32 slot = (FromEnum(command.type) - FromEnum(NullRenderer2DCommandType::VSTexture0));
+				out += U"VSTexture {} {}\n"_fmt(slot, detail::ToCaptureString(m_commandManager.getVSTexture(slot, index)));
+				break;
+			}
+		case NullRenderer2DCommandType::PSTexture0:
+		case NullRenderer2DCommandType::PSTexture1:
+		case NullRenderer2DCommandType::PSTexture2:
+		case NullRenderer2DCommandType::PSTexture3:
+		case NullRenderer2DCommandType::PSTexture4:
+		case NullRenderer2DCommandType::PSTexture5:
+		case NullRenderer2DCommandType::PSTexture6:
+		case NullRenderer2DCommandType::PSTexture7:
+			{
+				const uint32 slot = (FromEnum(command.type) - FromEnum(NullRenderer2DCommandType::PSTexture0));
+				out += U"PSTexture {} {}\n"_fmt(slot, detail::ToCaptureString(m_commandManager.getPSTexture(slot, index)));
+				break;
+			}
+		}
+	}
+
+	void CRenderer2D_Null::captureBatch(const uint32 batchIndex)
+	{
+		String& out = m_captureText;
+
+		const auto [pVertex, vertexCount] = m_batches.getVertices(batchIndex);
+		const auto [pIndex, indexCount] = m_batches.getIndices(batchIndex);
+
+		out += U"Vertices {}\n"_fmt(vertexCount);
+
+		for (uint32 i = 0; i < vertexCount; ++i)
+		{
+			const Vertex2D& v = pVertex[i];
+			out += U"v {} {} {} {} {}\n"_fmt(detail::ToCaptureString(v.pos.x), detail::ToCaptureString(v.pos.y), detail::ToCaptureString(v.tex.x), detail::ToCaptureString(v.tex.y), detail::ToCaptureString(v.color));
+		}
+
+		out += U"Indices {}\n"_fmt(indexCount);
+
+		for (uint32 i = 0; i < indexCount; i += 3)
+		{
+			out += U"i {} {} {}\n"_fmt(pIndex[i], pIndex[i + 1], pIndex[i + 2]);
+		}
+	}
+
+	void CRenderer2D_Null::writeCapture()
+	{
+		ScopeGuard cleanUp = [this]()
+		{
+			m_capturePath.clear();
+			m_captureText.clear();
+			m_captureText.shrink_to_fit();
+		};
+
+		TextWriter writer{ m_capturePath, TextEncoding::UTF8_NO_BOM };
+
+		if (not writer)
+		{
+			LOG_FAIL(U"❌ CRenderer2D_Null::writeCapture(): Failed to open `{}`"_fmt(m_capturePath));
+			return;
+		}
+
+		writer.write(m_captureText);
+
+		LOG_INFO(U"ℹ️ Renderer2D frame captured to `{}`"_fmt(m_capturePath));
 	}
 }
@@ -11,12 +11,63 @@
 
 # pragma once
 # include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/VertexShader.hpp>
+# include <Siv3D/PixelShader.hpp>
 # include <Siv3D/Renderer2D/IRenderer2D.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include <Siv3D/Renderer2D/Renderer2DCommon.hpp>
+# include "NullRenderer2DCommand.hpp"
+# include "NullVertex2DBatch.hpp"
 
 namespace s3d
 {
+	// Null レンダラーにはシェーダが存在しないため、標準シェーダにはどのシェーダとも重複しない ID を割り当てる
+	struct NullStandardVS2D
+	{
+		VertexShader::IDType spriteID{ VertexShader::IDType::InvalidID - 1 };
+	};
+
+	struct NullStandardPS2D
+	{
+		PixelShader::IDType shapeID{ PixelShader::IDType::InvalidID - 1 };
+		PixelShader::IDType square_dotID{ PixelShader::IDType::InvalidID - 2 };
+		PixelShader::IDType round_dotID{ PixelShader::IDType::InvalidID - 3 };
+		PixelShader::IDType textureID{ PixelShader::IDType::InvalidID - 4 };
+	};
+
 	class CRenderer2D_Null final : public ISiv3DRenderer2D
 	{
+	private:
+
+		std::unique_ptr<NullStandardVS2D> m_standardVS;
+		std::unique_ptr<NullStandardPS2D> m_standardPS;
+
+		NullVertex2DBatch m_batches;
+		NullRenderer2DCommandManager m_commandManager;
+		BufferCreatorFunc m_bufferCreator;
+
+		Optional<VertexShader> m_currentCustomVS;
+		Optional<PixelShader> m_currentCustomPS;
+
+		std::unique_ptr<Texture> m_boxShadowTexture;
+
+		// VertexBuilder でのメモリアロケーションを避けるためのバッファ
+		Array<Float2> m_buffer;
+
+		Renderer2DStat m_stat;
+
+		// 次の flush() でコマンド列を保存するファイルのパス
+		FilePath m_capturePath;
+
+		String m_captureText;
+
+		void captureCommand(const NullRenderer2DCommand& command);
+
+		void captureBatch(uint32 batchIndex);
+
+		void writeCapture();
+
 	public:
 
 		CRenderer2D_Null();
@@ -29,6 +80,8 @@ namespace s3d
 
 		const Renderer2DStat& getStat() const override;
 
+		bool captureNextFrame(FilePathView path) override;
+
 		void addLine(const LineStyle& style, const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2]) override;
 
 		void addTriangle(const Float2(&points)[3], const Float4& color) override;
@@ -101,10 +154,16 @@ namespace s3d
 
 		void addRoundRectShadow(const RoundRect& roundRect, float blur, const Float4& color, bool fill) override;
 
-		void addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
+		void addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
 			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) override;
 
+		void addCircles(const Circle* circles, size_t count, const ColorF* colors, const Float4& color) override;
+
+		void addRects(const RectF* rects, size_t count, const ColorF* colors, const Float4& color) override;
+
+		void addTexturedQuads(const Texture& texture, const Quad* quads, size_t count, const RectF* uvRects, const Float4& color) override;
+
 
 		Float4 getColorMul() const override;
 
@@ -177,11 +236,5 @@ namespace s3d
 
 
 		void flush() override;
-
-	private:
-
-		std::unique_ptr<Texture> m_emptyTexture;
-
-		Renderer2DStat m_stat;
 	};
 }
@@ -0,0 +1,193 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/Common.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "NullVertex2DBatch.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static size_t CalculateNewArraySize(const size_t current, const size_t target) noexcept
+		{
+			size_t newArraySize = current * 2;
+
+			while (newArraySize < target)
+			{
+				newArraySize *= 2;
+			}
+
+			return newArraySize;
+		}
+
+		static void WidenIndices(uint32* pDst, const Vertex2D::IndexType* pSrc, const uint32 size, const uint32 baseVertex) noexcept
+		{
+			for (uint32 i = 0; i < size; ++i)
+			{
+				pDst[i] = (baseVertex + pSrc[i]);
+			}
+		}
+	}
+
+	NullVertex2DBatch::NullVertex2DBatch()
+		: m_vertexArray(InitialVertexArraySize)
+		, m_indexArray(InitialIndexArraySize)
+		, m_indexArray32(InitialIndexArraySize)
+		, m_batches(1)
+	{
+
+	}
+
+	Vertex2DBufferPointer NullVertex2DBatch::requestBuffer(const uint16 vertexSize, const uint32 indexSize, NullRenderer2DCommandManager& commandManager)
+	{
+		commitPendingIndices();
+
+		// VB
+		if (const uint32 vertexArrayWritePosTarget = m_vertexArrayWritePos + vertexSize;
+			m_vertexArray.size() < vertexArrayWritePosTarget) SIV3D_UNLIKELY
+		{
+			if (MaxVertexArraySize < vertexArrayWritePosTarget) SIV3D_UNLIKELY
+			{
+				return{ nullptr, 0, 0 };
+			}
+
+			const size_t newVertexArraySize = detail::CalculateNewArraySize(m_vertexArray.size(), vertexArrayWritePosTarget);
+			LOG_TRACE(U"ℹ️ Resized NullVertex2DBatch::m_vertexArray (size: {} -> {})"_fmt(m_vertexArray.size(), newVertexArraySize));
+			m_vertexArray.resize(newVertexArraySize);
+		}
+
+		// IB
+		if (const uint32 indexArrayWritePosTarget = m_indexArrayWritePos + indexSize;
+			m_indexArray.size() < indexArrayWritePosTarget) SIV3D_UNLIKELY
+		{
+			if (MaxIndexArraySize < indexArrayWritePosTarget) SIV3D_UNLIKELY
+			{
+				return{ nullptr, 0, 0 };
+			}
+
+			const size_t newIndexArraySize = detail::CalculateNewArraySize(m_indexArray.size(), indexArrayWritePosTarget);
+			LOG_TRACE(U"ℹ️ Resized NullVertex2DBatch::m_indexArray (size: {} -> {})"_fmt(m_indexArray.size(), newIndexArraySize));
+			m_indexArray.resize(newIndexArraySize);
+			m_indexArray32.resize(newIndexArraySize);
+		}
+
+		if (const auto& lastbatch = m_batches.back();
+			(VertexBufferSize < (lastbatch.vertexPos + vertexSize) || IndexBufferSize < (lastbatch.indexPos + indexSize)))
+		{
+			commandManager.pushUpdateBuffers(static_cast<uint32>(m_batches.size()));
+			m_batches.push_back({ m_vertexArrayWritePos, m_indexArrayWritePos });
+		}
+
+		auto& lastbatch = m_batches.back();
+		Vertex2D* const pVertex = (m_vertexArray.data() + m_vertexArrayWritePos);
+		Vertex2D::IndexType* const pIndex = (m_indexArray.data() + m_indexArrayWritePos);
+
+		// 16-bit のインデックスを書き込んでもらい、次の要求時に頂点の位置を加えて 32-bit に変換する
+		m_pendingIndices = { m_indexArrayWritePos, indexSize, lastbatch.vertexPos };
+
+		advanceArrayWritePos(vertexSize, indexSize);
+		lastbatch.advance(vertexSize, indexSize);
+
+		return{ pVertex, pIndex, 0 };
+	}
+
+	size_t NullVertex2DBatch::num_batches() const noexcept
+	{
+		return m_batches.size();
+	}
+
+	void NullVertex2DBatch::reset()
+	{
+		m_batches.clear();
+		m_batches.emplace_back();
+
+		m_vertexArrayWritePos = 0;
+		m_indexArrayWritePos = 0;
+		m_pendingIndices = {};
+	}
+
+	BatchInfo2D NullVertex2DBatch::updateBuffers(const size_t batchIndex)
+	{
+		assert(batchIndex < m_batches.size());
+
+		commitPendingIndices();
+
+		BatchInfo2D batchInfo;
+		const auto& currentBatch = m_batches[batchIndex];
+
+		// VB
+		if (const uint32 vertexSize = currentBatch.vertexPos)
+		{
+			if ((VertexBufferSize * RingSectionCount) < (m_vertexBufferWritePos + vertexSize))
+			{
+				m_vertexBufferWritePos = 0;
+			}
+
+			batchInfo.baseVertexLocation = m_vertexBufferWritePos;
+			m_vertexBufferWritePos += vertexSize;
+		}
+
+		// IB
+		if (const uint32 indexSize = currentBatch.indexPos)
+		{
+			if ((IndexBufferSize * RingSectionCount) < (m_indexBufferWritePos + indexSize))
+			{
+				m_indexBufferWritePos = 0;
+			}
+
+			batchInfo.indexCount = indexSize;
+			batchInfo.startIndexLocation = m_indexBufferWritePos;
+			m_indexBufferWritePos += indexSize;
+		}
+
+		return batchInfo;
+	}
+
+	std::pair<const Vertex2D*, uint32> NullVertex2DBatch::getVertices(const size_t batchIndex) const
+	{
+		assert(batchIndex < m_batches.size());
+
+		const auto& batch = m_batches[batchIndex];
+
+		return{ (m_vertexArray.data() + batch.vertexArrayPos), batch.vertexPos };
+	}
+
+	std::pair<const uint32*, uint32> NullVertex2DBatch::getIndices(const size_t batchIndex)
+	{
+		assert(batchIndex < m_batches.size());
+
+		commitPendingIndices();
+
+		const auto& batch = m_batches[batchIndex];
+
+		return{ (m_indexArray32.data() + batch.indexArrayPos), batch.indexPos };
+	}
+
+	void NullVertex2DBatch::advanceArrayWritePos(const uint32 vertexSize, const uint32 indexSize) noexcept
+	{
+		m_vertexArrayWritePos	+= vertexSize;
+		m_indexArrayWritePos	+= indexSize;
+	}
+
+	void NullVertex2DBatch::commitPendingIndices()
+	{
+		if (const auto& pending = m_pendingIndices;
+			pending.indexSize)
+		{
+			detail::WidenIndices((m_indexArray32.data() + pending.indexArrayPos),
+				(m_indexArray.data() + pending.indexArrayPos), pending.indexSize, pending.baseVertex);
+		}
+
+		m_pendingIndices = {};
+	}
+}
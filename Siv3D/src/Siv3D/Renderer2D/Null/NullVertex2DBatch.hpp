@@ -0,0 +1,117 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBufferPointer.hpp>
+# include <Siv3D/Renderer2D/Renderer2DCommon.hpp>
+# include "NullRenderer2DCommand.hpp"
+
+namespace s3d
+{
+	/// @brief 32-bit インデックスモードの GL4Vertex2DBatch と同じ規則で頂点・インデックスをバッチに分割する、GPU を使わない実装
+	class NullVertex2DBatch
+	{
+	private:
+
+		struct BatchBufferPos
+		{
+			/// @brief バッチの先頭の頂点の m_vertexArray 上の位置
+			uint32 vertexArrayPos = 0;
+
+			/// @brief バッチの先頭のインデックスの m_indexArray 上の位置
+			uint32 indexArrayPos = 0;
+
+			uint32 vertexPos = 0;
+
+			uint32 indexPos = 0;
+
+			void advance(uint32 vertexSize, uint32 indexSize) noexcept
+			{
+				vertexPos += vertexSize;
+				indexPos += indexSize;
+			}
+		};
+
+		uint32 m_vertexBufferWritePos = 0;
+
+		uint32 m_indexBufferWritePos = 0;
+
+		Array<Vertex2D> m_vertexArray;
+		uint32 m_vertexArrayWritePos = 0;
+
+		Array<Vertex2D::IndexType> m_indexArray;
+		uint32 m_indexArrayWritePos = 0;
+
+		/// @brief m_indexArray を頂点の位置を加えて 32-bit に変換したもの
+		Array<uint32> m_indexArray32;
+
+		/// @brief まだ m_indexArray32 に変換していないインデックスの範囲と、加える頂点の位置
+		struct PendingIndices
+		{
+			uint32 indexArrayPos = 0;
+
+			uint32 indexSize = 0;
+
+			uint32 baseVertex = 0;
+		} m_pendingIndices;
+
+		Array<BatchBufferPos> m_batches;
+
+		static constexpr uint32 InitialVertexArraySize	= 4096;
+		static constexpr uint32 InitialIndexArraySize	= (4096 * 8); // 32,768
+
+		static constexpr uint32 MaxVertexArraySize		= (65536 * 64); // 4,194,304
+		static constexpr uint32 MaxIndexArraySize		= (65536 * 64); // 4,194,304
+
+		static constexpr uint32 VertexBufferSize		= (65536 * 4); // 262,144
+		static constexpr uint32 IndexBufferSize			= (VertexBufferSize * 4); // 1,048,576
+
+		static constexpr uint32 RingSectionCount		= 3;
+
+		void advanceArrayWritePos(uint32 vertexSize, uint32 indexSize) noexcept;
+
+		void commitPendingIndices();
+
+	public:
+
+		NullVertex2DBatch();
+
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer(uint16 vertexSize, uint32 indexSize, NullRenderer2DCommandManager& commandManager);
+
+		[[nodiscard]]
+		size_t num_batches() const noexcept;
+
+		void reset();
+
+		/// @brief バッチの頂点・インデックスを仮想的な頂点バッファ・インデックスバッファに書き込んだものとして、描画に必要な情報を返します。
+		/// @param batchIndex バッチのインデックス
+		/// @return 描画に必要な情報
+		[[nodiscard]]
+		BatchInfo2D updateBuffers(size_t batchIndex);
+
+		/// @brief バッチの頂点を返します。
+		/// @param batchIndex バッチのインデックス
+		/// @return バッチの頂点
+		[[nodiscard]]
+		std::pair<const Vertex2D*, uint32> getVertices(size_t batchIndex) const;
+
+		/// @brief バッチのインデックスを返します。
+		/// @param batchIndex バッチのインデックス
+		/// @return バッチのインデックス
+		[[nodiscard]]
+		std::pair<const uint32*, uint32> getIndices(size_t batchIndex);
+	};
+}
@@ -13,11 +13,28 @@
 # include <Siv3D/FastMath.hpp>
 # include <Siv3D/Math.hpp>
 # include <Siv3D/OffsetCircular.hpp>
+# include <Siv3D/SIMD_Float4.hpp>
+# include <Siv3D/Threading.hpp>
 
 namespace s3d
 {
 	namespace detail
 	{
+		inline void SIV3D_VECTOR_CALL StoreXY(Float2& dst, const SIMD_Float4 v) noexcept
+		{
+			DirectX::XMStoreFloat2(reinterpret_cast<DirectX::XMFLOAT2*>(&dst), v.vec);
+		}
+
+		inline void SIV3D_VECTOR_CALL StoreZW(Float2& dst, const SIMD_Float4 v) noexcept
+		{
+			DirectX::XMStoreFloat2(reinterpret_cast<DirectX::XMFLOAT2*>(&dst), DirectX::XMVectorSwizzle<2, 3, 2, 3>(v.vec));
+		}
+
+		inline void SIV3D_VECTOR_CALL StoreXYZW(Float4& dst, const SIMD_Float4 v) noexcept
+		{
+			DirectX::XMStoreFloat4(reinterpret_cast<DirectX::XMFLOAT4*>(&dst), v.vec);
+		}
+
 		static constexpr Vertex2D::IndexType RectIndexTable[6] = { 0, 1, 2, 2, 1, 3 };
 
 		static constexpr Vertex2D::IndexType RectFrameIndexTable[24] = { 0, 1, 2, 3, 2, 1, 0, 4, 1, 5, 1, 4, 5, 4, 7, 6, 7, 4, 3, 7, 2, 6, 2, 7 };
@@ -45,10 +62,344 @@ namespace s3d
 			return results;
 		}();
 
+		static constexpr Vertex2D::IndexType MaxCircleQuality = 255;
+
+		static constexpr size_t ExtendedSinCosTableSize = ((MaxCircleQuality - MaxSinCosTableQuality) * ((MaxSinCosTableQuality + 1) + MaxCircleQuality)) / 2;
+
+		// MaxSinCosTableQuality より大きい品質の円は使われる頻度が低いため、初めて必要になったときに作成する
 		[[nodiscard]]
-		inline const Float2* GetSinCosTableStartPtr(const uint16 quality) noexcept
+		inline const std::array<Float2, ExtendedSinCosTableSize>& GetExtendedSinCosTable()
 		{
-			return &CircleSinCosTable[((quality - 6) * (6 + (quality - 1))) / 2];
+			static const std::array<Float2, ExtendedSinCosTableSize> table = []()
+			{
+				std::array<Float2, ExtendedSinCosTableSize> results;
+				Float2* pDst = results.data();
+
+				for (int32 quality = (MaxSinCosTableQuality + 1); quality <= MaxCircleQuality; ++quality)
+				{
+					const float radDelta = Math::TwoPiF / quality;
+
+					for (Vertex2D::IndexType i = 0; i < quality; ++i)
+					{
+						const float rad = (radDelta * i);
+						(pDst++)->set(std::cos(rad), -std::sin(rad));
+					}
+				}
+
+				return results;
+			}();
+
+			return table;
+		}
+
+		/// @brief 品質 quality の円の単位円上の点 (cos, -sin) の配列の先頭を返します。
+		/// @param quality 円の品質（6 以上 MaxCircleQuality 以下）
+		/// @return 単位円上の点の配列の先頭
+		[[nodiscard]]
+		inline const Float2* GetSinCosTableStartPtr(const uint16 quality)
+		{
+			assert(InRange<uint16>(quality, 6, MaxCircleQuality));
+
+			if (quality <= MaxSinCosTableQuality)
+			{
+				return &CircleSinCosTable[((quality - 6) * (6 + (quality - 1))) / 2];
+			}
+			else
+			{
+				return &GetExtendedSinCosTable()[((quality - (MaxSinCosTableQuality + 1)) * ((MaxSinCosTableQuality + 1) + (quality - 1))) / 2];
+			}
+		}
+
+		static constexpr Vertex2D::IndexType MinFanQuality = 3;
+
+		static constexpr Vertex2D::IndexType MaxFanQuality = 64;
+
+		static constexpr size_t FanTableSize = ((MaxFanQuality - MinFanQuality + 1) * (MinFanQuality + MaxFanQuality)) / 2;
+
+		// 角丸長方形の角に使う 1/4 円の点 (sin, -cos) のテーブル
+		static const std::array<Float2, FanTableSize> FanSinCosTable = []()
+		{
+			std::array<Float2, FanTableSize> results;
+			Float2* pDst = results.data();
+
+			for (int32 quality = MinFanQuality; quality <= MaxFanQuality; ++quality)
+			{
+				const float radDelta = (Math::HalfPiF / (quality - 1));
+
+				for (int32 i = 0; i < quality; ++i)
+				{
+					const float rad = (radDelta * i);
+					(pDst++)->set(std::sin(rad), -std::cos(rad));
+				}
+			}
+
+			return results;
+		}();
+
+		/// @brief 品質 quality の 1/4 円の点 (sin, -cos) の配列の先頭を返します。
+		/// @param quality 1/4 円の品質（MinFanQuality 以上 MaxFanQuality 以下）
+		/// @return 1/4 円の点の配列の先頭
+		[[nodiscard]]
+		inline const Float2* GetFanTableStartPtr(const uint16 quality) noexcept
+		{
+			assert(InRange<uint16>(quality, MinFanQuality, MaxFanQuality));
+
+			return &FanSinCosTable[((quality - MinFanQuality) * (MinFanQuality + (quality - 1))) / 2];
+		}
+
+		/// @brief 単位円上の点 pUnit[0, count) を (radius 倍して center に平行移動し) 頂点の位置に書き込みます。
+		inline void WriteCirclePositions(Vertex2D* pDst, const Float2* pUnit, const size_t count, const Float2 radius, const Float2 center) noexcept
+		{
+			const SIMD_Float4 r{ radius, radius };
+			const SIMD_Float4 c{ center, center };
+			size_t i = 0;
+
+			for (; (i + 2) <= count; i += 2)
+			{
+				const SIMD_Float4 p = (SIMD_Float4{ pUnit[i], pUnit[i + 1] } * r + c);
+				StoreXY(pDst[i].pos, p);
+				StoreZW(pDst[i + 1].pos, p);
+			}
+
+			for (; i < count; ++i)
+			{
+				pDst[i].pos.set(radius.x * pUnit[i].x + center.x, radius.y * pUnit[i].y + center.y);
+			}
+		}
+
+		/// @brief 単位円上の点 pUnit[0, count) から、外周と内周の頂点の位置を交互に書き込みます。
+		inline void WriteCircleFramePositions(Vertex2D* pDst, const Float2* pUnit, const size_t count, const Float2 outerRadius, const Float2 innerRadius, const Float2 center) noexcept
+		{
+			const SIMD_Float4 r{ outerRadius, innerRadius };
+			const SIMD_Float4 c{ center, center };
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const SIMD_Float4 p = (SIMD_Float4{ pUnit[i], pUnit[i] } * r + c);
+				StoreXY(pDst[i * 2].pos, p);
+				StoreZW(pDst[i * 2 + 1].pos, p);
+			}
+		}
+
+		/// @brief 点 pSrc[0, count) を scale 倍して pDst に書き込みます。
+		inline void ScalePoints(Float2* pDst, const Float2* pSrc, const size_t count, const float scale) noexcept
+		{
+			const SIMD_Float4 s{ scale };
+			size_t i = 0;
+
+			for (; (i + 2) <= count; i += 2)
+			{
+				const SIMD_Float4 p = (SIMD_Float4{ pSrc[i], pSrc[i + 1] } * s);
+				StoreXY(pDst[i], p);
+				StoreZW(pDst[i + 1], p);
+			}
+
+			for (; i < count; ++i)
+			{
+				pDst[i] = (pSrc[i] * scale);
+			}
+		}
+
+		/// @brief 頂点の位置を offset だけ平行移動します。
+		inline void TranslatePositions(Vertex2D* pDst, const size_t count, const Float2 offset) noexcept
+		{
+			const SIMD_Float4 o{ offset, offset };
+			size_t i = 0;
+
+			for (; (i + 2) <= count; i += 2)
+			{
+				const SIMD_Float4 p = (SIMD_Float4{ pDst[i].pos, pDst[i + 1].pos } + o);
+				StoreXY(pDst[i].pos, p);
+				StoreZW(pDst[i + 1].pos, p);
+			}
+
+			for (; i < count; ++i)
+			{
+				pDst[i].pos.moveBy(offset);
+			}
+		}
+
+		/// @brief 頂点の色をすべて color にします。
+		inline void FillColor(Vertex2D* pDst, const size_t count, const Float4& color) noexcept
+		{
+			const SIMD_Float4 c{ color };
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				StoreXYZW(pDst[i].color, c);
+			}
+		}
+
+		/// @brief 頂点の色を color0, color1 の交互にします。
+		inline void FillColor2(Vertex2D* pDst, const size_t pairCount, const Float4& color0, const Float4& color1) noexcept
+		{
+			const SIMD_Float4 c0{ color0 };
+			const SIMD_Float4 c1{ color1 };
+
+			for (size_t i = 0; i < pairCount; ++i)
+			{
+				StoreXYZW(pDst[i * 2].color, c0);
+				StoreXYZW(pDst[i * 2 + 1].color, c1);
+			}
+		}
+
+		/// @brief 線分列の作成に使う作業用バッファを返します。
+		[[nodiscard]]
+		inline Array<Float2>& GetLineStringBuffer()
+		{
+			thread_local Array<Float2> buffer;
+			buffer.clear();
+			return buffer;
+		}
+
+		/// @brief 複数の図形をまとめて作成するときに使う、図形ごとの頂点の開始位置の作業用バッファを返します。
+		[[nodiscard]]
+		inline Array<uint32>& GetBatchOffsetBuffer()
+		{
+			thread_local Array<uint32> buffer;
+			buffer.clear();
+			return buffer;
+		}
+
+		/// @brief 1 回のバッファ確保で作成できる頂点・インデックスの最大数
+		inline constexpr uint32 MaxBatchBufferSize = std::numeric_limits<Vertex2D::IndexType>::max();
+
+		/// @brief 複数の図形をまとめて作成するとき、1 スレッドが一度に処理する図形の個数
+		inline constexpr size_t BatchGrainSize = 1024;
+
+		/// @brief 大きなメッシュを分割するときに使う、元の頂点の位置から分割後の頂点の位置への対応表を返します。
+		/// @remark 使っていない要素は UINT32_MAX です。使い終えたら使った要素を UINT32_MAX に戻します。
+		[[nodiscard]]
+		inline Array<uint32>& GetVertexRemapBuffer(const size_t vertexCount)
+		{
+			thread_local Array<uint32> buffer;
+
+			if (buffer.size() < vertexCount)
+			{
+				buffer.resize(vertexCount, UINT32_MAX);
+			}
+
+			return buffer;
+		}
+
+		/// @brief 大きなメッシュを分割するときに使う、分割後のインデックスの作業用バッファを返します。
+		[[nodiscard]]
+		inline Array<Vertex2D::IndexType>& GetLocalIndexBuffer()
+		{
+			thread_local Array<Vertex2D::IndexType> buffer;
+			buffer.clear();
+			return buffer;
+		}
+
+		/// @brief 頂点とインデックスで表されるメッシュを、1 回のバッファ確保に収まる分だけ作成します。
+		/// @remark 頂点・インデックスの数が 1 回のバッファ確保に収まらない場合は、先頭から収まる分の三角形を選び、使われている頂点だけを詰めて作成します。
+		[[nodiscard]]
+		inline Vertex2DBuilder::BatchResult BuildMesh(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
+		{
+			if ((not vertices)
+				|| (vertexCount == 0)
+				|| (not indices)
+				|| (num_triangles == 0))
+			{
+				return{};
+			}
+
+			if ((vertexCount <= MaxBatchBufferSize) && ((num_triangles * 3) <= MaxBatchBufferSize))
+			{
+				const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(vertexCount);
+				const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(num_triangles * 3);
+				auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
+
+				if (not pVertex)
+				{
+					return{};
+				}
+
+				std::memcpy(pVertex, vertices, (vertexSize * sizeof(Vertex2D)));
+
+				const TriangleIndex* pSrc = indices;
+				const TriangleIndex* const pSrcEnd = (indices + num_triangles);
+
+				while (pSrc != pSrcEnd)
+				{
+					*pIndex++ = (indexOffset + pSrc->i0);
+					*pIndex++ = (indexOffset + pSrc->i1);
+					*pIndex++ = (indexOffset + pSrc->i2);
+					++pSrc;
+				}
+
+				return{ indexSize, num_triangles };
+			}
+
+			// 収まる分の三角形を選び、使われている頂点に分割後の位置を割り当てる
+			Array<uint32>& remap = GetVertexRemapBuffer(vertexCount);
+			Array<uint32>& usedVertices = GetBatchOffsetBuffer();
+			Array<Vertex2D::IndexType>& localIndices = GetLocalIndexBuffer();
+			const size_t maxTriangles = Min<size_t>(num_triangles, (MaxBatchBufferSize / 3));
+			size_t n = 0;
+			bool invalid = false;
+
+			for (; n < maxTriangles; ++n)
+			{
+				const TriangleIndex& triangle = indices[n];
+
+				if ((vertexCount <= triangle.i0) || (vertexCount <= triangle.i1) || (vertexCount <= triangle.i2)) SIV3D_UNLIKELY
+				{
+					invalid = true;
+					break;
+				}
+
+				const uint32 newVertices = (remap[triangle.i0] == UINT32_MAX)
+					+ ((remap[triangle.i1] == UINT32_MAX) && (triangle.i1 != triangle.i0))
+					+ ((remap[triangle.i2] == UINT32_MAX) && (triangle.i2 != triangle.i0) && (triangle.i2 != triangle.i1));
+
+				if (MaxBatchBufferSize < (usedVertices.size() + newVertices))
+				{
+					break;
+				}
+
+				for (const uint32 i : { triangle.i0, triangle.i1, triangle.i2 })
+				{
+					if (remap[i] == UINT32_MAX)
+					{
+						remap[i] = static_cast<uint32>(usedVertices.size());
+						usedVertices.push_back(i);
+					}
+
+					localIndices.push_back(static_cast<Vertex2D::IndexType>(remap[i]));
+				}
+			}
+
+			for (const uint32 i : usedVertices)
+			{
+				remap[i] = UINT32_MAX;
+			}
+
+			if (invalid || (n == 0))
+			{
+				return{};
+			}
+
+			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(usedVertices.size());
+			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(localIndices.size());
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
+
+			if (not pVertex)
+			{
+				return{};
+			}
+
+			for (const uint32 i : usedVertices)
+			{
+				*pVertex++ = vertices[i];
+			}
+
+			for (const Vertex2D::IndexType index : localIndices)
+			{
+				*pIndex++ = (indexOffset + index);
+			}
+
+			return{ indexSize, n };
 		}
 
 		[[nodiscard]]
@@ -502,43 +853,13 @@ namespace s3d
 			}
 
 			// 中心
-			const float centerX = center.x;
-			const float centerY = center.y;
-			pVertex[0].pos.set(centerX, centerY);
+			pVertex[0].pos = center;
 
 			// 周
-			if (quality <= detail::MaxSinCosTableQuality)
-			{
-				const Float2* pCS = detail::GetSinCosTableStartPtr(quality);
-				Vertex2D* pDst = &pVertex[1];
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					(pDst++)->pos.set(r * pCS->x + centerX, r * pCS->y + centerY);
-					++pCS;
-				}
-			}
-			else
-			{
-				const float radDelta = Math::TwoPiF / quality;
-				Vertex2D* pDst = &pVertex[1];
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set(centerX + r * c, centerY - r * s);
-				}
-			}
+			detail::WriteCirclePositions(&pVertex[1], detail::GetSinCosTableStartPtr(quality), quality, Float2{ r, r }, center);
 
-			{
-				(pVertex++)->color = innerColor;
-
-				for (size_t i = 1; i < vertexSize; ++i)
-				{
-					(pVertex++)->color = outerColor;
-				}
-			}
+			pVertex[0].color = innerColor;
+			detail::FillColor(&pVertex[1], quality, outerColor);
 
 			{
 				for (Vertex2D::IndexType i = 0; i < (quality - 1); ++i)
@@ -568,40 +889,8 @@ namespace s3d
 				return 0;
 			}
 
-			const float centerX = center.x;
-			const float centerY = center.y;
-
-			if (quality <= detail::MaxSinCosTableQuality)
-			{
-				const Float2* pCS = detail::GetSinCosTableStartPtr(quality);
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					(pDst++)->pos.set(rOuter * pCS->x + centerX, rOuter * pCS->y + centerY);
-					(pDst++)->pos.set(rInner * pCS->x + centerX, rInner * pCS->y + centerY);
-					++pCS;
-				}
-			}
-			else
-			{
-				const float radDelta = Math::TwoPiF / quality;
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set(centerX + rOuter * c, centerY - rOuter * s);
-					(pDst++)->pos.set(centerX + rInner * c, centerY - rInner * s);
-				}
-			}
-
-			for (Vertex2D::IndexType i = 0; i < quality; ++i)
-			{
-				(pVertex++)->color = outerColor;
-				(pVertex++)->color = innerColor;
-			}
+			detail::WriteCircleFramePositions(pVertex, detail::GetSinCosTableStartPtr(quality), quality, Float2{ rOuter, rOuter }, Float2{ rInner, rInner }, center);
+			detail::FillColor2(pVertex, quality, outerColor, innerColor);
 
 			for (Vertex2D::IndexType i = 0; i < quality; ++i)
 			{
@@ -846,12 +1135,7 @@ namespace s3d
 				}
 			}
 
-			{
-				for (size_t i = 0; i < vertexSize; ++i)
-				{
-					(pVertex++)->color = color;
-				}
-			}
+			detail::FillColor(pVertex, vertexSize, color);
 
 			for (Vertex2D::IndexType i = 0; i < (quality - 1); ++i)
 			{
@@ -870,49 +1154,19 @@ namespace s3d
 			const Vertex2D::IndexType vertexSize = (quality + 1), indexSize = (quality * 3);
 			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
 
-			if (not pVertex)
-			{
-				return 0;
-			}
-
-			// 中心
-			const float centerX = center.x;
-			const float centerY = center.y;
-			pVertex[0].pos.set(centerX, centerY);
-
-			// 周
-			if (quality <= detail::MaxSinCosTableQuality)
-			{
-				const Float2* pCS = detail::GetSinCosTableStartPtr(quality);
-				Vertex2D* pDst = &pVertex[1];
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					(pDst++)->pos.set(a * pCS->x + centerX, b * pCS->y + centerY);
-					++pCS;
-				}
-			}
-			else
-			{
-				const float radDelta = (Math::TwoPiF / quality);
-				Vertex2D* pDst = &pVertex[1];
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set(centerX + a * c, centerY - b * s);
-				}
+			if (not pVertex)
+			{
+				return 0;
 			}
 
-			{
-				(pVertex++)->color = innerColor;
+			// 中心
+			pVertex[0].pos = center;
 
-				for (size_t i = 1; i < vertexSize; ++i)
-				{
-					(pVertex++)->color = outerColor;
-				}
-			}
+			// 周
+			detail::WriteCirclePositions(&pVertex[1], detail::GetSinCosTableStartPtr(quality), quality, Float2{ a, b }, center);
+
+			pVertex[0].color = innerColor;
+			detail::FillColor(&pVertex[1], quality, outerColor);
 
 			{
 				for (Vertex2D::IndexType i = 0; i < quality - 1; ++i)
@@ -944,40 +1198,8 @@ namespace s3d
 				return 0;
 			}
 
-			const float centerX = center.x;
-			const float centerY = center.y;
-
-			if (quality <= detail::MaxSinCosTableQuality)
-			{
-				const Float2* pCS = detail::GetSinCosTableStartPtr(quality);
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					(pDst++)->pos.set(aOuter * pCS->x + centerX, bOuter * pCS->y + centerY);
-					(pDst++)->pos.set(aInner * pCS->x + centerX, bInner * pCS->y + centerY);
-					++pCS;
-				}
-			}
-			else
-			{
-				const float radDelta = (Math::TwoPiF / quality);
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set(centerX + aOuter * c, centerY - bOuter * s);
-					(pDst++)->pos.set(centerX + aInner * c, centerY - bInner * s);
-				}
-			}
-
-			for (Vertex2D::IndexType i = 0; i < quality; ++i)
-			{
-				(pVertex++)->color = outerColor;
-				(pVertex++)->color = innerColor;
-			}
+			detail::WriteCircleFramePositions(pVertex, detail::GetSinCosTableStartPtr(quality), quality, Float2{ aOuter, bOuter }, Float2{ aInner, bInner }, center);
+			detail::FillColor2(pVertex, quality, outerColor, innerColor);
 
 			for (Vertex2D::IndexType i = 0; i < quality; ++i)
 			{
@@ -1042,16 +1264,7 @@ namespace s3d
 			const Vertex2D::IndexType quality = detail::CaluculateFanQuality(rr * scale);
 
 			buffer.resize(quality);
-			{
-				const float radDelta = (Math::HalfPiF / (quality - 1));
-
-				for (int32 i = 0; i < quality; ++i)
-				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					buffer[i].set(s * rr, -c * rr);
-				}
-			}
+			detail::ScalePoints(buffer.data(), detail::GetFanTableStartPtr(quality), quality, rr);
 
 			const bool uniteV = (h * 0.5f == rr);
 			const bool uniteH = (w * 0.5f == rr);
@@ -1099,10 +1312,7 @@ namespace s3d
 					++pDst;
 				}
 
-				for (size_t i = 0; i < vertexSize; ++i)
-				{
-					(pVertex++)->color = color;
-				}
+				detail::FillColor(pVertex, vertexSize, color);
 			}
 
 			for (Vertex2D::IndexType i = 0; i < (vertexSize - 2); ++i)
@@ -1121,16 +1331,7 @@ namespace s3d
 			const Vertex2D::IndexType quality = detail::CaluculateFanQuality(rr * scale);
 
 			buffer.resize(quality);
-			{
-				const float radDelta = (Math::HalfPiF / (quality - 1));
-
-				for (int32 i = 0; i < quality; ++i)
-				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					buffer[i].set(s * rr, -c * rr);
-				}
-			}
+			detail::ScalePoints(buffer.data(), detail::GetFanTableStartPtr(quality), quality, rr);
 
 			const bool uniteV = (h * 0.5f == rr);
 			const bool uniteH = (w * 0.5f == rr);
@@ -1220,16 +1421,7 @@ namespace s3d
 			// 外側の頂点
 			{
 				buffer.resize(quality);
-				{
-					const float radDelta = (Math::HalfPiF / (quality - 1));
-
-					for (int32 i = 0; i < quality; ++i)
-					{
-						const float rad = (radDelta * i);
-						const auto [s, c] = FastMath::SinCos(rad);
-						buffer[i].set(s * orr, -c * orr);
-					}
-				}
+				detail::ScalePoints(buffer.data(), detail::GetFanTableStartPtr(quality), quality, orr);
 
 				const FloatRect rect{ outer.rect.x, outer.rect.y, outer.rect.rightX(), outer.rect.bottomY() };
 				const std::array<Float2, 4> centers =
@@ -1270,14 +1462,7 @@ namespace s3d
 			// 内側の頂点
 			{
 				const float irr = static_cast<float>(inner.r);
-				{
-					const float s = (irr / orr);
-
-					for (int32 i = 0; i < quality; ++i)
-					{
-						buffer[i] *= s;
-					}
-				}
+				detail::ScalePoints(buffer.data(), buffer.data(), quality, (irr / orr));
 
 				const FloatRect rect{ inner.rect.x, inner.rect.y, inner.rect.rightX(), inner.rect.bottomY() };
 				const std::array<Float2, 4> centers =
@@ -1315,10 +1500,7 @@ namespace s3d
 				}
 			}
 
-			for (size_t i = 0; i < vertexSize; ++i)
-			{
-				(pVertex++)->color = color;
-			}
+			detail::FillColor(pVertex, vertexSize, color);
 
 			for (Vertex2D::IndexType i = 0; i < outerVertexSize; ++i)
 			{
@@ -1357,16 +1539,7 @@ namespace s3d
 			// 外側の頂点
 			{
 				buffer.resize(quality);
-				{
-					const float radDelta = (Math::HalfPiF / (quality - 1));
-
-					for (int32 i = 0; i < quality; ++i)
-					{
-						const float rad = (radDelta * i);
-						const auto [s, c] = FastMath::SinCos(rad);
-						buffer[i].set(s * orr, -c * orr);
-					}
-				}
+				detail::ScalePoints(buffer.data(), detail::GetFanTableStartPtr(quality), quality, orr);
 
 				const FloatRect rect{ outer.rect.x, outer.rect.y, outer.rect.rightX(), outer.rect.bottomY() };
 				const std::array<Float2, 4> centers =
@@ -1407,14 +1580,7 @@ namespace s3d
 			// 内側の頂点
 			{
 				const float irr = static_cast<float>(inner.r);
-				{
-					const float s = (irr / orr);
-
-					for (int32 i = 0; i < quality; ++i)
-					{
-						buffer[i] *= s;
-					}
-				}
+				detail::ScalePoints(buffer.data(), buffer.data(), quality, (irr / orr));
 
 				const FloatRect rect{ inner.rect.x, inner.rect.y, inner.rect.rightX(), inner.rect.bottomY() };
 				const std::array<Float2, 4> centers =
@@ -1571,7 +1737,7 @@ namespace s3d
 
 			const float threshold = 0.55f;
 
-			Array<Float2> buf2(Arg::reserve = buffer.size());
+			Array<Float2>& buf2 = detail::GetLineStringBuffer();
 			{
 				buf2.push_back(buffer.front());
 
@@ -1710,19 +1876,10 @@ namespace s3d
 
 			if (offset)
 			{
-				const Float2 v = *offset;
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < vertexSize; ++i)
-				{
-					(pDst++)->pos.moveBy(v);
-				}
+				detail::TranslatePositions(pVertex, vertexSize, *offset);
 			}
 
-			for (size_t i = 0; i < vertexSize; ++i)
-			{
-				(pVertex++)->color = color;
-			}
+			detail::FillColor(pVertex, vertexSize, color);
 
 			{
 				const Vertex2D::IndexType count = static_cast<Vertex2D::IndexType>(newSize);
@@ -1777,7 +1934,7 @@ namespace s3d
 
 			const float threshold = 0.55f;
 
-			Array<Float2> buf2(Arg::reserve = buffer.size());
+			Array<Float2>& buf2 = detail::GetLineStringBuffer();
 			{
 				buf2.push_back(buffer.front());
 
@@ -1875,19 +2032,10 @@ namespace s3d
 
 			if (offset)
 			{
-				const Float2 v = *offset;
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < vertexSize; ++i)
-				{
-					(pDst++)->pos.moveBy(v);
-				}
+				detail::TranslatePositions(pVertex, vertexSize, *offset);
 			}
 
-			for (size_t i = 0; i < vertexSize; ++i)
-			{
-				(pVertex++)->color = color;
-			}
+			detail::FillColor(pVertex, vertexSize, color);
 
 			{
 				const Vertex2D::IndexType count = static_cast<Vertex2D::IndexType>(newSize - 1);
@@ -1942,7 +2090,7 @@ namespace s3d
 
 			const float threshold = 0.55f;
 
-			Array<Float2> buf2(Arg::reserve = buffer.size());
+			Array<Float2>& buf2 = detail::GetLineStringBuffer();
 			{
 				buf2.push_back(buffer.front());
 
@@ -2048,19 +2196,10 @@ namespace s3d
 
 			if (offset)
 			{
-				const Float2 v = *offset;
-				Vertex2D* pDst = pVertex;
-
-				for (Vertex2D::IndexType i = 0; i < vertexSize; ++i)
-				{
-					(pDst++)->pos.moveBy(v);
-				}
+				detail::TranslatePositions(pVertex, vertexSize, *offset);
 			}
 
-			for (size_t i = 0; i < vertexSize; ++i)
-			{
-				(pVertex++)->color = color;
-			}
+			detail::FillColor(pVertex, vertexSize, color);
 
 			{
 				const Vertex2D::IndexType count = static_cast<Vertex2D::IndexType>(newSize - 1);
@@ -2383,39 +2522,9 @@ namespace s3d
 			return indexSize;
 		}
 
-		Vertex2D::IndexType BuildPolygon(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
+		BatchResult BuildPolygon(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 		{
-			if ((not vertices)
-				|| (vertexCount == 0)
-				|| (not indices)
-				|| (num_triangles == 0))
-			{
-				return 0;
-			}
-
-			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(vertexCount);
-			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(num_triangles * 3);
-			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
-
-			if (not pVertex)
-			{
-				return 0;
-			}
-
-			std::memcpy(pVertex, vertices, (vertexSize * sizeof(Vertex2D)));
-
-			const TriangleIndex* pSrc = indices;
-			const TriangleIndex* const pSrcEnd = (indices + num_triangles);
-
-			while (pSrc != pSrcEnd)
-			{
-				*pIndex++ = (indexOffset + pSrc->i0);
-				*pIndex++ = (indexOffset + pSrc->i1);
-				*pIndex++ = (indexOffset + pSrc->i2);
-				++pSrc;
-			}
-
-			return indexSize;
+			return detail::BuildMesh(bufferCreator, vertices, vertexCount, indices, num_triangles);
 		}
 
 		Vertex2D::IndexType BuildPolygonTransformed(const BufferCreatorFunc& bufferCreator, const Array<Float2>& vertices, const Array<TriangleIndex>& tirnagleIndices, const float s, const float c, const Float2& offset, const Float4& color)
@@ -2515,7 +2624,7 @@ namespace s3d
 
 			const float threshold = 0.55f;
 
-			Array<Float2> buf2(Arg::reserve = buffer.size());
+			Array<Float2>& buf2 = detail::GetLineStringBuffer();
 			{
 				buf2.push_back(buffer.front());
 
@@ -2648,10 +2757,7 @@ namespace s3d
 				pVertex[newSize * 2 - 1].pos.set(result1);
 			}
 
-			for (size_t i = 0; i < vertexSize; ++i)
-			{
-				(pVertex++)->color = color;
-			}
+			detail::FillColor(pVertex, vertexSize, color);
 
 			{
 				const Vertex2D::IndexType count = static_cast<Vertex2D::IndexType>(newSize);
@@ -2740,21 +2846,17 @@ namespace s3d
 
 			// 周
 			{
-				const float radDelta = (Math::TwoPiF / quality);
+				const Float2* pCS = detail::GetSinCosTableStartPtr(quality);
 				Vertex2D* pDst = &pVertex[1];
 
 				for (Vertex2D::IndexType i = 0; i < quality; ++i)
 				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->set((centerX + rf * c), (centerY - rf * s), (centerU + rU * c), (centerV - rV * s));
+					(pDst++)->set((centerX + rf * pCS->x), (centerY + rf * pCS->y), (centerU + rU * pCS->x), (centerV + rV * pCS->y));
+					++pCS;
 				}
 			}
 
-			for (size_t i = 0; i < vertexSize; ++i)
-			{
-				(pVertex++)->color = color;
-			}
+			detail::FillColor(pVertex, vertexSize, color);
 
 			{
 				for (Vertex2D::IndexType i = 0; i < (quality - 1); ++i)
@@ -2801,16 +2903,7 @@ namespace s3d
 			const Vertex2D::IndexType quality = detail::CaluculateFanQuality(rr * scale);
 
 			buffer.resize(quality);
-			{
-				const float radDelta = (Math::HalfPiF / (quality - 1));
-
-				for (int32 i = 0; i < quality; ++i)
-				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					buffer[i].set(s * rr, -c * rr);
-				}
-			}
+			detail::ScalePoints(buffer.data(), detail::GetFanTableStartPtr(quality), quality, rr);
 
 			const bool uniteV = (h * 0.5f == rr);
 			const bool uniteH = (w * 0.5f == rr);
@@ -2896,39 +2989,9 @@ namespace s3d
 			return indexSize;
 		}
 
-		Vertex2D::IndexType BuildTexturedVertices(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
+		BatchResult BuildTexturedVertices(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 		{
-			if ((not vertices)
-				|| (vertexCount == 0)
-				|| (not indices)
-				|| (num_triangles == 0))
-			{
-				return 0;
-			}
-
-			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(vertexCount);
-			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(num_triangles * 3);
-			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
-
-			if (not pVertex)
-			{
-				return 0;
-			}
-
-			std::memcpy(pVertex, vertices, (vertexSize * sizeof(Vertex2D)));
-
-			const TriangleIndex* pSrc = indices;
-			const TriangleIndex* const pSrcEnd = (indices + num_triangles);
-
-			while (pSrc != pSrcEnd)
-			{
-				*pIndex++ = (indexOffset + pSrc->i0);
-				*pIndex++ = (indexOffset + pSrc->i1);
-				*pIndex++ = (indexOffset + pSrc->i2);
-				++pSrc;
-			}
-
-			return indexSize;
+			return detail::BuildMesh(bufferCreator, vertices, vertexCount, indices, num_triangles);
 		}
 
 		Vertex2D::IndexType BuildRectShadow(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, float blur, const Float4& color, const bool fill)
@@ -3050,14 +3113,15 @@ namespace s3d
 			{
 				const float centerX = static_cast<float>(circle.x);
 				const float centerY = static_cast<float>(circle.y);
-				const float radDelta = (Math::TwoPiF / quality);
+				const Float2* pCS = detail::GetSinCosTableStartPtr(quality);
 				Vertex2D* pOuterVertex = &pVertex[0];
 				Vertex2D* pInnerVertex = &pVertex[outerVertexCount];
 
 				for (Vertex2D::IndexType i = 0; i < quality; ++i)
 				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
+					const float c = pCS->x;
+					const float s = -pCS->y;
+					++pCS;
 
 					pOuterVertex->pos.set((centerX + outerShadowR * c), (centerY - outerShadowR * s));
 					pOuterVertex->tex.set(0.0f, 0.5f);
@@ -3512,7 +3576,7 @@ namespace s3d
 			return indexCount;
 		}
 
-		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Array<Particle2D>& particles,
+		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const ParticleStorage2D& particles,
 			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
 		{
 			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(particles.size() * 4);
@@ -3524,17 +3588,26 @@ namespace s3d
 				return 0;
 			}
 
-			for (const auto& particle : particles)
+			// 成分ごとの配列から直接読む
+			const float* const pPositionX = particles.positionX();
+			const float* const pPositionY = particles.positionY();
+			const Float4* const pStartColor = particles.startColor();
+			const float* const pStartSize = particles.startSize();
+			const float* const pRotation = particles.rotation();
+			const float* const pStartLifeTime = particles.startLifeTime();
+			const float* const pRemainingLifeTime = particles.remainingLifeTime();
+
+			for (size_t i = 0; i < particles.size(); ++i)
 			{
-				const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
-				const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
+				const float size = sizeOverLifeTimeFunc(pStartSize[i], pStartLifeTime[i], pRemainingLifeTime[i]);
+				const Float4 color = colorOverLifeTimeFunc(pStartColor[i], pStartLifeTime[i], pRemainingLifeTime[i]);
 
 				const float size_half = (size * 0.5f);
-				const float cx = particle.position.x;
-				const float cy = particle.position.y;
+				const float cx = pPositionX[i];
+				const float cy = pPositionY[i];
 
 				const float x = size_half;
-				const auto [s, c] = FastMath::SinCos(particle.rotation);
+				const auto [s, c] = FastMath::SinCos(pRotation[i]);
 				const float xc = x * c;
 				const float xs = x * s;
 
@@ -3561,5 +3634,167 @@ namespace s3d
 
 			return indexSize;
 		}
+
+		BatchResult BuildCircles(const BufferCreatorFunc& bufferCreator, const Circle* circles, const size_t count, const ColorF* colors, const Float4& color, const float scale)
+		{
+			// 1 回のバッファ確保に収まる円の個数と、各円の頂点の開始位置を求める
+			Array<uint32>& vertexOffsets = detail::GetBatchOffsetBuffer();
+			uint32 vertexSize = 0;
+			size_t n = 0;
+
+			for (; n < count; ++n)
+			{
+				const Vertex2D::IndexType quality = detail::CalculateCircleQuality(static_cast<float>(Abs(circles[n].r)) * scale);
+				const uint32 nextVertexSize = (vertexSize + quality + 1);
+				const uint32 nextIndexSize = ((nextVertexSize - static_cast<uint32>(n + 1)) * 3);
+
+				if ((detail::MaxBatchBufferSize < nextVertexSize) || (detail::MaxBatchBufferSize < nextIndexSize))
+				{
+					break;
+				}
+
+				vertexOffsets.push_back(vertexSize);
+				vertexSize = nextVertexSize;
+			}
+
+			if (n == 0)
+			{
+				return{};
+			}
+
+			vertexOffsets.push_back(vertexSize);
+
+			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>((vertexSize - n) * 3);
+			const Vertex2DBufferPointer buffer = bufferCreator(static_cast<Vertex2D::IndexType>(vertexSize), indexSize);
+
+			if (not buffer.pVertex)
+			{
+				return{};
+			}
+
+			Threading::ParallelFor(n, [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					const uint32 vertexBegin = vertexOffsets[i];
+					const Vertex2D::IndexType quality = static_cast<Vertex2D::IndexType>(vertexOffsets[i + 1] - vertexBegin - 1);
+					Vertex2D* const pVertex = (buffer.pVertex + vertexBegin);
+					Vertex2D::IndexType* pIndex = (buffer.pIndex + ((vertexBegin - i) * 3));
+					const Vertex2D::IndexType indexOffset = static_cast<Vertex2D::IndexType>(buffer.indexOffset + vertexBegin);
+
+					const Float2 center{ circles[i].center };
+					const float r = static_cast<float>(circles[i].r);
+
+					pVertex[0].pos = center;
+					detail::WriteCirclePositions(&pVertex[1], detail::GetSinCosTableStartPtr(quality), quality, Float2{ r, r }, center);
+					detail::FillColor(pVertex, (quality + 1), (colors ? colors[i].toFloat4() : color));
+
+					for (Vertex2D::IndexType k = 0; k < (quality - 1); ++k)
+					{
+						*pIndex++ = indexOffset + (k + 1);
+						*pIndex++ = indexOffset;
+						*pIndex++ = indexOffset + (k + 2);
+					}
+
+					*pIndex++ = (indexOffset + quality);
+					*pIndex++ = indexOffset;
+					*pIndex++ = (indexOffset + 1);
+				}
+			}, detail::BatchGrainSize);
+
+			return{ indexSize, n };
+		}
+
+		BatchResult BuildRects(const BufferCreatorFunc& bufferCreator, const RectF* rects, const size_t count, const ColorF* colors, const Float4& color)
+		{
+			const size_t n = Min<size_t>(count, (detail::MaxBatchBufferSize / 6));
+
+			if (n == 0)
+			{
+				return{};
+			}
+
+			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(n * 4);
+			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(n * 6);
+			const Vertex2DBufferPointer buffer = bufferCreator(vertexSize, indexSize);
+
+			if (not buffer.pVertex)
+			{
+				return{};
+			}
+
+			Threading::ParallelFor(n, [&](const size_t begin, const size_t end)
+			{
+				Vertex2D* pVertex = (buffer.pVertex + (begin * 4));
+				Vertex2D::IndexType* pIndex = (buffer.pIndex + (begin * 6));
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const FloatRect rect{ rects[i].x, rects[i].y, (rects[i].x + rects[i].w), (rects[i].y + rects[i].h) };
+					const Float4 c = (colors ? colors[i].toFloat4() : color);
+
+					pVertex[0].set(rect.left, rect.top, c);
+					pVertex[1].set(rect.right, rect.top, c);
+					pVertex[2].set(rect.left, rect.bottom, c);
+					pVertex[3].set(rect.right, rect.bottom, c);
+					pVertex += 4;
+
+					const Vertex2D::IndexType indexOffset = static_cast<Vertex2D::IndexType>(buffer.indexOffset + (i * 4));
+
+					for (Vertex2D::IndexType k = 0; k < 6; ++k)
+					{
+						*pIndex++ = (indexOffset + detail::RectIndexTable[k]);
+					}
+				}
+			}, detail::BatchGrainSize);
+
+			return{ indexSize, n };
+		}
+
+		BatchResult BuildTexturedQuads(const BufferCreatorFunc& bufferCreator, const Quad* quads, const size_t count, const RectF* uvRects, const Float4& color)
+		{
+			const size_t n = Min<size_t>(count, (detail::MaxBatchBufferSize / 6));
+
+			if (n == 0)
+			{
+				return{};
+			}
+
+			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(n * 4);
+			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(n * 6);
+			const Vertex2DBufferPointer buffer = bufferCreator(vertexSize, indexSize);
+
+			if (not buffer.pVertex)
+			{
+				return{};
+			}
+
+			Threading::ParallelFor(n, [&](const size_t begin, const size_t end)
+			{
+				Vertex2D* pVertex = (buffer.pVertex + (begin * 4));
+				Vertex2D::IndexType* pIndex = (buffer.pIndex + (begin * 6));
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const FloatQuad quad{ quads[i] };
+					const FloatRect uv = (uvRects ? FloatRect{ uvRects[i].x, uvRects[i].y, (uvRects[i].x + uvRects[i].w), (uvRects[i].y + uvRects[i].h) } : FloatRect{ 0.0f, 0.0f, 1.0f, 1.0f });
+
+					pVertex[0].set(quad.p[0], uv.left, uv.top, color);
+					pVertex[1].set(quad.p[1], uv.right, uv.top, color);
+					pVertex[2].set(quad.p[3], uv.left, uv.bottom, color);
+					pVertex[3].set(quad.p[2], uv.right, uv.bottom, color);
+					pVertex += 4;
+
+					const Vertex2D::IndexType indexOffset = static_cast<Vertex2D::IndexType>(buffer.indexOffset + (i * 4));
+
+					for (Vertex2D::IndexType k = 0; k < 6; ++k)
+					{
+						*pIndex++ = (indexOffset + detail::RectIndexTable[k]);
+					}
+				}
+			}, detail::BatchGrainSize);
+
+			return{ indexSize, n };
+		}
 	}
 }
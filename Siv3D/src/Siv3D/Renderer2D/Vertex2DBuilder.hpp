@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # pragma once
+# include <new>
+# include <type_traits>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Vertex2D.hpp>
 # include <Siv3D/FloatRect.hpp>
@@ -20,16 +22,69 @@
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/YesNo.hpp>
 # include <Siv3D/PredefinedYesNo.hpp>
-# include <Siv3D/Particle2D.hpp>
+# include <Siv3D/ParticleSystem2D/ParticleStorage2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
 # include "Vertex2DBufferPointer.hpp"
 
 namespace s3d
 {
-	using BufferCreatorFunc = std::function<Vertex2DBufferPointer(Vertex2D::IndexType, Vertex2D::IndexType)>;
+	/// @brief 頂点バッファ・インデックスバッファを確保する関数
+	/// @remark 図形 1 つごとに呼ばれるため、std::function ではなく、小さなトリビアルコピー可能な関数オブジェクトをヒープ確保なしで保持し、関数ポインタ経由で呼び出します。
+	class BufferCreatorFunc
+	{
+	public:
+
+		BufferCreatorFunc() = default;
+
+		template <class Fty, std::enable_if_t<std::is_invocable_r_v<Vertex2DBufferPointer, const Fty&, Vertex2D::IndexType, Vertex2D::IndexType>>* = nullptr>
+		BufferCreatorFunc(const Fty& f) noexcept
+			: m_function{ &Invoke<Fty> }
+		{
+			static_assert(sizeof(Fty) <= sizeof(m_storage), "The function object is too large");
+			static_assert(alignof(Fty) <= alignof(Storage), "The function object is over-aligned");
+			static_assert(std::is_trivially_copyable_v<Fty> && std::is_trivially_destructible_v<Fty>);
+
+			::new (static_cast<void*>(&m_storage)) Fty(f);
+		}
+
+		[[nodiscard]]
+		Vertex2DBufferPointer operator ()(const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize) const
+		{
+			return m_function(&m_storage, vertexSize, indexSize);
+		}
+
+	private:
+
+		using FunctionType = Vertex2DBufferPointer(*)(const void*, Vertex2D::IndexType, Vertex2D::IndexType);
+
+		struct Storage
+		{
+			alignas(void*) unsigned char data[sizeof(void*) * 2];
+		};
+
+		template <class Fty>
+		static Vertex2DBufferPointer Invoke(const void* storage, const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize)
+		{
+			return (*static_cast<const Fty*>(storage))(vertexSize, indexSize);
+		}
+
+		FunctionType m_function = nullptr;
+
+		Storage m_storage;
+	};
 
 	namespace Vertex2DBuilder
 	{
+		/// @brief 複数の図形の頂点をまとめて作成した結果
+		struct BatchResult
+		{
+			/// @brief 作成したインデックスの数
+			Vertex2D::IndexType indexCount = 0;
+
+			/// @brief 頂点を作成した図形（メッシュの場合は三角形）の個数
+			size_t count = 0;
+		};
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildLine(const LineStyle& style, const BufferCreatorFunc& bufferCreator, const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2], float scale);
 
@@ -129,8 +184,10 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildPolygon(const BufferCreatorFunc& bufferCreator, const Array<Float2>& vertices, const Array<TriangleIndex>& tirnagleIndices, const Optional<Float2>& offset, const Float4& color);
 
+		/// @brief 頂点とインデックスで表されるメッシュの頂点を作成します。
+		/// @return 作成したインデックスの数と、作成した三角形の個数。頂点またはインデックスが 65,535 個を超えて 1 回のバッファに収まらない場合、count は引数の num_triangles より小さくなり、残りの三角形は indices + count から再び作成します。
 		[[nodiscard]]
-		Vertex2D::IndexType BuildPolygon(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, size_t vertexCount, const TriangleIndex* indices, size_t num_triangles);
+		BatchResult BuildPolygon(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, size_t vertexCount, const TriangleIndex* indices, size_t num_triangles);
 
 		[[nodiscard]]
 		Vertex2D::IndexType BuildPolygonTransformed(const BufferCreatorFunc& bufferCreator, const Array<Float2>& vertices, const Array<TriangleIndex>& tirnagleIndices, float s, float c, const Float2& offset, const Float4& color);
@@ -153,8 +210,10 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildTexturedRoundRect(const BufferCreatorFunc& bufferCreator, Array<Float2>& buffer, const FloatRect& rect, float w, float h, float r, const FloatRect& uvRect, const Float4& color, float scale);
 
+		/// @brief 頂点とインデックスで表されるテクスチャ付きメッシュの頂点を作成します。
+		/// @return 作成したインデックスの数と、作成した三角形の個数。1 回のバッファに収まらない場合の扱いは BuildPolygon と同じです。
 		[[nodiscard]]
-		Vertex2D::IndexType BuildTexturedVertices(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, size_t vertexCount, const TriangleIndex* indices, size_t num_triangles);
+		BatchResult BuildTexturedVertices(const BufferCreatorFunc& bufferCreator, const Vertex2D* vertices, size_t vertexCount, const TriangleIndex* indices, size_t num_triangles);
 
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRectShadow(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, float blur, const Float4& color, bool fill);
@@ -166,7 +225,25 @@ namespace s3d
 		Vertex2D::IndexType BuildRoundRectShadow(const BufferCreatorFunc& bufferCreator, const RoundRect& roundRect, float blur, const Float4& color, float scale, bool fill);
 
 		[[nodiscard]]
-		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Array<Particle2D>& particles,
+		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const ParticleStorage2D& particles,
 			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc);
+
+		/// @brief 複数の円の頂点を 1 回のバッファ確保でまとめて作成します。
+		/// @param colors 円ごとの色。nullptr の場合はすべての円に color を使います。
+		/// @return 作成したインデックスの数と、頂点を作成した円の個数。1 回のバッファに収まらない場合、count は引数の count より小さくなります。
+		[[nodiscard]]
+		BatchResult BuildCircles(const BufferCreatorFunc& bufferCreator, const Circle* circles, size_t count, const ColorF* colors, const Float4& color, float scale);
+
+		/// @brief 複数の長方形の頂点を 1 回のバッファ確保でまとめて作成します。
+		/// @param colors 長方形ごとの色。nullptr の場合はすべての長方形に color を使います。
+		/// @return 作成したインデックスの数と、頂点を作成した長方形の個数。1 回のバッファに収まらない場合、count は引数の count より小さくなります。
+		[[nodiscard]]
+		BatchResult BuildRects(const BufferCreatorFunc& bufferCreator, const RectF* rects, size_t count, const ColorF* colors, const Float4& color);
+
+		/// @brief 複数のテクスチャ付き四角形の頂点を 1 回のバッファ確保でまとめて作成します。
+		/// @param uvRects 四角形ごとの UV 座標。nullptr の場合はすべての四角形にテクスチャ全体を使います。
+		/// @return 作成したインデックスの数と、頂点を作成した四角形の個数。1 回のバッファに収まらない場合、count は引数の count より小さくなります。
+		[[nodiscard]]
+		BatchResult BuildTexturedQuads(const BufferCreatorFunc& bufferCreator, const Quad* quads, size_t count, const RectF* uvRects, const Float4& color);
 	}
 }
@@ -0,0 +1,800 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <algorithm>
+# include <bit>
+# include <Siv3D/SIMDCollision.hpp>
+# include <Siv3D/Geometry2D.hpp>
+# include <Siv3D/CPUInfo.hpp>
+
+# if SIV3D_INTRINSIC(SSE)
+#	include <immintrin.h>
+#	if !SIV3D_PLATFORM(WEB)
+#		define SIV3D_SIMDCOLLISION_AVX2_ENABLED 1
+#		if defined(__GNUC__) || defined(__clang__)
+#			define SIV3D_SIMDCOLLISION_AVX2 __attribute__((target("avx2")))
+#		else
+#			define SIV3D_SIMDCOLLISION_AVX2
+#		endif
+#	endif
+# endif
+
+namespace s3d
+{
+	namespace detail
+	{
+		inline constexpr size_t SIMDCollisionBlockSize = SIMDCollision::BitsPerWord;
+
+		[[nodiscard]]
+		static constexpr uint64 BlockMask(const size_t blockSize) noexcept
+		{
+			return ((blockSize == SIMDCollisionBlockSize) ? ~uint64{ 0 } : ((uint64{ 1 } << blockSize) - 1));
+		}
+
+		[[nodiscard]]
+		static constexpr size_t WordCount(const size_t count) noexcept
+		{
+			return ((count + (SIMDCollisionBlockSize - 1)) / SIMDCollisionBlockSize);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	sweep and prune の区間
+		//
+		////////////////////////////////////////////////////////////////
+
+		struct ActiveCircles
+		{
+			Array<double> x, y, r, maxX;
+
+			Array<size_t> index;
+
+			void add(const Circle& circle, const size_t i)
+			{
+				x << circle.x;
+				y << circle.y;
+				r << circle.r;
+				maxX << (circle.x + circle.r);
+				index << i;
+			}
+
+			void prune(const double minX) noexcept
+			{
+				size_t n = 0;
+
+				for (size_t k = 0; k < index.size(); ++k)
+				{
+					if (minX <= maxX[k])
+					{
+						x[n] = x[k]; y[n] = y[k]; r[n] = r[k];
+						maxX[n] = maxX[k]; index[n] = index[k];
+						++n;
+					}
+				}
+
+				x.resize(n); y.resize(n); r.resize(n);
+				maxX.resize(n); index.resize(n);
+			}
+
+			[[nodiscard]]
+			size_t size() const noexcept
+			{
+				return index.size();
+			}
+		};
+
+		struct ActiveRects
+		{
+			Array<double> x, y, w, h, maxX;
+
+			Array<size_t> index;
+
+			void add(const RectF& rect, const size_t i)
+			{
+				x << rect.x;
+				y << rect.y;
+				w << rect.w;
+				h << rect.h;
+				maxX << (rect.x + rect.w);
+				index << i;
+			}
+
+			void prune(const double minX) noexcept
+			{
+				size_t n = 0;
+
+				for (size_t k = 0; k < index.size(); ++k)
+				{
+					if (minX <= maxX[k])
+					{
+						x[n] = x[k]; y[n] = y[k]; w[n] = w[k]; h[n] = h[k];
+						maxX[n] = maxX[k]; index[n] = index[k];
+						++n;
+					}
+				}
+
+				x.resize(n); y.resize(n); w.resize(n); h.resize(n);
+				maxX.resize(n); index.resize(n);
+			}
+
+			[[nodiscard]]
+			size_t size() const noexcept
+			{
+				return index.size();
+			}
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Reference
+		//
+		////////////////////////////////////////////////////////////////
+
+		template <class Shape, class Query>
+		static void IntersectMany_Reference(const Shape* shapes, const size_t count, const Query& query, uint64* results) noexcept
+		{
+			for (size_t blockBegin = 0; blockBegin < count; blockBegin += SIMDCollisionBlockSize)
+			{
+				const size_t blockSize = Min(SIMDCollisionBlockSize, (count - blockBegin));
+				uint64 mask = 0;
+
+				for (size_t i = 0; i < blockSize; ++i)
+				{
+					mask |= (uint64{ Geometry2D::Intersect(shapes[blockBegin + i], query) } << i);
+				}
+
+				results[blockBegin / SIMDCollisionBlockSize] = mask;
+			}
+		}
+
+		static void FindCircleRects_Reference(const Circle& circle, const ActiveRects& rects, Array<size_t>& hits)
+		{
+			for (size_t k = 0; k < rects.size(); ++k)
+			{
+				if (Geometry2D::Intersect(RectF{ rects.x[k], rects.y[k], rects.w[k], rects.h[k] }, circle))
+				{
+					hits << k;
+				}
+			}
+		}
+
+		static void FindRectCircles_Reference(const RectF& rect, const ActiveCircles& circles, Array<size_t>& hits)
+		{
+			for (size_t k = 0; k < circles.size(); ++k)
+			{
+				if (Geometry2D::Intersect(rect, Circle{ circles.x[k], circles.y[k], circles.r[k] }))
+				{
+					hits << k;
+				}
+			}
+		}
+
+		static void FindCircleCircles_Reference(const Circle& circle, const ActiveCircles& circles, Array<size_t>& hits)
+		{
+			for (size_t k = 0; k < circles.size(); ++k)
+			{
+				if (Geometry2D::Intersect(Circle{ circles.x[k], circles.y[k], circles.r[k] }, circle))
+				{
+					hits << k;
+				}
+			}
+		}
+
+		static void FindRectRects_Reference(const RectF& rect, const ActiveRects& rects, Array<size_t>& hits)
+		{
+			for (size_t k = 0; k < rects.size(); ++k)
+			{
+				if (Geometry2D::Intersect(RectF{ rects.x[k], rects.y[k], rects.w[k], rects.h[k] }, rect))
+				{
+					hits << k;
+				}
+			}
+		}
+
+	# if SIV3D_SIMDCOLLISION_AVX2_ENABLED
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	AVX2
+		//
+		//	演算の順序は Geometry2D::Intersect() と同一にして、結果を一致させる
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief Geometry2D::Intersect(const RectF&, const Circle&) の 4 レーン版
+		[[nodiscard]]
+		SIV3D_SIMDCOLLISION_AVX2
+		static inline __m256d RectCircle_AVX2(const __m256d rx, const __m256d ry, const __m256d rw, const __m256d rh,
+			const __m256d cx, const __m256d cy, const __m256d cr) noexcept
+		{
+			const __m256d signMask = _mm256_set1_pd(-0.0);
+			const __m256d half = _mm256_set1_pd(0.5);
+			const __m256d aw = _mm256_mul_pd(rw, half);
+			const __m256d ah = _mm256_mul_pd(rh, half);
+			const __m256d cX = _mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_sub_pd(cx, rx), aw));
+			const __m256d cY = _mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_sub_pd(cy, ry), ah));
+
+			const __m256d outside = _mm256_or_pd(_mm256_cmp_pd(cX, _mm256_add_pd(aw, cr), _CMP_GT_OQ),
+				_mm256_cmp_pd(cY, _mm256_add_pd(ah, cr), _CMP_GT_OQ));
+			const __m256d edge = _mm256_or_pd(_mm256_cmp_pd(cX, aw, _CMP_LE_OQ), _mm256_cmp_pd(cY, ah, _CMP_LE_OQ));
+
+			const __m256d dx = _mm256_sub_pd(cX, aw);
+			const __m256d dy = _mm256_sub_pd(cY, ah);
+			const __m256d corner = _mm256_cmp_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)),
+				_mm256_mul_pd(cr, cr), _CMP_LE_OQ);
+
+			return _mm256_andnot_pd(outside, _mm256_or_pd(edge, corner));
+		}
+
+		/// @brief Geometry2D::Intersect(const Circle&, const Circle&) の 4 レーン版
+		[[nodiscard]]
+		SIV3D_SIMDCOLLISION_AVX2
+		static inline __m256d CircleCircle_AVX2(const __m256d ax, const __m256d ay, const __m256d ar,
+			const __m256d bx, const __m256d by, const __m256d br) noexcept
+		{
+			const __m256d dx = _mm256_sub_pd(ax, bx);
+			const __m256d dy = _mm256_sub_pd(ay, by);
+			const __m256d rr = _mm256_add_pd(ar, br);
+			return _mm256_cmp_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(rr, rr), _CMP_LE_OQ);
+		}
+
+		/// @brief Geometry2D::Intersect(const RectF&, const RectF&) の 4 レーン版
+		[[nodiscard]]
+		SIV3D_SIMDCOLLISION_AVX2
+		static inline __m256d RectRect_AVX2(const __m256d ax, const __m256d ay, const __m256d aw, const __m256d ah,
+			const __m256d bx, const __m256d by, const __m256d bw, const __m256d bh) noexcept
+		{
+			const __m256d x = _mm256_and_pd(_mm256_cmp_pd(ax, _mm256_add_pd(bx, bw), _CMP_LT_OQ),
+				_mm256_cmp_pd(bx, _mm256_add_pd(ax, aw), _CMP_LT_OQ));
+			const __m256d y = _mm256_and_pd(_mm256_cmp_pd(ay, _mm256_add_pd(by, bh), _CMP_LT_OQ),
+				_mm256_cmp_pd(by, _mm256_add_pd(ay, ah), _CMP_LT_OQ));
+			return _mm256_and_pd(x, y);
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void IntersectMany_AVX2(const Circle* circles, const size_t count, const RectF& rect, uint64* results) noexcept
+		{
+			const __m256d rx = _mm256_set1_pd(rect.x), ry = _mm256_set1_pd(rect.y);
+			const __m256d rw = _mm256_set1_pd(rect.w), rh = _mm256_set1_pd(rect.h);
+			alignas(32) double x[SIMDCollisionBlockSize], y[SIMDCollisionBlockSize], r[SIMDCollisionBlockSize];
+
+			for (size_t blockBegin = 0; blockBegin < count; blockBegin += SIMDCollisionBlockSize)
+			{
+				const size_t blockSize = Min(SIMDCollisionBlockSize, (count - blockBegin));
+				const size_t paddedSize = ((blockSize + 3) & ~size_t{ 3 });
+
+				for (size_t i = 0; i < paddedSize; ++i)
+				{
+					const Circle& c = circles[blockBegin + Min(i, (blockSize - 1))];
+					x[i] = c.x; y[i] = c.y; r[i] = c.r;
+				}
+
+				uint64 mask = 0;
+
+				for (size_t i = 0; i < paddedSize; i += 4)
+				{
+					const __m256d m = RectCircle_AVX2(rx, ry, rw, rh, _mm256_load_pd(x + i), _mm256_load_pd(y + i), _mm256_load_pd(r + i));
+					mask |= (static_cast<uint64>(_mm256_movemask_pd(m)) << i);
+				}
+
+				results[blockBegin / SIMDCollisionBlockSize] = (mask & BlockMask(blockSize));
+			}
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void IntersectMany_AVX2(const Circle* circles, const size_t count, const Circle& circle, uint64* results) noexcept
+		{
+			const __m256d bx = _mm256_set1_pd(circle.x), by = _mm256_set1_pd(circle.y), br = _mm256_set1_pd(circle.r);
+			alignas(32) double x[SIMDCollisionBlockSize], y[SIMDCollisionBlockSize], r[SIMDCollisionBlockSize];
+
+			for (size_t blockBegin = 0; blockBegin < count; blockBegin += SIMDCollisionBlockSize)
+			{
+				const size_t blockSize = Min(SIMDCollisionBlockSize, (count - blockBegin));
+				const size_t paddedSize = ((blockSize + 3) & ~size_t{ 3 });
+
+				for (size_t i = 0; i < paddedSize; ++i)
+				{
+					const Circle& c = circles[blockBegin + Min(i, (blockSize - 1))];
+					x[i] = c.x; y[i] = c.y; r[i] = c.r;
+				}
+
+				uint64 mask = 0;
+
+				for (size_t i = 0; i < paddedSize; i += 4)
+				{
+					const __m256d m = CircleCircle_AVX2(_mm256_load_pd(x + i), _mm256_load_pd(y + i), _mm256_load_pd(r + i), bx, by, br);
+					mask |= (static_cast<uint64>(_mm256_movemask_pd(m)) << i);
+				}
+
+				results[blockBegin / SIMDCollisionBlockSize] = (mask & BlockMask(blockSize));
+			}
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void IntersectMany_AVX2(const RectF* rects, const size_t count, const RectF& rect, uint64* results) noexcept
+		{
+			const __m256d bx = _mm256_set1_pd(rect.x), by = _mm256_set1_pd(rect.y);
+			const __m256d bw = _mm256_set1_pd(rect.w), bh = _mm256_set1_pd(rect.h);
+			alignas(32) double x[SIMDCollisionBlockSize], y[SIMDCollisionBlockSize], w[SIMDCollisionBlockSize], h[SIMDCollisionBlockSize];
+
+			for (size_t blockBegin = 0; blockBegin < count; blockBegin += SIMDCollisionBlockSize)
+			{
+				const size_t blockSize = Min(SIMDCollisionBlockSize, (count - blockBegin));
+				const size_t paddedSize = ((blockSize + 3) & ~size_t{ 3 });
+
+				for (size_t i = 0; i < paddedSize; ++i)
+				{
+					const RectF& a = rects[blockBegin + Min(i, (blockSize - 1))];
+					x[i] = a.x; y[i] = a.y; w[i] = a.w; h[i] = a.h;
+				}
+
+				uint64 mask = 0;
+
+				for (size_t i = 0; i < paddedSize; i += 4)
+				{
+					const __m256d m = RectRect_AVX2(_mm256_load_pd(x + i), _mm256_load_pd(y + i), _mm256_load_pd(w + i), _mm256_load_pd(h + i), bx, by, bw, bh);
+					mask |= (static_cast<uint64>(_mm256_movemask_pd(m)) << i);
+				}
+
+				results[blockBegin / SIMDCollisionBlockSize] = (mask & BlockMask(blockSize));
+			}
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void IntersectMany_AVX2(const RectF* rects, const size_t count, const Circle& circle, uint64* results) noexcept
+		{
+			const __m256d cx = _mm256_set1_pd(circle.x), cy = _mm256_set1_pd(circle.y), cr = _mm256_set1_pd(circle.r);
+			alignas(32) double x[SIMDCollisionBlockSize], y[SIMDCollisionBlockSize], w[SIMDCollisionBlockSize], h[SIMDCollisionBlockSize];
+
+			for (size_t blockBegin = 0; blockBegin < count; blockBegin += SIMDCollisionBlockSize)
+			{
+				const size_t blockSize = Min(SIMDCollisionBlockSize, (count - blockBegin));
+				const size_t paddedSize = ((blockSize + 3) & ~size_t{ 3 });
+
+				for (size_t i = 0; i < paddedSize; ++i)
+				{
+					const RectF& a = rects[blockBegin + Min(i, (blockSize - 1))];
+					x[i] = a.x; y[i] = a.y; w[i] = a.w; h[i] = a.h;
+				}
+
+				uint64 mask = 0;
+
+				for (size_t i = 0; i < paddedSize; i += 4)
+				{
+					const __m256d m = RectCircle_AVX2(_mm256_load_pd(x + i), _mm256_load_pd(y + i), _mm256_load_pd(w + i), _mm256_load_pd(h + i), cx, cy, cr);
+					mask |= (static_cast<uint64>(_mm256_movemask_pd(m)) << i);
+				}
+
+				results[blockBegin / SIMDCollisionBlockSize] = (mask & BlockMask(blockSize));
+			}
+		}
+
+		static void AppendHits(uint32 mask, const size_t offset, Array<size_t>& hits)
+		{
+			while (mask)
+			{
+				hits << (offset + std::countr_zero(mask));
+				mask &= (mask - 1);
+			}
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void FindCircleRects_AVX2(const Circle& circle, const ActiveRects& rects, Array<size_t>& hits)
+		{
+			const __m256d cx = _mm256_set1_pd(circle.x), cy = _mm256_set1_pd(circle.y), cr = _mm256_set1_pd(circle.r);
+			const size_t count = rects.size();
+			const size_t vectorCount = (count & ~size_t{ 3 });
+
+			for (size_t k = 0; k < vectorCount; k += 4)
+			{
+				const __m256d m = RectCircle_AVX2(_mm256_loadu_pd(rects.x.data() + k), _mm256_loadu_pd(rects.y.data() + k),
+					_mm256_loadu_pd(rects.w.data() + k), _mm256_loadu_pd(rects.h.data() + k), cx, cy, cr);
+				AppendHits(static_cast<uint32>(_mm256_movemask_pd(m)), k, hits);
+			}
+
+			for (size_t k = vectorCount; k < count; ++k)
+			{
+				if (Geometry2D::Intersect(RectF{ rects.x[k], rects.y[k], rects.w[k], rects.h[k] }, circle))
+				{
+					hits << k;
+				}
+			}
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void FindRectCircles_AVX2(const RectF& rect, const ActiveCircles& circles, Array<size_t>& hits)
+		{
+			const __m256d rx = _mm256_set1_pd(rect.x), ry = _mm256_set1_pd(rect.y);
+			const __m256d rw = _mm256_set1_pd(rect.w), rh = _mm256_set1_pd(rect.h);
+			const size_t count = circles.size();
+			const size_t vectorCount = (count & ~size_t{ 3 });
+
+			for (size_t k = 0; k < vectorCount; k += 4)
+			{
+				const __m256d m = RectCircle_AVX2(rx, ry, rw, rh,
+					_mm256_loadu_pd(circles.x.data() + k), _mm256_loadu_pd(circles.y.data() + k), _mm256_loadu_pd(circles.r.data() + k));
+				AppendHits(static_cast<uint32>(_mm256_movemask_pd(m)), k, hits);
+			}
+
+			for (size_t k = vectorCount; k < count; ++k)
+			{
+				if (Geometry2D::Intersect(rect, Circle{ circles.x[k], circles.y[k], circles.r[k] }))
+				{
+					hits << k;
+				}
+			}
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void FindCircleCircles_AVX2(const Circle& circle, const ActiveCircles& circles, Array<size_t>& hits)
+		{
+			const __m256d bx = _mm256_set1_pd(circle.x), by = _mm256_set1_pd(circle.y), br = _mm256_set1_pd(circle.r);
+			const size_t count = circles.size();
+			const size_t vectorCount = (count & ~size_t{ 3 });
+
+			for (size_t k = 0; k < vectorCount; k += 4)
+			{
+				const __m256d m = CircleCircle_AVX2(_mm256_loadu_pd(circles.x.data() + k), _mm256_loadu_pd(circles.y.data() + k),
+					_mm256_loadu_pd(circles.r.data() + k), bx, by, br);
+				AppendHits(static_cast<uint32>(_mm256_movemask_pd(m)), k, hits);
+			}
+
+			for (size_t k = vectorCount; k < count; ++k)
+			{
+				if (Geometry2D::Intersect(Circle{ circles.x[k], circles.y[k], circles.r[k] }, circle))
+				{
+					hits << k;
+				}
+			}
+		}
+
+		SIV3D_SIMDCOLLISION_AVX2
+		static void FindRectRects_AVX2(const RectF& rect, const ActiveRects& rects, Array<size_t>& hits)
+		{
+			const __m256d bx = _mm256_set1_pd(rect.x), by = _mm256_set1_pd(rect.y);
+			const __m256d bw = _mm256_set1_pd(rect.w), bh = _mm256_set1_pd(rect.h);
+			const size_t count = rects.size();
+			const size_t vectorCount = (count & ~size_t{ 3 });
+
+			for (size_t k = 0; k < vectorCount; k += 4)
+			{
+				const __m256d m = RectRect_AVX2(_mm256_loadu_pd(rects.x.data() + k), _mm256_loadu_pd(rects.y.data() + k),
+					_mm256_loadu_pd(rects.w.data() + k), _mm256_loadu_pd(rects.h.data() + k), bx, by, bw, bh);
+				AppendHits(static_cast<uint32>(_mm256_movemask_pd(m)), k, hits);
+			}
+
+			for (size_t k = vectorCount; k < count; ++k)
+			{
+				if (Geometry2D::Intersect(RectF{ rects.x[k], rects.y[k], rects.w[k], rects.h[k] }, rect))
+				{
+					hits << k;
+				}
+			}
+		}
+
+	# endif
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Dispatch
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		static bool HasAVX2() noexcept
+		{
+		# if SIV3D_SIMDCOLLISION_AVX2_ENABLED
+
+			return GetCPUInfo().features.avx2;
+
+		# else
+
+			return false;
+
+		# endif
+		}
+
+		template <class Shape, class Query>
+		static void IntersectMany(const Array<Shape>& shapes, const Query& query, Array<uint64>& results)
+		{
+			results.resize(WordCount(shapes.size()));
+
+			if (shapes.isEmpty())
+			{
+				return;
+			}
+
+		# if SIV3D_SIMDCOLLISION_AVX2_ENABLED
+
+			if (HasAVX2())
+			{
+				return IntersectMany_AVX2(shapes.data(), shapes.size(), query, results.data());
+			}
+
+		# endif
+
+			IntersectMany_Reference(shapes.data(), shapes.size(), query, results.data());
+		}
+
+		static void FindCircleRects(const bool avx2, const Circle& circle, const ActiveRects& rects, Array<size_t>& hits)
+		{
+		# if SIV3D_SIMDCOLLISION_AVX2_ENABLED
+
+			if (avx2)
+			{
+				return FindCircleRects_AVX2(circle, rects, hits);
+			}
+
+		# endif
+
+			(void)avx2;
+			FindCircleRects_Reference(circle, rects, hits);
+		}
+
+		static void FindRectCircles(const bool avx2, const RectF& rect, const ActiveCircles& circles, Array<size_t>& hits)
+		{
+		# if SIV3D_SIMDCOLLISION_AVX2_ENABLED
+
+			if (avx2)
+			{
+				return FindRectCircles_AVX2(rect, circles, hits);
+			}
+
+		# endif
+
+			(void)avx2;
+			FindRectCircles_Reference(rect, circles, hits);
+		}
+
+		static void FindCircleCircles(const bool avx2, const Circle& circle, const ActiveCircles& circles, Array<size_t>& hits)
+		{
+		# if SIV3D_SIMDCOLLISION_AVX2_ENABLED
+
+			if (avx2)
+			{
+				return FindCircleCircles_AVX2(circle, circles, hits);
+			}
+
+		# endif
+
+			(void)avx2;
+			FindCircleCircles_Reference(circle, circles, hits);
+		}
+
+		static void FindRectRects(const bool avx2, const RectF& rect, const ActiveRects& rects, Array<size_t>& hits)
+		{
+		# if SIV3D_SIMDCOLLISION_AVX2_ENABLED
+
+			if (avx2)
+			{
+				return FindRectRects_AVX2(rect, rects, hits);
+			}
+
+		# endif
+
+			(void)avx2;
+			FindRectRects_Reference(rect, rects, hits);
+		}
+
+		/// @brief x 軸方向の区間の左端の昇順に並べたインデックスを返します。
+		template <class Shape, class MinX>
+		[[nodiscard]]
+		static Array<size_t> SortByMinX(const Array<Shape>& shapes, MinX minX)
+		{
+			Array<double> keys(Arg::reserve = shapes.size());
+
+			for (const auto& shape : shapes)
+			{
+				keys << minX(shape);
+			}
+
+			Array<size_t> order(shapes.size());
+
+			for (size_t i = 0; i < order.size(); ++i)
+			{
+				order[i] = i;
+			}
+
+			std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b)
+				{
+					return (keys[a] < keys[b]) || ((keys[a] == keys[b]) && (a < b));
+				});
+
+			return order;
+		}
+
+		[[nodiscard]]
+		static double CircleMinX(const Circle& circle) noexcept
+		{
+			return (circle.x - circle.r);
+		}
+
+		[[nodiscard]]
+		static double RectMinX(const RectF& rect) noexcept
+		{
+			return rect.x;
+		}
+	}
+
+	namespace SIMDCollision
+	{
+		Array<uint64> IntersectMany(const Array<Circle>& circles, const RectF& rect)
+		{
+			Array<uint64> results;
+			detail::IntersectMany(circles, rect, results);
+			return results;
+		}
+
+		void IntersectMany(const Array<Circle>& circles, const RectF& rect, Array<uint64>& results)
+		{
+			detail::IntersectMany(circles, rect, results);
+		}
+
+		Array<uint64> IntersectMany(const Array<Circle>& circles, const Circle& circle)
+		{
+			Array<uint64> results;
+			detail::IntersectMany(circles, circle, results);
+			return results;
+		}
+
+		void IntersectMany(const Array<Circle>& circles, const Circle& circle, Array<uint64>& results)
+		{
+			detail::IntersectMany(circles, circle, results);
+		}
+
+		Array<uint64> IntersectMany(const Array<RectF>& rects, const RectF& rect)
+		{
+			Array<uint64> results;
+			detail::IntersectMany(rects, rect, results);
+			return results;
+		}
+
+		void IntersectMany(const Array<RectF>& rects, const RectF& rect, Array<uint64>& results)
+		{
+			detail::IntersectMany(rects, rect, results);
+		}
+
+		Array<uint64> IntersectMany(const Array<RectF>& rects, const Circle& circle)
+		{
+			Array<uint64> results;
+			detail::IntersectMany(rects, circle, results);
+			return results;
+		}
+
+		void IntersectMany(const Array<RectF>& rects, const Circle& circle, Array<uint64>& results)
+		{
+			detail::IntersectMany(rects, circle, results);
+		}
+
+		Array<std::pair<size_t, size_t>> IntersectPairs(const Array<Circle>& circles, const Array<RectF>& rects)
+		{
+			const bool avx2 = detail::HasAVX2();
+			const Array<size_t> circleOrder = detail::SortByMinX(circles, detail::CircleMinX);
+			const Array<size_t> rectOrder = detail::SortByMinX(rects, detail::RectMinX);
+
+			detail::ActiveCircles activeCircles;
+			detail::ActiveRects activeRects;
+			Array<size_t> hits;
+			Array<std::pair<size_t, size_t>> results;
+
+			size_t ci = 0, ri = 0;
+
+			// 左端の小さいほうから順に、区間が重なる相手とだけ判定する
+			while ((ci < circleOrder.size()) || (ri < rectOrder.size()))
+			{
+				const bool takeCircle = ((ri == rectOrder.size())
+					|| ((ci < circleOrder.size()) && (detail::CircleMinX(circles[circleOrder[ci]]) <= rects[rectOrder[ri]].x)));
+
+				hits.clear();
+
+				if (takeCircle)
+				{
+					const size_t index = circleOrder[ci++];
+					const Circle& circle = circles[index];
+
+					activeRects.prune(detail::CircleMinX(circle));
+					detail::FindCircleRects(avx2, circle, activeRects, hits);
+
+					for (const size_t k : hits)
+					{
+						results.emplace_back(index, activeRects.index[k]);
+					}
+
+					activeCircles.add(circle, index);
+				}
+				else
+				{
+					const size_t index = rectOrder[ri++];
+					const RectF& rect = rects[index];
+
+					activeCircles.prune(rect.x);
+					detail::FindRectCircles(avx2, rect, activeCircles, hits);
+
+					for (const size_t k : hits)
+					{
+						results.emplace_back(activeCircles.index[k], index);
+					}
+
+					activeRects.add(rect, index);
+				}
+			}
+
+			std::sort(results.begin(), results.end());
+
+			return results;
+		}
+
+		Array<std::pair<size_t, size_t>> IntersectPairs(const Array<Circle>& circles)
+		{
+			const bool avx2 = detail::HasAVX2();
+			const Array<size_t> order = detail::SortByMinX(circles, detail::CircleMinX);
+
+			detail::ActiveCircles active;
+			Array<size_t> hits;
+			Array<std::pair<size_t, size_t>> results;
+
+			for (const size_t index : order)
+			{
+				const Circle& circle = circles[index];
+
+				active.prune(detail::CircleMinX(circle));
+
+				hits.clear();
+				detail::FindCircleCircles(avx2, circle, active, hits);
+
+				for (const size_t k : hits)
+				{
+					const size_t other = active.index[k];
+					results.emplace_back(Min(index, other), Max(index, other));
+				}
+
+				active.add(circle, index);
+			}
+
+			std::sort(results.begin(), results.end());
+
+			return results;
+		}
+
+		Array<std::pair<size_t, size_t>> IntersectPairs(const Array<RectF>& rects)
+		{
+			const bool avx2 = detail::HasAVX2();
+			const Array<size_t> order = detail::SortByMinX(rects, detail::RectMinX);
+
+			detail::ActiveRects active;
+			Array<size_t> hits;
+			Array<std::pair<size_t, size_t>> results;
+
+			for (const size_t index : order)
+			{
+				const RectF& rect = rects[index];
+
+				active.prune(rect.x);
+
+				hits.clear();
+				detail::FindRectRects(avx2, rect, active, hits);
+
+				for (const size_t k : hits)
+				{
+					const size_t other = active.index[k];
+					results.emplace_back(Min(index, other), Max(index, other));
+				}
+
+				active.add(rect, index);
+			}
+
+			std::sort(results.begin(), results.end());
+
+			return results;
+		}
+	}
+}
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/System.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/System/ISystem.hpp>
 # include <Siv3D/Renderer/IRenderer.hpp>
 # include <Siv3D/UserAction/IUserAction.hpp>
@@ -21,6 +22,8 @@ namespace s3d
 	{
 		bool Update()
 		{
+			const ProfilerZone profilerZone{ U"System::Update" };
+
 			return SIV3D_ENGINE(System)->update();
 		}
 
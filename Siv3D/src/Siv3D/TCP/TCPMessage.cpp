@@ -0,0 +1,66 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Utility.hpp>
+# include "TCPMessage.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		size_t EncodeTCPMessageHeader(uint64 length, Byte* dst) noexcept
+		{
+			size_t size = 0;
+
+			while (0x80 <= length)
+			{
+				dst[size++] = static_cast<Byte>((length & 0x7F) | 0x80);
+				length >>= 7;
+			}
+
+			dst[size++] = static_cast<Byte>(length);
+
+			return size;
+		}
+
+		TCPMessageHeaderStatus DecodeTCPMessageHeader(const std::span<const Byte> data, uint64& length, size_t& headerSize) noexcept
+		{
+			uint64 value = 0;
+
+			for (size_t i = 0; i < Min(data.size(), TCPMessageMaxHeaderSize); ++i)
+			{
+				const uint64 b = static_cast<uint8>(data[i]);
+
+				// 10 バイト目は 64 ビット目の 1 ビットしか持てない
+				if ((i == (TCPMessageMaxHeaderSize - 1)) && (1 < b))
+				{
+					return TCPMessageHeaderStatus::Invalid;
+				}
+
+				value |= ((b & 0x7F) << (7 * i));
+
+				if ((b & 0x80) == 0)
+				{
+					length = value;
+					headerSize = (i + 1);
+					return TCPMessageHeaderStatus::OK;
+				}
+			}
+
+			if (TCPMessageMaxHeaderSize <= data.size())
+			{
+				return TCPMessageHeaderStatus::Invalid;
+			}
+
+			return TCPMessageHeaderStatus::Incomplete;
+		}
+	}
+}
@@ -0,0 +1,52 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <span>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Byte.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief メッセージのヘッダ（可変長の長さ）の最大のバイト数
+		inline constexpr size_t TCPMessageMaxHeaderSize = 10;
+
+		/// @brief メッセージのヘッダの解析結果
+		enum class TCPMessageHeaderStatus : uint8
+		{
+			/// @brief ヘッダを解析できた
+			OK,
+
+			/// @brief ヘッダの途中までしか受信していない
+			Incomplete,
+
+			/// @brief 不正なヘッダ
+			Invalid,
+		};
+
+		/// @brief メッセージの長さを可変長整数（LEB128）で書き込みます。
+		/// @param length メッセージの長さ（バイト）
+		/// @param dst 書き込み先。`TCPMessageMaxHeaderSize` バイト以上の領域が必要です
+		/// @return 書き込んだバイト数
+		[[nodiscard]]
+		size_t EncodeTCPMessageHeader(uint64 length, Byte* dst) noexcept;
+
+		/// @brief 受信したデータの先頭からメッセージの長さを読み込みます。
+		/// @param data 受信したデータ
+		/// @param length メッセージの長さ（バイト）の格納先
+		/// @param headerSize ヘッダのバイト数の格納先
+		/// @return 解析結果
+		[[nodiscard]]
+		TCPMessageHeaderStatus DecodeTCPMessageHeader(std::span<const Byte> data, uint64& length, size_t& headerSize) noexcept;
+	}
+}
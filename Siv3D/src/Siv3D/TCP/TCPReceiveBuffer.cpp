@@ -0,0 +1,180 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <bit>
+# include "TCPReceiveBuffer.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		TCPReceiveBuffer::TCPReceiveBuffer(const size_t maxSize)
+			: m_maxSize{ maxSize } {}
+
+		bool TCPReceiveBuffer::write(const void* data, const size_t size)
+		{
+			if (size == 0)
+			{
+				return true;
+			}
+
+			std::lock_guard lock{ m_mutex };
+
+			if (m_maxSize < (m_size + size))
+			{
+				return false;
+			}
+
+			if (m_storage.size() < (m_size + size))
+			{
+				reallocate(Max(std::bit_ceil(m_size + size), InitialCapacity));
+			}
+
+			const size_t capacity = m_storage.size();
+			const size_t tail = ((m_head + m_size) & (capacity - 1));
+			const size_t firstSize = Min(size, (capacity - tail));
+
+			std::memcpy((m_storage.data() + tail), data, firstSize);
+			std::memcpy(m_storage.data(), (static_cast<const Byte*>(data) + firstSize), (size - firstSize));
+
+			m_size += size;
+
+			return true;
+		}
+
+		size_t TCPReceiveBuffer::size() const
+		{
+			std::lock_guard lock{ m_mutex };
+
+			return m_size;
+		}
+
+		bool TCPReceiveBuffer::read(void* dst, const size_t size)
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_retired.clear();
+
+			if (m_size < size)
+			{
+				return false;
+			}
+
+			copyTo(dst, size);
+
+			m_head = ((m_head + size) & (m_storage.size() - 1));
+			m_size -= size;
+
+			return true;
+		}
+
+		bool TCPReceiveBuffer::lookahead(void* dst, const size_t size) const
+		{
+			std::lock_guard lock{ m_mutex };
+
+			if (m_size < size)
+			{
+				return false;
+			}
+
+			copyTo(dst, size);
+
+			return true;
+		}
+
+		bool TCPReceiveBuffer::skip(const size_t size)
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_retired.clear();
+
+			if (m_size < size)
+			{
+				return false;
+			}
+
+			if (size != 0)
+			{
+				m_head = ((m_head + size) & (m_storage.size() - 1));
+				m_size -= size;
+			}
+
+			return true;
+		}
+
+		std::span<const Byte> TCPReceiveBuffer::peek()
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_retired.clear();
+
+			if (m_size == 0)
+			{
+				return{};
+			}
+
+			if (m_storage.size() < (m_head + m_size))
+			{
+				// 折り返している場合は並べ直す。古い領域は解放しない
+				reallocate(m_storage.size());
+			}
+
+			return{ (m_storage.data() + m_head), m_size };
+		}
+
+		void TCPReceiveBuffer::clear()
+		{
+			std::lock_guard lock{ m_mutex };
+
+			// 受信スレッドから呼ばれることもあるため、peek() で返した領域はここでは解放しない
+			if (m_storage)
+			{
+				m_retired.push_back(std::move(m_storage));
+			}
+
+			m_head = 0;
+			m_size = 0;
+		}
+
+		void TCPReceiveBuffer::reallocate(const size_t newCapacity)
+		{
+			Array<Byte> newStorage(newCapacity);
+
+			if (m_size)
+			{
+				copyTo(newStorage.data(), m_size);
+			}
+
+			// 受信スレッドは古い領域に書き込まないので、peek() で返した領域の内容は変わらない
+			if (m_storage)
+			{
+				m_retired.push_back(std::move(m_storage));
+			}
+
+			m_storage = std::move(newStorage);
+			m_head = 0;
+		}
+
+		void TCPReceiveBuffer::copyTo(void* dst, const size_t size) const noexcept
+		{
+			if (size == 0)
+			{
+				return;
+			}
+
+			const size_t capacity = m_storage.size();
+			const size_t firstSize = Min(size, (capacity - m_head));
+
+			std::memcpy(dst, (m_storage.data() + m_head), firstSize);
+			std::memcpy((static_cast<Byte*>(dst) + firstSize), m_storage.data(), (size - firstSize));
+		}
+	}
+}
@@ -0,0 +1,97 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <mutex>
+# include <span>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Byte.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief TCP セッションの受信データを保持するリングバッファ
+		/// @remark 書き込みは受信スレッド（1 つ）から、読み込みはユーザのスレッド（1 つ）から行います。
+		/// @remark 読み込み済みの領域は先頭を進めるだけで解放されるため、read() / skip() はデータ量によらず O(1) です。
+		class TCPReceiveBuffer
+		{
+		public:
+
+			/// @brief リングバッファを作成します。
+			/// @param maxSize 保持できる最大のバイト数
+			SIV3D_NODISCARD_CXX20
+			explicit TCPReceiveBuffer(size_t maxSize);
+
+			/// @brief 受信したデータを追加します。受信スレッドから呼びます。
+			/// @param data データの先頭
+			/// @param size データのサイズ（バイト）
+			/// @return 追加に成功した場合 true, 最大サイズを超える場合は false
+			[[nodiscard]]
+			bool write(const void* data, size_t size);
+
+			/// @brief 保持しているデータのサイズ（バイト）を返します。
+			[[nodiscard]]
+			size_t size() const;
+
+			/// @brief 先頭からデータをコピーして取り除きます。
+			/// @return 十分なデータがあった場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool read(void* dst, size_t size);
+
+			/// @brief 先頭からデータをコピーします。データは取り除きません。
+			/// @return 十分なデータがあった場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool lookahead(void* dst, size_t size) const;
+
+			/// @brief 先頭からデータを取り除きます。
+			/// @return 十分なデータがあった場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool skip(size_t size);
+
+			/// @brief 保持しているすべてのデータを、コピーせずに参照します。
+			/// @return 保持しているデータ
+			/// @remark データがバッファの終端で折り返している場合は、連続した領域に並べ直します。
+			/// @remark 返した領域は、次に読み込み側の関数を呼ぶまで有効です。受信スレッドによって上書き・解放されることはありません。
+			[[nodiscard]]
+			std::span<const Byte> peek();
+
+			/// @brief すべてのデータを破棄します。
+			/// @remark 領域は次に読み込み側の関数を呼んだときに解放されます。
+			void clear();
+
+		private:
+
+			static constexpr size_t InitialCapacity = (4 * 1024);
+
+			mutable std::mutex m_mutex;
+
+			// 容量は常に 2 の累乗
+			Array<Byte> m_storage;
+
+			// 先頭の位置
+			size_t m_head = 0;
+
+			// 保持しているバイト数
+			size_t m_size = 0;
+
+			size_t m_maxSize = 0;
+
+			// 容量の変更で使われなくなった領域。peek() で返した領域が参照している可能性があるため、次の読み込みまで保持する
+			Array<Array<Byte>> m_retired;
+
+			void reallocate(size_t newCapacity);
+
+			void copyTo(void* dst, size_t size) const noexcept;
+		};
+	}
+}
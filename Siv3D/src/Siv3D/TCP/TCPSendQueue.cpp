@@ -0,0 +1,134 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "TCPSendQueue.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		bool TCPSendQueue::push(const std::span<const Byte> header, const void* data, const size_t size)
+		{
+			const size_t totalSize = (header.size() + size);
+
+			if (totalSize == 0)
+			{
+				return false;
+			}
+
+			std::lock_guard lock{ m_mutex };
+
+			// 直前のチャンクに収まらなければ、新しいチャンクに書き込む
+			if (m_pending.isEmpty()
+				|| (ChunkSize < (m_pending.back().size() + totalSize)))
+			{
+				m_pending.push_back(acquire(Max(totalSize, ChunkSize)));
+			}
+
+			Array<Byte>& chunk = m_pending.back();
+			chunk.insert(chunk.end(), header.begin(), header.end());
+			chunk.insert(chunk.end(), static_cast<const Byte*>(data), (static_cast<const Byte*>(data) + size));
+
+			if (m_isSending)
+			{
+				return false;
+			}
+
+			m_isSending = true;
+
+			return true;
+		}
+
+		const Array<Array<Byte>>& TCPSendQueue::beginFlush()
+		{
+			std::lock_guard lock{ m_mutex };
+
+			// 書き込み中のデータには、通信スレッドだけがアクセスする
+			m_inFlight.swap(m_pending);
+
+			m_flushCount.fetch_add(1, std::memory_order_relaxed);
+
+			return m_inFlight;
+		}
+
+		bool TCPSendQueue::endFlush()
+		{
+			std::lock_guard lock{ m_mutex };
+
+			for (auto& chunk : m_inFlight)
+			{
+				release(std::move(chunk));
+			}
+
+			m_inFlight.clear();
+
+			if (m_pending)
+			{
+				return true;
+			}
+
+			m_isSending = false;
+
+			return false;
+		}
+
+		void TCPSendQueue::clear()
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_pending.clear();
+		}
+
+		void TCPSendQueue::finish()
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_pending.clear();
+			m_inFlight.clear();
+			m_pool.clear();
+			m_isSending = false;
+		}
+
+		uint64 TCPSendQueue::getFlushCount() const noexcept
+		{
+			return m_flushCount.load(std::memory_order_relaxed);
+		}
+
+		Array<Byte> TCPSendQueue::acquire(const size_t capacity)
+		{
+			Array<Byte> chunk;
+
+			if (m_pool)
+			{
+				chunk = std::move(m_pool.back());
+				m_pool.pop_back();
+			}
+
+			chunk.reserve(capacity);
+
+			return chunk;
+		}
+
+		void TCPSendQueue::release(Array<Byte>&& chunk)
+		{
+			// 大きなメッセージ用に確保した領域は再利用しない
+			if ((MaxPooledChunks <= m_pool.size())
+				|| (ChunkSize < chunk.capacity()))
+			{
+				return;
+			}
+
+			chunk.clear();
+
+			m_pool.push_back(std::move(chunk));
+		}
+	}
+}
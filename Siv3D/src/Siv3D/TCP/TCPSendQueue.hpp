@@ -0,0 +1,91 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <mutex>
+# include <span>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Byte.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief TCP セッションの送信待ちのデータを保持するキュー
+		/// @remark 追加はユーザのスレッドから、送信は通信スレッドから行います。
+		/// @remark 小さなデータは固定サイズのチャンクにまとめて詰め、送信中に追加されたデータは次の 1 回の書き込み（ギャザー書き込み）でまとめて送ります。
+		/// @remark 送信し終えたチャンクはプールに戻して再利用します。
+		class TCPSendQueue
+		{
+		public:
+
+			/// @brief 1 つのチャンクの容量（バイト）
+			static constexpr size_t ChunkSize = (64 * 1024);
+
+			/// @brief データを追加します。
+			/// @param header 先頭に付けるデータ。不要な場合は空
+			/// @param data データの先頭
+			/// @param size データのサイズ（バイト）
+			/// @return 送信を開始する必要がある場合 true, 送信中でまとめて送られる場合は false
+			[[nodiscard]]
+			bool push(std::span<const Byte> header, const void* data, size_t size);
+
+			/// @brief 送信待ちのデータを、送信中のデータとして取り出します。通信スレッドから呼びます。
+			/// @return 送信するチャンクの一覧。次に `endFlush()` を呼ぶまで有効です
+			[[nodiscard]]
+			const Array<Array<Byte>>& beginFlush();
+
+			/// @brief 送信が完了したことを通知します。通信スレッドから呼びます。
+			/// @return 続けて送信するデータがある場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool endFlush();
+
+			/// @brief 送信待ちのデータを破棄します。
+			/// @remark 送信中のデータは `finish()` まで保持します。
+			void clear();
+
+			/// @brief 送信中のデータも含めてすべて破棄します。書き込みが完了した後に、通信スレッドから呼びます。
+			void finish();
+
+			/// @brief これまでに `beginFlush()` で送信を開始した回数（ソケットへの書き込みの回数）を返します。
+			/// @return 送信を開始した回数
+			[[nodiscard]]
+			uint64 getFlushCount() const noexcept;
+
+		private:
+
+			// プールに保持するチャンクの最大数
+			static constexpr size_t MaxPooledChunks = 16;
+
+			std::mutex m_mutex;
+
+			// 送信待ちのデータ
+			Array<Array<Byte>> m_pending;
+
+			// 書き込み中のデータ
+			Array<Array<Byte>> m_inFlight;
+
+			// 再利用するチャンク
+			Array<Array<Byte>> m_pool;
+
+			bool m_isSending = false;
+
+			std::atomic<uint64> m_flushCount = 0;
+
+			[[nodiscard]]
+			Array<Byte> acquire(size_t capacity);
+
+			void release(Array<Byte>&& chunk);
+		};
+	}
+}
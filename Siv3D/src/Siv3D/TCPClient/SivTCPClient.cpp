@@ -74,8 +74,43 @@ namespace s3d
 		return pImpl->read(dst, size);
 	}
 
+	std::span<const Byte> TCPClient::peek()
+	{
+		return pImpl->peek();
+	}
+
+	bool TCPClient::consume(const size_t size)
+	{
+		return pImpl->skip(size);
+	}
+
 	bool TCPClient::send(const void* data, const size_t size)
 	{
 		return pImpl->send(data, size);
 	}
+
+	bool TCPClient::sendMessage(const void* data, const size_t size)
+	{
+		return pImpl->sendMessage(data, size);
+	}
+
+	bool TCPClient::receiveMessage(Array<Byte>& message)
+	{
+		return pImpl->receiveMessage(message);
+	}
+
+	void TCPClient::setMaxMessageSize(const size_t size)
+	{
+		pImpl->setMaxMessageSize(size);
+	}
+
+	size_t TCPClient::maxMessageSize() const
+	{
+		return pImpl->maxMessageSize();
+	}
+
+	uint64 TCPClient::getWriteCount() const
+	{
+		return pImpl->getWriteCount();
+	}
 }
@@ -212,6 +212,16 @@ namespace s3d
 		return m_session->read(dst, size);
 	}
 
+	std::span<const Byte> TCPClient::TCPClientDetail::peek()
+	{
+		if (!m_session)
+		{
+			return{};
+		}
+
+		return m_session->peek();
+	}
+
 	bool TCPClient::TCPClientDetail::send(const void* data, const size_t size)
 	{
 		if (!m_session)
@@ -221,4 +231,50 @@ namespace s3d
 
 		return m_session->send(data, size);
 	}
+
+	bool TCPClient::TCPClientDetail::sendMessage(const void* data, const size_t size)
+	{
+		if (!m_session)
+		{
+			return false;
+		}
+
+		if (m_maxMessageSize < size)
+		{
+			LOG_FAIL(U"TCPClient: message size ({} bytes) exceeds the maximum message size ({} bytes)"_fmt(size, m_maxMessageSize));
+			return false;
+		}
+
+		return m_session->sendMessage(data, size);
+	}
+
+	bool TCPClient::TCPClientDetail::receiveMessage(Array<Byte>& message)
+	{
+		if (!m_session)
+		{
+			return false;
+		}
+
+		return m_session->receiveMessage(message, m_maxMessageSize);
+	}
+
+	void TCPClient::TCPClientDetail::setMaxMessageSize(const size_t size)
+	{
+		m_maxMessageSize = Min(size, detail::ClientSession::MaxMessageSize);
+	}
+
+	size_t TCPClient::TCPClientDetail::maxMessageSize() const
+	{
+		return m_maxMessageSize;
+	}
+
+	uint64 TCPClient::TCPClientDetail::getWriteCount() const
+	{
+		if (!m_session)
+		{
+			return 0;
+		}
+
+		return m_session->getWriteCount();
+	}
 }
@@ -15,6 +15,9 @@
 # include <Siv3D/Byte.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/TCP/TCPReceiveBuffer.hpp>
+# include <Siv3D/TCP/TCPSendQueue.hpp>
+# include <Siv3D/TCP/TCPMessage.hpp>
 
 # define _WINSOCK_DEPRECATED_NO_WARNINGS
 # ifndef _WIN32_WINNT
@@ -38,36 +41,67 @@ namespace s3d
 
 			TCPError m_error = TCPError::OK;
 
-			bool m_isActive = false;
-
-			asio::streambuf m_streamBuffer;
+			std::atomic<bool> m_isActive = false;
 
 			// 受信	
 			static constexpr size_t maxBufferSize = 32 * 1024 * 1024;
 
-			std::mutex m_mutexReceivedBuffer;
+			static constexpr size_t receiveChunkSize = 64 * 1024;
 
-			Array<Byte> m_receivedBuffer;
+			// ソケットから直接読み込む領域
+			Array<Byte> m_receiveChunk = Array<Byte>(receiveChunkSize);
 
+			TCPReceiveBuffer m_receivedBuffer{ maxBufferSize };
 
-			// 送信
-			std::mutex m_mutexSendingBuffer;
 
-			Array<Array<Byte>> m_sendingBuffer;
+			// 送信
+			TCPSendQueue m_sendQueue;
 
-			bool m_isSending = false;
+			// ギャザー書き込みに渡すバッファの一覧
+			Array<asio::const_buffer> m_sendBuffers;
 
 
-			void send_internal()
+			void flush(const std::shared_ptr<ClientSession>&)
 			{
-				m_isSending = true;
+				if (!m_isActive)
+				{
+					m_sendQueue.finish();
+					return;
+				}
+
+				m_sendBuffers.clear();
 
-				asio::async_write(m_socket, asio::buffer(m_sendingBuffer.front().data(), m_sendingBuffer.front().size()),
+				for (const auto& chunk : m_sendQueue.beginFlush())
+				{
+					m_sendBuffers.push_back(asio::buffer(chunk.data(), chunk.size()));
+				}
+
+				asio::async_write(m_socket, m_sendBuffers,
 					std::bind(&ClientSession::onSend, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
 			}
 
+			bool enqueue(const std::span<const Byte> header, const void* data, const size_t size)
+			{
+				if (!m_isActive)
+				{
+					return false;
+				}
+
+				// 同じフレームで送られたデータを 1 回の書き込みにまとめるため、送信は通信スレッドで行う
+				if (m_sendQueue.push(header, data, size))
+				{
+					asio::post(m_socket.get_executor(),
+						std::bind(&ClientSession::flush, this, shared_from_this()));
+				}
+
+				return true;
+			}
+
 		public:
 
+			/// @brief 受信できるメッセージの最大サイズ（バイト）
+			static constexpr size_t MaxMessageSize = (maxBufferSize - TCPMessageMaxHeaderSize);
+
 			ClientSession(asio::io_service& io_service)
 				: m_socket(io_service)
 			{
@@ -88,7 +122,8 @@ namespace s3d
 
 			void close()
 			{
-				if (!m_isActive)
+				// 受信スレッドとユーザのスレッドの両方から呼ばれても、一度だけ閉じる
+				if (!m_isActive.exchange(false))
 				{
 					return;
 				}
@@ -100,25 +135,11 @@ namespace s3d
 
 				m_socket.close();
 
-				if (!m_isSending)
-				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-					m_sendingBuffer.clear();
-				}
+				m_sendQueue.clear();
 
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-					m_receivedBuffer.clear();
-					m_streamBuffer.consume(m_streamBuffer.size());
-				}
+				m_receivedBuffer.clear();
 
-				if (m_isActive)
-				{
-					LOG_TRACE(U"Session closed");
-				}
-
-				m_isSending = false;
-				m_isActive = false;
+				LOG_TRACE(U"Session closed");
 			}
 
 			bool isActive() const
@@ -133,21 +154,30 @@ namespace s3d
 
 			size_t available()
 			{
-				std::lock_guard lock{ m_mutexReceivedBuffer };
-
 				return m_receivedBuffer.size();
 			}
 
+			uint64 getWriteCount() const noexcept
+			{
+				return m_sendQueue.getFlushCount();
+			}
+
 			void startReceive()
 			{
-				asio::async_read(m_socket, m_streamBuffer, asio::transfer_at_least(1),
+				m_socket.async_read_some(asio::buffer(m_receiveChunk.data(), m_receiveChunk.size()),
 					std::bind(&ClientSession::onReceive, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
 			}
 
-			void onReceive(const asio::error_code& error, size_t, const std::shared_ptr<ClientSession>&)
+			void onReceive(const asio::error_code& error, const size_t size, const std::shared_ptr<ClientSession>&)
 			{
 				if (error)
 				{
+					// close() によって中断された場合は、切断の理由を上書きしない
+					if (!m_isActive)
+					{
+						return;
+					}
+
 					if (error != asio::error::eof)
 					{
 						LOG_FAIL(U"TCPClient: onReceive failed: {}"_fmt(Unicode::Widen(error.message())));
@@ -161,48 +191,30 @@ namespace s3d
 						m_error = TCPError::EoF;
 					}
 
-					m_streamBuffer.consume(m_streamBuffer.size());
-
 					close();
 
 					return;
 				}
 
-				const Byte* data = asio::buffer_cast<const Byte*>(m_streamBuffer.data());
-				const size_t size = m_streamBuffer.size();
-
+				if (!m_receivedBuffer.write(m_receiveChunk.data(), size))
 				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (m_receivedBuffer.size() + size > maxBufferSize)
-					{
-						LOG_FAIL(U"TCPClient: onReceive exceeded the maximum buffer size");
-
-						m_error = TCPError::NoBufferSpaceAvailable;
-
-						m_streamBuffer.consume(m_streamBuffer.size());
+					LOG_FAIL(U"TCPClient: onReceive exceeded the maximum buffer size");
 
-						close();
+					m_error = TCPError::NoBufferSpaceAvailable;
 
-						return;
-					}
+					close();
 
-					m_receivedBuffer.insert(m_receivedBuffer.end(), data, data + size);
+					return;
 				}
 
-				m_streamBuffer.consume(m_streamBuffer.size());
-
 				startReceive();
 			}
 
-			void onSend(const asio::error_code& error, size_t, const std::shared_ptr<ClientSession>&)
+			void onSend(const asio::error_code& error, size_t, const std::shared_ptr<ClientSession>& self)
 			{
-				m_isSending = false;
-
 				if (!m_isActive)
 				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-					m_sendingBuffer.clear();
+					m_sendQueue.finish();
 					return;
 				}
 
@@ -212,23 +224,17 @@ namespace s3d
 
 					m_error = TCPError::Error;
 
+					m_sendQueue.finish();
+
 					close();
 
 					return;
 				}
 
+				// 書き込み中に追加されたデータを、まとめて送信する
+				if (m_sendQueue.endFlush())
 				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-
-					if (!m_sendingBuffer.empty())
-					{
-						m_sendingBuffer.erase(m_sendingBuffer.begin());
-					}
-
-					if (!m_sendingBuffer.empty())
-					{
-						send_internal();
-					}
+					flush(self);
 				}
 			}
 
@@ -239,103 +245,106 @@ namespace s3d
 					return false;
 				}
 
-				if (size == 0)
-				{
-					return true;
-				}
+				return m_receivedBuffer.skip(size);
+			}
 
+			bool lookahead(void* dst, const size_t size)
+			{
+				if (!m_isActive)
 				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (size > m_receivedBuffer.size())
-					{
-						return false;
-					}
-
-					m_receivedBuffer.pop_front_N(size);
+					return false;
 				}
 
-				return true;
+				return m_receivedBuffer.lookahead(dst, size);
 			}
 
-			bool lookahead(void* dst, const size_t size)
+			bool read(void* dst, const size_t size)
 			{
 				if (!m_isActive)
 				{
 					return false;
 				}
 
-				if (size == 0)
+				return m_receivedBuffer.read(dst, size);
+			}
+
+			std::span<const Byte> peek()
+			{
+				if (!m_isActive)
 				{
-					return true;
+					return{};
 				}
 
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
+				return m_receivedBuffer.peek();
+			}
 
-					if (m_receivedBuffer.size() < size)
-					{
-						return false;
-					}
+			bool send(const void* data, const size_t size)
+			{
+				return enqueue({}, data, size);
+			}
 
-					std::memcpy(dst, m_receivedBuffer.data(), size);
-				}
+			bool sendMessage(const void* data, const size_t size)
+			{
+				Byte header[TCPMessageMaxHeaderSize];
 
-				return true;
+				const size_t headerSize = EncodeTCPMessageHeader(size, header);
+
+				return enqueue({ header, headerSize }, data, size);
 			}
 
-			bool read(void* dst, const size_t size)
+			bool receiveMessage(Array<Byte>& message, const size_t maxMessageSize)
 			{
 				if (!m_isActive)
 				{
 					return false;
 				}
 
-				if (size == 0)
-				{
-					return true;
-				}
-
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
+				const size_t availableSize = m_receivedBuffer.size();
 
-					if (m_receivedBuffer.size() < size)
-					{
-						return false;
-					}
+				Byte header[TCPMessageMaxHeaderSize];
 
-					std::memcpy(dst, m_receivedBuffer.data(), size);
+				const size_t lookaheadSize = Min(availableSize, TCPMessageMaxHeaderSize);
 
-					m_receivedBuffer.pop_front_N(size);
+				if ((lookaheadSize == 0)
+					|| (not m_receivedBuffer.lookahead(header, lookaheadSize)))
+				{
+					return false;
 				}
 
-				return true;
-			}
+				uint64 length = 0;
 
-			bool send(const void* data, const size_t size)
-			{
-				if (!m_isActive)
+				size_t headerSize = 0;
+
+				switch (DecodeTCPMessageHeader({ header, lookaheadSize }, length, headerSize))
 				{
+				case TCPMessageHeaderStatus::Incomplete:
 					return false;
+				case TCPMessageHeaderStatus::Invalid:
+					LOG_FAIL(U"TCPClient: received an invalid message header");
+					m_error = TCPError::InvalidMessage;
+					close();
+					return false;
+				default:
+					break;
 				}
 
-				if (size == 0)
+				if (maxMessageSize < length)
 				{
-					return true;
+					LOG_FAIL(U"TCPClient: received a message ({} bytes) larger than the maximum message size ({} bytes)"_fmt(length, maxMessageSize));
+					m_error = TCPError::InvalidMessage;
+					close();
+					return false;
 				}
 
+				if (availableSize < (headerSize + length))
 				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-
-					m_sendingBuffer.emplace_back(static_cast<const Byte*>(data), static_cast<const Byte*>(data) + size);
-
-					if (!m_isSending)
-					{
-						send_internal();
-					}
+					return false;
 				}
 
-				return true;
+				message.resize(static_cast<size_t>(length));
+
+				return (m_receivedBuffer.skip(headerSize)
+					&& m_receivedBuffer.read(message.data(), message.size()));
 			}
 		};
 	}
@@ -356,6 +365,8 @@ namespace s3d
 
 		TCPError m_error = TCPError::OK;
 
+		size_t m_maxMessageSize = TCPClient::DefaultMaxMessageSize;
+
 		bool m_isConnected = false;
 
 		bool m_waitingConnection = false;
@@ -390,6 +401,18 @@ namespace s3d
 
 		bool read(void* dst, size_t size);
 
+		std::span<const Byte> peek();
+
 		bool send(const void* data, size_t size);
+
+		bool sendMessage(const void* data, size_t size);
+
+		bool receiveMessage(Array<Byte>& message);
+
+		void setMaxMessageSize(size_t size);
+
+		size_t maxMessageSize() const;
+
+		uint64 getWriteCount() const;
 	};
 }
@@ -89,8 +89,43 @@ namespace s3d
 		return pImpl->read(dst, size, id);
 	}
 
+	std::span<const Byte> TCPServer::peek(const Optional<TCPSessionID>& id)
+	{
+		return pImpl->peek(id);
+	}
+
+	bool TCPServer::consume(const size_t size, const Optional<TCPSessionID>& id)
+	{
+		return pImpl->skip(size, id);
+	}
+
 	bool TCPServer::send(const void* data, const size_t size, const Optional<TCPSessionID>& id)
 	{
 		return pImpl->send(data, size, id);
 	}
+
+	bool TCPServer::sendMessage(const void* data, const size_t size, const Optional<TCPSessionID>& id)
+	{
+		return pImpl->sendMessage(data, size, id);
+	}
+
+	bool TCPServer::receiveMessage(Array<Byte>& message, const Optional<TCPSessionID>& id)
+	{
+		return pImpl->receiveMessage(message, id);
+	}
+
+	void TCPServer::setMaxMessageSize(const size_t size)
+	{
+		pImpl->setMaxMessageSize(size);
+	}
+
+	size_t TCPServer::maxMessageSize() const
+	{
+		return pImpl->maxMessageSize();
+	}
+
+	uint64 TCPServer::getWriteCount(const Optional<TCPSessionID>& id) const
+	{
+		return pImpl->getWriteCount(id);
+	}
 }
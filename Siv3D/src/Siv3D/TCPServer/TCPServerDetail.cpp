@@ -99,12 +99,20 @@ namespace s3d
 	{
 		cancelAccept();
 
-		for (auto& session : m_sessions)
 		{
-			session.second->close();
-		}
+			std::lock_guard lock{ m_mutexSessions };
+
+			for (auto& session : m_sessions)
+			{
+				session.second->close();
+			}
 
-		m_sessions.clear();
+			m_sessions.clear();
+
+			m_sessionIDs.clear();
+
+			m_retiredSessions.clear();
+		}
 
 		if (m_work)
 		{
@@ -122,28 +130,36 @@ namespace s3d
 	{
 		updateSession();
 
-		return m_sessions.any([](const auto& session) { return session.second->isActive(); });
+		std::lock_guard lock{ m_mutexSessions };
+
+		return m_sessionIDs.any([this](const TCPSessionID id) { return m_sessions.at(id)->isActive(); });
 	}
 
 	bool TCPServer::TCPServerDetail::hasSession(const TCPSessionID id)
 	{
 		updateSession();
 
-		return m_sessions.contains_if([=](const auto& session) { return session.first == id; });
+		std::lock_guard lock{ m_mutexSessions };
+
+		return m_sessions.contains(id);
 	}
 
 	size_t TCPServer::TCPServerDetail::num_sessions()
 	{
 		updateSession();
 
-		return m_sessions.count_if([](const auto& session) { return session.second->isActive(); });
+		std::lock_guard lock{ m_mutexSessions };
+
+		return m_sessionIDs.count_if([this](const TCPSessionID id) { return m_sessions.at(id)->isActive(); });
 	}
 
 	Array<TCPSessionID> TCPServer::TCPServerDetail::getSessionIDs()
 	{
 		updateSession();
 
-		return m_sessions.map([](const auto& session) { return session.first; });
+		std::lock_guard lock{ m_mutexSessions };
+
+		return m_sessionIDs;
 	}
 
 	uint16 TCPServer::TCPServerDetail::port() const
@@ -153,108 +169,122 @@ namespace s3d
 
 	size_t TCPServer::TCPServerDetail::available(const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		if (const auto session = findSession(id))
 		{
-			return 0;
+			return session->available();
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return 0;
+	}
 
-		for (auto& session : m_sessions)
+	bool TCPServer::TCPServerDetail::skip(const size_t size, const Optional<TCPSessionID>& id)
+	{
+		releaseRetiredSessions(id);
+
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->available();
-			}
+			return session->skip(size);
 		}
 
-		return 0;
+		return false;
 	}
 
-	bool TCPServer::TCPServerDetail::skip(const size_t size, const Optional<TCPSessionID>& id)
+	bool TCPServer::TCPServerDetail::lookahead(void* dst, const size_t size, const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		if (const auto session = findSession(id))
 		{
-			return false;
+			return session->lookahead(dst, size);
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return false;
+	}
+
+	bool TCPServer::TCPServerDetail::read(void* dst, const size_t size, const Optional<TCPSessionID>& id)
+	{
+		releaseRetiredSessions(id);
 
-		for (auto& session : m_sessions)
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->skip(size);
-			}
+			return session->read(dst, size);
 		}
 
 		return false;
 	}
 
-	bool TCPServer::TCPServerDetail::lookahead(void* dst, const size_t size, const Optional<TCPSessionID>& id) const
+	std::span<const Byte> TCPServer::TCPServerDetail::peek(const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		releaseRetiredSessions(id);
+
+		if (const auto session = findSession(id))
 		{
-			return false;
+			return session->peek();
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return{};
+	}
 
-		for (auto& session : m_sessions)
+	bool TCPServer::TCPServerDetail::send(const void* data, const size_t size, const Optional<TCPSessionID>& id)
+	{
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->lookahead(dst, size);
-			}
+			return session->send(data, size);
 		}
 
 		return false;
 	}
 
-	bool TCPServer::TCPServerDetail::read(void* dst, const size_t size, const Optional<TCPSessionID>& id)
+	bool TCPServer::TCPServerDetail::sendMessage(const void* data, const size_t size, const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		if (m_maxMessageSize < size)
 		{
+			LOG_FAIL(U"TCPServer: message size ({} bytes) exceeds the maximum message size ({} bytes)"_fmt(size, m_maxMessageSize));
 			return false;
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
-
-		for (auto& session : m_sessions)
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->read(dst, size);
-			}
+			return session->sendMessage(data, size);
 		}
 
 		return false;
 	}
 
-	bool TCPServer::TCPServerDetail::send(const void* data, const size_t size, const Optional<TCPSessionID>& id)
+	bool TCPServer::TCPServerDetail::receiveMessage(Array<Byte>& message, const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		releaseRetiredSessions(id);
+
+		if (const auto session = findSession(id))
 		{
-			return false;
+			return session->receiveMessage(message, m_maxMessageSize);
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return false;
+	}
 
-		for (auto& session : m_sessions)
+	void TCPServer::TCPServerDetail::setMaxMessageSize(const size_t size)
+	{
+		m_maxMessageSize = Min(size, detail::ServerSession::MaxMessageSize);
+	}
+
+	size_t TCPServer::TCPServerDetail::maxMessageSize() const
+	{
+		return m_maxMessageSize;
+	}
+
+	uint64 TCPServer::TCPServerDetail::getWriteCount(const Optional<TCPSessionID>& id)
+	{
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->send(data, size);
-			}
+			return session->getWriteCount();
 		}
 
-		return false;
+		return 0;
 	}
 
 	void TCPServer::TCPServerDetail::onAccept(const asio::error_code& error, const std::shared_ptr<detail::ServerSession>& session)
 	{
-		updateSession();
-
+		// 通信スレッドで呼ばれるため、ここではセッションを取り除かない（ユーザのスレッドで peek() が返した領域を無効にしてしまう）。
+		// 取り除く処理は、次のユーザのスレッドからの呼び出しで行う
 		if (!m_accepting)
 		{
 			return;
@@ -283,11 +313,19 @@ namespace s3d
 				socket.local_endpoint().port()));
 		}
 
-		m_sessions.push_back({ id, session });
+		{
+			std::lock_guard lock{ m_mutexSessions };
+
+			m_sessions.emplace(id, session);
+
+			m_sessionIDs.push_back(id);
+		}
+
+		m_sessionsUpdateRequired.store(true, std::memory_order_release);
 
 		LOG_TRACE(U"TCPServer session [{}] created"_fmt(id));
 
-		m_sessions.back().second->startReceive();
+		session->startReceive();
 
 		if (m_allowMulti)
 		{
@@ -304,6 +342,88 @@ namespace s3d
 
 	void TCPServer::TCPServerDetail::updateSession()
 	{
-		m_sessions.remove_if([](const auto& session) { return !session.second->isActive(); });
+		std::lock_guard lock{ m_mutexSessions };
+
+		m_sessionIDs.remove_if([this](const TCPSessionID id)
+			{
+				const auto it = m_sessions.find(id);
+
+				if (it->second->isActive())
+				{
+					return false;
+				}
+
+				if (it->second->hasPeekedData())
+				{
+					m_retiredSessions.emplace(id, std::move(it->second));
+				}
+
+				m_sessions.erase(it);
+
+				return true;
+			});
+	}
+
+	void TCPServer::TCPServerDetail::updateSessionIfRequired()
+	{
+		if (m_sessionsUpdateRequired.exchange(false, std::memory_order_acq_rel))
+		{
+			updateSession();
+		}
+	}
+
+	void TCPServer::TCPServerDetail::releaseRetiredSessions(const Optional<TCPSessionID>& id)
+	{
+		updateSessionIfRequired();
+
+		std::lock_guard lock{ m_mutexSessions };
+
+		if (m_retiredSessions.empty())
+		{
+			return;
+		}
+
+		if (id)
+		{
+			m_retiredSessions.erase(*id);
+			return;
+		}
+
+		// 省略した場合の対象は最も古いセッションであるため、それより前に接続していたセッションは参照されなくなる
+		const TCPSessionID oldestID = (m_sessionIDs ? m_sessionIDs.front() : Largest<TCPSessionID>);
+
+		for (auto it = m_retiredSessions.begin(); it != m_retiredSessions.end();)
+		{
+			if (it->first < oldestID)
+			{
+				m_retiredSessions.erase(it++);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	std::shared_ptr<detail::ServerSession> TCPServer::TCPServerDetail::findSession(const Optional<TCPSessionID>& id)
+	{
+		updateSessionIfRequired();
+
+		std::lock_guard lock{ m_mutexSessions };
+
+		if (m_sessionIDs.isEmpty())
+		{
+			return nullptr;
+		}
+
+		// 省略した場合は最も古いセッション
+		const TCPSessionID sessionID = id.value_or(m_sessionIDs.front());
+
+		if (const auto it = m_sessions.find(sessionID); it != m_sessions.end())
+		{
+			return it->second;
+		}
+
+		return nullptr;
 	}
 }
@@ -12,9 +12,13 @@
 # pragma once
 # include <Siv3D/TCPServer.hpp>
 # include <Siv3D/AsyncTask.hpp>
+# include <Siv3D/HashTable.hpp>
 # include <Siv3D/Byte.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/TCP/TCPReceiveBuffer.hpp>
+# include <Siv3D/TCP/TCPSendQueue.hpp>
+# include <Siv3D/TCP/TCPMessage.hpp>
 
 # define _WINSOCK_DEPRECATED_NO_WARNINGS
 # ifndef _WIN32_WINNT
@@ -38,38 +42,72 @@ namespace s3d
 
 			TCPSessionID m_id = 0;
 
-			bool m_isActive = false;
+			std::atomic<bool> m_isActive = false;
 
 			bool m_eof = false;
 
-			asio::streambuf m_streamBuffer;
+			// peek() で返した領域をユーザが参照している可能性があるか（ユーザのスレッドからのみ使う）
+			bool m_peeked = false;
 
 			// 受信	
 			static constexpr size_t maxBufferSize = 32 * 1024 * 1024;
 
-			std::mutex m_mutexReceivedBuffer;
+			static constexpr size_t receiveChunkSize = 64 * 1024;
 
-			Array<Byte> m_receivedBuffer;
+			// ソケットから直接読み込む領域
+			Array<Byte> m_receiveChunk = Array<Byte>(receiveChunkSize);
 
+			TCPReceiveBuffer m_receivedBuffer{ maxBufferSize };
 
-			// 送信
-			std::mutex m_mutexSendingBuffer;
 
-			Array<Array<Byte>> m_sendingBuffer;
+			// 送信
+			TCPSendQueue m_sendQueue;
 
-			bool m_isSending = false;
+			// ギャザー書き込みに渡すバッファの一覧
+			Array<asio::const_buffer> m_sendBuffers;
 
 
-			void send_internal()
+			void flush(const std::shared_ptr<ServerSession>&)
 			{
-				m_isSending = true;
+				if (!m_isActive)
+				{
+					m_sendQueue.finish();
+					return;
+				}
+
+				m_sendBuffers.clear();
+
+				for (const auto& chunk : m_sendQueue.beginFlush())
+				{
+					m_sendBuffers.push_back(asio::buffer(chunk.data(), chunk.size()));
+				}
 
-				asio::async_write(m_socket, asio::buffer(m_sendingBuffer.front().data(), m_sendingBuffer.front().size()),
+				asio::async_write(m_socket, m_sendBuffers,
 					std::bind(&ServerSession::onSend, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
 			}
 
+			bool enqueue(const std::span<const Byte> header, const void* data, const size_t size)
+			{
+				if (!m_isActive)
+				{
+					return false;
+				}
+
+				// 同じフレームで送られたデータを 1 回の書き込みにまとめるため、送信は通信スレッドで行う
+				if (m_sendQueue.push(header, data, size))
+				{
+					asio::post(m_socket.get_executor(),
+						std::bind(&ServerSession::flush, this, shared_from_this()));
+				}
+
+				return true;
+			}
+
 		public:
 
+			/// @brief 受信できるメッセージの最大サイズ（バイト）
+			static constexpr size_t MaxMessageSize = (maxBufferSize - TCPMessageMaxHeaderSize);
+
 			ServerSession(asio::io_service& io_service)
 				: m_socket(io_service)
 			{
@@ -83,7 +121,8 @@ namespace s3d
 
 			void close()
 			{
-				if (m_id == 0)
+				// 受信スレッドとユーザのスレッドの両方から呼ばれても、一度だけ閉じる
+				if (!m_isActive.exchange(false))
 				{
 					return;
 				}
@@ -95,20 +134,10 @@ namespace s3d
 
 				m_socket.close();
 
-				if (!m_isSending)
-				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-					m_sendingBuffer.clear();
-				}
+				m_sendQueue.clear();
 
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-					m_receivedBuffer.clear();
-					m_streamBuffer.consume(m_streamBuffer.size());
-				}
+				m_receivedBuffer.clear();
 
-				m_isSending = false;
-				m_isActive = false;
 				m_eof = false;
 
 				if (m_id)
@@ -140,18 +169,21 @@ namespace s3d
 
 			size_t available()
 			{
-				std::lock_guard lock{ m_mutexReceivedBuffer };
-
 				return m_receivedBuffer.size();
 			}
 
+			uint64 getWriteCount() const noexcept
+			{
+				return m_sendQueue.getFlushCount();
+			}
+
 			void startReceive()
 			{
-				asio::async_read(m_socket, m_streamBuffer, asio::transfer_at_least(1),
+				m_socket.async_read_some(asio::buffer(m_receiveChunk.data(), m_receiveChunk.size()),
 					std::bind(&ServerSession::onReceive, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
 			}
 
-			void onReceive(const asio::error_code& error, size_t, const std::shared_ptr<ServerSession>&)
+			void onReceive(const asio::error_code& error, const size_t size, const std::shared_ptr<ServerSession>&)
 			{
 				if (error)
 				{
@@ -166,46 +198,28 @@ namespace s3d
 						m_eof = true;
 					}
 
-					m_streamBuffer.consume(m_streamBuffer.size());
-
 					close();
 
 					return;
 				}
 
-				const Byte* data = asio::buffer_cast<const Byte*>(m_streamBuffer.data());
-				const size_t size = m_streamBuffer.size();
-
+				if (!m_receivedBuffer.write(m_receiveChunk.data(), size))
 				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (m_receivedBuffer.size() + size > maxBufferSize)
-					{
-						LOG_FAIL(U"TCPServer: onReceive exceeded the maximum buffer size");
-
-						m_streamBuffer.consume(m_streamBuffer.size());
+					LOG_FAIL(U"TCPServer: onReceive exceeded the maximum buffer size");
 
-						close();
-
-						return;
-					}
+					close();
 
-					m_receivedBuffer.insert(m_receivedBuffer.end(), data, data + size);
+					return;
 				}
 
-				m_streamBuffer.consume(m_streamBuffer.size());
-
 				startReceive();
 			}
 
-			void onSend(const asio::error_code& error, size_t, const std::shared_ptr<ServerSession>&)
+			void onSend(const asio::error_code& error, size_t, const std::shared_ptr<ServerSession>& self)
 			{
-				m_isSending = false;
-
 				if (!m_isActive)
 				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-					m_sendingBuffer.clear();
+					m_sendQueue.finish();
 					return;
 				}
 
@@ -213,125 +227,141 @@ namespace s3d
 				{
 					LOG_FAIL(U"TCPServer: send failed: {}"_fmt(Unicode::Widen(error.message())));
 
+					m_sendQueue.finish();
+
 					close();
 
 					return;
 				}
 
+				// 書き込み中に追加されたデータを、まとめて送信する
+				if (m_sendQueue.endFlush())
 				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-
-					if (!m_sendingBuffer.empty())
-					{
-						m_sendingBuffer.erase(m_sendingBuffer.begin());
-					}
-
-					if (!m_sendingBuffer.empty())
-					{
-						send_internal();
-					}
+					flush(self);
 				}
 			}
 
 			bool skip(const size_t size)
 			{
+				m_peeked = false;
+
 				if (!m_isActive)
 				{
 					return false;
 				}
 
-				if (size == 0)
-				{
-					return true;
-				}
+				return m_receivedBuffer.skip(size);
+			}
 
+			bool lookahead(void* dst, const size_t size)
+			{
+				if (!m_isActive)
 				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (size > m_receivedBuffer.size())
-					{
-						return false;
-					}
-
-					m_receivedBuffer.pop_front_N(size);
+					return false;
 				}
 
-				return true;
+				return m_receivedBuffer.lookahead(dst, size);
 			}
 
-			bool lookahead(void* dst, const size_t size)
+			bool read(void* dst, const size_t size)
 			{
+				m_peeked = false;
+
 				if (!m_isActive)
 				{
 					return false;
 				}
 
-				if (size == 0)
+				return m_receivedBuffer.read(dst, size);
+			}
+
+			std::span<const Byte> peek()
+			{
+				if (!m_isActive)
 				{
-					return true;
+					m_peeked = false;
+					return{};
 				}
 
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
+				const std::span<const Byte> data = m_receivedBuffer.peek();
 
-					if (m_receivedBuffer.size() < size)
-					{
-						return false;
-					}
+				m_peeked = (not data.empty());
 
-					std::memcpy(dst, m_receivedBuffer.data(), size);
-				}
+				return data;
+			}
 
-				return true;
+			bool hasPeekedData() const
+			{
+				return m_peeked;
 			}
 
-			bool read(void* dst, const size_t size)
+			bool send(const void* data, const size_t size)
+			{
+				return enqueue({}, data, size);
+			}
+
+			bool sendMessage(const void* data, const size_t size)
+			{
+				Byte header[TCPMessageMaxHeaderSize];
+
+				const size_t headerSize = EncodeTCPMessageHeader(size, header);
+
+				return enqueue({ header, headerSize }, data, size);
+			}
+
+			bool receiveMessage(Array<Byte>& message, const size_t maxMessageSize)
 			{
+				m_peeked = false;
+
 				if (!m_isActive)
 				{
 					return false;
 				}
 
-				if (size == 0)
-				{
-					return true;
-				}
-
-				{
-					std::lock_guard<std::mutex> lock{ m_mutexReceivedBuffer };
+				const size_t availableSize = m_receivedBuffer.size();
 
-					if (m_receivedBuffer.size() < size)
-					{
-						return false;
-					}
+				Byte header[TCPMessageMaxHeaderSize];
 
-					std::memcpy(dst, m_receivedBuffer.data(), size);
+				const size_t lookaheadSize = Min(availableSize, TCPMessageMaxHeaderSize);
 
-					m_receivedBuffer.pop_front_N(size);
+				if ((lookaheadSize == 0)
+					|| (not m_receivedBuffer.lookahead(header, lookaheadSize)))
+				{
+					return false;
 				}
 
-				return true;
-			}
+				uint64 length = 0;
 
-			bool send(const void* data, const size_t size)
-			{
-				if (!m_isActive)
+				size_t headerSize = 0;
+
+				switch (DecodeTCPMessageHeader({ header, lookaheadSize }, length, headerSize))
 				{
+				case TCPMessageHeaderStatus::Incomplete:
+					return false;
+				case TCPMessageHeaderStatus::Invalid:
+					LOG_FAIL(U"TCPServer: received an invalid message header");
+					close();
 					return false;
+				default:
+					break;
 				}
 
+				if (maxMessageSize < length)
 				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-
-					m_sendingBuffer.emplace_back(static_cast<const Byte*>(data), static_cast<const Byte*>(data) + size);
+					LOG_FAIL(U"TCPServer: received a message ({} bytes) larger than the maximum message size ({} bytes)"_fmt(length, maxMessageSize));
+					close();
+					return false;
+				}
 
-					if (!m_isSending)
-					{
-						send_internal();
-					}
+				if (availableSize < (headerSize + length))
+				{
+					return false;
 				}
 
-				return true;
+				message.resize(static_cast<size_t>(length));
+
+				return (m_receivedBuffer.skip(headerSize)
+					&& m_receivedBuffer.read(message.data(), message.size()));
 			}
 		};
 	}
@@ -348,10 +378,24 @@ namespace s3d
 
 		AsyncTask<void> m_io_service_thread;
 
-		Array<std::pair<TCPSessionID, std::shared_ptr<detail::ServerSession>>> m_sessions;
+		mutable std::mutex m_mutexSessions;
+
+		HashTable<TCPSessionID, std::shared_ptr<detail::ServerSession>> m_sessions;
+
+		// 接続した順のセッション ID
+		Array<TCPSessionID> m_sessionIDs;
+
+		// updateSession() で取り除いたが、peek() で返した領域が使われている可能性があるセッション。
+		// 領域を保つため、そのセッションに対して次に peek(), consume(), skip(), read(), receiveMessage() を呼ぶか、disconnect() するまで保持する
+		HashTable<TCPSessionID, std::shared_ptr<detail::ServerSession>> m_retiredSessions;
 
 		std::atomic<TCPSessionID> m_currentTCPSessionID = 0;
 
+		// 新しいセッションを受け入れたため、次のユーザのスレッドからの呼び出しで切断されたセッションを取り除く必要があるか
+		std::atomic<bool> m_sessionsUpdateRequired = false;
+
+		size_t m_maxMessageSize = TCPServer::DefaultMaxMessageSize;
+
 		uint16 m_port = 0;
 
 		bool m_accepting = false;
@@ -360,8 +404,18 @@ namespace s3d
 
 		void onAccept(const asio::error_code& error, const std::shared_ptr<detail::ServerSession>& session);
 
+		/// @brief 切断されたセッションを取り除きます。ユーザのスレッドからのみ呼びます。
 		void updateSession();
 
+		/// @brief onAccept() で要求された場合、切断されたセッションを取り除きます。ユーザのスレッドからのみ呼びます。
+		void updateSessionIfRequired();
+
+		/// @brief id のセッションに対する呼び出しで無効になる、取り除いたセッションを解放します。
+		void releaseRetiredSessions(const Optional<TCPSessionID>& id);
+
+		[[nodiscard]]
+		std::shared_ptr<detail::ServerSession> findSession(const Optional<TCPSessionID>& id);
+
 	public:
 
 		TCPServerDetail();
@@ -392,10 +446,22 @@ namespace s3d
 
 		bool skip(size_t size, const Optional<TCPSessionID>& id);
 
-		bool lookahead(void* dst, size_t size, const Optional<TCPSessionID>& id) const;
+		bool lookahead(void* dst, size_t size, const Optional<TCPSessionID>& id);
 
 		bool read(void* dst, size_t size, const Optional<TCPSessionID>& id);
 
+		std::span<const Byte> peek(const Optional<TCPSessionID>& id);
+
 		bool send(const void* data, size_t size, const Optional<TCPSessionID>& id);
+
+		bool sendMessage(const void* data, size_t size, const Optional<TCPSessionID>& id);
+
+		bool receiveMessage(Array<Byte>& message, const Optional<TCPSessionID>& id);
+
+		void setMaxMessageSize(size_t size);
+
+		size_t maxMessageSize() const;
+
+		uint64 getWriteCount(const Optional<TCPSessionID>& id);
 	};
 }
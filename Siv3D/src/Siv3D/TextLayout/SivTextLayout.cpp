@@ -0,0 +1,157 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/TextLayout.hpp>
+# include <Siv3D/DrawableText.hpp>
+# include "TextLayoutDetail.hpp"
+
+namespace s3d
+{
+	TextLayout::TextLayout()
+		: pImpl{ std::make_shared<TextLayoutDetail>() } {}
+
+	TextLayout::TextLayout(const Font& font, const StringView text)
+		: TextLayout{ font, static_cast<double>(font.fontSize()), text } {}
+
+	TextLayout::TextLayout(const Font& font, const double fontSize, const StringView text)
+		: pImpl{ std::make_shared<TextLayoutDetail>(font, fontSize, String{ text }, font.getGlyphClusters(text)) } {}
+
+	TextLayout::TextLayout(const DrawableText& text)
+		: TextLayout{ text, static_cast<double>(text.font.fontSize()) } {}
+
+	TextLayout::TextLayout(const DrawableText& text, const double fontSize)
+		: pImpl{ std::make_shared<TextLayoutDetail>(text.font, fontSize, String{ text.text }, Array<GlyphCluster>{ text.clusters }) } {}
+
+	TextLayout::~TextLayout() {}
+
+	void TextLayout::setText(const StringView text)
+	{
+		_mutableDetail().setText(text);
+	}
+
+	void TextLayout::setFontSize(const double fontSize)
+	{
+		_mutableDetail().setFontSize(fontSize);
+	}
+
+	bool TextLayout::isEmpty() const noexcept
+	{
+		return pImpl->clusters().isEmpty();
+	}
+
+	const Font& TextLayout::font() const noexcept
+	{
+		return pImpl->font();
+	}
+
+	const String& TextLayout::text() const noexcept
+	{
+		return pImpl->text();
+	}
+
+	double TextLayout::fontSize() const noexcept
+	{
+		return pImpl->fontSize();
+	}
+
+	const Array<GlyphCluster>& TextLayout::clusters() const noexcept
+	{
+		return pImpl->clusters();
+	}
+
+	size_t TextLayout::reusedClusters() const noexcept
+	{
+		return pImpl->reusedClusters();
+	}
+
+	SizeF TextLayout::size() const noexcept
+	{
+		return pImpl->size();
+	}
+
+	RectF TextLayout::region(const double x, const double y) const noexcept
+	{
+		return region(Vec2{ x, y });
+	}
+
+	RectF TextLayout::region(const Vec2& pos) const noexcept
+	{
+		return{ pos, pImpl->size() };
+	}
+
+	RectF TextLayout::regionAt(const double x, const double y) const noexcept
+	{
+		return regionAt(Vec2{ x, y });
+	}
+
+	RectF TextLayout::regionAt(const Vec2& center) const noexcept
+	{
+		return{ Arg::center = center, pImpl->size() };
+	}
+
+	RectF TextLayout::regionBase(const Vec2& pos) const noexcept
+	{
+		return{ pos.movedBy(0, -pImpl->ascender()), pImpl->size() };
+	}
+
+	RectF TextLayout::draw(const double x, const double y, const ColorF& color) const
+	{
+		return draw(TextStyle::Default(), Vec2{ x, y }, color);
+	}
+
+	RectF TextLayout::draw(const Vec2& pos, const ColorF& color) const
+	{
+		return draw(TextStyle::Default(), pos, color);
+	}
+
+	RectF TextLayout::draw(const TextStyle& textStyle, const Vec2& pos, const ColorF& color) const
+	{
+		pImpl->draw(textStyle, pos, color);
+
+		return region(pos);
+	}
+
+	RectF TextLayout::drawAt(const double x, const double y, const ColorF& color) const
+	{
+		return drawAt(TextStyle::Default(), Vec2{ x, y }, color);
+	}
+
+	RectF TextLayout::drawAt(const Vec2& center, const ColorF& color) const
+	{
+		return drawAt(TextStyle::Default(), center, color);
+	}
+
+	RectF TextLayout::drawAt(const TextStyle& textStyle, const Vec2& center, const ColorF& color) const
+	{
+		return draw(textStyle, regionAt(center).pos, color);
+	}
+
+	RectF TextLayout::drawBase(const Vec2& pos, const ColorF& color) const
+	{
+		return drawBase(TextStyle::Default(), pos, color);
+	}
+
+	RectF TextLayout::drawBase(const TextStyle& textStyle, const Vec2& pos, const ColorF& color) const
+	{
+		return draw(textStyle, regionBase(pos).pos, color);
+	}
+
+	TextLayoutDetail& TextLayout::_mutableDetail()
+	{
+		if (pImpl.use_count() != 1)
+		{
+			pImpl = std::make_shared<TextLayoutDetail>(*pImpl);
+		}
+
+		return *pImpl;
+	}
+}
@@ -0,0 +1,196 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/Char.hpp>
+# include <Siv3D/Font/IFont.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+# include "TextLayoutDetail.hpp"
+
+namespace s3d
+{
+	TextLayoutDetail::TextLayoutDetail()
+		: m_glyphs(1) {}
+
+	TextLayoutDetail::TextLayoutDetail(const Font& font, const double fontSize, String&& text, Array<GlyphCluster>&& clusters)
+		: m_font{ font }
+		, m_text{ std::move(text) }
+		, m_fontSize{ fontSize }
+		, m_clusters{ std::move(clusters) }
+	{
+		layout(0);
+	}
+
+	void TextLayoutDetail::setText(const StringView text)
+	{
+		if (m_text == text)
+		{
+			m_reusedClusters = m_clusters.size();
+			return;
+		}
+
+		const size_t boundary = FindReshapeBoundary(m_text, text);
+		size_t firstCluster = 0;
+
+		if (0 < boundary)
+		{
+			// boundary より前のクラスタだけを、そのまま再利用できる
+			while ((firstCluster < m_clusters.size()) && (m_clusters[firstCluster].pos < boundary))
+			{
+				++firstCluster;
+			}
+
+			const bool aligned = (firstCluster < m_clusters.size()) ?
+				(m_clusters[firstCluster].pos == boundary) : (boundary == m_text.size());
+
+			for (size_t i = firstCluster; (aligned && (i < m_clusters.size())); ++i)
+			{
+				// 右から左に書く文字などでクラスタが文字の順に並んでいない
+				if (m_clusters[i].pos < boundary)
+				{
+					firstCluster = 0;
+					break;
+				}
+			}
+
+			if (not aligned)
+			{
+				firstCluster = 0;
+			}
+		}
+
+		m_text = text;
+
+		if (firstCluster == 0)
+		{
+			m_clusters = m_font.getGlyphClusters(m_text);
+		}
+		else
+		{
+			Array<GlyphCluster> suffix = m_font.getGlyphClusters(StringView{ m_text }.substr(boundary));
+
+			for (auto& cluster : suffix)
+			{
+				cluster.pos += boundary;
+			}
+
+			m_clusters.resize(firstCluster);
+			m_clusters.append(suffix);
+		}
+
+		m_reusedClusters = firstCluster;
+
+		layout(firstCluster);
+	}
+
+	void TextLayoutDetail::setFontSize(const double fontSize)
+	{
+		if (m_fontSize == fontSize)
+		{
+			return;
+		}
+
+		m_fontSize = fontSize;
+
+		layout(0);
+	}
+
+	const Font& TextLayoutDetail::font() const noexcept
+	{
+		return m_font;
+	}
+
+	const String& TextLayoutDetail::text() const noexcept
+	{
+		return m_text;
+	}
+
+	double TextLayoutDetail::fontSize() const noexcept
+	{
+		return m_fontSize;
+	}
+
+	const Array<GlyphCluster>& TextLayoutDetail::clusters() const noexcept
+	{
+		return m_clusters;
+	}
+
+	size_t TextLayoutDetail::reusedClusters() const noexcept
+	{
+		return m_reusedClusters;
+	}
+
+	SizeF TextLayoutDetail::size() const noexcept
+	{
+		if (m_fontSize == 0.0)
+		{
+			return{ 0, 0 };
+		}
+
+		const TextLayoutGlyph& end = m_glyphs.back();
+		const double scale = (m_fontSize / m_font.fontSize());
+
+		return{ end.xMax, (end.lineCount * m_font.height() * scale) };
+	}
+
+	double TextLayoutDetail::ascender() const noexcept
+	{
+		if (m_fontSize == 0.0)
+		{
+			return 0.0;
+		}
+
+		return (m_font.ascender() * (m_fontSize / m_font.fontSize()));
+	}
+
+	void TextLayoutDetail::draw(const TextStyle& textStyle, const Vec2& pos, const ColorF& color) const
+	{
+		if (m_glyphs.size() != (m_clusters.size() + 1))
+		{
+			return;
+		}
+
+		SIV3D_ENGINE(Font)->drawLayout(m_font.id(), m_clusters, m_glyphs, pos, m_fontSize, textStyle, color, 1.0);
+	}
+
+	size_t TextLayoutDetail::FindReshapeBoundary(const StringView oldText, const StringView newText) noexcept
+	{
+		const size_t length = Min(oldText.size(), newText.size());
+		size_t boundary = 0;
+
+		while ((boundary < length) && (oldText[boundary] == newText[boundary]))
+		{
+			++boundary;
+		}
+
+		// 空白文字の直後であれば、カーニングや合字が境界をまたがない
+		while ((0 < boundary) && (not IsSpace(newText[boundary - 1])))
+		{
+			--boundary;
+		}
+
+		return boundary;
+	}
+
+	void TextLayoutDetail::layout(const size_t firstCluster)
+	{
+		if (m_glyphs.size() <= firstCluster)
+		{
+			return layout(0);
+		}
+
+		if (not SIV3D_ENGINE(Font)->layout(m_font.id(), m_text, m_clusters, firstCluster, m_fontSize, 1.0, m_glyphs))
+		{
+			// 次の更新では、すべてを計算し直す
+			m_glyphs.assign(1, TextLayoutGlyph{});
+		}
+	}
+}
@@ -0,0 +1,75 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <Siv3D/TextLayout.hpp>
+# include <Siv3D/Font/GlyphCache/GlyphCacheCommon.hpp>
+
+namespace s3d
+{
+	class TextLayoutDetail
+	{
+	public:
+
+		TextLayoutDetail();
+
+		TextLayoutDetail(const Font& font, double fontSize, String&& text, Array<GlyphCluster>&& clusters);
+
+		void setText(StringView text);
+
+		void setFontSize(double fontSize);
+
+		[[nodiscard]]
+		const Font& font() const noexcept;
+
+		[[nodiscard]]
+		const String& text() const noexcept;
+
+		[[nodiscard]]
+		double fontSize() const noexcept;
+
+		[[nodiscard]]
+		const Array<GlyphCluster>& clusters() const noexcept;
+
+		[[nodiscard]]
+		size_t reusedClusters() const noexcept;
+
+		[[nodiscard]]
+		SizeF size() const noexcept;
+
+		[[nodiscard]]
+		double ascender() const noexcept;
+
+		void draw(const TextStyle& textStyle, const Vec2& pos, const ColorF& color) const;
+
+	private:
+
+		Font m_font;
+
+		String m_text;
+
+		double m_fontSize = 0.0;
+
+		Array<GlyphCluster> m_clusters;
+
+		/// @brief クラスタごとのレイアウト。末尾の要素はテキスト末尾のペンの状態
+		Array<TextLayoutGlyph> m_glyphs;
+
+		size_t m_reusedClusters = 0;
+
+		/// @brief 再シェーピングを始めても結果が変わらない位置を返します。
+		[[nodiscard]]
+		static size_t FindReshapeBoundary(StringView oldText, StringView newText) noexcept;
+
+		void layout(size_t firstCluster);
+	};
+}
@@ -9,15 +9,64 @@
 //
 //-----------------------------------------------
 
+# include <bit>
+# include <cstring>
 # include "TextReaderDetail.hpp"
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Endian.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/UnicodeConverter.hpp>
+# include <Siv3D/Unicode/UnicodeUtility.hpp>
+
+# if SIV3D_INTRINSIC(SSE)
+#	include <immintrin.h>
+# endif
 
 namespace s3d
 {
+	namespace detail
+	{
+		/// @brief 区切り文字 ('\n' または '\0') の位置を探します。
+		/// @param first 探索範囲の先頭
+		/// @param last 探索範囲の終端
+		/// @param stopAtNewline '\n' を区切り文字とする場合 true
+		/// @return 最初の区切り文字の位置。見つからない場合は last
+		[[nodiscard]]
+		static const uint8* FindTerminator(const uint8* first, const uint8* const last, const bool stopAtNewline) noexcept
+		{
+			const uint8 newline = (stopAtNewline ? '\n' : '\0');
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			const __m128i newlines = _mm_set1_epi8(static_cast<char>(newline));
+			const __m128i zeros = _mm_setzero_si128();
+
+			for (; 16 <= (last - first); first += 16)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				const __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, newlines), _mm_cmpeq_epi8(v, zeros));
+
+				if (const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(m)))
+				{
+					return (first + std::countr_zero(mask));
+				}
+			}
+
+		# endif
+
+			for (; first != last; ++first)
+			{
+				if ((*first == newline) || (*first == 0))
+				{
+					break;
+				}
+			}
+
+			return first;
+		}
+	}
+
 	TextReader::TextReaderDetail::TextReaderDetail()
 	{
 		// do nothing
@@ -43,6 +92,7 @@ namespace s3d
 		}
 
 		m_reader = std::move(tmpReader);
+		resetBuffer();
 
 		m_info =
 		{
@@ -77,6 +127,7 @@ namespace s3d
 		}
 
 		m_reader = std::move(reader);
+		resetBuffer();
 
 		m_info =
 		{
@@ -103,6 +154,10 @@ namespace s3d
 		m_reader.reset();
 
 		m_info = {};
+
+		m_buffer.release();
+		m_bufferPos = m_bufferSize = 0;
+		m_bytes = std::string{};
 	}
 
 	bool TextReader::TextReaderDetail::isOpen() const noexcept
@@ -146,6 +201,20 @@ namespace s3d
 
 		String line;
 
+		if (isUTF8())
+		{
+			const bool terminated = readUTF8Bytes(true);
+
+			appendUTF8Bytes(line);
+
+			if (terminated || line)
+			{
+				return line;
+			}
+
+			return none;
+		}
+
 		for (;;)
 		{
 			char32 codePoint;
@@ -181,6 +250,27 @@ namespace s3d
 		Array<String> lines;
 		String line;
 
+		if (isUTF8())
+		{
+			for (;;)
+			{
+				const bool terminated = readUTF8Bytes(true);
+
+				appendUTF8Bytes(line);
+
+				if (terminated || line)
+				{
+					lines.push_back(std::move(line));
+					line.clear();
+				}
+
+				if (not terminated)
+				{
+					return lines;
+				}
+			}
+		}
+
 		for (;;)
 		{
 			char32 codePoint;
@@ -216,6 +306,15 @@ namespace s3d
 
 		String s;
 
+		if (isUTF8())
+		{
+			[[maybe_unused]] const bool terminated = readUTF8Bytes(false);
+
+			appendUTF8Bytes(s);
+
+			return s;
+		}
+
 		for (;;)
 		{
 			char32 codePoint;
@@ -275,6 +374,15 @@ namespace s3d
 			return false;
 		}
 
+		if (isUTF8())
+		{
+			const bool terminated = readUTF8Bytes(true);
+
+			appendUTF8Bytes(line);
+
+			return (terminated || line);
+		}
+
 		for (;;)
 		{
 			char32 codePoint;
@@ -311,6 +419,27 @@ namespace s3d
 
 		String line;
 
+		if (isUTF8())
+		{
+			for (;;)
+			{
+				const bool terminated = readUTF8Bytes(true);
+
+				appendUTF8Bytes(line);
+
+				if (terminated || line)
+				{
+					lines.push_back(std::move(line));
+					line.clear();
+				}
+
+				if (not terminated)
+				{
+					return (not lines.isEmpty());
+				}
+			}
+		}
+
 		for (;;)
 		{
 			char32 codePoint;
@@ -351,6 +480,15 @@ namespace s3d
 			return false;
 		}
 
+		if (isUTF8())
+		{
+			const bool terminated = readUTF8Bytes(false);
+
+			appendUTF8Bytes(s);
+
+			return (terminated || s);
+		}
+
 		for (;;)
 		{
 			char32 codePoint;
@@ -386,14 +524,98 @@ namespace s3d
 		return m_info.fullPath;
 	}
 
+	void TextReader::TextReaderDetail::resetBuffer()
+	{
+		m_buffer.resize(BufferSize);
+		m_bufferPos = m_bufferSize = 0;
+	}
+
+	bool TextReader::TextReaderDetail::fillBuffer()
+	{
+		const int64 readSize = m_reader->read(m_buffer.data(), static_cast<int64>(m_buffer.size()));
+
+		m_bufferPos = 0;
+		m_bufferSize = static_cast<size_t>(Max<int64>(readSize, 0));
+
+		return (m_bufferSize != 0);
+	}
+
+	bool TextReader::TextReaderDetail::isUTF8() const noexcept
+	{
+		return ((m_info.encoding != TextEncoding::UTF16LE)
+			&& (m_info.encoding != TextEncoding::UTF16BE));
+	}
+
+	bool TextReader::TextReaderDetail::readUTF8Bytes(const bool stopAtNewline)
+	{
+		m_bytes.clear();
+
+		for (;;)
+		{
+			if ((m_bufferPos == m_bufferSize) && (not fillBuffer()))
+			{
+				return false;
+			}
+
+			const uint8* const first = (m_buffer.data() + m_bufferPos);
+			const uint8* const last = (m_buffer.data() + m_bufferSize);
+			const uint8* const terminator = detail::FindTerminator(first, last, stopAtNewline);
+
+			m_bytes.append(reinterpret_cast<const char*>(first), (terminator - first));
+
+			if (terminator != last)
+			{
+				m_bufferPos = ((terminator - m_buffer.data()) + 1);
+				return true;
+			}
+
+			m_bufferPos = m_bufferSize;
+		}
+	}
+
+	void TextReader::TextReaderDetail::appendUTF8Bytes(String& s)
+	{
+		if (m_bytes.find('\r') != std::string::npos)
+		{
+			std::erase(m_bytes, '\r');
+		}
+
+		if (size_t utf32Length = 0, utf16Length = 0; detail::UTF8_Validate(m_bytes, utf32Length, utf16Length))
+		{
+			const size_t oldLength = s.size();
+			s.resize(oldLength + utf32Length);
+			detail::UTF8_DecodeValid(m_bytes, (s.data() + oldLength));
+		}
+		else
+		{
+			s.append(Unicode::FromUTF8(m_bytes));
+		}
+	}
+
 	bool TextReader::TextReaderDetail::readByte(uint8& c)
 	{
-		return m_reader->read(c);
+		if ((m_bufferPos == m_bufferSize) && (not fillBuffer()))
+		{
+			return false;
+		}
+
+		c = m_buffer[m_bufferPos++];
+		return true;
 	}
 
 	bool TextReader::TextReaderDetail::readTwoBytes(uint16& c)
 	{
-		return m_reader->read(c);
+		uint8 c0, c1;
+
+		if ((not readByte(c0)) || (not readByte(c1)))
+		{
+			return false;
+		}
+
+		// Reader から直接読み込んだ場合と同じく、ネイティブのバイトオーダーで解釈する
+		const uint8 bytes[2] = { c0, c1 };
+		std::memcpy(&c, bytes, sizeof(c));
+		return true;
 	}
 
 	bool TextReader::TextReaderDetail::readUTF8(char32& c)
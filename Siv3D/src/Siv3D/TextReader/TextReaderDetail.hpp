@@ -18,6 +18,9 @@ namespace s3d
 	{
 	private:
 
+		/// @brief 読み込みバッファのサイズ（バイト）
+		static constexpr size_t BufferSize = (64 * 1024);
+
 		std::unique_ptr<IReader> m_reader;
 
 		struct Info
@@ -27,6 +30,36 @@ namespace s3d
 			bool isOpen = false;
 		} m_info;
 
+		/// @brief Reader からまとめて読み込んだバイト列
+		Array<uint8> m_buffer;
+
+		/// @brief m_buffer の未処理部分の先頭
+		size_t m_bufferPos = 0;
+
+		/// @brief m_buffer の有効なバイト数
+		size_t m_bufferSize = 0;
+
+		/// @brief UTF-8 の 1 行分のバイト列を一時的に保持するバッファ
+		std::string m_bytes;
+
+		void resetBuffer();
+
+		[[nodiscard]]
+		bool fillBuffer();
+
+		[[nodiscard]]
+		bool isUTF8() const noexcept;
+
+		/// @brief UTF-8 のバイト列を、区切り文字の直前まで m_bytes に読み込みます。
+		/// @param stopAtNewline '\n' を区切り文字とする場合 true, '\0' だけを区切り文字とする場合 false
+		/// @return 区切り文字に到達した場合 true, ファイルの終端に到達した場合 false
+		[[nodiscard]]
+		bool readUTF8Bytes(bool stopAtNewline);
+
+		/// @brief m_bytes から '\r' を取り除き、UTF-32 に変換して追加します。
+		/// @param s 追加先の文字列
+		void appendUTF8Bytes(String& s);
+
 		[[nodiscard]]
 		bool readByte(uint8& c);
 
@@ -171,9 +171,14 @@ namespace s3d
 		return SIV3D_ENGINE(Asset)->load(AssetType::Texture, name, {});
 	}
 
-	void TextureAsset::LoadAsync(const AssetNameView name)
+	void TextureAsset::LoadAsync(const AssetNameView name, const int32 priority)
 	{
-		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Texture, name, {});
+		SIV3D_ENGINE(Asset)->loadAsync(AssetType::Texture, name, {}, priority);
+	}
+
+	bool TextureAsset::CancelLoadAsync(const AssetNameView name)
+	{
+		return SIV3D_ENGINE(Asset)->cancelLoadAsync(AssetType::Texture, name);
 	}
 
 	void TextureAsset::Wait(const AssetNameView name)
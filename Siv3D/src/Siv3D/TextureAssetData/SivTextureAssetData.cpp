@@ -10,6 +10,9 @@
 //-----------------------------------------------
 
 # include <Siv3D/TextureAssetData.hpp>
+# include <Siv3D/ProfilerZone.hpp>
+# include <Siv3D/Asset/IAsset.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
 
 namespace s3d
 {
@@ -47,6 +50,8 @@ namespace s3d
 	{
 		if (isUninitialized())
 		{
+			const ProfilerZone profilerZone{ U"TextureAsset::load" };
+
 			if (onLoad(*this, hint))
 			{
 				setState(AssetState::Loaded);
@@ -73,9 +78,17 @@ namespace s3d
 		{
 			setState(AssetState::AsyncLoading);
 
-			m_task = Async([this, hint = hint]()
+			// CAsset のローダープールで、優先度順に実行される
+			m_task = SIV3D_ENGINE(Asset)->submitAsyncLoad(*this,
+				[this, hint = hint]()
 				{
+					const ProfilerZone profilerZone{ U"TextureAsset::load" };
+
 					setState(onLoad(*this, hint) ? AssetState::Loaded : AssetState::Failed);
+				},
+				[this]()
+				{
+					setState(AssetState::Uninitialized);
 				});
 		}
 	}
@@ -84,6 +97,9 @@ namespace s3d
 	{
 		if (m_task.isValid())
 		{
+			// まだ開始していなければ、このスレッドで直ちにロードする
+			SIV3D_ENGINE(Asset)->runPendingAsyncLoad(*this);
+
 			m_task.get();
 		}
 	}
@@ -97,7 +113,15 @@ namespace s3d
 
 		if (isAsyncLoading())
 		{
+			// まだ開始していないロードはキャンセルする
+			SIV3D_ENGINE(Asset)->cancelAsyncLoad(*this);
+
 			wait();
+
+			if (isUninitialized())
+			{
+				return;
+			}
 		}
 
 		onRelease(*this);
@@ -0,0 +1,237 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <exception>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "CThreadPool.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static constexpr size_t NotWorker = static_cast<size_t>(-1);
+
+		static thread_local const CThreadPool* tls_pool = nullptr;
+
+		static thread_local size_t tls_workerIndex = NotWorker;
+
+		[[nodiscard]]
+		static size_t GetDefaultWorkerCount() noexcept
+		{
+		# if SIV3D_PLATFORM(WEB) && !defined(__EMSCRIPTEN_PTHREADS__)
+
+			return 0;
+
+		# else
+
+			// メインスレッドも ParallelFor のチャンクを処理するため、1 つ少なくする
+			return Max<size_t>(1, (Threading::GetConcurrency() - 1));
+
+		# endif
+		}
+	}
+
+	CThreadPool::CThreadPool()
+		: m_workerCount{ detail::GetDefaultWorkerCount() } {}
+
+	CThreadPool::~CThreadPool()
+	{
+		LOG_SCOPED_TRACE(U"CThreadPool::~CThreadPool()");
+
+		{
+			std::lock_guard lock{ m_sleepMutex };
+			m_stop = true;
+		}
+
+		m_sleepCondition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			worker.join();
+		}
+	}
+
+	size_t CThreadPool::getWorkerCount() const noexcept
+	{
+		return m_workerCount;
+	}
+
+	bool CThreadPool::isWorkerThread() const noexcept
+	{
+		return (detail::tls_pool == this);
+	}
+
+	void CThreadPool::submit(Task task)
+	{
+		if (m_workerCount == 0)
+		{
+			task();
+			return;
+		}
+
+		std::call_once(m_startFlag, [this]() { start(); });
+
+		if (isWorkerThread())
+		{
+			// ワーカースレッドから投入されたタスクは自身のキューに積む
+			auto& queue = *m_localQueues[detail::tls_workerIndex];
+			std::lock_guard lock{ queue.mutex };
+			queue.tasks.push_back(std::move(task));
+		}
+		else
+		{
+			std::lock_guard lock{ m_globalQueue.mutex };
+			m_globalQueue.tasks.push_back(std::move(task));
+		}
+
+		{
+			std::lock_guard lock{ m_sleepMutex };
+			++m_pendingTaskCount;
+		}
+
+		m_sleepCondition.notify_one();
+	}
+
+	bool CThreadPool::tryRunPendingTask()
+	{
+		if (m_pendingTaskCount == 0)
+		{
+			return false;
+		}
+
+		const size_t workerIndex = (isWorkerThread() ? detail::tls_workerIndex : detail::NotWorker);
+
+		Task task;
+
+		if (tryPop(workerIndex, task) || trySteal(workerIndex, task))
+		{
+			--m_pendingTaskCount;
+
+			// WaitGroup を伴わないタスクの例外は受け取る先が無いため、ワーカースレッドを止めずにログに残す
+			try
+			{
+				task();
+			}
+			catch (const std::exception& e)
+			{
+				LOG_ERROR(U"✖ CThreadPool: a task threw an exception ({})"_fmt(Unicode::Widen(e.what())));
+			}
+			catch (...)
+			{
+				LOG_ERROR(U"✖ CThreadPool: a task threw an exception");
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void CThreadPool::start()
+	{
+		LOG_SCOPED_TRACE(U"CThreadPool::start()");
+
+		for (size_t i = 0; i < m_workerCount; ++i)
+		{
+			m_localQueues.push_back(std::make_unique<WorkQueue>());
+		}
+
+		for (size_t i = 0; i < m_workerCount; ++i)
+		{
+			m_workers.emplace_back(&CThreadPool::run, this, i);
+		}
+
+		LOG_INFO(U"ℹ️ Thread pool started (worker count: {})"_fmt(m_workerCount));
+	}
+
+	void CThreadPool::run(const size_t workerIndex)
+	{
+		detail::tls_pool = this;
+		detail::tls_workerIndex = workerIndex;
+
+		while (true)
+		{
+			if (tryRunPendingTask())
+			{
+				continue;
+			}
+
+			std::unique_lock lock{ m_sleepMutex };
+
+			m_sleepCondition.wait(lock, [this]() { return (m_stop || (0 < m_pendingTaskCount)); });
+
+			// 終了時には残っているタスクをすべて実行してから抜ける
+			if (m_stop && (m_pendingTaskCount == 0))
+			{
+				break;
+			}
+		}
+	}
+
+	bool CThreadPool::tryPop(const size_t workerIndex, Task& task)
+	{
+		if (workerIndex != detail::NotWorker)
+		{
+			auto& queue = *m_localQueues[workerIndex];
+			std::lock_guard lock{ queue.mutex };
+
+			if (not queue.tasks.empty())
+			{
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+				return true;
+			}
+		}
+
+		{
+			std::lock_guard lock{ m_globalQueue.mutex };
+
+			if (not m_globalQueue.tasks.empty())
+			{
+				task = std::move(m_globalQueue.tasks.front());
+				m_globalQueue.tasks.pop_front();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool CThreadPool::trySteal(const size_t workerIndex, Task& task)
+	{
+		const size_t offset = ((workerIndex == detail::NotWorker) ? 0 : (workerIndex + 1));
+
+		for (size_t i = 0; i < m_workerCount; ++i)
+		{
+			const size_t victimIndex = ((offset + i) % m_workerCount);
+
+			if (victimIndex == workerIndex)
+			{
+				continue;
+			}
+
+			auto& queue = *m_localQueues[victimIndex];
+			std::lock_guard lock{ queue.mutex };
+
+			if (not queue.tasks.empty())
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,80 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <Siv3D/Array.hpp>
+# include "IThreadPool.hpp"
+
+namespace s3d
+{
+	class CThreadPool final : public ISiv3DThreadPool
+	{
+	public:
+
+		CThreadPool();
+
+		~CThreadPool() override;
+
+		size_t getWorkerCount() const noexcept override;
+
+		bool isWorkerThread() const noexcept override;
+
+		void submit(Task task) override;
+
+		bool tryRunPendingTask() override;
+
+	private:
+
+		struct WorkQueue
+		{
+			std::mutex mutex;
+
+			std::deque<Task> tasks;
+		};
+
+		const size_t m_workerCount;
+
+		std::once_flag m_startFlag;
+
+		Array<std::thread> m_workers;
+
+		// ワーカースレッドごとのタスクキュー（所有スレッドは末尾から、他のスレッドは先頭から取り出す）
+		Array<std::unique_ptr<WorkQueue>> m_localQueues;
+
+		// ワーカースレッド以外から投入されたタスク
+		WorkQueue m_globalQueue;
+
+		std::atomic<size_t> m_pendingTaskCount{ 0 };
+
+		std::mutex m_sleepMutex;
+
+		std::condition_variable m_sleepCondition;
+
+		std::atomic<bool> m_stop{ false };
+
+		void start();
+
+		void run(size_t workerIndex);
+
+		[[nodiscard]]
+		bool tryPop(size_t workerIndex, Task& task);
+
+		[[nodiscard]]
+		bool trySteal(size_t workerIndex, Task& task);
+	};
+}
@@ -0,0 +1,37 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <functional>
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	class SIV3D_NOVTABLE ISiv3DThreadPool
+	{
+	public:
+
+		using Task = std::function<void()>;
+
+		static ISiv3DThreadPool* Create();
+
+		virtual ~ISiv3DThreadPool() = default;
+
+		virtual size_t getWorkerCount() const noexcept = 0;
+
+		virtual bool isWorkerThread() const noexcept = 0;
+
+		virtual void submit(Task task) = 0;
+
+		virtual bool tryRunPendingTask() = 0;
+	};
+}
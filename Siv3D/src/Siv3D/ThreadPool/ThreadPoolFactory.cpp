@@ -0,0 +1,21 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "CThreadPool.hpp"
+
+namespace s3d
+{
+	ISiv3DThreadPool* ISiv3DThreadPool::Create()
+	{
+		return new CThreadPool;
+	}
+}
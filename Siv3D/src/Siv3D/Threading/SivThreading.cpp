@@ -9,18 +9,291 @@
 //
 //-----------------------------------------------
 
+
 # include <thread>
+# include <exception>
+# include <mutex>
+# include <memory>
+# include <condition_variable>
+# include <utility>
 # include <Siv3D/Threading.hpp>
 # include <Siv3D/Utility.hpp>
+# include <Siv3D/ThreadPool/IThreadPool.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
 
 namespace s3d
 {
 	namespace Threading
 	{
+		namespace detail
+		{
+			/// @brief スコープを抜けるときに WaitGroup::done() を呼びます。
+			class WaitGroupDoneGuard
+			{
+			public:
+
+				explicit WaitGroupDoneGuard(WaitGroup& waitGroup) noexcept
+					: m_waitGroup{ waitGroup } {}
+
+				WaitGroupDoneGuard(const WaitGroupDoneGuard&) = delete;
+
+				WaitGroupDoneGuard& operator =(const WaitGroupDoneGuard&) = delete;
+
+				~WaitGroupDoneGuard()
+				{
+					m_waitGroup.done();
+				}
+
+			private:
+
+				WaitGroup& m_waitGroup;
+			};
+
+			[[nodiscard]]
+			static ISiv3DThreadPool* GetThreadPool() noexcept
+			{
+				if (not Siv3DEngine::isActive())
+				{
+					return nullptr;
+				}
+
+				return SIV3D_ENGINE(ThreadPool);
+			}
+
+			/// @brief ParallelFor の 1 回の呼び出しの状態です。
+			/// @remark 呼び出し元は、すべてのチャンクが終わった時点で戻ります。そのあとで開始したヘルパーのタスクはチャンクを取得できずにすぐ終了するため、状態は共有所有します。
+			struct ParallelForContext
+			{
+				std::atomic<size_t> nextChunk{ 0 };
+
+				size_t chunkCount = 0;
+
+				size_t count = 0;
+
+				size_t grainSize = 0;
+
+				ParallelForFunction function = nullptr;
+
+				void* data = nullptr;
+
+				std::mutex mutex;
+
+				std::condition_variable condition;
+
+				size_t finishedChunkCount = 0;
+
+				std::exception_ptr exception;
+
+				void run()
+				{
+					size_t finished = 0;
+
+					try
+					{
+						for (;;)
+						{
+							const size_t chunkIndex = nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+							if (chunkCount <= chunkIndex)
+							{
+								break;
+							}
+
+							const size_t begin = (chunkIndex * grainSize);
+							const size_t end = Min((begin + grainSize), count);
+							function(data, begin, end);
+							++finished;
+						}
+					}
+					catch (...)
+					{
+						// 残りのチャンクを処理しないようにし、処理されないチャンクは終了したものとして数える
+						const size_t claimed = nextChunk.exchange(chunkCount, std::memory_order_relaxed);
+						finished += (1 + ((claimed < chunkCount) ? (chunkCount - claimed) : 0));
+
+						std::lock_guard lock{ mutex };
+
+						if (not exception)
+						{
+							exception = std::current_exception();
+						}
+					}
+
+					if (finished)
+					{
+						std::lock_guard lock{ mutex };
+
+						if ((finishedChunkCount += finished) == chunkCount)
+						{
+							condition.notify_all();
+						}
+					}
+				}
+
+				void wait()
+				{
+					std::unique_lock lock{ mutex };
+
+					condition.wait(lock, [this]() { return (finishedChunkCount == chunkCount); });
+
+					if (exception)
+					{
+						std::rethrow_exception(exception);
+					}
+				}
+			};
+
+			void ParallelForImpl(const size_t count, const size_t grainSize, const ParallelForFunction function, void* data)
+			{
+				ISiv3DThreadPool* const pool = GetThreadPool();
+				const size_t chunkCount = ((count + (grainSize - 1)) / grainSize);
+
+				if ((pool == nullptr) || (chunkCount <= 1))
+				{
+					for (size_t begin = 0; begin < count; begin += grainSize)
+					{
+						function(data, begin, Min((begin + grainSize), count));
+					}
+
+					return;
+				}
+
+				const auto context = std::make_shared<ParallelForContext>();
+				context->chunkCount = chunkCount;
+				context->count = count;
+				context->grainSize = grainSize;
+				context->function = function;
+				context->data = data;
+
+				// 呼び出し元のスレッドも 1 つ分のチャンクを処理する
+				const size_t helperCount = Min((chunkCount - 1), pool->getWorkerCount());
+
+				for (size_t i = 0; i < helperCount; ++i)
+				{
+					pool->submit([context]()
+					{
+						context->run();
+					});
+				}
+
+				context->run();
+
+				// キューに残っているヘルパーのタスクは待たず、処理中のチャンクの終了だけを待つ
+				context->wait();
+			}
+		}
+
 		size_t GetConcurrency() noexcept
 		{
 			static const size_t n = Max<size_t>(1, std::thread::hardware_concurrency());
 			return n;
 		}
+
+		size_t GetWorkerCount() noexcept
+		{
+			if (ISiv3DThreadPool* pool = detail::GetThreadPool())
+			{
+				return pool->getWorkerCount();
+			}
+
+			return 0;
+		}
+
+		bool IsWorkerThread() noexcept
+		{
+			if (ISiv3DThreadPool* pool = detail::GetThreadPool())
+			{
+				return pool->isWorkerThread();
+			}
+
+			return false;
+		}
+
+		void WaitGroup::add(const size_t n) noexcept
+		{
+			m_count.fetch_add(n, std::memory_order_relaxed);
+		}
+
+		void WaitGroup::done() noexcept
+		{
+			std::lock_guard lock{ m_mutex };
+
+			if (m_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				m_condition.notify_all();
+			}
+		}
+
+		bool WaitGroup::isDone() const noexcept
+		{
+			return (m_count.load(std::memory_order_acquire) == 0);
+		}
+
+		void WaitGroup::wait()
+		{
+			ISiv3DThreadPool* const pool = detail::GetThreadPool();
+			const bool isWorker = (pool && pool->isWorkerThread());
+
+			// ワーカースレッドは、待機しているタスクが自身のキューに残っている可能性があるため、待機中にタスクを実行する
+			if (isWorker)
+			{
+				while ((not isDone()) && pool->tryRunPendingTask()) {}
+			}
+
+			std::exception_ptr exception;
+			{
+				std::unique_lock lock{ m_mutex };
+
+				m_condition.wait(lock, [this]() { return isDone(); });
+
+				exception = std::exchange(m_exception, nullptr);
+			}
+
+			if (exception)
+			{
+				std::rethrow_exception(exception);
+			}
+		}
+
+		void WaitGroup::setException(std::exception_ptr exception) noexcept
+		{
+			std::lock_guard lock{ m_mutex };
+
+			if (not m_exception)
+			{
+				m_exception = std::move(exception);
+			}
+		}
+
+		void Submit(std::function<void()> task)
+		{
+			if (ISiv3DThreadPool* pool = detail::GetThreadPool())
+			{
+				pool->submit(std::move(task));
+			}
+			else
+			{
+				task();
+			}
+		}
+
+		void Submit(WaitGroup& waitGroup, std::function<void()> task)
+		{
+			waitGroup.add();
+
+			Submit([&waitGroup, task = std::move(task)]()
+			{
+				const detail::WaitGroupDoneGuard guard{ waitGroup };
+
+				try
+				{
+					task();
+				}
+				catch (...)
+				{
+					waitGroup.setException(std::current_exception());
+				}
+			});
+		}
 	}
 }
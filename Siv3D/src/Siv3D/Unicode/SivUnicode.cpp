@@ -25,6 +25,13 @@ namespace s3d
 
 		String FromUTF8(const std::string_view s)
 		{
+			if (size_t utf32Length = 0, utf16Length = 0; detail::UTF8_Validate(s, utf32Length, utf16Length))
+			{
+				String result(utf32Length, U'0');
+				detail::UTF8_DecodeValid(s, result.data());
+				return result;
+			}
+
 			String result(detail::UTF32_Length(s), '0');
 
 			const char8* pSrc = s.data();
@@ -84,14 +91,7 @@ namespace s3d
 		{
 			std::string result(detail::UTF8_Length(s), '0');
 
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-			char8* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8_Encode(&pDst, *pSrc++);
-			}
+			detail::UTF8_EncodeString(result.data(), s);
 
 			return result;
 		}
@@ -119,6 +119,13 @@ namespace s3d
 
 		std::u16string UTF8ToUTF16(const std::string_view s)
 		{
+			if (size_t utf32Length = 0, utf16Length = 0; detail::UTF8_Validate(s, utf32Length, utf16Length))
+			{
+				std::u16string result(utf16Length, u'0');
+				detail::UTF8_DecodeValid(s, result.data());
+				return result;
+			}
+
 			std::u16string result(detail::UTF16_Length(s), '0');
 
 			const char8* pSrc = s.data();
@@ -139,6 +146,13 @@ namespace s3d
 
 		std::u32string UTF8ToUTF32(const std::string_view s)
 		{
+			if (size_t utf32Length = 0, utf16Length = 0; detail::UTF8_Validate(s, utf32Length, utf16Length))
+			{
+				std::u32string result(utf32Length, U'0');
+				detail::UTF8_DecodeValid(s, result.data());
+				return result;
+			}
+
 			std::u32string result(detail::UTF32_Length(s), '0');
 
 			const char8* pSrc = s.data();
@@ -201,14 +215,7 @@ namespace s3d
 		{
 			std::string result(detail::UTF8_Length(s), '0');
 
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-			char8* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8_Encode(&pDst, *pSrc++);
-			}
+			detail::UTF8_EncodeString(result.data(), s);
 
 			return result;
 		}
@@ -9,13 +9,548 @@
 //
 //-----------------------------------------------
 
+# include <bit>
+# include <cstring>
+# include <Siv3D/CPUInfo.hpp>
 # include "UnicodeUtility.hpp"
 # include <ThirdParty/miniutf/miniutf.hpp>
 
+# if SIV3D_INTRINSIC(SSE)
+#	include <immintrin.h>
+#	if !SIV3D_PLATFORM(WEB)
+#		define SIV3D_UNICODE_AVX2_ENABLED 1
+#		if defined(__GNUC__) || defined(__clang__)
+#			define SIV3D_UNICODE_AVX2 __attribute__((target("avx2")))
+#		else
+#			define SIV3D_UNICODE_AVX2
+#		endif
+#	endif
+# endif
+
 namespace s3d
 {
 	namespace detail
 	{
+		/// @brief 検証済みの UTF-8 から 1 文字をデコードします。
+		/// @param s 文字の先頭
+		/// @param codePoint デコードしたコードポイントの格納先
+		/// @return 次の文字の先頭
+		[[nodiscard]]
+		static inline const char8* UTF8_DecodeUnchecked(const char8* s, char32& codePoint) noexcept
+		{
+			const uint8 c0 = static_cast<uint8>(s[0]);
+
+			if (c0 < 0x80)
+			{
+				codePoint = c0;
+				return (s + 1);
+			}
+			else if (c0 < 0xE0)
+			{
+				codePoint = (((c0 & 0x1F) << 6) | (static_cast<uint8>(s[1]) & 0x3F));
+				return (s + 2);
+			}
+			else if (c0 < 0xF0)
+			{
+				codePoint = (((c0 & 0x0F) << 12) | ((static_cast<uint8>(s[1]) & 0x3F) << 6) | (static_cast<uint8>(s[2]) & 0x3F));
+				return (s + 3);
+			}
+			else
+			{
+				codePoint = (((c0 & 0x07) << 18) | ((static_cast<uint8>(s[1]) & 0x3F) << 12)
+					| ((static_cast<uint8>(s[2]) & 0x3F) << 6) | (static_cast<uint8>(s[3]) & 0x3F));
+				return (s + 4);
+			}
+		}
+
+		[[nodiscard]]
+		static bool UTF8_Validate_Reference(const char8* s, const char8* const sEnd, size_t& utf32Length, size_t& utf16Length) noexcept
+		{
+			size_t codePoints = 0;
+			size_t fourByteCodePoints = 0;
+
+			const auto isContinuation = [](const char8 c) { return ((static_cast<uint8>(c) & 0xC0) == 0x80); };
+
+			while (s != sEnd)
+			{
+				const uint8 c0 = static_cast<uint8>(*s);
+				const ptrdiff_t remaining = (sEnd - s);
+
+				if (c0 < 0x80)
+				{
+					++s;
+				}
+				else if (c0 < 0xC2) // 継続バイト, 冗長な 2 バイト表現
+				{
+					return false;
+				}
+				else if (c0 < 0xE0)
+				{
+					if ((remaining < 2) || (not isContinuation(s[1])))
+					{
+						return false;
+					}
+
+					s += 2;
+				}
+				else if (c0 < 0xF0)
+				{
+					if ((remaining < 3) || (not isContinuation(s[1])) || (not isContinuation(s[2])))
+					{
+						return false;
+					}
+
+					char32 codePoint;
+					s = UTF8_DecodeUnchecked(s, codePoint);
+
+					if ((codePoint < 0x800) || ((0xD800 <= codePoint) && (codePoint <= 0xDFFF)))
+					{
+						return false;
+					}
+				}
+				else if (c0 < 0xF5)
+				{
+					if ((remaining < 4) || (not isContinuation(s[1])) || (not isContinuation(s[2])) || (not isContinuation(s[3])))
+					{
+						return false;
+					}
+
+					char32 codePoint;
+					s = UTF8_DecodeUnchecked(s, codePoint);
+
+					if ((codePoint < 0x10000) || (0x110000 <= codePoint))
+					{
+						return false;
+					}
+
+					++fourByteCodePoints;
+				}
+				else
+				{
+					return false;
+				}
+
+				++codePoints;
+			}
+
+			utf32Length = codePoints;
+			utf16Length = (codePoints + fourByteCodePoints);
+			return true;
+		}
+
+	# if SIV3D_INTRINSIC(SSE)
+
+		//
+		//	UTF-8 の検証 (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte")
+		//
+		//	連続する 2 バイトの上位 / 下位ニブルを表引きし、3 つの表の論理積で誤りの種類を求める。
+		//	3, 4 バイト目に継続バイトが必要かどうかは 2, 3 バイト前の先頭バイトから求める。
+		//
+
+		inline constexpr uint8 UTF8TooShort		= (1 << 0);
+		inline constexpr uint8 UTF8TooLong		= (1 << 1);
+		inline constexpr uint8 UTF8Overlong3	= (1 << 2);
+		inline constexpr uint8 UTF8TooLarge		= (1 << 3);
+		inline constexpr uint8 UTF8Surrogate	= (1 << 4);
+		inline constexpr uint8 UTF8Overlong2	= (1 << 5);
+		inline constexpr uint8 UTF8TooLarge1000	= (1 << 6);
+		inline constexpr uint8 UTF8Overlong4	= (1 << 6);
+		inline constexpr uint8 UTF8TwoConts		= (1 << 7);
+		inline constexpr uint8 UTF8Carry		= (UTF8TooShort | UTF8TooLong | UTF8TwoConts);
+
+		[[nodiscard]]
+		static constexpr char ToChar(const uint8 value) noexcept
+		{
+			return static_cast<char>(value);
+		}
+
+		[[nodiscard]]
+		static inline __m128i UTF8Byte1HighTable() noexcept
+		{
+			return _mm_setr_epi8(
+				ToChar(UTF8TooLong), ToChar(UTF8TooLong), ToChar(UTF8TooLong), ToChar(UTF8TooLong),
+				ToChar(UTF8TooLong), ToChar(UTF8TooLong), ToChar(UTF8TooLong), ToChar(UTF8TooLong),
+				ToChar(UTF8TwoConts), ToChar(UTF8TwoConts), ToChar(UTF8TwoConts), ToChar(UTF8TwoConts),
+				ToChar(UTF8TooShort | UTF8Overlong2),
+				ToChar(UTF8TooShort),
+				ToChar(UTF8TooShort | UTF8Overlong3 | UTF8Surrogate),
+				ToChar(UTF8TooShort | UTF8TooLarge | UTF8TooLarge1000 | UTF8Overlong4));
+		}
+
+		[[nodiscard]]
+		static inline __m128i UTF8Byte1LowTable() noexcept
+		{
+			constexpr uint8 Large = (UTF8Carry | UTF8TooLarge | UTF8TooLarge1000);
+
+			return _mm_setr_epi8(
+				ToChar(UTF8Carry | UTF8Overlong3 | UTF8Overlong2 | UTF8Overlong4),
+				ToChar(UTF8Carry | UTF8Overlong2),
+				ToChar(UTF8Carry),
+				ToChar(UTF8Carry),
+				ToChar(UTF8Carry | UTF8TooLarge),
+				ToChar(Large), ToChar(Large), ToChar(Large), ToChar(Large),
+				ToChar(Large), ToChar(Large), ToChar(Large), ToChar(Large),
+				ToChar(Large | UTF8Surrogate),
+				ToChar(Large), ToChar(Large));
+		}
+
+		[[nodiscard]]
+		static inline __m128i UTF8Byte2HighTable() noexcept
+		{
+			return _mm_setr_epi8(
+				ToChar(UTF8TooShort), ToChar(UTF8TooShort), ToChar(UTF8TooShort), ToChar(UTF8TooShort),
+				ToChar(UTF8TooShort), ToChar(UTF8TooShort), ToChar(UTF8TooShort), ToChar(UTF8TooShort),
+				ToChar(UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Overlong3 | UTF8TooLarge1000 | UTF8Overlong4),
+				ToChar(UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Overlong3 | UTF8TooLarge),
+				ToChar(UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Surrogate | UTF8TooLarge),
+				ToChar(UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Surrogate | UTF8TooLarge),
+				ToChar(UTF8TooShort), ToChar(UTF8TooShort), ToChar(UTF8TooShort), ToChar(UTF8TooShort));
+		}
+
+		/// @brief 末尾の 1 ~ 3 バイトが、後続の継続バイトを必要とする先頭バイトであるかを調べるための値を返します。
+		[[nodiscard]]
+		static inline __m128i UTF8IncompleteMax() noexcept
+		{
+			return _mm_setr_epi8(
+				ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xFF),
+				ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xFF), ToChar(0xF0 - 1), ToChar(0xE0 - 1), ToChar(0xC0 - 1));
+		}
+
+		[[nodiscard]]
+		static inline __m128i UTF8CheckBlock_SSE4_1(const __m128i input, const __m128i prevInput,
+			const __m128i byte1HighTable, const __m128i byte1LowTable, const __m128i byte2HighTable) noexcept
+		{
+			const __m128i lowNibbleMask = _mm_set1_epi8(0x0F);
+			const __m128i prev1 = _mm_alignr_epi8(input, prevInput, 15);
+			const __m128i byte1High = _mm_shuffle_epi8(byte1HighTable, _mm_and_si128(_mm_srli_epi16(prev1, 4), lowNibbleMask));
+			const __m128i byte1Low = _mm_shuffle_epi8(byte1LowTable, _mm_and_si128(prev1, lowNibbleMask));
+			const __m128i byte2High = _mm_shuffle_epi8(byte2HighTable, _mm_and_si128(_mm_srli_epi16(input, 4), lowNibbleMask));
+			const __m128i specialCases = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+			const __m128i prev2 = _mm_alignr_epi8(input, prevInput, 14);
+			const __m128i prev3 = _mm_alignr_epi8(input, prevInput, 13);
+			const __m128i isThirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8(ToChar(0xE0 - 0x80)));
+			const __m128i isFourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8(ToChar(0xF0 - 0x80)));
+			const __m128i mustBe23Continuation = _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte), _mm_set1_epi8(ToChar(0x80)));
+
+			return _mm_xor_si128(mustBe23Continuation, specialCases);
+		}
+
+		[[nodiscard]]
+		static bool UTF8_Validate_SSE4_1(const char8* s, const size_t size, size_t& utf32Length, size_t& utf16Length) noexcept
+		{
+			const __m128i byte1HighTable = UTF8Byte1HighTable();
+			const __m128i byte1LowTable = UTF8Byte1LowTable();
+			const __m128i byte2HighTable = UTF8Byte2HighTable();
+			const __m128i incompleteMax = UTF8IncompleteMax();
+			const __m128i leadThreshold = _mm_set1_epi8(-65); // 0xBF
+			const __m128i fourByteThreshold = _mm_set1_epi8(-17); // 0xEF
+
+			__m128i error = _mm_setzero_si128();
+			__m128i prevInput = _mm_setzero_si128();
+			__m128i prevIncomplete = _mm_setzero_si128();
+			size_t codePoints = 0;
+			size_t fourByteCodePoints = 0;
+
+			size_t i = 0;
+
+			for (; (i + 16) <= size; i += 16)
+			{
+				const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+				const uint32 nonAsciiMask = static_cast<uint32>(_mm_movemask_epi8(input));
+
+				if (nonAsciiMask == 0)
+				{
+					// ASCII のみのブロックでは、直前のブロックが途切れていないことだけを確かめる
+					error = _mm_or_si128(error, prevIncomplete);
+					codePoints += 16;
+				}
+				else
+				{
+					error = _mm_or_si128(error, UTF8CheckBlock_SSE4_1(input, prevInput, byte1HighTable, byte1LowTable, byte2HighTable));
+					prevIncomplete = _mm_subs_epu8(input, incompleteMax);
+					codePoints += std::popcount(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, leadThreshold))));
+					fourByteCodePoints += std::popcount(nonAsciiMask & static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, fourByteThreshold))));
+				}
+
+				prevInput = input;
+			}
+
+			if (i < size)
+			{
+				alignas(16) char8 buffer[16] = {};
+				std::memcpy(buffer, (s + i), (size - i));
+
+				const __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(buffer));
+				const uint32 validMask = ((1u << (size - i)) - 1);
+				const uint32 nonAsciiMask = static_cast<uint32>(_mm_movemask_epi8(input));
+
+				error = _mm_or_si128(error, UTF8CheckBlock_SSE4_1(input, prevInput, byte1HighTable, byte1LowTable, byte2HighTable));
+				prevIncomplete = _mm_subs_epu8(input, incompleteMax);
+				codePoints += std::popcount(validMask & static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, leadThreshold))));
+				fourByteCodePoints += std::popcount(validMask & nonAsciiMask & static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, fourByteThreshold))));
+			}
+
+			error = _mm_or_si128(error, prevIncomplete);
+
+			if (not _mm_testz_si128(error, error))
+			{
+				return false;
+			}
+
+			utf32Length = codePoints;
+			utf16Length = (codePoints + fourByteCodePoints);
+			return true;
+		}
+
+	# if SIV3D_UNICODE_AVX2_ENABLED
+
+		SIV3D_UNICODE_AVX2
+		[[nodiscard]]
+		static inline __m256i UTF8CheckBlock_AVX2(const __m256i input, const __m256i prevInput,
+			const __m256i byte1HighTable, const __m256i byte1LowTable, const __m256i byte2HighTable) noexcept
+		{
+			// 直前のブロックの上位レーンと、このブロックの下位レーン
+			const __m256i prevHighLow = _mm256_permute2x128_si256(prevInput, input, 0x21);
+
+			const __m256i lowNibbleMask = _mm256_set1_epi8(0x0F);
+			const __m256i prev1 = _mm256_alignr_epi8(input, prevHighLow, 15);
+			const __m256i byte1High = _mm256_shuffle_epi8(byte1HighTable, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibbleMask));
+			const __m256i byte1Low = _mm256_shuffle_epi8(byte1LowTable, _mm256_and_si256(prev1, lowNibbleMask));
+			const __m256i byte2High = _mm256_shuffle_epi8(byte2HighTable, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibbleMask));
+			const __m256i specialCases = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+			const __m256i prev2 = _mm256_alignr_epi8(input, prevHighLow, 14);
+			const __m256i prev3 = _mm256_alignr_epi8(input, prevHighLow, 13);
+			const __m256i isThirdByte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(ToChar(0xE0 - 0x80)));
+			const __m256i isFourthByte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(ToChar(0xF0 - 0x80)));
+			const __m256i mustBe23Continuation = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte), _mm256_set1_epi8(ToChar(0x80)));
+
+			return _mm256_xor_si256(mustBe23Continuation, specialCases);
+		}
+
+		SIV3D_UNICODE_AVX2
+		[[nodiscard]]
+		static bool UTF8_Validate_AVX2(const char8* s, const size_t size, size_t& utf32Length, size_t& utf16Length) noexcept
+		{
+			const __m256i byte1HighTable = _mm256_broadcastsi128_si256(UTF8Byte1HighTable());
+			const __m256i byte1LowTable = _mm256_broadcastsi128_si256(UTF8Byte1LowTable());
+			const __m256i byte2HighTable = _mm256_broadcastsi128_si256(UTF8Byte2HighTable());
+			const __m256i incompleteMax = _mm256_inserti128_si256(_mm256_set1_epi8(ToChar(0xFF)), UTF8IncompleteMax(), 1);
+			const __m256i leadThreshold = _mm256_set1_epi8(-65); // 0xBF
+			const __m256i fourByteThreshold = _mm256_set1_epi8(-17); // 0xEF
+
+			__m256i error = _mm256_setzero_si256();
+			__m256i prevInput = _mm256_setzero_si256();
+			__m256i prevIncomplete = _mm256_setzero_si256();
+			size_t codePoints = 0;
+			size_t fourByteCodePoints = 0;
+
+			size_t i = 0;
+
+			for (; (i + 32) <= size; i += 32)
+			{
+				const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+				const uint32 nonAsciiMask = static_cast<uint32>(_mm256_movemask_epi8(input));
+
+				if (nonAsciiMask == 0)
+				{
+					error = _mm256_or_si256(error, prevIncomplete);
+					codePoints += 32;
+				}
+				else
+				{
+					error = _mm256_or_si256(error, UTF8CheckBlock_AVX2(input, prevInput, byte1HighTable, byte1LowTable, byte2HighTable));
+					prevIncomplete = _mm256_subs_epu8(input, incompleteMax);
+					codePoints += std::popcount(static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, leadThreshold))));
+					fourByteCodePoints += std::popcount(nonAsciiMask & static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, fourByteThreshold))));
+				}
+
+				prevInput = input;
+			}
+
+			if (i < size)
+			{
+				alignas(32) char8 buffer[32] = {};
+				std::memcpy(buffer, (s + i), (size - i));
+
+				const __m256i input = _mm256_load_si256(reinterpret_cast<const __m256i*>(buffer));
+				const uint32 validMask = ((1u << (size - i)) - 1);
+				const uint32 nonAsciiMask = static_cast<uint32>(_mm256_movemask_epi8(input));
+
+				error = _mm256_or_si256(error, UTF8CheckBlock_AVX2(input, prevInput, byte1HighTable, byte1LowTable, byte2HighTable));
+				prevIncomplete = _mm256_subs_epu8(input, incompleteMax);
+				codePoints += std::popcount(validMask & static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, leadThreshold))));
+				fourByteCodePoints += std::popcount(validMask & nonAsciiMask & static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, fourByteThreshold))));
+			}
+
+			error = _mm256_or_si256(error, prevIncomplete);
+
+			if (not _mm256_testz_si256(error, error))
+			{
+				return false;
+			}
+
+			utf32Length = codePoints;
+			utf16Length = (codePoints + fourByteCodePoints);
+			return true;
+		}
+
+	# endif
+
+		//
+		//	検証済み UTF-8 のデコード / UTF-8 へのエンコード
+		//
+
+		static void UTF8_DecodeValid_SSE4_1(const char8* s, const char8* const sEnd, char32* dst) noexcept
+		{
+			while (16 <= (sEnd - s))
+			{
+				const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+				const uint32 nonAsciiMask = static_cast<uint32>(_mm_movemask_epi8(input));
+
+				if (nonAsciiMask == 0)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 0), _mm_cvtepu8_epi32(input));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), _mm_cvtepu8_epi32(_mm_srli_si128(input, 4)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12), _mm_cvtepu8_epi32(_mm_srli_si128(input, 12)));
+					s += 16;
+					dst += 16;
+					continue;
+				}
+
+				// 先頭の ASCII 部分と、続く 1 文字を処理する
+				for (const char8* const asciiEnd = (s + std::countr_zero(nonAsciiMask)); s != asciiEnd;)
+				{
+					*dst++ = static_cast<uint8>(*s++);
+				}
+
+				s = UTF8_DecodeUnchecked(s, *dst++);
+			}
+
+			while (s != sEnd)
+			{
+				s = UTF8_DecodeUnchecked(s, *dst++);
+			}
+		}
+
+		static void UTF8_DecodeValid_SSE4_1(const char8* s, const char8* const sEnd, char16* dst) noexcept
+		{
+			while (16 <= (sEnd - s))
+			{
+				const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+				const uint32 nonAsciiMask = static_cast<uint32>(_mm_movemask_epi8(input));
+
+				if (nonAsciiMask == 0)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 0), _mm_cvtepu8_epi16(input));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_cvtepu8_epi16(_mm_srli_si128(input, 8)));
+					s += 16;
+					dst += 16;
+					continue;
+				}
+
+				for (const char8* const asciiEnd = (s + std::countr_zero(nonAsciiMask)); s != asciiEnd;)
+				{
+					*dst++ = static_cast<uint8>(*s++);
+				}
+
+				char32 codePoint;
+				s = UTF8_DecodeUnchecked(s, codePoint);
+				UTF16_Encode(&dst, codePoint);
+			}
+
+			while (s != sEnd)
+			{
+				char32 codePoint;
+				s = UTF8_DecodeUnchecked(s, codePoint);
+				UTF16_Encode(&dst, codePoint);
+			}
+		}
+
+		[[nodiscard]]
+		static size_t UTF8_Length_SSE4_1(const char32* s, const char32* const sEnd) noexcept
+		{
+			const __m128i maxCodePoint = _mm_set1_epi32(0x10FFFF);
+			const __m128i threshold1 = _mm_set1_epi32(0x7F);
+			const __m128i threshold2 = _mm_set1_epi32(0x7FF);
+			const __m128i threshold3 = _mm_set1_epi32(0xFFFF);
+
+			size_t result = 0;
+
+			while (4 <= (sEnd - s))
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+
+				if (_mm_testz_si128(v, _mm_set1_epi32(~0x7F)))
+				{
+					result += 4;
+				}
+				else if (_mm_testc_si128(_mm_cmpeq_epi32(_mm_min_epu32(v, maxCodePoint), v), _mm_set1_epi32(-1)))
+				{
+					// 4 つとも 0x10FFFF 以下であれば、閾値を超えた数だけバイト数が増える
+					const int32 extra = std::popcount(static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, threshold1)))))
+						+ std::popcount(static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, threshold2)))))
+						+ std::popcount(static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, threshold3)))));
+					result += (4 + extra);
+				}
+				else
+				{
+					for (size_t i = 0; i < 4; ++i)
+					{
+						result += UTF8_Length(s[i]);
+					}
+				}
+
+				s += 4;
+			}
+
+			while (s != sEnd)
+			{
+				result += UTF8_Length(*s++);
+			}
+
+			return result;
+		}
+
+		[[nodiscard]]
+		static char8* UTF8_EncodeString_SSE4_1(char8* dst, const char32* s, const char32* const sEnd) noexcept
+		{
+			const __m128i nonAsciiBits = _mm_set1_epi32(~0x7F);
+
+			while (8 <= (sEnd - s))
+			{
+				const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+				const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 4));
+
+				if (_mm_testz_si128(_mm_or_si128(v0, v1), nonAsciiBits))
+				{
+					const __m128i v16 = _mm_packus_epi32(v0, v1);
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(v16, v16));
+					dst += 8;
+				}
+				else
+				{
+					for (size_t i = 0; i < 8; ++i)
+					{
+						UTF8_Encode(&dst, s[i]);
+					}
+				}
+
+				s += 8;
+			}
+
+			while (s != sEnd)
+			{
+				UTF8_Encode(&dst, *s++);
+			}
+
+			return dst;
+		}
+
+	# endif
+
 		//
 		// UTF-8
 		//
@@ -68,17 +603,25 @@ namespace s3d
 
 		size_t UTF8_Length(const StringView s) noexcept
 		{
-			size_t result = 0;
-
 			const char32* pSrc = s.data();
 			const char32* const pSrcEnd = pSrc + s.size();
 
+		# if SIV3D_INTRINSIC(SSE)
+
+			return UTF8_Length_SSE4_1(pSrc, pSrcEnd);
+
+		# else
+
+			size_t result = 0;
+
 			while (pSrc != pSrcEnd)
 			{
 				result += UTF8_Length(*pSrc++);
 			}
 
 			return result;
+
+		# endif
 		}
 
 		void UTF8_Encode(char8** s, const char32 codePoint) noexcept
@@ -117,6 +660,95 @@ namespace s3d
 			}
 		}
 
+		char8* UTF8_EncodeString(char8* dst, const StringView s) noexcept
+		{
+			const char32* pSrc = s.data();
+			const char32* const pSrcEnd = pSrc + s.size();
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			return UTF8_EncodeString_SSE4_1(dst, pSrc, pSrcEnd);
+
+		# else
+
+			while (pSrc != pSrcEnd)
+			{
+				UTF8_Encode(&dst, *pSrc++);
+			}
+
+			return dst;
+
+		# endif
+		}
+
+		bool UTF8_Validate(const std::string_view s, size_t& utf32Length, size_t& utf16Length) noexcept
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			// 短い文字列ではブロックの準備のほうが高くつく
+			if (s.size() < 16)
+			{
+				return UTF8_Validate_Reference(s.data(), (s.data() + s.size()), utf32Length, utf16Length);
+			}
+
+		#	if SIV3D_UNICODE_AVX2_ENABLED
+
+			if (GetCPUInfo().features.avx2)
+			{
+				return UTF8_Validate_AVX2(s.data(), s.size(), utf32Length, utf16Length);
+			}
+
+		#	endif
+
+			return UTF8_Validate_SSE4_1(s.data(), s.size(), utf32Length, utf16Length);
+
+		# else
+
+			return UTF8_Validate_Reference(s.data(), (s.data() + s.size()), utf32Length, utf16Length);
+
+		# endif
+		}
+
+		void UTF8_DecodeValid(const std::string_view s, char32* dst) noexcept
+		{
+			const char8* pSrc = s.data();
+			const char8* const pSrcEnd = pSrc + s.size();
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			UTF8_DecodeValid_SSE4_1(pSrc, pSrcEnd, dst);
+
+		# else
+
+			while (pSrc != pSrcEnd)
+			{
+				pSrc = UTF8_DecodeUnchecked(pSrc, *dst++);
+			}
+
+		# endif
+		}
+
+		void UTF8_DecodeValid(const std::string_view s, char16* dst) noexcept
+		{
+			const char8* pSrc = s.data();
+			const char8* const pSrcEnd = pSrc + s.size();
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			UTF8_DecodeValid_SSE4_1(pSrc, pSrcEnd, dst);
+
+		# else
+
+			while (pSrc != pSrcEnd)
+			{
+				char32 codePoint;
+				pSrc = UTF8_DecodeUnchecked(pSrc, codePoint);
+				UTF16_Encode(&dst, codePoint);
+			}
+
+		# endif
+		}
+
 		//
 		// UTF-16
 		//
@@ -31,6 +31,31 @@ namespace s3d
 
 		void UTF8_Encode(char8** s, char32 codePoint) noexcept;
 
+		/// @brief UTF-32 文字列をまとめて UTF-8 にエンコードします。
+		/// @param dst 出力先。`UTF8_Length(s)` バイト以上の領域が必要です。
+		/// @param s UTF-32 文字列
+		/// @return 書き込んだ末尾の次の位置
+		char8* UTF8_EncodeString(char8* dst, StringView s) noexcept;
+
+		/// @brief 文字列が正しい UTF-8 であるかを検証し、変換後の長さを求めます。
+		/// @param s UTF-8 文字列
+		/// @param utf32Length 正しい UTF-8 である場合、UTF-32 に変換したときの長さ
+		/// @param utf16Length 正しい UTF-8 である場合、UTF-16 に変換したときの長さ
+		/// @return 冗長表現、サロゲート、範囲外のコードポイント、途切れたシーケンスを含まない場合 true, それ以外の場合は false
+		/// @remark SSE4.1 / AVX2 が利用できる環境では 16 / 32 バイト単位で検証します。
+		[[nodiscard]]
+		bool UTF8_Validate(std::string_view s, size_t& utf32Length, size_t& utf16Length) noexcept;
+
+		/// @brief `UTF8_Validate()` で検証済みの UTF-8 文字列を UTF-32 にデコードします。
+		/// @param s 検証済みの UTF-8 文字列
+		/// @param dst 出力先。UTF-32 に変換したときの長さ以上の領域が必要です。
+		void UTF8_DecodeValid(std::string_view s, char32* dst) noexcept;
+
+		/// @brief `UTF8_Validate()` で検証済みの UTF-8 文字列を UTF-16 にデコードします。
+		/// @param s 検証済みの UTF-8 文字列
+		/// @param dst 出力先。UTF-16 に変換したときの長さ以上の領域が必要です。
+		void UTF8_DecodeValid(std::string_view s, char16* dst) noexcept;
+
 
 		//
 		// UTF-16
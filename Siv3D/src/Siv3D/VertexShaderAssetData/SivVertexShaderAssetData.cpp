@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/VertexShaderAssetData.hpp>
+# include <Siv3D/ProfilerZone.hpp>
 # include <Siv3D/System.hpp>
 
 namespace s3d
@@ -57,6 +58,8 @@ namespace s3d
 	{
 		if (isUninitialized())
 		{
+			const ProfilerZone profilerZone{ U"VertexShaderAsset::load" };
+
 			if (onLoad(*this, hint))
 			{
 				setState(AssetState::Loaded);
@@ -85,6 +88,8 @@ namespace s3d
 
 			m_task = Async([this, hint = hint]()
 				{
+					const ProfilerZone profilerZone{ U"VertexShaderAsset::load" };
+
 					setState(onLoad(*this, hint) ? AssetState::Loaded : AssetState::Failed);
 				});
 		}
@@ -0,0 +1,65 @@
+//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3DTest.hpp>
+# include <Siv3D/AssetHandleManager/AssetHandleManager.hpp>
+
+namespace
+{
+	using TestAssetID = AssetID<struct TestAssetTag>;
+
+	struct TestAssetData
+	{
+		int32 value = 0;
+	};
+}
+
+TEST_CASE("AssetHandleManager")
+{
+	AssetHandleManager<TestAssetID, TestAssetData> manager{ U"TestAsset" };
+	manager.setNullData(std::make_unique<TestAssetData>(TestAssetData{ -1 }));
+
+	SECTION("lookup")
+	{
+		const TestAssetID id = manager.add(std::make_unique<TestAssetData>(TestAssetData{ 1 }));
+
+		REQUIRE(manager.contains(id));
+		REQUIRE(manager[id]->value == 1);
+		REQUIRE(manager.size() == 2);
+
+		manager.erase(id);
+	}
+
+	SECTION("stale ID after slot reuse")
+	{
+		const TestAssetID oldID = manager.add(std::make_unique<TestAssetData>(TestAssetData{ 1 }));
+		manager.erase(oldID);
+
+		REQUIRE_FALSE(manager.contains(oldID));
+		REQUIRE(manager[oldID]->value == -1);
+
+		// 解放されたスロットが再利用される
+		const TestAssetID newID = manager.add(std::make_unique<TestAssetData>(TestAssetData{ 2 }));
+		using Manager = decltype(manager);
+		REQUIRE((newID.value() & Manager::IndexMask) == (oldID.value() & Manager::IndexMask));
+		REQUIRE(newID != oldID);
+
+		// 古い ID は新しいアセットのデータではなく Null アセットのデータになる
+		REQUIRE_FALSE(manager.contains(oldID));
+		REQUIRE(manager[oldID]->value == -1);
+		REQUIRE(manager[newID]->value == 2);
+
+		manager.erase(newID);
+	}
+
+	manager.destroy();
+}
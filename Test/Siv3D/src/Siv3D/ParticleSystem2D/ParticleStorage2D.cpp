@@ -0,0 +1,164 @@
+//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3DTest.hpp>
+# include <Siv3D/ParticleSystem2D/ParticleStorage2D.hpp>
+
+namespace
+{
+	[[nodiscard]]
+	Particle2D MakeParticle(const float position, const float velocity, const float rotation, const float angularVelocity, const float remainingLifeTime)
+	{
+		Particle2D particle;
+		particle.position = Float2{ position, (position * 2) };
+		particle.velocity = Float2{ velocity, -velocity };
+		particle.startColor = Float4{ 1, 1, 1, 1 };
+		particle.startSize = (remainingLifeTime * 10);
+		particle.rotation = rotation;
+		particle.startAngularVelocity = angularVelocity;
+		particle.startLifeTime = 8.0f;
+		particle.remainingLifeTime = remainingLifeTime;
+		return particle;
+	}
+
+	[[nodiscard]]
+	Array<float> SortedRemainingLifeTimes(const ParticleStorage2D& storage)
+	{
+		Array<float> result(storage.remainingLifeTime(), (storage.remainingLifeTime() + storage.size()));
+		return result.sort();
+	}
+}
+
+TEST_CASE("ParticleStorage2D")
+{
+	SECTION("update")
+	{
+		// 4 個単位の SIMD の部分と、端数のスカラーの部分の両方を確かめる
+		for (size_t count = 1; count <= 9; ++count)
+		{
+			ParticleStorage2D storage;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float k = static_cast<float>(i);
+				storage.push_back(MakeParticle(k, (10 + k), (0.25f * k), (1 + k), (1 + 0.5f * k)));
+			}
+
+			// 値はすべて 2 進数で正確に表せるため、結果は厳密に一致する
+			storage.update(0.5f, Float2{ 1.0f, -2.0f });
+
+			REQUIRE(storage.size() == count);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float k = static_cast<float>(i);
+				const Particle2D particle = storage[i];
+				const Float2 velocity{ (10 + k + 1.0f), (-(10 + k) - 2.0f) };
+
+				REQUIRE(particle.velocity.x == velocity.x);
+				REQUIRE(particle.velocity.y == velocity.y);
+				REQUIRE(particle.position.x == (k + velocity.x * 0.5f));
+				REQUIRE(particle.position.y == (k * 2 + velocity.y * 0.5f));
+				REQUIRE(particle.rotation == (0.25f * k + (1 + k) * 0.5f));
+				REQUIRE(particle.remainingLifeTime == (1 + 0.5f * k - 0.5f));
+				REQUIRE(particle.startLifeTime == 8.0f);
+			}
+		}
+	}
+
+	SECTION("update matches Particle2D::update")
+	{
+		Array<Particle2D> expected;
+		ParticleStorage2D storage;
+
+		for (size_t i = 0; i < 11; ++i)
+		{
+			const float k = static_cast<float>(i);
+			const Particle2D particle = MakeParticle((k * 1.37f), (k * -3.1f + 0.7f), (k * 0.11f), (k * 0.9f - 2.3f), (3.0f + k * 0.173f));
+			expected << particle;
+			storage.push_back(particle);
+		}
+
+		constexpr float DeltaTime = (1.0f / 60.0f);
+		const Float2 deltaVelocity{ 0.0f, (9.8f / 60.0f) };
+
+		for (int32 frame = 0; frame < 30; ++frame)
+		{
+			storage.update(DeltaTime, deltaVelocity);
+
+			for (auto& particle : expected)
+			{
+				particle.update(DeltaTime, deltaVelocity);
+			}
+		}
+
+		REQUIRE(storage.size() == expected.size());
+
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			const Particle2D particle = storage[i];
+
+			REQUIRE(particle.position.x == Approx(expected[i].position.x));
+			REQUIRE(particle.position.y == Approx(expected[i].position.y));
+			REQUIRE(particle.velocity.x == Approx(expected[i].velocity.x));
+			REQUIRE(particle.velocity.y == Approx(expected[i].velocity.y));
+			REQUIRE(particle.rotation == Approx(expected[i].rotation));
+			REQUIRE(particle.remainingLifeTime == Approx(expected[i].remainingLifeTime));
+		}
+	}
+
+	SECTION("removeDead")
+	{
+		ParticleStorage2D storage;
+
+		for (const float remainingLifeTime : { 1.0f, -1.0f, 2.0f, -0.5f, -2.0f, 3.0f, 4.0f, -3.0f, 5.0f })
+		{
+			storage.push_back(MakeParticle(0, 0, 0, 0, remainingLifeTime));
+		}
+
+		storage.removeDead();
+
+		REQUIRE(SortedRemainingLifeTimes(storage) == Array<float>{ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f });
+	}
+
+	SECTION("removeOldest with ties")
+	{
+		ParticleStorage2D storage;
+
+		for (const float remainingLifeTime : { 3.0f, 1.0f, 2.0f, 2.0f, 5.0f, 2.0f, 4.0f, 2.0f })
+		{
+			storage.push_back(MakeParticle(0, 0, 0, 0, remainingLifeTime));
+		}
+
+		// 1.0 と、4 個ある 2.0 のうち 2 個が取り除かれる
+		storage.removeOldest(3);
+
+		REQUIRE(SortedRemainingLifeTimes(storage) == Array<float>{ 2.0f, 2.0f, 3.0f, 4.0f, 5.0f });
+
+		// 他の成分も同じパーティクルのものが残る
+		for (size_t i = 0; i < storage.size(); ++i)
+		{
+			REQUIRE(storage[i].startSize == (storage[i].remainingLifeTime * 10));
+		}
+
+		// すべて等しい場合も、指定した個数だけ取り除く
+		ParticleStorage2D equal;
+
+		for (int32 i = 0; i < 7; ++i)
+		{
+			equal.push_back(MakeParticle(0, 0, 0, 0, 1.0f));
+		}
+
+		equal.removeOldest(4);
+		REQUIRE(equal.size() == 3);
+	}
+}
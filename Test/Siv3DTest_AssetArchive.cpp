@@ -0,0 +1,178 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	FilePath MakeAssetArchiveSource()
+	{
+		const FilePath directory = FileSystem::FullPath(U"test/runtime/assetarchive/source/");
+
+		FileSystem::Remove(directory);
+		FileSystem::CreateDirectories(directory + U"data/");
+		FileSystem::CreateDirectories(directory + U"text/");
+
+		JSON json;
+		json[U"value"] = 42;
+		json.save(directory + U"data/config.json");
+
+		FileSystem::Copy(U"test/image/png/3x3.png", (directory + U"image.png"));
+
+		Wave{ 4410, Arg::generator = [](double t) { return (Math::Sin(t * 440 * Math::TwoPi) * 0.5); } }.save(directory + U"sound.wav");
+
+		{
+			TextWriter writer{ directory + U"text/repeat.txt" };
+
+			for (int32 i = 0; i < 1000; ++i)
+			{
+				writer.writeln(U"The quick brown fox jumps over the lazy dog.");
+			}
+		}
+
+		{
+			const BinaryWriter writer{ directory + U"empty.bin" };
+		}
+
+		return directory;
+	}
+}
+
+TEST_CASE("AssetArchive")
+{
+	const FilePath sourceDirectory = MakeAssetArchiveSource();
+	const FilePath archivePath = FileSystem::FullPath(U"test/runtime/assetarchive/assets.s3da");
+
+	REQUIRE(AssetArchiveWriter::Pack(sourceDirectory, archivePath));
+
+	AssetArchive archive{ archivePath };
+	REQUIRE(archive.isOpen());
+	REQUIRE(archive.size() == 5);
+	REQUIRE(archive.enumPaths().size() == 5);
+
+	SECTION("lookup")
+	{
+		REQUIRE(archive.contains(U"data/config.json"));
+		REQUIRE(archive.contains(U"data\\config.json"));
+		REQUIRE(archive.contains(U"empty.bin"));
+		REQUIRE_FALSE(archive.contains(U"config.json"));
+		REQUIRE_FALSE(archive.contains(U"missing.txt"));
+		REQUIRE_FALSE(archive.getReader(U"missing.txt").isOpen());
+	}
+
+	SECTION("compression")
+	{
+		// 既に圧縮されている形式は、そのまま格納される
+		REQUIRE(archive.isCompressed(U"text/repeat.txt"));
+		REQUIRE_FALSE(archive.isCompressed(U"image.png"));
+
+		REQUIRE(archive.extractToBlob(U"text/repeat.txt") == Blob{ sourceDirectory + U"text/repeat.txt" });
+		REQUIRE(archive.extractToBlob(U"image.png") == Blob{ sourceDirectory + U"image.png" });
+		REQUIRE(archive.extractToBlob(U"empty.bin").isEmpty());
+	}
+
+	SECTION("loading")
+	{
+		const Image image{ archive.getReader(U"image.png") };
+		REQUIRE(image == Image{ sourceDirectory + U"image.png" });
+
+		const Wave wave{ archive.getReader(U"sound.wav") };
+		REQUIRE(wave.size() == 4410);
+
+		const JSON json = JSON::Load(archive.getReader(U"data/config.json"));
+		REQUIRE(json[U"value"].get<int32>() == 42);
+	}
+
+	SECTION("reader outlives archive")
+	{
+		AssetArchiveEntryReader reader = archive.getReader(U"image.png");
+		archive.close();
+		REQUIRE_FALSE(archive.isOpen());
+
+		REQUIRE(Image{ std::move(reader) } == Image{ sourceDirectory + U"image.png" });
+	}
+
+	SECTION("invalid archive")
+	{
+		const FilePath invalidPath = FileSystem::FullPath(U"test/runtime/assetarchive/invalid.s3da");
+		TextWriter{ invalidPath }.write(U"This is not an asset archive.");
+
+		REQUIRE_FALSE(AssetArchive{ invalidPath }.isOpen());
+		REQUIRE_FALSE(AssetArchive{ U"test/runtime/assetarchive/missing.s3da" }.isOpen());
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("AssetArchive : benchmark")
+{
+	const ZIPReader zip{ U"test/archive/assets.zip" };
+	REQUIRE(zip.isOpen());
+
+	// ZIP と同じエントリでアーカイブを作成する
+	const FilePath archivePath = FileSystem::FullPath(U"test/runtime/assetarchive/benchmark.s3da");
+	{
+		AssetArchiveWriter writer;
+
+		for (const auto& path : zip.enumPaths())
+		{
+			writer.add(path, zip.extractToBlob(path));
+		}
+
+		REQUIRE(writer.save(archivePath));
+	}
+
+	const AssetArchive archive{ archivePath };
+	REQUIRE(archive.size() == zip.enumPaths().size());
+
+	BENCHMARK("ZIPReader::extractToBlob() | all entries")
+	{
+		size_t size = 0;
+
+		for (const auto& path : zip.enumPaths())
+		{
+			size += zip.extractToBlob(path).size();
+		}
+
+		return size;
+	};
+
+	BENCHMARK("AssetArchive::getReader() | all entries")
+	{
+		size_t size = 0;
+
+		for (const auto& path : archive.enumPaths())
+		{
+			size += static_cast<size_t>(archive.getReader(path).size());
+		}
+
+		return size;
+	};
+
+	BENCHMARK("ZIPReader | Image")
+	{
+		return Image{ zip.extract(U"image/png/3x3.png") }.size();
+	};
+
+	BENCHMARK("AssetArchive | Image")
+	{
+		return Image{ archive.getReader(U"image/png/3x3.png") }.size();
+	};
+
+	BENCHMARK("AssetArchive | open")
+	{
+		return AssetArchive{ archivePath }.size();
+	};
+}
+
+# endif
@@ -0,0 +1,140 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// onLoad で指定したフラグが立つまでブロックするテクスチャアセットを登録する
+	void RegisterBlockingTexture(const AssetNameView name, std::atomic<bool>& released)
+	{
+		auto data = std::make_unique<TextureAssetData>();
+		data->onLoad = [&released](TextureAssetData&, const String&)
+			{
+				while (not released)
+				{
+					std::this_thread::yield();
+				}
+
+				return true;
+			};
+
+		TextureAsset::Register(name, std::move(data));
+	}
+
+	void RegisterRecordingTexture(const AssetNameAndTags& nameAndTags, std::mutex& mutex, Array<String>& order)
+	{
+		auto data = std::make_unique<TextureAssetData>(U"", TextureDesc::Unmipped, nameAndTags.tags);
+		data->onLoad = [&mutex, &order, name = nameAndTags.name](TextureAssetData&, const String&)
+			{
+				std::lock_guard lock{ mutex };
+				order << name;
+				return true;
+			};
+
+		TextureAsset::Register(nameAndTags.name, std::move(data));
+	}
+}
+
+TEST_CASE("AssetLoader")
+{
+	const size_t maxWorkers = AssetLoader::GetMaxWorkers();
+	AssetLoader::SetMaxWorkers(1);
+
+	SECTION("priority")
+	{
+		std::atomic<bool> released{ false };
+		std::mutex mutex;
+		Array<String> order;
+
+		RegisterBlockingTexture(U"AssetLoader.blocker", released);
+		RegisterRecordingTexture({ U"AssetLoader.low", {} }, mutex, order);
+		RegisterRecordingTexture({ U"AssetLoader.high", {} }, mutex, order);
+
+		TextureAsset::LoadAsync(U"AssetLoader.blocker");
+		TextureAsset::LoadAsync(U"AssetLoader.low", 0);
+		TextureAsset::LoadAsync(U"AssetLoader.high", 10);
+
+		released = true;
+		TextureAsset::Wait(U"AssetLoader.blocker");
+
+		// ワーカーが 1 つなので、優先度の高いものから順に実行される
+		while (not (TextureAsset::IsReady(U"AssetLoader.low") && TextureAsset::IsReady(U"AssetLoader.high")))
+		{
+			std::this_thread::yield();
+		}
+
+		REQUIRE(order == Array<String>{ U"AssetLoader.high", U"AssetLoader.low" });
+
+		TextureAsset::UnregisterAll();
+	}
+
+	SECTION("cancel")
+	{
+		std::atomic<bool> released{ false };
+		std::mutex mutex;
+		Array<String> order;
+
+		RegisterBlockingTexture(U"AssetLoader.blocker", released);
+		RegisterRecordingTexture({ U"AssetLoader.cancelled", {} }, mutex, order);
+
+		TextureAsset::LoadAsync(U"AssetLoader.blocker");
+		TextureAsset::LoadAsync(U"AssetLoader.cancelled");
+
+		REQUIRE(TextureAsset::CancelLoadAsync(U"AssetLoader.cancelled"));
+		REQUIRE(TextureAsset::Enumerate()[U"AssetLoader.cancelled"].state == AssetState::Uninitialized);
+
+		released = true;
+		TextureAsset::Wait(U"AssetLoader.blocker");
+		REQUIRE_FALSE(TextureAsset::CancelLoadAsync(U"AssetLoader.blocker"));
+		REQUIRE(order.isEmpty());
+
+		TextureAsset::UnregisterAll();
+	}
+
+	SECTION("progress")
+	{
+		std::mutex mutex;
+		Array<String> order;
+
+		for (int32 i = 0; i < 16; ++i)
+		{
+			RegisterRecordingTexture({ U"AssetLoader.level{}"_fmt(i), { U"level" } }, mutex, order);
+		}
+
+		REQUIRE(AssetLoader::GetProgress(U"level").total == 16);
+		REQUIRE(AssetLoader::GetProgress(U"level").ratio() == 0.0);
+
+		for (int32 i = 0; i < 16; ++i)
+		{
+			TextureAsset::LoadAsync(U"AssetLoader.level{}"_fmt(i));
+		}
+
+		for (int32 i = 0; i < 16; ++i)
+		{
+			TextureAsset::Wait(U"AssetLoader.level{}"_fmt(i));
+		}
+
+		const AssetLoadProgress progress = AssetLoader::GetProgress(U"level");
+		REQUIRE(progress.isDone());
+		REQUIRE(progress.loaded == 16);
+		REQUIRE(AssetLoader::GetProgress(U"unknown").total == 0);
+
+		const AssetLoaderStat stat = AssetLoader::GetStat();
+		REQUIRE(stat.peakWorkerCount <= maxWorkers);
+		REQUIRE(16 <= stat.completedCount);
+
+		TextureAsset::UnregisterAll();
+	}
+
+	AssetLoader::SetMaxWorkers(maxWorkers);
+}
@@ -0,0 +1,108 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Audio : compressed in memory")
+{
+	SECTION("OggVorbis")
+	{
+		const Audio audio{ Audio::Compressed, U"test/audio/sample.ogg" };
+		REQUIRE(not audio.isEmpty());
+		REQUIRE(audio.isStreaming());
+		REQUIRE(audio.sampleRate() == 44100);
+		REQUIRE(audio.samples() == 83968);
+		REQUIRE(not audio.isLoop());
+	}
+
+	SECTION("WAVE")
+	{
+		const Audio audio{ Audio::Compressed, U"test/audio/sample.wav" };
+		REQUIRE(not audio.isEmpty());
+		REQUIRE(audio.isStreaming());
+		REQUIRE(audio.sampleRate() == 44100);
+		REQUIRE(audio.samples() == 87813);
+	}
+
+	SECTION("IReader")
+	{
+		const Audio audio{ Audio::Compressed, BinaryReader{ U"test/audio/sample.ogg" } };
+		REQUIRE(not audio.isEmpty());
+		REQUIRE(audio.isStreaming());
+		REQUIRE(audio.samples() == 83968);
+	}
+
+	SECTION("Loop")
+	{
+		const Audio audio{ Audio::Compressed, U"test/audio/sample.ogg", Arg::loopBegin = 1000 };
+		REQUIRE(audio.isLoop());
+		REQUIRE(audio.getLoopTiming().beginPos == 1000);
+	}
+
+	SECTION("Fallback")
+	{
+		// AAC は圧縮したまま再生できないため、すべてデコードされる
+		const Audio audio{ Audio::Compressed, U"test/audio/sample.aac" };
+		REQUIRE(not audio.isEmpty());
+		REQUIRE(not audio.isStreaming());
+		REQUIRE(audio.samples() == 87813);
+	}
+
+	SECTION("Memory")
+	{
+		const FilePathView path = U"test/audio/sample.ogg";
+		const Wave wave{ path };
+		REQUIRE(static_cast<size_t>(FileSystem::FileSize(path)) < (wave.size() * sizeof(WaveSample)));
+	}
+
+	SECTION("Cache capacity")
+	{
+		const size_t capacity = GlobalAudio::GetCompressedCacheCapacity();
+
+		GlobalAudio::SetCompressedCacheCapacity(0);
+		REQUIRE(GlobalAudio::GetCompressedCacheCapacity() == 0);
+
+		GlobalAudio::SetCompressedCacheCapacity(capacity);
+		REQUIRE(GlobalAudio::GetCompressedCacheCapacity() == capacity);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Audio : compressed in memory benchmark")
+{
+	const FilePathView path = U"test/audio/sample.ogg";
+	const Blob blob{ path };
+	const Wave wave{ path };
+
+	// 常駐するメモリ量: 圧縮したままの場合はファイルサイズ、デコードした場合はサンプル数 × 8 バイト
+	const double encodedKiB = (blob.size() / 1024.0);
+	const double decodedKiB = ((wave.size() * sizeof(WaveSample)) / 1024.0);
+	Console << U"Audio memory | compressed: {:.1f} KiB, decoded: {:.1f} KiB ({:.1f}x)"_fmt(encodedKiB, decodedKiB, (decodedKiB / encodedKiB));
+
+	BENCHMARK("Audio{ path } | create")
+	{
+		return Audio{ path }.samples();
+	};
+
+	BENCHMARK("Audio{ Audio::Compressed, path } | create")
+	{
+		return Audio{ Audio::Compressed, path }.samples();
+	};
+
+	// キャッシュに無いボイス 1 つがクリップの長さの間にミキサースレッドで費やすデコード時間に相当する
+	BENCHMARK("decode from memory | per voice")
+	{
+		return Wave{ MemoryReader{ blob }, AudioFormat::OggVorbis }.size();
+	};
+}
+
+# endif
@@ -0,0 +1,223 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	Array<Array<String>> ReadAll(CSVReader& reader)
+	{
+		Array<Array<String>> rows;
+		CSVRowView row;
+
+		while (reader.readRow(row))
+		{
+			rows << row.toArray();
+		}
+
+		return rows;
+	}
+}
+
+TEST_CASE("CSVReader")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/csvreader/basic.csv");
+	{
+		TextWriter writer{ path };
+		writer.writeln(U"name,score,comment");
+		writer.writeln(U"Alice,100,\"Hello, world\"");
+		writer.writeln(U"ボブ,75,\"quote \\\" and \\\\ and \\n\"");
+		writer.writeln(U"");
+		writer.writeln(U"Carol,,unknown \\x escape");
+		writer.write(U"Dave,50,trailing,\r\nEve,1,");
+	}
+
+	CSVReader reader{ path };
+	REQUIRE(reader);
+
+	// CSV と同じ結果になる
+	const Array<Array<String>> rows = ReadAll(reader);
+	REQUIRE(rows == CSV{ path }.getData());
+	REQUIRE(rows.size() == 7);
+	REQUIRE(rows[1][2] == U"Hello, world");
+	REQUIRE(rows[2][0] == U"ボブ");
+	REQUIRE(rows[2][2] == U"quote \" and \\ and \n");
+	REQUIRE(rows[3].isEmpty());
+	REQUIRE(rows[4][2] == U"unknown \\x escape");
+	REQUIRE(rows[5] == Array<String>{ U"Dave", U"50", U"trailing", U"" });
+	REQUIRE(rows[6] == Array<String>{ U"Eve", U"1", U"" });
+
+	// 値はファイル上のバイト列を参照し、必要になったときに変換される
+	{
+		reader.rewind();
+		CSVRowView row;
+		REQUIRE(reader.readRow(row));
+		REQUIRE(reader.readRow(row));
+		REQUIRE(row.size() == 3);
+		REQUIRE(row[0].isPlain());
+		REQUIRE(row[0].raw() == "Alice");
+		REQUIRE(row[1].get<int32>() == 100);
+		REQUIRE(row[1].getOpt<double>() == 100.0);
+		REQUIRE_FALSE(row[0].getOpt<int32>());
+		REQUIRE_FALSE(row[2].isPlain());
+		REQUIRE(row[2].raw() == "\"Hello, world\"");
+		REQUIRE(row[2].toUTF8() == "Hello, world");
+	}
+
+	// 区切り文字は変更できる
+	{
+		const FilePath tsvPath = FileSystem::FullPath(U"test/runtime/csvreader/basic.tsv");
+		TextWriter{ tsvPath }.write(U"a\tb,c\t'd\te'\n");
+
+		CSVReader tsv{ tsvPath, U'\t', U'\'' };
+		REQUIRE(ReadAll(tsv) == Array<Array<String>>{ { U"a", U"b,c", U"d\te" } });
+		REQUIRE_FALSE(CSVReader{ tsvPath, U'、' });
+	}
+}
+
+TEST_CASE("CSVReader : parallel")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/csvreader/parallel.csv");
+	constexpr int64 N = 20'000;
+	{
+		TextWriter writer{ path };
+
+		for (int64 i = 0; i < N; ++i)
+		{
+			writer.writeln(U"{},\"row {}\",{}"_fmt(i, i, (i * 3)));
+		}
+	}
+
+	CSVReader reader{ path };
+	REQUIRE(reader);
+
+	// チャンクは行の境界で区切られ、ファイル全体を隙間なく覆う
+	for (const size_t count : { 1, 2, 7, 64 })
+	{
+		const Array<CSVChunk> chunks = reader.split(count);
+		REQUIRE(InRange<size_t>(chunks.size(), 1, count));
+
+		size_t offset = chunks.front().offset();
+		int64 rows = 0;
+
+		for (auto chunk : chunks)
+		{
+			REQUIRE(chunk.offset() == offset);
+			offset += chunk.size();
+
+			CSVRowView row;
+
+			while (chunk.readRow(row))
+			{
+				REQUIRE(row.size() == 3);
+				REQUIRE(row[1].toString() == U"row {}"_fmt(row[0].get<int64>()));
+				++rows;
+			}
+		}
+
+		REQUIRE(offset == reader.size());
+		REQUIRE(rows == N);
+	}
+
+	// チャンクごとに集計すれば、スレッド間の同期は不要
+	{
+		constexpr size_t ChunkCount = 16;
+		Array<int64> sums(ChunkCount, 0);
+		Array<int64> counts(ChunkCount, 0);
+
+		const size_t chunkCount = reader.parallelForEachRow([&](const CSVRowView& row, const size_t chunkIndex)
+		{
+			sums[chunkIndex] += row[2].get<int64>();
+			++counts[chunkIndex];
+		}, ChunkCount);
+
+		REQUIRE(InRange<size_t>(chunkCount, 1, ChunkCount));
+		REQUIRE(counts.sum() == N);
+		REQUIRE(sums.sum() == (3 * N * (N - 1) / 2));
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("CSVReader : benchmark")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/csvreader/benchmark.csv");
+	{
+		TextWriter writer{ path };
+
+		for (int32 i = 0; i < 1'000'000; ++i)
+		{
+			writer.writeln(U"{},2025-01-01T00:00:{:0>2},\"message {}, level {}\",{:.3f}"_fmt(i, (i % 60), i, (i % 5), (i * 0.001)));
+		}
+	}
+
+	const double megaBytes = (FileSystem::FileSize(path) / (1024.0 * 1024.0));
+
+	const auto measure = [&](const StringView name, auto f)
+	{
+		const Stopwatch stopwatch{ StartImmediately::Yes };
+		f();
+		Console << U"{}: {:.1f} MB/s"_fmt(name, (megaBytes / stopwatch.sF()));
+	};
+
+	measure(U"CSV::load()", [&]() { return CSV{ path }.rows(); });
+
+	measure(U"CSVReader::readRow()", [&]()
+	{
+		CSVReader reader{ path };
+		CSVRowView row;
+		size_t fields = 0;
+
+		while (reader.readRow(row))
+		{
+			fields += row.size();
+		}
+
+		return fields;
+	});
+
+	measure(U"CSVReader::parallelForEachRow()", [&]()
+	{
+		std::atomic<size_t> fields = 0;
+		CSVReader{ path }.parallelForEachRow([&](const CSVRowView& row, size_t) { fields += row.size(); });
+		return fields.load();
+	});
+
+	BENCHMARK("CSV::load()")
+	{
+		return CSV{ path }.rows();
+	};
+
+	BENCHMARK("CSVReader::readRow()")
+	{
+		CSVReader reader{ path };
+		CSVRowView row;
+		size_t rows = 0;
+
+		while (reader.readRow(row))
+		{
+			++rows;
+		}
+
+		return rows;
+	};
+
+	BENCHMARK("CSVReader::parallelForEachRow()")
+	{
+		std::atomic<size_t> rows = 0;
+		CSVReader{ path }.parallelForEachRow([&](const CSVRowView&, size_t) { ++rows; });
+		return rows.load();
+	};
+}
+
+# endif
@@ -0,0 +1,292 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Font::prewarm")
+{
+	const Font font{ FontMethod::SDF, 32, Typeface::Regular };
+	const String text = U"Siv3D prewarm 0123456789";
+	const FilePath path = FileSystem::FullPath(U"test/runtime/font/trace.json");
+
+	Profiler::EnableZoneProfiling(true);
+	System::Update();
+
+	// グリフの画像はスレッドプールで並列に生成され、完了するまで戻らない
+	REQUIRE(font.prewarm(text));
+	REQUIRE(font.prewarm(U'A', U'Z'));
+	REQUIRE(font.prewarm(U'\xD7FF', U'\xE000'));
+	REQUIRE(font.prewarm(U'Z', U'A'));
+	System::Update();
+
+	// 事前生成したグリフの描画では、グリフの読み込みも画像の生成も発生しない
+	{
+		Profiler::ClearZoneHistory();
+
+		font(text).draw();
+		font(U"ABCXYZ").draw(Vec2{ 0, 40 });
+		System::Update();
+
+		REQUIRE(Profiler::ExportChromeTrace(path));
+		const String trace = TextReader{ path }.readAll();
+		REQUIRE(trace.includes(U"\"Font::SDFGlyphCache::prerender\""));
+		REQUIRE_FALSE(trace.includes(U"\"Font::PrepareSDFGlyph\""));
+		REQUIRE_FALSE(trace.includes(U"\"Font::GenerateSDF\""));
+	}
+
+	// 未キャッシュのグリフは描画時に読み込まれ、画像はワーカースレッドで生成される
+	{
+		Profiler::ClearZoneHistory();
+
+		font(U"jkqx").draw();
+		System::Update();
+
+		REQUIRE(Profiler::ExportChromeTrace(path));
+		const String trace = TextReader{ path }.readAll();
+		REQUIRE(trace.includes(U"\"Font::PrepareSDFGlyph\""));
+		REQUIRE_FALSE(trace.includes(U"\"Font::RenderSDFGlyph\""));
+	}
+
+	// 生成の完了を待ってからは、非同期に生成したグリフがキャッシュから描画される
+	{
+		(void)font.getTexture();
+		System::Update();
+		Profiler::ClearZoneHistory();
+
+		font(U"jkqx").draw();
+		System::Update();
+
+		REQUIRE(Profiler::ExportChromeTrace(path));
+		const String trace = TextReader{ path }.readAll();
+		REQUIRE_FALSE(trace.includes(U"\"Font::PrepareSDFGlyph\""));
+		REQUIRE_FALSE(trace.includes(U"\"Font::GenerateSDF\""));
+	}
+
+	Profiler::EnableZoneProfiling(false);
+}
+
+TEST_CASE("Font::saveGlyphCache")
+{
+	const String text = U"Siv3D glyph cache 0123456789";
+	const FilePath path = FileSystem::FullPath(U"test/runtime/font/sdf32.glyphcache");
+	const FilePath tracePath = FileSystem::FullPath(U"test/runtime/font/trace_cache.json");
+
+	{
+		const Font font{ FontMethod::SDF, 32, Typeface::Regular };
+		REQUIRE(font.prewarm(text));
+		REQUIRE(font.saveGlyphCache(path));
+	}
+
+	// 同じフォントと設定であれば、キャッシュから復元したグリフをそのまま描画できる
+	{
+		const Font font{ FontMethod::SDF, 32, Typeface::Regular };
+		REQUIRE(font.loadGlyphCache(path));
+
+		Profiler::EnableZoneProfiling(true);
+		System::Update();
+		Profiler::ClearZoneHistory();
+
+		font(text).draw();
+		System::Update();
+		Profiler::EnableZoneProfiling(false);
+
+		REQUIRE(Profiler::ExportChromeTrace(tracePath));
+		const String trace = TextReader{ tracePath }.readAll();
+		REQUIRE(trace.includes(U"\"Font::SDFGlyphCache::prerender\""));
+		REQUIRE_FALSE(trace.includes(U"\"Font::PrepareSDFGlyph\""));
+	}
+
+	// キーが一致しないキャッシュは読み込まれない
+	REQUIRE_FALSE(Font{ FontMethod::SDF, 33, Typeface::Regular }.loadGlyphCache(path));
+	REQUIRE_FALSE(Font{ FontMethod::SDF, 32, Typeface::Regular, FontStyle::Bold }.loadGlyphCache(path));
+	REQUIRE_FALSE(Font{ FontMethod::MSDF, 32, Typeface::Regular }.loadGlyphCache(path));
+	REQUIRE_FALSE(Font{ FontMethod::SDF, 32, Typeface::Bold }.loadGlyphCache(path));
+
+	// ビットマップ方式のフォントは保存に対応しない
+	{
+		const Font font{ FontMethod::Bitmap, 32, Typeface::Regular };
+		REQUIRE(font.prewarm(text));
+		REQUIRE_FALSE(font.saveGlyphCache(path + U".bitmap"));
+	}
+
+	// 壊れたファイルは読み込まれない
+	{
+		const Blob blob{ path };
+		REQUIRE(blob.size() > 64);
+		REQUIRE(Blob{ blob.data(), (blob.size() - 1) }.save(path + U".broken"));
+		REQUIRE_FALSE(Font{ FontMethod::SDF, 32, Typeface::Regular }.loadGlyphCache(path + U".broken"));
+	}
+}
+
+TEST_CASE("TextLayout")
+{
+	const Font font{ FontMethod::MSDF, 32, Typeface::Regular };
+
+	const auto requireSameRegion = [](const RectF& a, const RectF& b)
+		{
+			REQUIRE(a.x == Approx(b.x));
+			REQUIRE(a.y == Approx(b.y));
+			REQUIRE(a.w == Approx(b.w));
+			REQUIRE(a.h == Approx(b.h));
+		};
+
+	SECTION("region")
+	{
+		for (const String text : { U"", U"Siv3D", U"AVA Tokyo\nline 2", U"a\tb\t\tc" })
+		{
+			const TextLayout layout{ font, text };
+			requireSameRegion(layout.region(Vec2{ 10, 20 }), font(text).region(Vec2{ 10, 20 }));
+			requireSameRegion(layout.regionAt(Vec2{ 100, 50 }), font(text).regionAt(Vec2{ 100, 50 }));
+			requireSameRegion(layout.regionBase(Vec2{ 10, 80 }), font(text).regionBase(Vec2{ 10, 80 }));
+			requireSameRegion(TextLayout{ font(text), 48 }.region(), font(text).region(48));
+		}
+	}
+
+	SECTION("setText")
+	{
+		TextLayout layout{ font, U"Score: 100" };
+		const TextLayout copy = layout;
+
+		// 最後の空白文字までのクラスタが再利用される
+		layout.setText(U"Score: 101");
+		REQUIRE(layout.reusedClusters() == 7);
+		REQUIRE(layout.clusters().map([](const GlyphCluster& c) { return c.glyphIndex; }) == font(U"Score: 101").clusters.map([](const GlyphCluster& c) { return c.glyphIndex; }));
+		requireSameRegion(layout.region(), font(U"Score: 101").region());
+
+		layout.setText(U"Score: 1000 points");
+		REQUIRE(layout.reusedClusters() == 7);
+		requireSameRegion(layout.region(), font(U"Score: 1000 points").region());
+
+		layout.setText(U"Level\n\tScore: 5");
+		REQUIRE(layout.reusedClusters() == 0);
+		requireSameRegion(layout.region(), font(U"Level\n\tScore: 5").region());
+
+		layout.setText(U"Level\n\tScore: 50");
+		REQUIRE(layout.reusedClusters() == 14);
+		requireSameRegion(layout.region(), font(U"Level\n\tScore: 50").region());
+
+		// コピー元は変更されない
+		REQUIRE(copy.text() == U"Score: 100");
+		requireSameRegion(copy.region(), font(U"Score: 100").region());
+	}
+
+	SECTION("setFontSize")
+	{
+		TextLayout layout{ font, U"Siv3D" };
+		layout.setFontSize(20);
+		REQUIRE(layout.fontSize() == 20);
+		requireSameRegion(layout.region(), font(U"Siv3D").region(20));
+	}
+
+	SECTION("draw")
+	{
+		const TextLayout layout{ font, U"Siv3D" };
+		requireSameRegion(layout.draw(Vec2{ 10, 20 }), font(U"Siv3D").draw(Vec2{ 10, 20 }));
+		requireSameRegion(layout.drawAt(Vec2{ 100, 50 }), font(U"Siv3D").drawAt(Vec2{ 100, 50 }));
+		System::Update();
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Font : glyph cache benchmark")
+{
+	// 起動時に 2,048 文字の CJK グリフを用意する場合の、コールドスタートとウォームスタートの比較
+	const FilePath path = FileSystem::FullPath(U"test/runtime/font/benchmark.glyphcache");
+
+	{
+		const Font font{ FontMethod::SDF, 48, Typeface::CJK_Regular_JP };
+		font.prewarm(U'\x4E00', U'\x55FF');
+		font.saveGlyphCache(path);
+	}
+
+	BENCHMARK("Font::prewarm() | cold | 2048 CJK glyphs")
+	{
+		const Font font{ FontMethod::SDF, 48, Typeface::CJK_Regular_JP };
+		return font.prewarm(U'\x4E00', U'\x55FF');
+	};
+
+	BENCHMARK("Font::loadGlyphCache() | warm | 2048 CJK glyphs")
+	{
+		const Font font{ FontMethod::SDF, 48, Typeface::CJK_Regular_JP };
+		return font.loadGlyphCache(path);
+	};
+}
+
+TEST_CASE("TextLayout benchmark")
+{
+	// 毎フレーム 500 個のラベルを描画する HUD を想定した、レイアウトの計算の比較
+	const Font font{ FontMethod::MSDF, 24, Typeface::Regular };
+	const Array<String> labels = Array<String>::IndexedGenerate(500, [](size_t i) { return U"Label {} : HP {} / MP {}"_fmt(i, (i * 7), (i * 3)); });
+	const Array<TextLayout> layouts = labels.map([&](const String& label) { return TextLayout{ font, label }; });
+
+	BENCHMARK("font(text).region() | 500 labels")
+	{
+		double sum = 0.0;
+
+		for (const auto& label : labels)
+		{
+			sum += font(label).region().w;
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("TextLayout::region() | 500 labels")
+	{
+		double sum = 0.0;
+
+		for (const auto& layout : layouts)
+		{
+			sum += layout.region().w;
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("font(text).draw() | 500 labels")
+	{
+		double sum = 0.0;
+
+		for (const auto& label : labels)
+		{
+			sum += font(label).draw(Vec2{ 0, 0 }).w;
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("TextLayout::draw() | 500 labels")
+	{
+		double sum = 0.0;
+
+		for (const auto& layout : layouts)
+		{
+			sum += layout.draw(Vec2{ 0, 0 }).w;
+		}
+
+		return sum;
+	};
+
+	TextLayout counter{ font, U"Score: 0" };
+	int32 score = 0;
+
+	BENCHMARK("TextLayout::setText() | counter")
+	{
+		counter.setText(U"Score: {}"_fmt(++score));
+		return counter.reusedClusters();
+	};
+
+	System::Update();
+}
+
+# endif
@@ -201,3 +201,245 @@ TEST_CASE("Image")
 		}
 	}
 }
+
+namespace
+{
+	[[nodiscard]]
+	Image MakeNoiseImage(const int32 width, const int32 height)
+	{
+		Image image{ Size{ width, height } };
+
+		for (auto& pixel : image)
+		{
+			pixel = Color{ static_cast<uint8>(Random(255)), static_cast<uint8>(Random(255)), static_cast<uint8>(Random(255)), static_cast<uint8>(Random(255)) };
+		}
+
+		return image;
+	}
+
+	// 並列化・SIMD 化する前のスカラー実装と同じ計算で、画素ごとの期待値を作る
+	template <class Fty>
+	[[nodiscard]]
+	Image MakeReference(const Image& src, Fty f)
+	{
+		Image image{ src };
+
+		for (auto& pixel : image)
+		{
+			pixel = f(pixel);
+		}
+
+		return image;
+	}
+
+	[[nodiscard]]
+	Color ReferenceSepia(Color color)
+	{
+		const double tr = Min(((0.393 * color.r) + (0.769 * color.g) + (0.189 * color.b)), 255.0);
+		const double tg = Min(((0.349 * color.r) + (0.686 * color.g) + (0.168 * color.b)), 255.0);
+		const double tb = Min(((0.272 * color.r) + (0.534 * color.g) + (0.131 * color.b)), 255.0);
+
+		color.r = static_cast<uint8>(tr);
+		color.g = static_cast<uint8>(tg);
+		color.b = static_cast<uint8>(tb);
+		return color;
+	}
+
+	[[nodiscard]]
+	Color ReferenceThreshold(Color color, const uint8 threshold, const InvertColor invertColor)
+	{
+		const bool bright = ((threshold / 255.0) < color.grayscale());
+		color.setRGB((bright != invertColor.getBool()) ? 255 : 0);
+		return color;
+	}
+
+	[[nodiscard]]
+	Color ReferenceBrighten(Color color, const int32 level)
+	{
+		color.r = static_cast<uint8>(Clamp((static_cast<int32>(color.r) + level), 0, 255));
+		color.g = static_cast<uint8>(Clamp((static_cast<int32>(color.g) + level), 0, 255));
+		color.b = static_cast<uint8>(Clamp((static_cast<int32>(color.b) + level), 0, 255));
+		return color;
+	}
+
+	[[nodiscard]]
+	Color ReferenceTable(Color color, const std::array<uint8, 256>& table)
+	{
+		color.r = table[color.r];
+		color.g = table[color.g];
+		color.b = table[color.b];
+		return color;
+	}
+
+	[[nodiscard]]
+	std::array<uint8, 256> ReferencePosterizeTable(const int32 level)
+	{
+		std::array<uint8, 256> table;
+		const int32 levN = Clamp(level, 2, 256) - 1;
+
+		for (size_t i = 0; i < 256; ++i)
+		{
+			table[i] = static_cast<uint8>(std::floor(i / 255.0 * levN + 0.5) / levN * 255);
+		}
+
+		return table;
+	}
+
+	[[nodiscard]]
+	std::array<uint8, 256> ReferenceGammaTable(const double gamma)
+	{
+		std::array<uint8, 256> table;
+		const double gammaInv = (1.0 / gamma);
+
+		for (size_t i = 0; i < 256; ++i)
+		{
+			table[i] = static_cast<uint8>(std::pow(i / 255.0, gammaInv) * 255.0);
+		}
+
+		return table;
+	}
+}
+
+TEST_CASE("Image pixel operations")
+{
+	// 並列処理が有効になる大きさと、SIMD の端数が出る幅・高さ
+	const Image src = MakeNoiseImage(1029, 517);
+
+	const auto compare = [&](const auto& op)
+	{
+		ImageProcessing::SetParallelEnabled(false);
+		const Image serial = op(src);
+
+		ImageProcessing::SetParallelEnabled(true);
+		const Image parallel = op(src);
+
+		REQUIRE(serial.size() == parallel.size());
+		REQUIRE(serial.asArray() == parallel.asArray());
+		return serial;
+	};
+
+	// 直列・並列の結果が一致し、さらにスカラー実装の結果とも一致することを確かめる
+	const auto compareWithReference = [&](const auto& op, const auto& reference)
+	{
+		const Image result = compare(op);
+		REQUIRE(result.asArray() == MakeReference(src, reference).asArray());
+	};
+
+	SECTION("negated")
+	{
+		compareWithReference([](const Image& image) { return image.negated(); },
+			[](const Color& color) { return ~color; });
+	}
+
+	SECTION("grayscaled")
+	{
+		compareWithReference([](const Image& image) { return image.grayscaled(); },
+			[](const Color& color) { const uint8 gray = color.grayscale0_255(); return Color{ gray, gray, gray, color.a }; });
+	}
+
+	SECTION("sepiaed")
+	{
+		compareWithReference([](const Image& image) { return image.sepiaed(); }, ReferenceSepia);
+	}
+
+	SECTION("posterized / gammaCorrected")
+	{
+		const auto posterizeTable = ReferencePosterizeTable(4);
+		compareWithReference([](const Image& image) { return image.posterized(4); },
+			[&](const Color& color) { return ReferenceTable(color, posterizeTable); });
+
+		const auto gammaTable = ReferenceGammaTable(2.2);
+		compareWithReference([](const Image& image) { return image.gammaCorrected(2.2); },
+			[&](const Color& color) { return ReferenceTable(color, gammaTable); });
+	}
+
+	SECTION("brightened")
+	{
+		compareWithReference([](const Image& image) { return image.brightened(-80); },
+			[](const Color& color) { return ReferenceBrighten(color, -80); });
+		compareWithReference([](const Image& image) { return image.brightened(80); },
+			[](const Color& color) { return ReferenceBrighten(color, 80); });
+	}
+
+	SECTION("thresholded")
+	{
+		compareWithReference([](const Image& image) { return image.thresholded(128); },
+			[](const Color& color) { return ReferenceThreshold(color, 128, InvertColor::No); });
+		compareWithReference([](const Image& image) { return image.thresholded(128, InvertColor::Yes); },
+			[](const Color& color) { return ReferenceThreshold(color, 128, InvertColor::Yes); });
+	}
+
+	SECTION("mirrored / flipped / rotated180")
+	{
+		const Image mirrored = compare([](const Image& image) { return image.mirrored(); });
+		REQUIRE(mirrored[3][0] == src[3][src.width() - 1]);
+
+		const Image flipped = compare([](const Image& image) { return image.flipped(); });
+		REQUIRE(flipped[0][3] == src[src.height() - 1][3]);
+
+		const Image rotated = compare([](const Image& image) { return image.rotated180(); });
+		REQUIRE(rotated[0][0] == src[src.height() - 1][src.width() - 1]);
+	}
+
+	SECTION("rotated90 / rotated270")
+	{
+		const Image rotated90 = compare([](const Image& image) { return image.rotated90(); });
+		REQUIRE(rotated90.size() == Size{ src.height(), src.width() });
+		REQUIRE(rotated90[0][src.height() - 1] == src[0][0]);
+		REQUIRE(rotated90.rotated270().asArray() == src.asArray());
+
+		const Image square = MakeNoiseImage(601, 601);
+		Image image = square;
+		image.rotate90();
+		REQUIRE(image[0][600] == square[0][0]);
+		image.rotate270();
+		REQUIRE(image.asArray() == square.asArray());
+	}
+
+	ImageProcessing::SetParallelEnabled(false);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Image pixel operations : benchmark")
+{
+	for (const auto& [size, label] : { std::pair{ Size{ 1920, 1080 }, "1080p" }, std::pair{ Size{ 3840, 2160 }, "4K" } })
+	{
+		Image image = MakeNoiseImage(size.x, size.y);
+
+		for (const bool parallel : { false, true })
+		{
+			ImageProcessing::SetParallelEnabled(parallel);
+			const std::string suffix = (std::string{ parallel ? " (parallel) | " : " (serial) | " } + label);
+
+			BENCHMARK("negate()" + suffix)
+			{
+				return image.negate().width();
+			};
+
+			BENCHMARK("grayscale()" + suffix)
+			{
+				return image.grayscale().width();
+			};
+
+			BENCHMARK("sepia()" + suffix)
+			{
+				return image.sepia().width();
+			};
+
+			BENCHMARK("mirror()" + suffix)
+			{
+				return image.mirror().width();
+			};
+
+			BENCHMARK("rotate90()" + suffix)
+			{
+				return image.rotate90().width();
+			};
+		}
+	}
+
+	ImageProcessing::SetParallelEnabled(false);
+}
+
+# endif
@@ -0,0 +1,138 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	constexpr int32 GridCells = 20;
+
+	constexpr double CellSize = 40.0;
+
+	// 格子状に正方形の障害物を並べた地形
+	[[nodiscard]]
+	NavMesh MakeGridNavMesh()
+	{
+		const double mapSize = (GridCells * CellSize);
+		Array<Array<Vec2>> holes;
+
+		for (int32 y = 0; y < GridCells; ++y)
+		{
+			for (int32 x = 0; x < GridCells; ++x)
+			{
+				holes << RectF{ (x * CellSize + 10), (y * CellSize + 10), 20 }.asPolygon().outer().reversed();
+			}
+		}
+
+		const Polygon polygon{ RectF{ mapSize }.asPolygon().outer(), holes };
+
+		return NavMesh{ polygon };
+	}
+
+	// 障害物の間の通路上の座標を返す
+	[[nodiscard]]
+	Vec2 CorridorPoint(const size_t index, const size_t salt)
+	{
+		const size_t x = ((index * 7 + salt) % GridCells);
+		const size_t y = ((index * 13 + salt * 3) % GridCells);
+		return{ (x * CellSize + 5), (y * CellSize + 5) };
+	}
+
+	void MakeAgents(const size_t count, Array<Vec2>& starts, Array<Vec2>& ends)
+	{
+		starts.clear();
+		ends.clear();
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			starts << CorridorPoint(i, 1);
+			ends << CorridorPoint(i, 11);
+		}
+	}
+}
+
+TEST_CASE("NavMesh")
+{
+	const NavMesh navMesh = MakeGridNavMesh();
+	REQUIRE(navMesh.isValid());
+
+	Array<Vec2> starts, ends;
+	MakeAgents(500, starts, ends);
+
+	Array<Array<Vec2>> expected;
+
+	for (size_t i = 0; i < starts.size(); ++i)
+	{
+		expected << navMesh.query(starts[i], ends[i]);
+	}
+
+	REQUIRE(expected.all([](const Array<Vec2>& path) { return (2 <= path.size()); }));
+
+	SECTION("queryMany")
+	{
+		REQUIRE(navMesh.queryMany(starts, ends) == expected);
+
+		// 経路の格納先を再利用する
+		Array<Array<Vec2>> paths;
+		navMesh.queryMany(starts, ends, paths);
+		navMesh.queryMany(starts, ends, paths);
+		REQUIRE(paths == expected);
+
+		navMesh.queryMany(starts, ends.take(100), paths);
+		REQUIRE(paths.size() == 100);
+		REQUIRE(paths == expected.take(100));
+
+		REQUIRE(NavMesh{}.queryMany(starts, ends).all([](const Array<Vec2>& path) { return path.isEmpty(); }));
+	}
+
+	SECTION("queryManyAsync")
+	{
+		AsyncTask<Array<Array<Vec2>>> task = navMesh.queryManyAsync(starts, ends);
+		REQUIRE(task.get() == expected);
+
+		// 前回の結果を格納先として渡す
+		task = navMesh.queryManyAsync(starts, ends, {}, navMesh.queryMany(starts, ends));
+		REQUIRE(task.get() == expected);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("NavMesh benchmark")
+{
+	const NavMesh navMesh = MakeGridNavMesh();
+
+	for (const size_t numAgents : { 1'000, 10'000 })
+	{
+		Array<Vec2> starts, ends;
+		MakeAgents(numAgents, starts, ends);
+
+		Array<Array<Vec2>> paths(numAgents);
+
+		BENCHMARK(U"NavMesh::query() | {} agents"_fmt(numAgents).toUTF8())
+		{
+			for (size_t i = 0; i < numAgents; ++i)
+			{
+				navMesh.query(starts[i], ends[i], paths[i]);
+			}
+
+			return paths.size();
+		};
+
+		BENCHMARK(U"NavMesh::queryMany() | {} agents"_fmt(numAgents).toUTF8())
+		{
+			navMesh.queryMany(starts, ends, paths);
+			return paths.size();
+		};
+	}
+}
+
+# endif
@@ -0,0 +1,212 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("P2World : spatial queries")
+{
+	P2World world{ 0.0 };
+	const P2Body a = world.createCircle(P2Static, Vec2{ 0, 0 }, 10);
+	const P2Body b = world.createRect(P2Static, Vec2{ 100, 0 }, 20);
+	const P2Body c = world.createCircle(P2Static, Vec2{ 200, 0 }, 10, {}, P2Filter{ .categoryBits = 0b10 });
+	const P2Body sensor = world.createCircleSensor(P2Static, Vec2{ 0, 100 }, 10);
+
+	SECTION("queryAABB")
+	{
+		REQUIRE(world.queryAABB(RectF{ -20, -20, 140, 40 }) == Array<P2BodyID>{ a.id(), b.id() });
+		REQUIRE(world.queryAABB(RectF{ 300, 300, 10, 10 }).isEmpty());
+	}
+
+	SECTION("raycast")
+	{
+		const auto hit = world.raycast(Vec2{ -100, 0 }, Vec2{ 300, 0 });
+		REQUIRE(hit.has_value());
+		REQUIRE(hit->id == a.id());
+		REQUIRE(hit->pos.x == Approx(-10.0).margin(0.01));
+		REQUIRE(hit->normal.x == Approx(-1.0).margin(0.01));
+		REQUIRE(hit->distance == Approx(90.0).margin(0.01));
+
+		REQUIRE(not world.raycast(Vec2{ -100, 50 }, Vec2{ 300, 50 }));
+		REQUIRE(not world.raycast(Vec2{ 0, 0 }, Vec2{ 0, 0 }));
+	}
+
+	SECTION("raycastAll")
+	{
+		const auto hits = world.raycastAll(Vec2{ -100, 0 }, Vec2{ 300, 0 });
+		REQUIRE(hits.size() == 3);
+		REQUIRE(hits[0].id == a.id());
+		REQUIRE(hits[1].id == b.id());
+		REQUIRE(hits[2].id == c.id());
+		REQUIRE(hits[1].distance == Approx(190.0).margin(0.01));
+	}
+
+	SECTION("raycastMany")
+	{
+		const Array<Line> rays = { Line{ -100, 0, 300, 0 }, Line{ 300, 0, -100, 0 }, Line{ -100, 50, 300, 50 } };
+		const auto results = world.raycastMany(rays);
+		REQUIRE(results.size() == 3);
+		REQUIRE(results[0]->id == a.id());
+		REQUIRE(results[1]->id == c.id());
+		REQUIRE(not results[2]);
+	}
+
+	SECTION("overlap")
+	{
+		REQUIRE(world.overlapCircle(Circle{ 50, 0, 45 }) == Array<P2BodyID>{ a.id(), b.id() });
+		REQUIRE(world.overlapCircle(Circle{ 50, 0, 20 }).isEmpty());
+
+		// 凹多角形
+		const Polygon polygon{ { -20, -20 }, { 120, -20 }, { 120, 20 }, { 100, 20 }, { 50, -10 }, { 0, 20 }, { -20, 20 } };
+		REQUIRE(world.overlapPolygon(polygon) == Array<P2BodyID>{ a.id(), b.id() });
+		REQUIRE(world.overlapPolygon(Polygon{ { 40, 5 }, { 60, 5 }, { 50, 15 } }).isEmpty());
+	}
+
+	SECTION("pointQuery")
+	{
+		REQUIRE(world.pointQuery(Vec2{ 105, 5 }) == Array<P2BodyID>{ b.id() });
+		REQUIRE(world.pointQuery(Vec2{ 50, 0 }).isEmpty());
+	}
+
+	SECTION("filter")
+	{
+		REQUIRE(world.queryAABB(RectF{ -20, -20, 240, 40 }, P2QueryFilter{ .maskBits = 0b10 }) == Array<P2BodyID>{ c.id() });
+		REQUIRE(world.raycast(Vec2{ -100, 0 }, Vec2{ 300, 0 }, P2QueryFilter{ .ignoreBodyID = a.id() })->id == b.id());
+
+		REQUIRE(world.pointQuery(Vec2{ 0, 100 }).isEmpty());
+		REQUIRE(world.pointQuery(Vec2{ 0, 100 }, P2QueryFilter{ .includeSensors = true }) == Array<P2BodyID>{ sensor.id() });
+	}
+}
+
+TEST_CASE("P2World : fixed timestep")
+{
+	constexpr double FixedTimeStep = (1.0 / 64.0);
+
+	const auto simulate = [](const Array<double>& frameSteps)
+	{
+		P2World world;
+		const P2Body ground = world.createRect(P2Static, Vec2{ 0, 200 }, SizeF{ 800, 20 });
+		Array<P2Body> bodies;
+
+		for (int32 i = 0; i < 10; ++i)
+		{
+			bodies << world.createCircle(P2Dynamic, Vec2{ (i * 15.0 - 70.0), (-i * 25.0) }, 10);
+		}
+
+		for (const double frameStep : frameSteps)
+		{
+			world.updateFixed((frameStep * FixedTimeStep), FixedTimeStep);
+		}
+
+		return std::make_pair(world.getStepCount(), bodies.map([](const P2Body& body) { return body.getTransform(); }));
+	};
+
+	SECTION("results depend only on the number of steps")
+	{
+		Array<double> irregular;
+
+		for (int32 i = 0; i < 30; ++i)
+		{
+			irregular.append({ 0.5, 1.5, 3.0, 0.25, 2.75 });
+		}
+
+		const auto a = simulate(Array<double>(240, 1.0));
+		const auto b = simulate(irregular);
+
+		REQUIRE(a.first == 240);
+		REQUIRE(b.first == 240);
+		REQUIRE(a.second == b.second);
+	}
+
+	SECTION("substep cap and interpolation")
+	{
+		P2World world;
+		const P2Body body = world.createCircle(P2Dynamic, Vec2{ 0, 0 }, 10);
+
+		REQUIRE(world.updateFixed((20 * FixedTimeStep), FixedTimeStep, 4) == 4);
+		REQUIRE(world.getStepStat().steps == 4);
+		REQUIRE(world.getStepStat().droppedTime == (16 * FixedTimeStep));
+		REQUIRE(world.getInterpolationAlpha() == 0.0);
+		REQUIRE(body.getInterpolatedPos().y < body.getPos().y);
+
+		REQUIRE(world.updateFixed((0.5 * FixedTimeStep), FixedTimeStep) == 0);
+		REQUIRE(world.getInterpolationAlpha() == 0.5);
+
+		REQUIRE(world.updateFixed((0.5 * FixedTimeStep), FixedTimeStep) == 1);
+		REQUIRE(world.getStepCount() == 5);
+		REQUIRE(world.getInterpolationAlpha() == 0.0);
+
+		world.update(FixedTimeStep);
+		REQUIRE(world.getInterpolationAlpha() == 1.0);
+		REQUIRE(body.getInterpolatedPos() == body.getPos());
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("P2World : spatial queries benchmark")
+{
+	P2World world{ 0.0 };
+	Array<P2Body> bodies;
+
+	for (int32 y = 0; y < 50; ++y)
+	{
+		for (int32 x = 0; x < 50; ++x)
+		{
+			bodies << world.createCircle(P2Static, Vec2{ (x * 40), (y * 40) }, 10);
+		}
+	}
+
+	SmallRNG rng{ 12345 };
+	const Array<Line> rays = Array<Line>::Generate(10000, [&]()
+	{
+		const Vec2 start = RandomVec2(RectF{ 0, 0, 2000, 2000 }, rng);
+		return Line{ start, (start + RandomVec2(500.0, rng)) };
+	});
+
+	BENCHMARK("Line::intersects() | all bodies, 1 query")
+	{
+		size_t count = 0;
+
+		for (const auto& body : bodies)
+		{
+			count += rays[0].intersects(Circle{ body.getPos(), 10 });
+		}
+
+		return count;
+	};
+
+	BENCHMARK("P2World::raycast() | 1 query")
+	{
+		return world.raycast(rays[0].begin, rays[0].end).has_value();
+	};
+
+	BENCHMARK("P2World::raycast() | 10,000 rays")
+	{
+		size_t count = 0;
+
+		for (const auto& ray : rays)
+		{
+			count += world.raycast(ray.begin, ray.end).has_value();
+		}
+
+		return count;
+	};
+
+	Array<Optional<P2RaycastHit>> results;
+
+	BENCHMARK("P2World::raycastMany() | 10,000 rays")
+	{
+		world.raycastMany(rays, results);
+		return results.size();
+	};
+}
+
+# endif
@@ -0,0 +1,125 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	ParticleSystem2D MakeParticleSystem(const double rate, const double maxParticles, const double startLifeTime)
+	{
+		ParticleSystem2DParameters parameters;
+		parameters.rate = rate;
+		parameters.maxParticles = maxParticles;
+		parameters.startLifeTime = startLifeTime;
+		parameters.startAngularVelocityDeg = 90.0;
+
+		return ParticleSystem2D{ Vec2{ 400, 300 }, Vec2{ 0, 100 }, CircleEmitter2D{}, parameters, Texture{} };
+	}
+}
+
+TEST_CASE("ParticleSystem2D")
+{
+	SECTION("Emission and death")
+	{
+		ParticleSystem2D system = MakeParticleSystem(100, 1000, 1.0);
+		REQUIRE(system.num_particles() == 0);
+
+		system.update(0.5);
+		const size_t emitted = system.num_particles();
+		REQUIRE(InRange<size_t>(emitted, 49, 50));
+
+		// 寿命が尽きたパーティクルは取り除かれる
+		ParticleSystem2DParameters parameters;
+		parameters.rate = 0.0;
+		system.setParameters(parameters);
+		system.update(1.5);
+		REQUIRE(system.num_particles() == 0);
+	}
+
+	SECTION("maxParticles")
+	{
+		ParticleSystem2D system = MakeParticleSystem(10000, 300, 10.0);
+
+		for (int32 i = 0; i < 10; ++i)
+		{
+			system.update(0.1);
+			REQUIRE(system.num_particles() <= 300);
+		}
+
+		REQUIRE(system.num_particles() == 300);
+	}
+
+	SECTION("prewarm")
+	{
+		ParticleSystem2D system = MakeParticleSystem(1000, 100000, 2.0);
+		system.prewarm();
+		REQUIRE(InRange<size_t>(system.num_particles(), 1990, 2000));
+	}
+
+	SECTION("UpdateMany")
+	{
+		Array<ParticleSystem2D> systems;
+		Array<ParticleSystem2D> expected;
+
+		for (int32 i = 0; i < 16; ++i)
+		{
+			systems << MakeParticleSystem((100 + i * 50), 1000, (0.5 + i * 0.1));
+			expected << MakeParticleSystem((100 + i * 50), 1000, (0.5 + i * 0.1));
+		}
+
+		for (int32 frame = 0; frame < 60; ++frame)
+		{
+			ParticleSystem2D::UpdateMany(systems, (1.0 / 30.0));
+
+			for (auto& system : expected)
+			{
+				system.update(1.0 / 30.0);
+			}
+		}
+
+		for (size_t i = 0; i < systems.size(); ++i)
+		{
+			REQUIRE(systems[i].num_particles() == expected[i].num_particles());
+		}
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("ParticleSystem2D benchmark")
+{
+	// 100,000 個のパーティクルを保つ
+	ParticleSystem2D system = MakeParticleSystem(20000, 100000, 5.0);
+	system.prewarm();
+
+	BENCHMARK("ParticleSystem2D::update() | 100,000 particles")
+	{
+		system.update(1.0 / 60.0);
+		return system.num_particles();
+	};
+
+	Array<ParticleSystem2D> systems;
+
+	for (int32 i = 0; i < 16; ++i)
+	{
+		systems << MakeParticleSystem(2000, 10000, 5.0);
+		systems.back().prewarm();
+	}
+
+	BENCHMARK("ParticleSystem2D::UpdateMany() | 16 systems x 10,000 particles")
+	{
+		ParticleSystem2D::UpdateMany(systems, (1.0 / 60.0));
+		return systems.front().num_particles();
+	};
+}
+
+# endif
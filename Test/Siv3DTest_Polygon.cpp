@@ -0,0 +1,148 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// 頂点列から作成する（三角形分割を伴う）多角形
+	[[nodiscard]]
+	Polygon MakeStar(const Vec2& center, const double r)
+	{
+		Array<Vec2> points;
+
+		for (int32 i = 0; i < 10; ++i)
+		{
+			points << OffsetCircular{ center, ((i % 2) ? (r * 0.5) : r), (i * 36_deg) };
+		}
+
+		return Polygon{ points };
+	}
+}
+
+TEST_CASE("Polygon : copy-on-write")
+{
+	const Polygon a{ Vec2{ 0, 0 }, Vec2{ 100, 0 }, Vec2{ 100, 100 }, Vec2{ 0, 100 } };
+	Polygon b = a;
+
+	REQUIRE(b.outer() == a.outer());
+	REQUIRE(&b.outer() == &a.outer());
+
+	b.moveBy(10, 0);
+	REQUIRE(&b.outer() != &a.outer());
+	REQUIRE(a.outer()[0] == Vec2{ 0, 0 });
+	REQUIRE(b.outer()[0] == Vec2{ 10, 0 });
+	REQUIRE(b.boundingRect() == RectF{ 10, 0, 100, 100 });
+	REQUIRE(b.num_triangles() == 2);
+	REQUIRE(b.triangle(0).boundingRect().x >= 10.0);
+
+	Polygon c = std::move(b);
+	REQUIRE(b.isEmpty());
+	REQUIRE(c.outer()[0] == Vec2{ 10, 0 });
+
+	b = a;
+	REQUIRE(b.area() == Approx(10000.0));
+}
+
+TEST_CASE("Polygon : lazy triangulation")
+{
+	const Polygon star = MakeStar(Vec2{ 0, 0 }, 100);
+	const Polygon moved = star.movedBy(200, 0);
+	const Polygon rotated = star.rotated(90_deg);
+
+	REQUIRE(star.num_triangles() == 8);
+	REQUIRE(moved.num_triangles() == 8);
+	REQUIRE(rotated.num_triangles() == 8);
+	REQUIRE(moved.area() == Approx(star.area()));
+	REQUIRE(moved.vertices()[0].x == Approx(star.vertices()[0].x + 200.0));
+	REQUIRE(moved.vertices()[0].y == Approx(star.vertices()[0].y));
+}
+
+TEST_CASE("Polygon : intersects")
+{
+	const Polygon polygon{ { Vec2{ 0, 0 }, Vec2{ 100, 0 }, Vec2{ 100, 100 }, Vec2{ 0, 100 } },
+		{ { Vec2{ 30, 30 }, Vec2{ 30, 70 }, Vec2{ 70, 70 }, Vec2{ 70, 30 } } } };
+	REQUIRE(polygon.hasHoles());
+
+	REQUIRE(polygon.contains(Vec2{ 10, 10 }));
+	REQUIRE(not polygon.contains(Vec2{ 50, 50 }));
+	REQUIRE(not polygon.contains(Vec2{ 150, 50 }));
+
+	REQUIRE(polygon.intersects(Circle{ 50, 50, 25 }));
+	REQUIRE(not polygon.intersects(Circle{ 50, 50, 10 }));
+	REQUIRE(polygon.intersects(Circle{ -50, 50, 500 }));
+	REQUIRE(not polygon.intersects(Circle{ -50, 50, 40 }));
+
+	REQUIRE(polygon.intersects(Line{ 10, 10, 20, 20 }));
+	REQUIRE(polygon.intersects(Line{ -50, 50, 50, 50 }));
+	REQUIRE(not polygon.intersects(Line{ 40, 40, 60, 60 }));
+	REQUIRE(not polygon.intersects(Line{ -50, -50, -10, 200 }));
+
+	// 三角形分割後も同じ結果になる
+	REQUIRE(polygon.num_triangles() != 0);
+	REQUIRE(not polygon.contains(Vec2{ 50, 50 }));
+	REQUIRE(polygon.intersects(Circle{ 50, 50, 25 }));
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Polygon : collision benchmark")
+{
+	SmallRNG rng{ 12345 };
+	const Array<Vec2> centers = Array<Vec2>::Generate(1000, [&]() { return RandomVec2(RectF{ 0, 0, 2000, 2000 }, rng); });
+	const Array<Circle> circles = Array<Circle>::Generate(1000, [&]() { return Circle{ RandomVec2(RectF{ 0, 0, 2000, 2000 }, rng), 20 }; });
+
+	BENCHMARK("Polygon | construct 1,000 polygons")
+	{
+		return centers.map([](const Vec2& center) { return MakeStar(center, 30); }).size();
+	};
+
+	const Polygon base = MakeStar(Vec2{ 0, 0 }, 30);
+
+	BENCHMARK("Polygon::movedBy() | 1,000 copies")
+	{
+		return centers.map([&](const Vec2& center) { return base.movedBy(center); }).size();
+	};
+
+	BENCHMARK("Polygon | construct 1,000 polygons + 1,000,000 Circle tests")
+	{
+		const Array<Polygon> polygons = centers.map([](const Vec2& center) { return MakeStar(center, 30); });
+		size_t count = 0;
+
+		for (const auto& polygon : polygons)
+		{
+			for (const auto& circle : circles)
+			{
+				count += polygon.intersects(circle);
+			}
+		}
+
+		return count;
+	};
+
+	BENCHMARK("Polygon | construct 1,000 polygons + 1,000,000 Vec2 tests")
+	{
+		const Array<Polygon> polygons = centers.map([](const Vec2& center) { return MakeStar(center, 30); });
+		size_t count = 0;
+
+		for (const auto& polygon : polygons)
+		{
+			for (const auto& circle : circles)
+			{
+				count += polygon.contains(circle.center);
+			}
+		}
+
+		return count;
+	};
+}
+
+# endif
@@ -0,0 +1,167 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	MultiPolygon MakeGrid(const int32 columns, const int32 rows)
+	{
+		Array<Polygon> polygons;
+
+		for (int32 y = 0; y < rows; ++y)
+		{
+			for (int32 x = 0; x < columns; ++x)
+			{
+				polygons << RectF{ (x * 20.0), (y * 20.0), 15, 15 }.rotated(15_deg).asPolygon();
+			}
+		}
+
+		return MultiPolygon{ polygons };
+	}
+}
+
+TEST_CASE("PolygonIndex")
+{
+	const MultiPolygon polygons = MakeGrid(40, 30);
+	const PolygonIndex index = polygons.buildIndex();
+	REQUIRE(index.size() == polygons.size());
+
+	SmallRNG rng{ 12345 };
+
+	SECTION("queryRect")
+	{
+		for (int32 i = 0; i < 100; ++i)
+		{
+			const RectF rect{ RandomVec2(RectF{ -50, -50, 900, 700 }, rng), 60, 40 };
+			const Array<size_t> expected = Range(0, (polygons.size() - 1)).filter([&](size_t k) { return polygons[k].boundingRect().intersects(rect); }).asArray();
+			REQUIRE(index.queryRect(rect) == expected);
+		}
+	}
+
+	SECTION("queryIntersects / queryContains")
+	{
+		for (int32 i = 0; i < 100; ++i)
+		{
+			const Vec2 pos = RandomVec2(RectF{ -50, -50, 900, 700 }, rng);
+			const Circle circle{ pos, 8 };
+
+			const Array<size_t> expectedCircle = Range(0, (polygons.size() - 1)).filter([&](size_t k) { return polygons[k].intersects(circle); }).asArray();
+			REQUIRE(index.queryIntersects(circle) == expectedCircle);
+
+			const Array<size_t> expectedPoint = Range(0, (polygons.size() - 1)).filter([&](size_t k) { return polygons[k].contains(pos); }).asArray();
+			REQUIRE(index.queryContains(pos) == expectedPoint);
+		}
+	}
+
+	SECTION("nearest")
+	{
+		for (int32 i = 0; i < 100; ++i)
+		{
+			const Vec2 pos = RandomVec2(RectF{ -200, -200, 1200, 1000 }, rng);
+			const auto result = index.nearest(pos);
+			REQUIRE(result.has_value());
+
+			double minDistance = Inf<double>;
+
+			for (const auto& polygon : polygons)
+			{
+				minDistance = Min(minDistance, Geometry2D::Distance(pos, polygon));
+			}
+
+			REQUIRE(Geometry2D::Distance(pos, polygons[*result]) == minDistance);
+		}
+	}
+
+	SECTION("queryAll")
+	{
+		const Array<Vec2> points = Array<Vec2>::Generate(5000, [&]() { return RandomVec2(RectF{ -50, -50, 900, 700 }, rng); });
+		const Array<Optional<size_t>> results = index.queryAll(points);
+		REQUIRE(results.size() == points.size());
+
+		for (size_t i = 0; i < points.size(); ++i)
+		{
+			const Array<size_t> expected = index.queryContains(points[i]);
+			REQUIRE(results[i] == (expected ? Optional<size_t>{ expected.front() } : none));
+		}
+	}
+
+	SECTION("empty")
+	{
+		const PolygonIndex empty{ Array<Polygon>{} };
+		REQUIRE(empty.isEmpty());
+		REQUIRE(empty.queryRect(RectF{ 0, 0, 100, 100 }).isEmpty());
+		REQUIRE(not empty.nearest(Vec2{ 0, 0 }));
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("PolygonIndex benchmark")
+{
+	const MultiPolygon polygons = MakeGrid(250, 200);
+	SmallRNG rng{ 12345 };
+	const Array<Vec2> points = Array<Vec2>::Generate(10000, [&]() { return RandomVec2(RectF{ 0, 0, 5000, 4000 }, rng); });
+
+	BENCHMARK("MultiPolygon::buildIndex() | 50,000 polygons")
+	{
+		return polygons.buildIndex().size();
+	};
+
+	const PolygonIndex index = polygons.buildIndex();
+
+	BENCHMARK("Polygon::contains() | 50,000 polygons, 100 points")
+	{
+		size_t count = 0;
+
+		for (size_t i = 0; i < 100; ++i)
+		{
+			for (const auto& polygon : polygons)
+			{
+				count += polygon.contains(points[i]);
+			}
+		}
+
+		return count;
+	};
+
+	BENCHMARK("PolygonIndex::queryContains() | 50,000 polygons, 100 points")
+	{
+		size_t count = 0;
+
+		for (size_t i = 0; i < 100; ++i)
+		{
+			count += index.queryContains(points[i]).size();
+		}
+
+		return count;
+	};
+
+	BENCHMARK("PolygonIndex::queryAll() | 50,000 polygons, 10,000 points")
+	{
+		return index.queryAll(points).size();
+	};
+
+	BENCHMARK("PolygonIndex::nearest() | 50,000 polygons, 100 points")
+	{
+		size_t sum = 0;
+
+		for (size_t i = 0; i < 100; ++i)
+		{
+			sum += index.nearest(points[i]).value_or(0);
+		}
+
+		return sum;
+	};
+}
+
+# endif
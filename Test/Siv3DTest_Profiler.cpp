@@ -0,0 +1,201 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("ProfilerZone")
+{
+	Profiler::EnableZoneProfiling(true);
+	REQUIRE(Profiler::IsZoneProfilingEnabled());
+
+	for (int32 frame = 0; frame < 4; ++frame)
+	{
+		{
+			const ProfilerZone zone{ U"Test.Outer" };
+
+			for (int32 i = 0; i < 3; ++i)
+			{
+				const ProfilerZone inner{ U"Test.Inner" };
+				System::Sleep(1);
+			}
+		}
+
+		// ワーカースレッドで記録されたゾーンも集計される
+		Threading::ParallelFor(64, [](size_t, size_t)
+		{
+			const ProfilerZone zone{ U"Test.Worker" };
+		}, 1);
+
+		System::Update();
+	}
+
+	Profiler::EnableZoneProfiling(false);
+	REQUIRE_FALSE(Profiler::IsZoneProfilingEnabled());
+
+	const Array<ProfilerZoneStat> stats = Profiler::GetZoneStats();
+
+	const auto find = [&](StringView name) -> const ProfilerZoneStat*
+	{
+		for (const auto& stat : stats)
+		{
+			if (stat.name == name)
+			{
+				return &stat;
+			}
+		}
+
+		return nullptr;
+	};
+
+	const ProfilerZoneStat* outer = find(U"Test.Outer");
+	const ProfilerZoneStat* inner = find(U"Test.Inner");
+	const ProfilerZoneStat* worker = find(U"Test.Worker");
+	REQUIRE(outer != nullptr);
+	REQUIRE(inner != nullptr);
+	REQUIRE(worker != nullptr);
+	REQUIRE(find(U"System::Update") != nullptr);
+
+	REQUIRE(outer->frameCount == 4);
+	REQUIRE(outer->callsPerFrame == 1.0);
+	REQUIRE(inner->callsPerFrame == 3.0);
+	REQUIRE(worker->callsPerFrame == 64.0);
+	REQUIRE(inner->minMillisec >= 3.0);
+	REQUIRE(outer->minMillisec >= inner->minMillisec);
+	REQUIRE(outer->minMillisec <= outer->avgMillisec);
+	REQUIRE(outer->avgMillisec <= outer->maxMillisec);
+	REQUIRE(outer->p99Millisec <= outer->maxMillisec);
+
+	// 無効の間は記録されない
+	{
+		const ProfilerZone zone{ U"Test.Disabled" };
+	}
+	System::Update();
+	for (const auto& stat : Profiler::GetZoneStats())
+	{
+		REQUIRE(stat.name != U"Test.Disabled");
+	}
+
+	const FilePath path = FileSystem::FullPath(U"test/runtime/profiler/trace.json");
+	REQUIRE(Profiler::ExportChromeTrace(path));
+
+	const JSON trace = JSON::Load(path);
+	REQUIRE(trace);
+	REQUIRE(trace[U"traceEvents"].isArray());
+	REQUIRE(TextReader{ path }.readAll().includes(U"\"Test.Outer\""));
+}
+
+TEST_CASE("Renderer2DStat")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/profiler/renderer2d.txt");
+	const bool headless = (System::GetRendererType() == EngineOption::Renderer::Headless);
+
+	REQUIRE(Profiler::CaptureRenderer2DFrame(path) == headless);
+
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Rect{ (i * 20), 0, 10, 10 }.draw();
+	}
+
+	System::Update();
+
+	const Renderer2DStat& stat = Profiler::GetRenderer2DStat();
+	REQUIRE(stat.triangleCount >= 20);
+
+	if (not headless)
+	{
+		return;
+	}
+
+	// 連続した Rect は 1 回の描画コールにまとめられる
+	REQUIRE(stat.drawCalls == 1);
+	REQUIRE(stat.triangleCount == 20);
+	REQUIRE(stat.batchCount == 1);
+	REQUIRE(stat.vertexCount == 40);
+	REQUIRE(stat.indexCount == 60);
+	REQUIRE(stat.commandCount > stat.drawCalls);
+	REQUIRE(stat.stateChanges.total() > 0);
+
+	{
+		const String capture = TextReader{ path }.readAll();
+		REQUIRE(capture.includes(U"\nDraw 60\n"));
+		REQUIRE(capture.includes(U"\nVertices 40\n"));
+		REQUIRE(capture.includes(U"\nSetPS shape\n"));
+	}
+
+	// 同じシーンは同じキャプチャになる
+	REQUIRE(Profiler::CaptureRenderer2DFrame(path + U".2"));
+
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Rect{ (i * 20), 0, 10, 10 }.draw();
+	}
+
+	System::Update();
+	REQUIRE(TextReader{ path }.readAll() == TextReader{ path + U".2" }.readAll());
+}
+
+TEST_CASE("Renderer2DStat : large batches")
+{
+	if (System::GetRendererType() != EngineOption::Renderer::Headless)
+	{
+		return;
+	}
+
+	// 1,000,000 頂点
+	{
+		const Array<RectF> rects(250'000, RectF{ 10, 10, 20, 20 });
+		Graphics2D::DrawRects(rects);
+		System::Update();
+
+		const Renderer2DStat& stat = Profiler::GetRenderer2DStat();
+		REQUIRE(stat.vertexCount == 1'000'000);
+		REQUIRE(stat.batchCount <= 4);
+	}
+
+	// 32-bit インデックスは各バッチの頂点を参照する
+	{
+		const FilePath path = FileSystem::FullPath(U"test/runtime/profiler/renderer2d_large.txt");
+		REQUIRE(Profiler::CaptureRenderer2DFrame(path));
+
+		const Array<RectF> rects(70'000, RectF{ 10, 10, 20, 20 });
+		Graphics2D::DrawRects(rects);
+		System::Update();
+
+		REQUIRE(Profiler::GetRenderer2DStat().batchCount == 2);
+
+		TextReader reader{ path };
+		String line;
+		uint32 vertexCount = 0;
+		uint32 maxIndex = 0;
+		bool inRange = true;
+
+		while (reader.readLine(line))
+		{
+			if (line.starts_with(U"Vertices "))
+			{
+				vertexCount = Parse<uint32>(line.substr(9));
+			}
+			else if (line.starts_with(U"i "))
+			{
+				for (const auto& item : line.substr(2).split(U' '))
+				{
+					const uint32 index = Parse<uint32>(item);
+					inRange &= (index < vertexCount);
+					maxIndex = Max(maxIndex, index);
+				}
+			}
+		}
+
+		REQUIRE(inRange);
+		REQUIRE(65535 < maxIndex);
+	}
+}
@@ -0,0 +1,189 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	Array<Circle> MakeCircles(const size_t count, SmallRNG& rng)
+	{
+		return Array<Circle>::Generate(count, [&]() { return Circle{ RandomVec2(RectF{ 0, 0, 1000, 1000 }, rng), Random(0.0, 30.0, rng) }; });
+	}
+
+	[[nodiscard]]
+	Array<RectF> MakeRects(const size_t count, SmallRNG& rng)
+	{
+		return Array<RectF>::Generate(count, [&]() { return RectF{ RandomVec2(RectF{ 0, 0, 1000, 1000 }, rng), Random(0.0, 60.0, rng), Random(0.0, 60.0, rng) }; });
+	}
+
+	template <class Shape, class Query>
+	[[nodiscard]]
+	bool MatchesGeometry2D(const Array<Shape>& shapes, const Query& query)
+	{
+		const Array<uint64> results = SIMDCollision::IntersectMany(shapes, query);
+
+		if (results.size() != ((shapes.size() + 63) / 64))
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < shapes.size(); ++i)
+		{
+			if (SIMDCollision::Test(results, i) != Geometry2D::Intersect(shapes[i], query))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+TEST_CASE("SIMDCollision")
+{
+	SmallRNG rng{ 12345 };
+
+	SECTION("IntersectMany")
+	{
+		for (const size_t count : { 0, 1, 3, 4, 5, 63, 64, 65, 1000 })
+		{
+			const Array<Circle> circles = MakeCircles(count, rng);
+			const Array<RectF> rects = MakeRects(count, rng);
+
+			for (int32 i = 0; i < 20; ++i)
+			{
+				const RectF rect{ RandomVec2(RectF{ 0, 0, 1000, 1000 }, rng), 200, 150 };
+				const Circle circle{ RandomVec2(RectF{ 0, 0, 1000, 1000 }, rng), 100 };
+
+				REQUIRE(MatchesGeometry2D(circles, rect));
+				REQUIRE(MatchesGeometry2D(circles, circle));
+				REQUIRE(MatchesGeometry2D(rects, rect));
+				REQUIRE(MatchesGeometry2D(rects, circle));
+			}
+		}
+	}
+
+	SECTION("IntersectMany (touching)")
+	{
+		const Array<Circle> circles = { Circle{ 0, 50, 10 }, Circle{ 110, 50, 10 }, Circle{ 111, 50, 10 }, Circle{ 100 + 6, 100 + 8, 10 } };
+		const Array<RectF> rects = { RectF{ 100, 0, 10, 10 }, RectF{ 0, 100, 10, 10 }, RectF{ -10, 0, 10, 10 } };
+		const RectF rect{ 0, 0, 100, 100 };
+
+		REQUIRE(MatchesGeometry2D(circles, rect));
+		REQUIRE(MatchesGeometry2D(rects, rect));
+		REQUIRE(SIMDCollision::IntersectMany(rects, rect).front() == 0);
+	}
+
+	SECTION("IntersectPairs")
+	{
+		const Array<Circle> circles = MakeCircles(500, rng);
+		const Array<RectF> rects = MakeRects(400, rng);
+
+		Array<std::pair<size_t, size_t>> circleRect, circleCircle, rectRect;
+
+		for (size_t i = 0; i < circles.size(); ++i)
+		{
+			for (size_t k = 0; k < rects.size(); ++k)
+			{
+				if (Geometry2D::Intersect(circles[i], rects[k]))
+				{
+					circleRect.emplace_back(i, k);
+				}
+			}
+
+			for (size_t k = (i + 1); k < circles.size(); ++k)
+			{
+				if (Geometry2D::Intersect(circles[i], circles[k]))
+				{
+					circleCircle.emplace_back(i, k);
+				}
+			}
+		}
+
+		for (size_t i = 0; i < rects.size(); ++i)
+		{
+			for (size_t k = (i + 1); k < rects.size(); ++k)
+			{
+				if (Geometry2D::Intersect(rects[i], rects[k]))
+				{
+					rectRect.emplace_back(i, k);
+				}
+			}
+		}
+
+		REQUIRE(SIMDCollision::IntersectPairs(circles, rects) == circleRect);
+		REQUIRE(SIMDCollision::IntersectPairs(circles) == circleCircle);
+		REQUIRE(SIMDCollision::IntersectPairs(rects) == rectRect);
+	}
+
+	SECTION("empty")
+	{
+		REQUIRE(SIMDCollision::IntersectMany(Array<Circle>{}, RectF{ 0, 0, 10, 10 }).isEmpty());
+		REQUIRE(SIMDCollision::IntersectPairs(Array<Circle>{}, Array<RectF>{ RectF{ 0, 0, 10, 10 } }).isEmpty());
+		REQUIRE(SIMDCollision::IntersectPairs(Array<RectF>{}).isEmpty());
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("SIMDCollision benchmark")
+{
+	SmallRNG rng{ 12345 };
+	const Array<Circle> circles = MakeCircles(100000, rng);
+	const Array<RectF> rects = MakeRects(2000, rng);
+	const RectF rect{ 400, 400, 200, 150 };
+
+	BENCHMARK("Geometry2D::Intersect(Circle, RectF) | 100,000 circles")
+	{
+		size_t count = 0;
+
+		for (const auto& circle : circles)
+		{
+			count += Geometry2D::Intersect(circle, rect);
+		}
+
+		return count;
+	};
+
+	Array<uint64> results;
+
+	BENCHMARK("SIMDCollision::IntersectMany(Circle, RectF) | 100,000 circles")
+	{
+		SIMDCollision::IntersectMany(circles, rect, results);
+		return results.size();
+	};
+
+	const Array<Circle> smallCircles = circles.take(2000);
+
+	BENCHMARK("Geometry2D::Intersect(Circle, RectF) all pairs | 2,000 circles x 2,000 rects")
+	{
+		size_t count = 0;
+
+		for (const auto& circle : smallCircles)
+		{
+			for (const auto& r : rects)
+			{
+				count += Geometry2D::Intersect(circle, r);
+			}
+		}
+
+		return count;
+	};
+
+	BENCHMARK("SIMDCollision::IntersectPairs(Circle, RectF) | 2,000 circles x 2,000 rects")
+	{
+		return SIMDCollision::IntersectPairs(smallCircles, rects).size();
+	};
+}
+
+# endif
@@ -0,0 +1,402 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	constexpr uint16 TestPort = 50123;
+
+	// 条件が満たされるまで待ちます。タイムアウトした場合は false
+	template <class Predicate>
+	[[nodiscard]]
+	bool WaitUntil(Predicate predicate, const int32 timeoutMillisec = 5000)
+	{
+		for (int32 i = 0; i < timeoutMillisec; ++i)
+		{
+			if (predicate())
+			{
+				return true;
+			}
+
+			System::Sleep(1);
+		}
+
+		return predicate();
+	}
+}
+
+TEST_CASE("TCPServer / TCPClient")
+{
+	TCPServer server;
+	server.startAcceptMulti(TestPort);
+
+	constexpr size_t NumClients = 8;
+	Array<TCPClient> clients(NumClients);
+
+	for (auto& client : clients)
+	{
+		REQUIRE(client.connect(IPv4Address::Localhost(), TestPort));
+	}
+
+	REQUIRE(WaitUntil([&]() { return (server.num_sessions() == NumClients) && clients.all([](const TCPClient& c) { return c.isConnected(); }); }));
+
+	const Array<TCPSessionID> sessionIDs = server.getSessionIDs();
+	REQUIRE(sessionIDs.size() == NumClients);
+
+	SECTION("peek / consume")
+	{
+		// 各クライアントが 0, 1, 2, ... を送る
+		constexpr uint32 NumValues = 20000;
+
+		for (uint32 i = 0; i < NumValues; ++i)
+		{
+			for (auto& client : clients)
+			{
+				REQUIRE(client.send(i));
+			}
+		}
+
+		for (const auto& id : sessionIDs)
+		{
+			REQUIRE(WaitUntil([&]() { return (server.available(id) == (NumValues * sizeof(uint32))); }));
+
+			const std::span<const Byte> data = server.peek(id);
+			REQUIRE(data.size() == (NumValues * sizeof(uint32)));
+
+			for (uint32 i = 0; i < NumValues; ++i)
+			{
+				uint32 value;
+				std::memcpy(&value, (data.data() + i * sizeof(uint32)), sizeof(uint32));
+				REQUIRE(value == i);
+			}
+
+			REQUIRE(server.consume(data.size() - sizeof(uint32), id));
+			REQUIRE(server.available(id) == sizeof(uint32));
+
+			uint32 last = 0;
+			REQUIRE(server.read(last, id));
+			REQUIRE(last == (NumValues - 1));
+			REQUIRE(server.peek(id).empty());
+			REQUIRE(server.consume(1, id) == false);
+		}
+	}
+
+	SECTION("Ring buffer wrap-around")
+	{
+		// 読み込みと受信を交互に行い、バッファの終端をまたがせる
+		TCPClient& client = clients.front();
+		const TCPSessionID id = sessionIDs.front();
+		uint64 next = 0;
+
+		for (uint64 i = 0; i < 2000; ++i)
+		{
+			for (uint64 k = 0; k < 3; ++k)
+			{
+				REQUIRE(client.send((i * 3) + k));
+			}
+
+			REQUIRE(WaitUntil([&]() { return (sizeof(uint64) * 2) <= server.available(id); }));
+
+			uint64 value = 0;
+			REQUIRE(server.lookahead(value, id));
+			REQUIRE(value == next);
+			REQUIRE(server.read(value, id));
+			REQUIRE(value == next++);
+
+			const std::span<const Byte> data = server.peek(id);
+			REQUIRE((data.size() % sizeof(uint64)) == 0);
+			std::memcpy(&value, data.data(), sizeof(uint64));
+			REQUIRE(value == next++);
+			REQUIRE(server.consume(sizeof(uint64), id));
+		}
+	}
+
+	SECTION("Server to client")
+	{
+		for (const auto& id : sessionIDs)
+		{
+			REQUIRE(server.send(id, id));
+		}
+
+		for (size_t i = 0; i < NumClients; ++i)
+		{
+			REQUIRE(WaitUntil([&]() { return (clients[i].available() == sizeof(TCPSessionID)); }));
+
+			const std::span<const Byte> data = clients[i].peek();
+			REQUIRE(data.size() == sizeof(TCPSessionID));
+
+			TCPSessionID id;
+			std::memcpy(&id, data.data(), sizeof(TCPSessionID));
+			REQUIRE(sessionIDs.contains(id));
+			REQUIRE(clients[i].consume(sizeof(TCPSessionID)));
+			REQUIRE(clients[i].available() == 0);
+		}
+	}
+
+	SECTION("Message framing")
+	{
+		// ヘッダの長さが変わる境界のサイズを含める
+		const Array<size_t> sizes = { 0, 1, 127, 128, 300, 16383, 16384, 100000, 1000000 };
+		TCPClient& client = clients.front();
+		const TCPSessionID id = sessionIDs.front();
+
+		for (const auto& size : sizes)
+		{
+			Array<Byte> message(size);
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				message[i] = static_cast<Byte>(i * 7 + size);
+			}
+
+			REQUIRE(client.sendMessage(message));
+			REQUIRE(server.sendMessage(message, id));
+		}
+
+		for (const auto& size : sizes)
+		{
+			Array<Byte> message;
+			REQUIRE(WaitUntil([&]() { return server.receiveMessage(message, id); }));
+			REQUIRE(message.size() == size);
+			REQUIRE(message.all([&, i = size_t{ 0 }](const Byte b) mutable { return (b == static_cast<Byte>(i++ * 7 + size)); }));
+
+			REQUIRE(WaitUntil([&]() { return client.receiveMessage(message); }));
+			REQUIRE(message.size() == size);
+		}
+
+		Array<Byte> message;
+		REQUIRE(server.receiveMessage(message, id) == false);
+		REQUIRE(server.available(id) == 0);
+
+		// 送信したメッセージと同じ順で受信する
+		for (uint32 i = 0; i < 10000; ++i)
+		{
+			REQUIRE(server.sendMessage(&i, sizeof(i), id));
+		}
+
+		for (uint32 i = 0; i < 10000; ++i)
+		{
+			REQUIRE(WaitUntil([&]() { return client.receiveMessage(message); }));
+			REQUIRE(message.size() == sizeof(uint32));
+
+			uint32 value;
+			std::memcpy(&value, message.data(), sizeof(uint32));
+			REQUIRE(value == i);
+		}
+	}
+
+	SECTION("Maximum message size")
+	{
+		server.setMaxMessageSize(100);
+		REQUIRE(server.maxMessageSize() == 100);
+
+		const Array<Byte> message(101);
+		const TCPSessionID id = sessionIDs.front();
+		REQUIRE(server.sendMessage(message, id) == false);
+
+		// 最大サイズを超えるメッセージを受信したセッションは切断される
+		REQUIRE(clients.front().sendMessage(message));
+		REQUIRE(WaitUntil([&]() { return (server.available(id) == (message.size() + 1)); }));
+
+		Array<Byte> received;
+		REQUIRE(server.receiveMessage(received, id) == false);
+		REQUIRE(WaitUntil([&]() { return (server.hasSession(id) == false); }));
+
+		clients.back().setMaxMessageSize(10);
+		REQUIRE(server.sendMessage(message.data(), 50, sessionIDs.back()));
+		REQUIRE(WaitUntil([&]() { return (clients.back().available() == 51); }));
+		REQUIRE(clients.back().receiveMessage(received) == false);
+		REQUIRE(clients.back().getError() == TCPError::InvalidMessage);
+	}
+
+	SECTION("Disconnect")
+	{
+		clients.front().disconnect();
+
+		REQUIRE(WaitUntil([&]() { return (server.num_sessions() == (NumClients - 1)); }));
+		REQUIRE(server.hasSession(sessionIDs.front()) == false);
+		REQUIRE(server.hasSession(sessionIDs.back()) == true);
+		REQUIRE(server.getSessionIDs() == sessionIDs.slice(1));
+	}
+
+	for (auto& client : clients)
+	{
+		client.disconnect();
+	}
+
+	server.disconnect();
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("TCPServer benchmark")
+{
+	constexpr size_t NumClients = 256;
+	constexpr size_t NumMessages = 1000;
+	constexpr size_t MessageSize = 64;
+
+	TCPServer server;
+	server.startAcceptMulti(TestPort);
+
+	Array<TCPClient> clients(NumClients);
+
+	for (auto& client : clients)
+	{
+		client.connect(IPv4Address::Localhost(), TestPort);
+	}
+
+	REQUIRE(WaitUntil([&]() { return (server.num_sessions() == NumClients) && clients.all([](const TCPClient& c) { return c.isConnected(); }); }, 20000));
+
+	const Array<TCPSessionID> sessionIDs = server.getSessionIDs();
+	const Array<Byte> message(MessageSize, Byte{ 0x5A });
+
+	// 全クライアントから 64 バイトのメッセージを送り、サーバ側で peek / consume で取り出す
+	BENCHMARK("TCPServer throughput | 256 clients x 1,000 messages x 64 bytes")
+	{
+		for (size_t i = 0; i < NumMessages; ++i)
+		{
+			for (auto& client : clients)
+			{
+				client.send(message.data(), message.size());
+			}
+		}
+
+		size_t received = 0;
+
+		while (received < (NumClients * NumMessages * MessageSize))
+		{
+			for (const auto& id : sessionIDs)
+			{
+				const std::span<const Byte> data = server.peek(id);
+				const size_t size = (data.size() - (data.size() % MessageSize));
+				server.consume(size, id);
+				received += size;
+			}
+		}
+
+		return received;
+	};
+
+	// 各クライアントとの往復の時間
+	BENCHMARK("TCPServer round trip | 256 clients")
+	{
+		for (auto& client : clients)
+		{
+			client.send(message.data(), message.size());
+		}
+
+		size_t replied = 0;
+
+		while (replied < NumClients)
+		{
+			for (const auto& id : sessionIDs)
+			{
+				if (MessageSize <= server.available(id))
+				{
+					server.skip(MessageSize, id);
+					server.send(message.data(), message.size(), id);
+				}
+			}
+
+			for (auto& client : clients)
+			{
+				if (MessageSize <= client.available())
+				{
+					client.skip(MessageSize);
+					++replied;
+				}
+			}
+		}
+
+		return replied;
+	};
+
+	for (auto& client : clients)
+	{
+		client.disconnect();
+	}
+
+	server.disconnect();
+}
+
+TEST_CASE("TCPServer message benchmark")
+{
+	constexpr size_t NumMessages = 10000;
+	constexpr size_t MessageSize = 32;
+
+	TCPServer server;
+	server.startAccept(TestPort);
+
+	TCPClient client;
+	client.connect(IPv4Address::Localhost(), TestPort);
+
+	REQUIRE(WaitUntil([&]() { return server.hasSession() && client.isConnected(); }));
+
+	const Array<Byte> message(MessageSize, Byte{ 0x5A });
+
+	// 10,000 個のメッセージを送るのに必要だったソケットへの書き込みの回数
+	{
+		const uint64 writeCountBegin = server.getWriteCount();
+
+		for (size_t i = 0; i < NumMessages; ++i)
+		{
+			REQUIRE(server.sendMessage(message));
+		}
+
+		Array<Byte> received;
+		size_t count = 0;
+
+		REQUIRE(WaitUntil([&]()
+		{
+			while (client.receiveMessage(received))
+			{
+				++count;
+			}
+
+			return (count == NumMessages);
+		}));
+
+		const uint64 writeCount = (server.getWriteCount() - writeCountBegin);
+		Console << U"TCPServer sendMessage | {} messages x {} bytes: {} writes"_fmt(NumMessages, MessageSize, writeCount);
+
+		// 送信中に追加されたメッセージは次の 1 回の書き込みにまとめられる
+		REQUIRE(writeCount < (NumMessages / 10));
+	}
+
+	// 1 フレームで小さなメッセージを大量に送る。送信はまとめて書き込まれる
+	BENCHMARK("TCPServer sendMessage / receiveMessage | 10,000 x 32 bytes")
+	{
+		for (size_t i = 0; i < NumMessages; ++i)
+		{
+			server.sendMessage(message);
+		}
+
+		Array<Byte> received;
+		size_t count = 0;
+
+		while (count < NumMessages)
+		{
+			if (client.receiveMessage(received))
+			{
+				++count;
+			}
+		}
+
+		return count;
+	};
+
+	client.disconnect();
+
+	server.disconnect();
+}
+
+# endif
@@ -1416,4 +1416,127 @@ TEST_CASE("TextReader::readAll(String&) | LONG")
 	}
 }
 
+TEST_CASE("TextReader | Buffered")
+{
+	// 読み込みバッファ (64 KiB) をまたぐ行を含むテキスト
+	std::string text;
+	Array<String> expected;
+
+	for (int32 i = 0; text.size() < (200 * 1024); ++i)
+	{
+		const String line = U"{} あいうえお 😎 {}"_fmt(i, String(i % 97, U'x'));
+		text += line.toUTF8();
+		text += ((i % 3) ? "\r\n" : "\n");
+		expected << line;
+	}
+
+	SECTION("readLines")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(text.data(), text.size()), TextEncoding::UTF8_NO_BOM };
+		REQUIRE(reader.readLines() == expected);
+		REQUIRE(reader.readLines() == Array<String>{});
+	}
+
+	SECTION("readLine")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(text.data(), text.size()), TextEncoding::UTF8_NO_BOM };
+		String line;
+
+		for (const auto& e : expected)
+		{
+			REQUIRE(reader.readLine(line) == true);
+			REQUIRE(line == e);
+		}
+
+		REQUIRE(reader.readLine(line) == false);
+	}
+
+	SECTION("readChar + readLine")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(text.data(), text.size()), TextEncoding::UTF8_NO_BOM };
+
+		for (const auto& e : expected)
+		{
+			REQUIRE(reader.readChar() == e.front());
+			REQUIRE(reader.readLine() == e.substr(1));
+		}
+
+		REQUIRE(reader.readChar() == none);
+	}
+
+	SECTION("readAll")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(text.data(), text.size()), TextEncoding::UTF8_NO_BOM };
+		REQUIRE(reader.readAll() == (expected.join(U"\n", U"", U"") + U"\n"));
+	}
+
+	SECTION("NUL")
+	{
+		const std::string s = (text.substr(0, 70000) + '\0' + "abc\r\ndef");
+		TextReader reader{ std::make_unique<MemoryReader>(s.data(), s.size()), TextEncoding::UTF8_NO_BOM };
+		String all;
+		REQUIRE(reader.readAll(all) == true);
+		REQUIRE(all == Unicode::FromUTF8(text.substr(0, 70000)).removed(U'\r'));
+		REQUIRE(reader.readLines() == Array<String>{ U"abc", U"def" });
+	}
+
+	SECTION("Invalid UTF-8")
+	{
+		const std::string s = "ab\xFF\xC0\r\ncd\xE3\x81";
+		TextReader reader{ std::make_unique<MemoryReader>(s.data(), s.size()), TextEncoding::UTF8_NO_BOM };
+		REQUIRE(reader.readLines() == Array<String>{ U"ab\uFFFD\uFFFD", U"cd\uFFFD\uFFFD" });
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("TextReader benchmark")
+{
+	std::string ascii, japanese;
+
+	while (ascii.size() < (8 << 20))
+	{
+		ascii += "The quick brown fox jumps over the lazy dog. 0123456789\r\n";
+	}
+
+	while (japanese.size() < (8 << 20))
+	{
+		japanese += "\xE5\x90\xBE\xE8\xBC\xA9\xE3\x81\xAF\xE7\x8C\xAB\xE3\x81\xA7\xE3\x81\x82\xE3\x82\x8B\xE3\x80\x82 Siv3D\n";
+	}
+
+	BENCHMARK("TextReader::readLines() | ASCII 8 MiB")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(ascii.data(), ascii.size()), TextEncoding::UTF8_NO_BOM };
+		return reader.readLines().size();
+	};
+
+	BENCHMARK("TextReader::readLines() | Japanese 8 MiB")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(japanese.data(), japanese.size()), TextEncoding::UTF8_NO_BOM };
+		return reader.readLines().size();
+	};
+
+	BENCHMARK("TextReader::readLine(String&) | ASCII 8 MiB")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(ascii.data(), ascii.size()), TextEncoding::UTF8_NO_BOM };
+		String line;
+		size_t length = 0;
+
+		while (reader.readLine(line))
+		{
+			length += line.size();
+		}
+
+		return length;
+	};
+
+	BENCHMARK("TextReader::readAll() | Japanese 8 MiB")
+	{
+		TextReader reader{ std::make_unique<MemoryReader>(japanese.data(), japanese.size()), TextEncoding::UTF8_NO_BOM };
+		return reader.readAll().size();
+	};
+}
+
+# endif
+
 SIV3D_DISABLE_MSVC_WARNINGS_POP()
@@ -24,3 +24,63 @@ TEST_CASE("non-existent Texture (#44)")
 	REQUIRE_THAT(cout, Catch::Matchers::Contains("BinaryReader: Failed to open the file `example/windmill2.png`"));
 # endif
 }
+
+TEST_CASE("Texture handle reuse")
+{
+	const Image image{ 16, 16, Palette::White };
+
+	Texture a{ image };
+	const Texture::IDType oldID = a.id();
+	REQUIRE_FALSE(a.isEmpty());
+
+	a.release();
+	REQUIRE(a.isEmpty());
+
+	// 解放されたスロットが再利用されても、世代が異なるため古い ID とは一致しない
+	const Texture b{ image };
+	REQUIRE(b.id() != oldID);
+	REQUIRE(b.size() == Size{ 16, 16 });
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Texture handle lookup")
+{
+	const Image image{ 16, 16, Palette::White };
+	const Array<Texture> textures = Array<Texture>::IndexedGenerate(64, [&](size_t) { return Texture{ image }; });
+
+	constexpr size_t LookupCount = 1'000'000;
+
+	BENCHMARK("Texture::width() | 1 thread")
+	{
+		size_t sum = 0;
+
+		for (size_t i = 0; i < LookupCount; ++i)
+		{
+			sum += textures[i % textures.size()].width();
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("Texture::width() | Threading::ParallelFor()")
+	{
+		std::atomic<size_t> sum{ 0 };
+
+		Threading::ParallelFor(LookupCount, [&](const size_t begin, const size_t end)
+		{
+			size_t localSum = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				localSum += textures[i % textures.size()].width();
+			}
+
+			sum += localSum;
+		});
+
+		return sum.load();
+	};
+}
+
+# endif
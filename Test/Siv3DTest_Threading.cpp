@@ -0,0 +1,215 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Threading::ParallelFor()")
+{
+	for (const size_t count : { 0, 1, 7, 1000, 123457 })
+	{
+		for (const size_t grainSize : { 0, 1, 64 })
+		{
+			Array<int32> v(count, 0);
+
+			Threading::ParallelFor(count, [&](const size_t first, const size_t last)
+			{
+				for (size_t i = first; i < last; ++i)
+				{
+					++v[i];
+				}
+			}, grainSize);
+
+			REQUIRE(v.all([](int32 n) { return (n == 1); }));
+		}
+	}
+}
+
+TEST_CASE("Threading::ParallelFor() : nested")
+{
+	std::atomic<size_t> total{ 0 };
+
+	Threading::ParallelFor(64, [&](const size_t first, const size_t last)
+	{
+		for (size_t i = first; i < last; ++i)
+		{
+			Threading::ParallelFor(1000, [&](const size_t first2, const size_t last2)
+			{
+				total += (last2 - first2);
+			}, 16);
+		}
+	}, 1);
+
+	REQUIRE(total == (64 * 1000));
+}
+
+TEST_CASE("Threading::ParallelFor() : exception")
+{
+	REQUIRE_THROWS_AS(Threading::ParallelFor(1000, [](const size_t, const size_t last)
+	{
+		if (last == 1000)
+		{
+			throw std::runtime_error{ "error" };
+		}
+	}, 10), std::runtime_error);
+}
+
+TEST_CASE("Threading::WaitGroup")
+{
+	Threading::WaitGroup waitGroup;
+	std::atomic<int32> count{ 0 };
+
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		Threading::Submit(waitGroup, [&]() { ++count; });
+	}
+
+	waitGroup.wait();
+
+	REQUIRE(waitGroup.isDone());
+	REQUIRE(count == 1000);
+}
+
+TEST_CASE("Threading::WaitGroup : exception")
+{
+	Threading::WaitGroup waitGroup;
+	std::atomic<int32> count{ 0 };
+
+	for (int32 i = 0; i < 100; ++i)
+	{
+		Threading::Submit(waitGroup, [&, i]()
+		{
+			if (i == 50)
+			{
+				throw std::runtime_error{ "error" };
+			}
+
+			++count;
+		});
+	}
+
+	// 例外を送出したタスクも完了として数えられ、wait() で例外が再送出される
+	REQUIRE_THROWS_AS(waitGroup.wait(), std::runtime_error);
+	REQUIRE(waitGroup.isDone());
+	REQUIRE(count == 99);
+
+	// 例外は一度だけ再送出される
+	REQUIRE_NOTHROW(waitGroup.wait());
+}
+
+TEST_CASE("Threading::WaitGroup : nested wait")
+{
+	Threading::WaitGroup waitGroup;
+	std::atomic<int32> count{ 0 };
+
+	for (int32 i = 0; i < 32; ++i)
+	{
+		Threading::Submit(waitGroup, [&]()
+		{
+			Threading::WaitGroup innerGroup;
+
+			for (int32 k = 0; k < 20; ++k)
+			{
+				Threading::Submit(innerGroup, [&]() { ++count; });
+			}
+
+			innerGroup.wait();
+		});
+	}
+
+	waitGroup.wait();
+
+	REQUIRE(count == (32 * 20));
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+namespace
+{
+	// スレッドプール導入前の Array::parallel_count_if() の実装
+	template <class Fty>
+	size_t CountIfWithAsync(const Array<double>& v, Fty f)
+	{
+		const size_t numThreads = Threading::GetConcurrency();
+
+		if (numThreads <= 1)
+		{
+			return v.count_if(f);
+		}
+
+		const size_t countPerthread = Max<size_t>(1, (v.size() + (numThreads - 1)) / numThreads);
+
+		Array<std::future<std::ptrdiff_t>> futures;
+
+		auto it = v.begin();
+		size_t countLeft = v.size();
+
+		for (size_t i = 0; i < (numThreads - 1); ++i)
+		{
+			const size_t n = Min(countPerthread, countLeft);
+
+			if (n == 0)
+			{
+				break;
+			}
+
+			futures.emplace_back(std::async(std::launch::async, [=, &f]()
+			{
+				return std::count_if(it, it + n, f);
+			}));
+
+			it += n;
+			countLeft -= n;
+		}
+
+		size_t result = std::count_if(it, it + countLeft, f);
+
+		for (auto& future : futures)
+		{
+			result += future.get();
+		}
+
+		return result;
+	}
+}
+
+TEST_CASE("Threading::ParallelFor() : benchmark")
+{
+	for (const auto& [count, label] : { std::pair{ 1'000, "1K" }, std::pair{ 10'000, "10K" }, std::pair{ 100'000, "100K" },
+		std::pair{ 1'000'000, "1M" }, std::pair{ 10'000'000, "10M" } })
+	{
+		Array<double> v(count);
+		for (size_t i = 0; i < v.size(); ++i)
+		{
+			v[i] = Random();
+		}
+
+		REQUIRE(CountIfWithAsync(v, [](double x) { return x < 0.5; })
+			== v.parallel_count_if([](double x) { return x < 0.5; }));
+
+		BENCHMARK(std::string{ "std::count_if() | " } + label)
+		{
+			return std::count_if(v.begin(), v.end(), [](double x) { return x < 0.5; });
+		};
+
+		BENCHMARK(std::string{ "std::async | " } + label)
+		{
+			return CountIfWithAsync(v, [](double x) { return x < 0.5; });
+		};
+
+		BENCHMARK(std::string{ "Threading::ParallelFor() | " } + label)
+		{
+			return v.parallel_count_if([](double x) { return x < 0.5; });
+		};
+	}
+}
+
+# endif
@@ -52,3 +52,144 @@ TEST_CASE("Unicode")
 		REQUIRE(Unicode::ToUTF32(U"あいうえお") == U"あいうえお");
 	}
 }
+
+namespace
+{
+	// SIMD でまとめて処理される長さにするための ASCII の前置き
+	const std::string AsciiPrefix(37, 'x');
+	const std::u32string AsciiPrefix32(37, U'x');
+
+	[[nodiscard]]
+	std::u32string MakeCodePoints(const size_t length, SmallRNG& rng)
+	{
+		constexpr char32 Samples[] = { U'A', U'z', U'\n', U'\r', U'\0', 0x7F, 0x80, 0x7FF, 0x800, U'あ', U'齟', 0xFFFD, 0xFFFF, 0x10000, U'😎', 0x10FFFF };
+
+		std::u32string result;
+
+		for (size_t i = 0; i < length; ++i)
+		{
+			if (RandomBool(0.5, rng))
+			{
+				result.push_back(Samples[Random<size_t>(0, (std::size(Samples) - 1), rng)]);
+			}
+			else
+			{
+				char32 ch = static_cast<char32>(Random<uint32>(0, 0x10FFFF, rng));
+
+				if (InRange<char32>(ch, 0xD800, 0xDFFF))
+				{
+					ch = U'?';
+				}
+
+				result.push_back(ch);
+			}
+		}
+
+		return result;
+	}
+
+	[[nodiscard]]
+	std::string MakeText(const std::string_view line, const size_t sizeBytes)
+	{
+		std::string result;
+		result.reserve(sizeBytes + line.size());
+
+		while (result.size() < sizeBytes)
+		{
+			result.append(line);
+		}
+
+		return result;
+	}
+}
+
+TEST_CASE("Unicode::UTF8ToUTF32")
+{
+	SECTION("Round trip")
+	{
+		SmallRNG rng{ 12345 };
+
+		for (size_t length = 0; length < 300; ++length)
+		{
+			const std::u32string s = MakeCodePoints(length, rng);
+			const std::string utf8 = Unicode::UTF32ToUTF8(s);
+			REQUIRE(Unicode::UTF8ToUTF32(utf8) == s);
+			REQUIRE(Unicode::UTF8ToUTF16(utf8) == Unicode::UTF32ToUTF16(s));
+			REQUIRE(Unicode::FromUTF8(utf8) == StringView{ s });
+			REQUIRE(Unicode::ToUTF8(StringView{ s }) == utf8);
+		}
+	}
+
+	SECTION("Block boundary")
+	{
+		// 4 バイトの文字が 16 / 32 バイトの境界をまたぐ位置を網羅する
+		for (size_t offset = 0; offset < 40; ++offset)
+		{
+			const std::string utf8 = (std::string(offset, 'a') + "\xF0\x9F\x98\x8E" + std::string(40, 'b'));
+			const std::u32string expected = (std::u32string(offset, U'a') + U"😎" + std::u32string(40, U'b'));
+			REQUIRE(Unicode::UTF8ToUTF32(utf8) == expected);
+			REQUIRE(Unicode::UTF8ToUTF16(utf8) == Unicode::UTF32ToUTF16(expected));
+		}
+	}
+
+	SECTION("Invalid")
+	{
+		// 不正なバイトは 1 バイトごとに U+FFFD になる
+		REQUIRE(Unicode::UTF8ToUTF32(AsciiPrefix + "\xC0\xAF") == (AsciiPrefix32 + U"\uFFFD\uFFFD"));
+		REQUIRE(Unicode::UTF8ToUTF32(AsciiPrefix + "a\x80z") == (AsciiPrefix32 + U"a\uFFFDz"));
+		REQUIRE(Unicode::UTF8ToUTF32(AsciiPrefix + "\xF4\x90\x80\x80") == (AsciiPrefix32 + U"\uFFFD\uFFFD\uFFFD\uFFFD"));
+		REQUIRE(Unicode::UTF8ToUTF32(AsciiPrefix + "ab\xE3\x81") == (AsciiPrefix32 + U"ab\uFFFD\uFFFD"));
+		REQUIRE(Unicode::UTF8ToUTF32(AsciiPrefix + "\xF0\x9F\x98") == (AsciiPrefix32 + U"\uFFFD\uFFFD\uFFFD"));
+		REQUIRE(Unicode::UTF8ToUTF32("\xF0\x9F\x98" + AsciiPrefix) == (U"\uFFFD\uFFFD\uFFFD" + AsciiPrefix32));
+	}
+
+	SECTION("Invalid code points")
+	{
+		const std::u32string s = (AsciiPrefix32 + char32(0x110000) + U"あ" + char32(0xFFFFFFFF));
+		REQUIRE(Unicode::UTF32ToUTF8(s) == (AsciiPrefix + "\xEF\xBF\xBD\xE3\x81\x82\xEF\xBF\xBD"));
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Unicode::UTF8ToUTF32 benchmark")
+{
+	const std::string ascii = MakeText("The quick brown fox jumps over the lazy dog. 0123456789\n", (4 << 20));
+	const std::string japanese = MakeText("\xE5\x90\xBE\xE8\xBC\xA9\xE3\x81\xAF\xE7\x8C\xAB\xE3\x81\xA7\xE3\x81\x82\xE3\x82\x8B\xE3\x80\x82\n", (4 << 20));
+	const std::string mixed = MakeText("Score: \xE7\x82\xB9\xE6\x95\xB0 42 \xF0\x9F\x98\x8E OK\n", (4 << 20));
+
+	BENCHMARK("Unicode::UTF8ToUTF32() | ASCII 4 MiB")
+	{
+		return Unicode::UTF8ToUTF32(ascii).size();
+	};
+
+	BENCHMARK("Unicode::UTF8ToUTF32() | Japanese 4 MiB")
+	{
+		return Unicode::UTF8ToUTF32(japanese).size();
+	};
+
+	BENCHMARK("Unicode::UTF8ToUTF32() | Mixed 4 MiB")
+	{
+		return Unicode::UTF8ToUTF32(mixed).size();
+	};
+
+	BENCHMARK("Unicode::UTF8ToUTF16() | Mixed 4 MiB")
+	{
+		return Unicode::UTF8ToUTF16(mixed).size();
+	};
+
+	const std::u32string asciiUTF32 = Unicode::UTF8ToUTF32(ascii);
+	const std::u32string japaneseUTF32 = Unicode::UTF8ToUTF32(japanese);
+
+	BENCHMARK("Unicode::UTF32ToUTF8() | ASCII 4 MiB")
+	{
+		return Unicode::UTF32ToUTF8(asciiUTF32).size();
+	};
+
+	BENCHMARK("Unicode::UTF32ToUTF8() | Japanese 4 MiB")
+	{
+		return Unicode::UTF32ToUTF8(japaneseUTF32).size();
+	};
+}
+
+# endif
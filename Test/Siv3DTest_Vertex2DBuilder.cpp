@@ -0,0 +1,338 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2025 Ryo Suzuki
+//	Copyright (c) 2016-2025 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	/// @brief 次のフレームの描画内容をキャプチャし、頂点座標の一覧を返します。
+	template <class Draw>
+	Array<Vec2> CaptureVertexPositions(const FilePath& path, Draw draw)
+	{
+		if (not Profiler::CaptureRenderer2DFrame(path))
+		{
+			return{};
+		}
+
+		draw();
+
+		System::Update();
+
+		Array<Vec2> positions;
+		TextReader reader{ path };
+		String line;
+
+		while (reader.readLine(line))
+		{
+			if (not line.starts_with(U"v "))
+			{
+				continue;
+			}
+
+			const Array<String> items = line.split(U' ');
+			positions.emplace_back(Parse<double>(items[1]), Parse<double>(items[2]));
+		}
+
+		return positions;
+	}
+}
+
+TEST_CASE("Vertex2DBuilder")
+{
+	if (System::GetRendererType() != EngineOption::Renderer::Headless)
+	{
+		return;
+	}
+
+	const FilePath path = FileSystem::FullPath(U"test/runtime/renderer2d/vertex2d.txt");
+
+	// 小さな円と、分割数の大きい円
+	for (const double r : { 8.0, 50.0, 400.0 })
+	{
+		const Vec2 center{ 200.5, 150.25 };
+		const Array<Vec2> positions = CaptureVertexPositions(path, [&]() { Circle{ center, r }.draw(); });
+		REQUIRE(positions.size() >= 7);
+		REQUIRE(positions.front().distanceFrom(center) < 0.01);
+
+		for (size_t i = 1; i < positions.size(); ++i)
+		{
+			REQUIRE(positions[i].distanceFrom(center) == Approx(r).epsilon(0.001));
+		}
+	}
+
+	// 円の枠
+	{
+		const Vec2 center{ 320, 240 };
+		const Array<Vec2> positions = CaptureVertexPositions(path, [&]() { Circle{ center, 100 }.drawFrame(4, 6); });
+		REQUIRE(positions.size() >= 12);
+		REQUIRE((positions.size() % 2) == 0);
+
+		for (size_t i = 0; i < positions.size(); i += 2)
+		{
+			REQUIRE(positions[i].distanceFrom(center) == Approx(106).epsilon(0.001));
+			REQUIRE(positions[i + 1].distanceFrom(center) == Approx(96).epsilon(0.001));
+		}
+	}
+
+	// 楕円
+	{
+		const Vec2 center{ 320, 240 };
+		const double a = 120, b = 30;
+		const Array<Vec2> positions = CaptureVertexPositions(path, [&]() { Ellipse{ center, a, b }.draw(); });
+		REQUIRE(positions.size() >= 7);
+		REQUIRE(positions.front().distanceFrom(center) < 0.01);
+
+		for (size_t i = 1; i < positions.size(); ++i)
+		{
+			const Vec2 p = (positions[i] - center);
+			REQUIRE(((p.x * p.x) / (a * a) + (p.y * p.y) / (b * b)) == Approx(1.0).epsilon(0.002));
+		}
+	}
+
+	// 角丸長方形の頂点は元の長方形の内側にある
+	{
+		const RectF rect{ 100, 100, 200, 80 };
+		const Array<Vec2> positions = CaptureVertexPositions(path, [&]() { rect.rounded(20).draw(); });
+		REQUIRE(positions.size() > 4);
+
+		for (const auto& position : positions)
+		{
+			REQUIRE(rect.stretched(0.01).contains(position));
+		}
+	}
+}
+
+namespace
+{
+	/// @brief 次のフレームの描画内容をキャプチャし、その文字列を返します。
+	template <class Draw>
+	String CaptureFrame(const FilePath& path, Draw draw)
+	{
+		if (not Profiler::CaptureRenderer2DFrame(path))
+		{
+			return{};
+		}
+
+		draw();
+
+		System::Update();
+
+		return TextReader{ path }.readAll();
+	}
+}
+
+TEST_CASE("Graphics2D::DrawCircles()")
+{
+	if (System::GetRendererType() != EngineOption::Renderer::Headless)
+	{
+		return;
+	}
+
+	const FilePath path = FileSystem::FullPath(U"test/runtime/renderer2d/batch.txt");
+
+	// 並列に頂点を作成する個数
+	Array<Circle> circles;
+	Array<ColorF> colors;
+
+	for (int32 i = 0; i < 1500; ++i)
+	{
+		circles.emplace_back((i % 40) * 16.0, (i / 40) * 12.0, (1.0 + (i % 3)));
+		colors.emplace_back((i % 7) / 7.0, (i % 11) / 11.0, (i % 13) / 13.0);
+	}
+
+	const String expected = CaptureFrame(path, [&]()
+	{
+		for (size_t i = 0; i < circles.size(); ++i)
+		{
+			circles[i].draw(colors[i]);
+		}
+	});
+
+	REQUIRE(expected.includes(U"\nDraw "));
+	REQUIRE(CaptureFrame(path, [&]() { Graphics2D::DrawCircles(circles, colors); }) == expected);
+
+	const String expectedUniform = CaptureFrame(path, [&]()
+	{
+		for (const auto& circle : circles)
+		{
+			circle.draw(Palette::Orange);
+		}
+	});
+
+	REQUIRE(CaptureFrame(path, [&]() { Graphics2D::DrawCircles(circles, Palette::Orange); }) == expectedUniform);
+}
+
+TEST_CASE("Graphics2D::DrawRects()")
+{
+	if (System::GetRendererType() != EngineOption::Renderer::Headless)
+	{
+		return;
+	}
+
+	const FilePath path = FileSystem::FullPath(U"test/runtime/renderer2d/batch.txt");
+
+	Array<RectF> rects;
+	Array<ColorF> colors;
+
+	for (int32 i = 0; i < 3000; ++i)
+	{
+		rects.emplace_back((i % 50) * 12.5, (i / 50) * 8.0, 10, 6.5);
+		colors.emplace_back((i % 5) / 5.0, 0.5, (i % 9) / 9.0, 0.75);
+	}
+
+	const String expected = CaptureFrame(path, [&]()
+	{
+		for (size_t i = 0; i < rects.size(); ++i)
+		{
+			rects[i].draw(colors[i]);
+		}
+	});
+
+	REQUIRE(CaptureFrame(path, [&]() { Graphics2D::DrawRects(rects, colors); }) == expected);
+
+	// 1 回のバッファに収まらない個数
+	{
+		Array<RectF> many(50'000, RectF{ 10, 20, 30, 40 });
+		CaptureFrame(path, [&]() { Graphics2D::DrawRects(many, Palette::White); });
+		REQUIRE(Profiler::GetRenderer2DStat().triangleCount == (50'000 * 2));
+		REQUIRE(Profiler::GetRenderer2DStat().vertexCount == (50'000 * 4));
+	}
+}
+
+TEST_CASE("Graphics2D::DrawTexturedQuads()")
+{
+	if (System::GetRendererType() != EngineOption::Renderer::Headless)
+	{
+		return;
+	}
+
+	const FilePath path = FileSystem::FullPath(U"test/runtime/renderer2d/batch.txt");
+	const Texture texture;
+
+	Array<Quad> quads;
+	Array<RectF> uvRects;
+
+	for (int32 i = 0; i < 2000; ++i)
+	{
+		quads.push_back(RectF{ (i % 40) * 16.0, (i / 40) * 16.0, 12 }.rotated(i * 0.1));
+		uvRects.emplace_back((i % 4) * 0.25, 0.0, 0.25, 1.0);
+	}
+
+	const String expected = CaptureFrame(path, [&]()
+	{
+		for (size_t i = 0; i < quads.size(); ++i)
+		{
+			quads[i](texture.uv(uvRects[i])).draw(ColorF{ 0.5 });
+		}
+	});
+
+	REQUIRE(CaptureFrame(path, [&]() { Graphics2D::DrawTexturedQuads(texture, quads, uvRects, ColorF{ 0.5 }); }) == expected);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Vertex2DBuilder : benchmark")
+{
+	constexpr int32 N = 10'000;
+
+	BENCHMARK("Circle::draw() | 10K")
+	{
+		for (int32 i = 0; i < N; ++i)
+		{
+			Circle{ (i % 100) * 8, (i / 100) * 6, 20 }.draw();
+		}
+
+		System::Update();
+	};
+
+	BENCHMARK("Graphics2D::DrawCircles() | 10K")
+	{
+		Array<Circle> circles(Arg::reserve = N);
+
+		for (int32 i = 0; i < N; ++i)
+		{
+			circles.emplace_back((i % 100) * 8, (i / 100) * 6, 20);
+		}
+
+		Graphics2D::DrawCircles(circles);
+
+		System::Update();
+	};
+
+	BENCHMARK("RectF::draw() | 100K")
+	{
+		for (int32 i = 0; i < 100'000; ++i)
+		{
+			RectF{ (i % 400) * 2.0, (i / 400) * 2.0, 2 }.draw();
+		}
+
+		System::Update();
+	};
+
+	BENCHMARK("Graphics2D::DrawRects() | 100K")
+	{
+		Array<RectF> rects(Arg::reserve = 100'000);
+
+		for (int32 i = 0; i < 100'000; ++i)
+		{
+			rects.emplace_back((i % 400) * 2.0, (i / 400) * 2.0, 2);
+		}
+
+		Graphics2D::DrawRects(rects);
+
+		System::Update();
+	};
+
+	BENCHMARK("Circle::drawFrame() | 10K")
+	{
+		for (int32 i = 0; i < N; ++i)
+		{
+			Circle{ (i % 100) * 8, (i / 100) * 6, 20 }.drawFrame(2);
+		}
+
+		System::Update();
+	};
+
+	BENCHMARK("Ellipse::draw() | 10K")
+	{
+		for (int32 i = 0; i < N; ++i)
+		{
+			Ellipse{ (i % 100) * 8, (i / 100) * 6, 30, 15 }.draw();
+		}
+
+		System::Update();
+	};
+
+	BENCHMARK("RoundRect::draw() | 10K")
+	{
+		for (int32 i = 0; i < N; ++i)
+		{
+			RoundRect{ (i % 100) * 8, (i / 100) * 6, 40, 30, 8 }.draw();
+		}
+
+		System::Update();
+	};
+
+	BENCHMARK("LineString::draw() | 1K")
+	{
+		const LineString lines{ Array<Vec2>::IndexedGenerate(32, [](size_t i) { return Vec2{ (i * 20.0), ((i % 2) * 30.0) }; }) };
+
+		for (int32 i = 0; i < 1'000; ++i)
+		{
+			lines.movedBy(0, i).draw(3);
+		}
+
+		System::Update();
+	};
+}
+
+# endif